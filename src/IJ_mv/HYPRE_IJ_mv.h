@@ -240,6 +240,8 @@ HYPRE_Int HYPRE_IJMatrixSetRowSizes(HYPRE_IJMatrix   matrix,
  * process, and the off-diagonal block is everything else.  The arrays
  * {\tt diag\_sizes} and {\tt offdiag\_sizes} contain estimated sizes
  * for each row of the diagonal and off-diagonal blocks, respectively.
+ * The sizes may overestimate the actual number of nonzeros (unused space
+ * is removed during assembly), but must not underestimate it.
  * This routine can significantly improve the efficiency of matrix
  * construction, and should always be utilized if possible.
  *
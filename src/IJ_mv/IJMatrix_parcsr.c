@@ -2822,10 +2822,65 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
       }
       else
       {
-         /* move diagonal element into first space */
-   
+         HYPRE_Int *indx_diag = hypre_AuxParCSRMatrixIndxDiag(aux_matrix);
+         HYPRE_Int *indx_offd = hypre_AuxParCSRMatrixIndxOffd(aux_matrix);
+
          diag_j = hypre_CSRMatrixJ(diag);
          diag_data = hypre_CSRMatrixData(diag);
+         offd_j = hypre_CSRMatrixJ(offd);
+         offd_data = hypre_CSRMatrixData(offd);
+
+         /* remove unused space if the diag/offd row sizes were upper
+            bounds rather than exact sizes */
+         if (indx_diag)
+         {
+            for (i=0; i < num_rows; i++)
+            {
+               if (indx_diag[i] < diag_i[i+1]) break;
+            }
+            if (i < num_rows)
+            {
+               i_diag = diag_i[i];
+               for ( ; i < num_rows; i++)
+               {
+                  j0 = diag_i[i];
+                  diag_i[i] = i_diag;
+                  for (j=j0; j < indx_diag[i]; j++)
+                  {
+                     diag_j[i_diag] = diag_j[j];
+                     diag_data[i_diag++] = diag_data[j];
+                  }
+               }
+               diag_i[num_rows] = i_diag;
+               hypre_CSRMatrixNumNonzeros(diag) = i_diag;
+            }
+         }
+         if (indx_offd && offd_j)
+         {
+            for (i=0; i < num_rows; i++)
+            {
+               if (indx_offd[i] < offd_i[i+1]) break;
+            }
+            if (i < num_rows)
+            {
+               i_offd = offd_i[i];
+               for ( ; i < num_rows; i++)
+               {
+                  j0 = offd_i[i];
+                  offd_i[i] = i_offd;
+                  for (j=j0; j < indx_offd[i]; j++)
+                  {
+                     offd_j[i_offd] = offd_j[j];
+                     offd_data[i_offd++] = offd_data[j];
+                  }
+               }
+               offd_i[num_rows] = i_offd;
+               hypre_CSRMatrixNumNonzeros(offd) = i_offd;
+            }
+         }
+
+         /* move diagonal element into first space */
+   
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private (i,j,j0,temp)
 #endif 
@@ -2845,8 +2900,6 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
    	       }
    	    }
          }
-   
-         offd_j = hypre_CSRMatrixJ(offd);
       }
 
       /*  generate the nonzero rows inside offd and diag by calling */
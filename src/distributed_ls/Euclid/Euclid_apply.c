@@ -75,8 +75,13 @@ void Euclid_dhApply(Euclid_dh ctx, HYPRE_Real *rhs, HYPRE_Real *lhs)
    * big switch to choose the appropriate triangular solve
    *----------------------------------------------------------------*/
 
+  /* approximate solves by Jacobi sweeps, all cases */
+  if (ctx->triSweeps) {
+    Factor_dhSolveJacobi(rhs_, lhs_, ctx); CHECK_V_ERROR;
+  }
+
   /* sequential and mpi block jacobi cases */
-  if (np_dh == 1 ||
+  else if (np_dh == 1 ||
       ! strcmp(ctx->algo_par, "bj") ) {
     Factor_dhSolveSeq(rhs_, lhs_, ctx); CHECK_V_ERROR;
   }
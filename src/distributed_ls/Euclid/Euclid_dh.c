@@ -68,6 +68,8 @@ void Euclid_dhCreate(Euclid_dh *ctxOUT)
   ctx->pivotMin = 0.0;
   ctx->pivotFix = PIVOT_FIX_DEFAULT;
   ctx->maxVal = 0.0;
+  ctx->factorSweeps = 0;
+  ctx->triSweeps = 0;
 
   ctx->slist = NULL;
   ctx->extRows = NULL;
@@ -285,6 +287,21 @@ void Euclid_dhSetup(Euclid_dh ctx)
     ctx->timing[SOLVE_SETUP_T] += (hypre_MPI_Wtime() - t1);
   }
 
+  /*-------------------------------------------------------------- 
+   * with several threads per task, build level schedules of the
+   * factors so the triangular solves run thread-parallel.
+   *--------------------------------------------------------------*/
+  if (strcmp(ctx->algo_par, "none")  &&  ! ctx->triSweeps  &&
+      hypre_NumThreads() > 1) {
+    HYPRE_Int split = 0;
+    if (! strcmp(ctx->algo_par, "pilu")  &&  np_dh > 1) {
+      split = ctx->F->first_bdry;
+    }
+    t1 = hypre_MPI_Wtime();
+    Factor_dhSolveLevelsSetup(ctx->F, split); CHECK_V_ERROR;
+    ctx->timing[SOLVE_SETUP_T] += (hypre_MPI_Wtime() - t1);
+  }
+
 END_OF_FUNCTION: ;
 
   /*-------------------------------------------------------
@@ -354,6 +371,17 @@ void get_runtime_params_private(Euclid_dh ctx)
   Parser_dhReadDouble(parser_dh, "-pivotFix", &(ctx->pivotFix));    
                                         /* how to adjust pivots */
 
+  /* approximate (fixed-point) factorization and triangular solves;
+     fixed-point factorization needs the local ILU(k) factor of a
+     single task or of block Jacobi.
+  */
+  Parser_dhReadInt(parser_dh, "-factorSweeps", &(ctx->factorSweeps));
+  Parser_dhReadInt(parser_dh, "-triSweeps", &(ctx->triSweeps));
+  if (strcmp(ctx->algo_ilu, "iluk") || Parser_dhHasSwitch(parser_dh, "-mpi") ||
+      (np_dh > 1 && strcmp(ctx->algo_par, "bj"))) {
+    ctx->factorSweeps = 0;
+  }
+
   /* set row scaling for mandatory cases */
   if (ctx->sparseTolA || ! strcmp(ctx->algo_ilu, "ilut")) {
     ctx->isScaled = true;
@@ -580,6 +608,14 @@ if (Parser_dhHasSwitch(parser_dh, "-test")) {
     }
   }
 
+  /*-------------------------------------------------------------
+   * fixed-point ILU(k): the factor holds the values of A on the
+   * ILU(k) pattern; compute L and U by sweeps over all entries.
+   *-------------------------------------------------------------*/
+  if (ctx->factorSweeps) {
+    Factor_dhFixedPointSweeps(ctx->F, ctx->factorSweeps); CHECK_V_ERROR;
+  }
+
 DO_NOTHING: ;
 
   END_FUNC_DH
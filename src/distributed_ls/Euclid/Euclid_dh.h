@@ -135,6 +135,8 @@ struct _mpi_interface_dh {
   HYPRE_Real pivotMin;    /* if pivots are <= to this value, fix 'em */
   HYPRE_Real pivotFix;    /* multiplier for adjusting small pivots */
   HYPRE_Real maxVal;      /* largest abs. value in matrix */
+  HYPRE_Int factorSweeps; /* if > 0, fixed-point sweeps compute ILU(k) values */
+  HYPRE_Int triSweeps;    /* if > 0, Jacobi sweeps replace triangular solves */
 
   /* data structures for parallel ilu (pilu) */
   SortedList_dh   slist;
@@ -65,6 +65,7 @@ void Factor_dhCreate(Factor_dh *mat)
   tmp->alloc = 0;
 
   tmp->work_y_lo = tmp->work_x_hi = NULL;
+  tmp->work_jac = NULL;
   tmp->sendbufLo = tmp->sendbufHi = NULL;
   tmp->sendindLo = tmp->sendindHi = NULL;
   tmp->num_recvLo = tmp->num_recvHi = 0;
@@ -74,6 +75,11 @@ void Factor_dhCreate(Factor_dh *mat)
   tmp->solveIsSetup = false;
   tmp->numbSolve = NULL;
 
+  tmp->numLevelsL = tmp->splitLevelL = 0;
+  tmp->numLevelsU = tmp->splitLevelU = 0;
+  tmp->levelPtrL = tmp->levelRowsL = NULL;
+  tmp->levelPtrU = tmp->levelRowsU = NULL;
+
   tmp->debug = Parser_dhHasSwitch(parser_dh, "-debug_Factor");
   
   /* initialize MPI request to null */
@@ -104,12 +110,18 @@ void Factor_dhDestroy(Factor_dh mat)
 
   if (mat->work_y_lo != NULL) { FREE_DH(mat->work_y_lo); CHECK_V_ERROR; }
   if (mat->work_x_hi != NULL) { FREE_DH(mat->work_x_hi); CHECK_V_ERROR; }
+  if (mat->work_jac != NULL) { FREE_DH(mat->work_jac); CHECK_V_ERROR; }
   if (mat->sendbufLo != NULL) { FREE_DH(mat->sendbufLo); CHECK_V_ERROR; }
   if (mat->sendbufHi != NULL) { FREE_DH(mat->sendbufHi); CHECK_V_ERROR; }
   if (mat->sendindLo != NULL) { FREE_DH(mat->sendindLo); CHECK_V_ERROR; }
   if (mat->sendindHi != NULL) { FREE_DH(mat->sendindHi); CHECK_V_ERROR; }
 
   if (mat->numbSolve != NULL) { Numbering_dhDestroy(mat->numbSolve); CHECK_V_ERROR; }
+
+  if (mat->levelPtrL != NULL) { FREE_DH(mat->levelPtrL); CHECK_V_ERROR; }
+  if (mat->levelRowsL != NULL) { FREE_DH(mat->levelRowsL); CHECK_V_ERROR; }
+  if (mat->levelPtrU != NULL) { FREE_DH(mat->levelPtrU); CHECK_V_ERROR; }
+  if (mat->levelRowsU != NULL) { FREE_DH(mat->levelRowsU); CHECK_V_ERROR; }
   
   /* cleanup MPI requests */
   for(i=0; i<MAX_MPI_TASKS; i++)
@@ -579,6 +591,7 @@ void Factor_dhSolveSetup(Factor_dh mat, SubdomainGraph_dh sg)
   FREE_DH(outlist); CHECK_V_ERROR;
   FREE_DH(inlist); CHECK_V_ERROR;
   FREE_DH(end_rows); CHECK_V_ERROR;
+  mat->solveIsSetup = true;
 
   if (debug) {
     HYPRE_Int ii, jj;
@@ -597,6 +610,170 @@ void Factor_dhSolveSetup(Factor_dh mat, SubdomainGraph_dh sg)
   END_FUNC_DH
 }
 
+static void bucket_levels_private(HYPRE_Int m, HYPRE_Int *level, HYPRE_Int num_levels,
+                                  HYPRE_Int **level_ptr, HYPRE_Int **level_rows);
+
+/* Level scheduling: the level of a row is one more than the largest
+   level of the rows it depends on, so all rows of one level can be
+   solved concurrently once the previous levels are done.  Only
+   dependencies inside the row's own range, [0,split) or [split,m),
+   are followed; the other range and the external (recv buffer)
+   columns are complete before the range is solved.
+*/
+#undef __FUNC__
+#define __FUNC__ "Factor_dhSolveLevelsSetup"
+void Factor_dhSolveLevelsSetup(Factor_dh mat, HYPRE_Int split)
+{
+  START_FUNC_DH
+  HYPRE_Int m = mat->m, *rp = mat->rp, *cval = mat->cval, *diag = mat->diag;
+  HYPRE_Int i, j, col, lev, beg, end;
+  HYPRE_Int numLo, numHi, *level;
+
+  if (mat->levelPtrL != NULL) { FREE_DH(mat->levelPtrL); CHECK_V_ERROR; }
+  if (mat->levelRowsL != NULL) { FREE_DH(mat->levelRowsL); CHECK_V_ERROR; }
+  if (mat->levelPtrU != NULL) { FREE_DH(mat->levelPtrU); CHECK_V_ERROR; }
+  if (mat->levelRowsU != NULL) { FREE_DH(mat->levelRowsU); CHECK_V_ERROR; }
+  mat->levelPtrL = mat->levelRowsL = NULL;
+  mat->levelPtrU = mat->levelRowsU = NULL;
+  mat->numLevelsL = mat->splitLevelL = 0;
+  mat->numLevelsU = mat->splitLevelU = 0;
+
+  if (m == 0) goto END_OF_FUNCTION;
+
+  level = (HYPRE_Int*)MALLOC_DH(m*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+
+  /* L: rows [0,split) are solved first, then rows [split,m) */
+  numLo = numHi = 0;
+  for (i=0; i<m; ++i) {
+    beg = (i < split) ? 0 : split;
+    lev = 0;
+    for (j=rp[i]; j<diag[i]; ++j) {
+      col = cval[j];
+      if (col >= beg && col < i && level[col] >= lev) lev = level[col]+1;
+    }
+    level[i] = lev;
+    if (i < split) numLo = MAX(numLo, lev+1);
+    else           numHi = MAX(numHi, lev+1);
+  }
+  for (i=split; i<m; ++i) level[i] += numLo;
+  mat->numLevelsL = numLo + numHi;
+  mat->splitLevelL = numLo;
+  bucket_levels_private(m, level, mat->numLevelsL,
+                        &mat->levelPtrL, &mat->levelRowsL); CHECK_V_ERROR;
+
+  /* U: rows [split,m) are solved first, then rows [0,split) */
+  numLo = numHi = 0;
+  for (i=m-1; i>=0; --i) {
+    end = (i < split) ? split : m;
+    lev = 0;
+    for (j=diag[i]+1; j<rp[i+1]; ++j) {
+      col = cval[j];
+      if (col > i && col < end && level[col] >= lev) lev = level[col]+1;
+    }
+    level[i] = lev;
+    if (i < split) numLo = MAX(numLo, lev+1);
+    else           numHi = MAX(numHi, lev+1);
+  }
+  for (i=0; i<split; ++i) level[i] += numHi;
+  mat->numLevelsU = numLo + numHi;
+  mat->splitLevelU = numHi;
+  bucket_levels_private(m, level, mat->numLevelsU,
+                        &mat->levelPtrU, &mat->levelRowsU); CHECK_V_ERROR;
+
+  FREE_DH(level); CHECK_V_ERROR;
+
+END_OF_FUNCTION: ;
+
+  END_FUNC_DH
+}
+
+#undef __FUNC__
+#define __FUNC__ "bucket_levels_private"
+void bucket_levels_private(HYPRE_Int m, HYPRE_Int *level, HYPRE_Int num_levels,
+                           HYPRE_Int **level_ptr, HYPRE_Int **level_rows)
+{
+  START_FUNC_DH
+  HYPRE_Int i, *ptr, *rows;
+
+  ptr = *level_ptr = (HYPRE_Int*)MALLOC_DH((num_levels+1)*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+  rows = *level_rows = (HYPRE_Int*)MALLOC_DH(m*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+
+  /* counting sort; rows within a level stay in increasing order */
+  for (i=0; i<=num_levels; ++i) ptr[i] = 0;
+  for (i=0; i<m; ++i) ptr[level[i]+1] += 1;
+  for (i=0; i<num_levels; ++i) ptr[i+1] += ptr[i];
+  for (i=0; i<m; ++i) rows[ptr[level[i]]++] = i;
+  for (i=num_levels; i>0; --i) ptr[i] = ptr[i-1];
+  ptr[0] = 0;
+  END_FUNC_DH
+}
+
+/* Solves levels [lev_beg,lev_end) of Ly = rhs for y (L has unit
+   diagonal), and of Ux = y for x (the diagonal of U holds inverted
+   pivots).  Rows of one level are shared among the threads; the
+   arithmetic of each row is the same as in the row-ordered sweeps.
+   y and x may be the same vector.
+*/
+#undef __FUNC__
+#define __FUNC__ "forward_solve_levels_private"
+static void forward_solve_levels_private(HYPRE_Int lev_beg, HYPRE_Int lev_end,
+                                         HYPRE_Int *level_ptr, HYPRE_Int *level_rows,
+                                         HYPRE_Int *rp, HYPRE_Int *cval, HYPRE_Int *diag,
+                                         HYPRE_Real *aval, HYPRE_Real *rhs, HYPRE_Real *y)
+{
+  START_FUNC_DH
+  HYPRE_Int lev, k, i, j;
+  HYPRE_Real sum;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(lev, k, i, j, sum)
+#endif
+  for (lev=lev_beg; lev<lev_end; ++lev) {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+    for (k=level_ptr[lev]; k<level_ptr[lev+1]; ++k) {
+      i = level_rows[k];
+      sum = rhs[i];
+      for (j=rp[i]; j<diag[i]; ++j) {
+        sum -= (aval[j] * y[cval[j]]);
+      }
+      y[i] = sum;
+    }
+  }
+  END_FUNC_DH
+}
+
+#undef __FUNC__
+#define __FUNC__ "backward_solve_levels_private"
+static void backward_solve_levels_private(HYPRE_Int lev_beg, HYPRE_Int lev_end,
+                                          HYPRE_Int *level_ptr, HYPRE_Int *level_rows,
+                                          HYPRE_Int *rp, HYPRE_Int *cval, HYPRE_Int *diag,
+                                          HYPRE_Real *aval, HYPRE_Real *y, HYPRE_Real *x)
+{
+  START_FUNC_DH
+  HYPRE_Int lev, k, i, j;
+  HYPRE_Real sum;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(lev, k, i, j, sum)
+#endif
+  for (lev=lev_beg; lev<lev_end; ++lev) {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+    for (k=level_ptr[lev]; k<level_ptr[lev+1]; ++k) {
+      i = level_rows[k];
+      sum = y[i];
+      for (j=diag[i]+1; j<rp[i+1]; ++j) {
+        sum -= (aval[j] * x[cval[j]]);
+      }
+      x[i] = sum*aval[diag[i]];
+    }
+  }
+  END_FUNC_DH
+}
+
 /* solve for MPI implementation of PILU.  This function is
    so similar to MatVec, that I put it here, instead of with
    the other solves located in Euclid_apply.c.
@@ -661,7 +838,11 @@ for (i=0; i<m+offsetLo+offsetHi; ++i) {
   /* forward triangular solve on interior nodes */
   from = 0;
   to = first_bdry;
-  if (from != to) {
+  if (mat->numLevelsL && ! debug) {
+    forward_solve_levels_private(0, mat->splitLevelL, mat->levelPtrL,
+                                 mat->levelRowsL, rp, cval, diag, aval,
+                                 rhs, work_y); CHECK_V_ERROR;
+  } else if (from != to) {
     forward_solve_private(m, from, to, rp, cval, diag, aval, 
                           rhs, work_y, debug); CHECK_V_ERROR;
   }
@@ -684,7 +865,11 @@ for (i=0; i<m+offsetLo+offsetHi; ++i) {
   /* forward triangular solve on boundary nodes */
   from = first_bdry;
   to = m;
-  if (from != to) {
+  if (mat->numLevelsL && ! debug) {
+    forward_solve_levels_private(mat->splitLevelL, mat->numLevelsL,
+                                 mat->levelPtrL, mat->levelRowsL, rp, cval,
+                                 diag, aval, rhs, work_y); CHECK_V_ERROR;
+  } else if (from != to) {
     forward_solve_private(m, from, to, rp, cval, diag, aval, 
                           rhs, work_y, debug); CHECK_V_ERROR;
   }
@@ -730,7 +915,11 @@ for (i=0; i<m+offsetLo+offsetHi; ++i) {
   /* backward solve boundary nodes */
   from = m;
   to = first_bdry;
-  if (from != to) {
+  if (mat->numLevelsU && ! debug) {
+    backward_solve_levels_private(0, mat->splitLevelU, mat->levelPtrU,
+                                  mat->levelRowsU, rp, cval, diag, aval,
+                                  work_y, work_x); CHECK_V_ERROR;
+  } else if (from != to) {
     backward_solve_private(m, from, to, rp, cval, diag, aval, 
                            work_y, work_x, debug); CHECK_V_ERROR;
   }
@@ -759,7 +948,11 @@ for (i=0; i<m+offsetLo+offsetHi; ++i) {
   /* backward solve interior nodes */
   from = first_bdry;
   to = 0;
-  if (from != to) {
+  if (mat->numLevelsU && ! debug) {
+    backward_solve_levels_private(mat->splitLevelU, mat->numLevelsU,
+                                  mat->levelPtrU, mat->levelRowsU, rp, cval,
+                                  diag, aval, work_y, work_x); CHECK_V_ERROR;
+  } else if (from != to) {
     backward_solve_private(m, from, to, rp, cval, diag, aval, 
                            work_y, work_x, debug); CHECK_V_ERROR;
   }
@@ -987,7 +1180,9 @@ void Factor_dhTranspose(Factor_dh A, Factor_dh *Bout)
 }
 
 
-/* this could be done using OpenMP, but I took it out for now */
+/* when level schedules exist (Factor_dhSolveLevelsSetup) the
+   solves are thread-parallel within each level.
+*/
 #undef __FUNC__
 #define __FUNC__ "Factor_dhSolveSeq"
 void Factor_dhSolveSeq(HYPRE_Real *rhs, HYPRE_Real *lhs, Euclid_dh ctx)
@@ -1061,6 +1256,13 @@ void Factor_dhSolveSeq(HYPRE_Real *rhs, HYPRE_Real *lhs, Euclid_dh ctx)
   hypre_fprintf(logFile, "\n");
 
 
+ } else if (F->numLevelsL) {
+  forward_solve_levels_private(0, F->numLevelsL, F->levelPtrL, F->levelRowsL,
+                               rp, cval, diag, aval, rhs, work); CHECK_V_ERROR;
+  backward_solve_levels_private(0, F->numLevelsU, F->levelPtrU, F->levelRowsU,
+                                rp, cval, diag, aval, work, work); CHECK_V_ERROR;
+  hypre_TMemcpy(lhs, work, REAL_DH, m, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
  } else {
   /* forward solve lower triangle */
   work[0] = rhs[0];
@@ -1086,6 +1288,257 @@ void Factor_dhSolveSeq(HYPRE_Real *rhs, HYPRE_Real *lhs, Euclid_dh ctx)
   END_FUNC_DH
 }
 
+/* One Jacobi sweep over rows [from,to) of Ly = rhs, where L has
+   unit diagonal:  y_new = rhs - (L-I)*y.
+*/
+#undef __FUNC__
+#define __FUNC__ "forward_jacobi_private"
+static void forward_jacobi_private(HYPRE_Int from, HYPRE_Int to,
+                                   HYPRE_Int *rp, HYPRE_Int *cval, HYPRE_Int *diag,
+                                   HYPRE_Real *aval, HYPRE_Real *rhs,
+                                   HYPRE_Real *y, HYPRE_Real *y_new)
+{
+  START_FUNC_DH
+  HYPRE_Int i, j;
+  HYPRE_Real sum;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, sum) HYPRE_SMP_SCHEDULE
+#endif
+  for (i=from; i<to; ++i) {
+    sum = rhs[i];
+    for (j=rp[i]; j<diag[i]; ++j) {
+      sum -= (aval[j] * y[cval[j]]);
+    }
+    y_new[i] = sum;
+  }
+  END_FUNC_DH
+}
+
+/* One Jacobi sweep over rows [from,to) of Ux = y, where the diagonal
+   of U holds inverted pivots:  x_new = D^{-1}*(y - (U-D)*x).
+*/
+#undef __FUNC__
+#define __FUNC__ "backward_jacobi_private"
+static void backward_jacobi_private(HYPRE_Int from, HYPRE_Int to,
+                                    HYPRE_Int *rp, HYPRE_Int *cval, HYPRE_Int *diag,
+                                    HYPRE_Real *aval, HYPRE_Real *y,
+                                    HYPRE_Real *x, HYPRE_Real *x_new)
+{
+  START_FUNC_DH
+  HYPRE_Int i, j;
+  HYPRE_Real sum;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, sum) HYPRE_SMP_SCHEDULE
+#endif
+  for (i=from; i<to; ++i) {
+    sum = y[i];
+    for (j=diag[i]+1; j<rp[i+1]; ++j) {
+      sum -= (aval[j] * x[cval[j]]);
+    }
+    x_new[i] = sum*aval[diag[i]];
+  }
+  END_FUNC_DH
+}
+
+/* Approximate triangular solves (Anzt and Chow): each solve is
+   replaced by ctx->triSweeps Jacobi sweeps, so every sweep is a
+   row-parallel, matvec-like kernel.  For PILU, each sweep exchanges
+   the current boundary values with the neighbors (using the
+   persistent requests of Factor_dhSolveSetup) instead of waiting for
+   the lower (resp. higher) ordered subdomains to finish their solves.
+*/
+#undef __FUNC__
+#define __FUNC__ "Factor_dhSolveJacobi"
+void Factor_dhSolveJacobi(HYPRE_Real *rhs, HYPRE_Real *lhs, Euclid_dh ctx)
+{
+  START_FUNC_DH
+  Factor_dh mat = ctx->F;
+  HYPRE_Int    i, k, ierr, m = mat->m, sweeps = ctx->triSweeps;
+  HYPRE_Int    *rp = mat->rp, *cval = mat->cval, *diag = mat->diag;
+  HYPRE_Real *aval = mat->aval;
+  HYPRE_Int    *sendindLo = mat->sendindLo, *sendindHi = mat->sendindHi;
+  HYPRE_Real *sendbufLo = mat->sendbufLo, *sendbufHi = mat->sendbufHi; 
+  HYPRE_Real *y, *x, *tmp = ctx->work;
+  HYPRE_Int    split = m;
+
+  /* PILU iterates live in the receive buffers, so the external
+     values land next to the local ones; otherwise there are no
+     external values, and all rows are "interior."
+  */
+  if (mat->solveIsSetup) {
+    y = mat->work_y_lo;
+    x = mat->work_x_hi;
+    split = mat->first_bdry;
+  } else {
+    if (mat->work_jac == NULL) {
+      mat->work_jac = (HYPRE_Real*)MALLOC_DH(m*sizeof(HYPRE_Real)); CHECK_V_ERROR;
+    }
+    y = mat->work_jac;
+    x = lhs;
+  }
+
+  /*-------------------------------------------------------------
+   * PART 1: Ly = rhs; starting guess y = rhs
+   *-------------------------------------------------------------*/
+  hypre_TMemcpy(y,  rhs, HYPRE_Real, m, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+  for (k=0; k<sweeps; ++k) {
+    if (mat->num_recvLo) {
+      ierr = hypre_MPI_Startall(mat->num_recvLo, mat->recv_reqLo); CHECK_MPI_V_ERROR(ierr);
+    }
+    if (mat->num_sendHi) {
+      for (i=0; i<mat->sendlenHi; i++) {
+        sendbufHi[i] = y[sendindHi[i]]; 
+      }
+      ierr = hypre_MPI_Startall(mat->num_sendHi, mat->send_reqHi); CHECK_MPI_V_ERROR(ierr);
+    }
+
+    /* interior rows don't need external values */
+    forward_jacobi_private(0, split, rp, cval, diag, aval,
+                           rhs, y, tmp); CHECK_V_ERROR;
+    if (mat->num_recvLo) {
+      ierr = hypre_MPI_Waitall(mat->num_recvLo, mat->recv_reqLo, mat->status); CHECK_MPI_V_ERROR(ierr);
+    }
+    forward_jacobi_private(split, m, rp, cval, diag, aval,
+                           rhs, y, tmp); CHECK_V_ERROR;
+    if (mat->num_sendHi) {
+      ierr = hypre_MPI_Waitall(mat->num_sendHi, mat->send_reqHi, mat->status); CHECK_MPI_V_ERROR(ierr);
+    }
+    hypre_TMemcpy(y,  tmp, HYPRE_Real, m, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+  }
+
+  /*-------------------------------------------------------------
+   * PART 2: Ux = y; starting guess x = D^{-1}*y
+   *-------------------------------------------------------------*/
+  for (i=0; i<m; ++i) {
+    x[i] = y[i]*aval[diag[i]];
+  }
+  for (k=0; k<sweeps; ++k) {
+    if (mat->num_recvHi) {
+      ierr = hypre_MPI_Startall(mat->num_recvHi, mat->recv_reqHi); CHECK_MPI_V_ERROR(ierr);
+    }
+    if (mat->num_sendLo) {
+      for (i=0; i<mat->sendlenLo; i++) {
+        sendbufLo[i] = x[sendindLo[i]]; 
+      }
+      ierr = hypre_MPI_Startall(mat->num_sendLo, mat->send_reqLo); CHECK_MPI_V_ERROR(ierr);
+    }
+
+    backward_jacobi_private(0, split, rp, cval, diag, aval,
+                            y, x, tmp); CHECK_V_ERROR;
+    if (mat->num_recvHi) {
+      ierr = hypre_MPI_Waitall(mat->num_recvHi, mat->recv_reqHi, mat->status); CHECK_MPI_V_ERROR(ierr);
+    }
+    backward_jacobi_private(split, m, rp, cval, diag, aval,
+                            y, x, tmp); CHECK_V_ERROR;
+    if (mat->num_sendLo) {
+      ierr = hypre_MPI_Waitall(mat->num_sendLo, mat->send_reqLo, mat->status); CHECK_MPI_V_ERROR(ierr);
+    }
+    hypre_TMemcpy(x,  tmp, HYPRE_Real, m, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+  }
+
+  if (x != lhs) {
+    hypre_TMemcpy(lhs,  x, HYPRE_Real, m, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+  }
+  END_FUNC_DH
+}
+
+/* Fixed-point ILU (Chow and Patel): every entry of the factors on
+   the given pattern is updated from the previous iterate,
+     l_ij = (a_ij - sum_{k<j} l_ik*u_kj) / u_jj,   i > j,
+     u_ij =  a_ij - sum_{k<i} l_ik*u_kj,           i <= j,
+   so all rows are computed independently.  The iteration starts
+   from L = (strictly lower part of A)*D_A^{-1} and U = upper part
+   of A, and reaches the exact ILU factors on the pattern after
+   (at most) as many sweeps as the depth of the elimination tree.
+*/
+#undef __FUNC__
+#define __FUNC__ "Factor_dhFixedPointSweeps"
+void Factor_dhFixedPointSweeps(Factor_dh mat, HYPRE_Int sweeps)
+{
+  START_FUNC_DH
+  HYPRE_Int m = mat->m, *rp = mat->rp, *cval = mat->cval, *diag = mat->diag;
+  HYPRE_Int nz = rp[m], num_threads = hypre_NumThreads();
+  HYPRE_Int i, j, s, *marker;
+  REAL_DH   *aval = mat->aval, *avalA, *avalNew, *tmp, *work, pv;
+
+  avalA = (REAL_DH*)MALLOC_DH(nz*sizeof(REAL_DH)); CHECK_V_ERROR;
+  avalNew = (REAL_DH*)MALLOC_DH(nz*sizeof(REAL_DH)); CHECK_V_ERROR;
+  work = (REAL_DH*)MALLOC_DH(num_threads*m*sizeof(REAL_DH)); CHECK_V_ERROR;
+  marker = (HYPRE_Int*)MALLOC_DH(num_threads*m*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+  for (i=0; i<num_threads*m; ++i) marker[i] = -1;
+  hypre_TMemcpy(avalA,  aval, REAL_DH, nz, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+  /* starting guess */
+  for (i=0; i<m; ++i) {
+    for (j=rp[i]; j<diag[i]; ++j) {
+      pv = avalA[diag[cval[j]]];
+      aval[j] = (pv != 0.0) ? avalA[j]/pv : 0.0;
+    }
+  }
+
+  for (s=0; s<sweeps; ++s) {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, j, pv)
+#endif
+    {
+      HYPRE_Int  k, row, col, begin, end;
+      HYPRE_Int  *mark = marker + hypre_GetThreadNum()*m;
+      REAL_DH    *w = work + hypre_GetThreadNum()*m, lik;
+
+      hypre_GetSimpleThreadPartition(&begin, &end, m);
+      for (i=begin; i<end; ++i) {
+        for (j=rp[i]; j<rp[i+1]; ++j) {
+          mark[cval[j]] = i;
+          w[cval[j]] = avalA[j];
+        }
+
+        /* subtract l_ik*u_kj for all k < min(i,j) on the pattern */
+        for (j=rp[i]; j<diag[i]; ++j) {
+          row = cval[j];
+          lik = aval[j];
+          for (k=diag[row]+1; k<rp[row+1]; ++k) {
+            col = cval[k];
+            if (mark[col] == i) w[col] -= (lik * aval[k]);
+          }
+        }
+
+        for (j=rp[i]; j<diag[i]; ++j) {
+          pv = aval[diag[cval[j]]];
+          avalNew[j] = (pv != 0.0) ? w[cval[j]]/pv : 0.0;
+        }
+        for (j=diag[i]; j<rp[i+1]; ++j) {
+          avalNew[j] = w[cval[j]];
+        }
+      }
+    }
+
+    tmp = aval;
+    aval = avalNew;
+    avalNew = tmp;
+  }
+
+  if (aval != mat->aval) {
+    hypre_TMemcpy(mat->aval,  aval, REAL_DH, nz, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+    avalNew = aval;
+  }
+
+  FREE_DH(avalA); CHECK_V_ERROR;
+  FREE_DH(avalNew); CHECK_V_ERROR;
+  FREE_DH(work); CHECK_V_ERROR;
+  FREE_DH(marker); CHECK_V_ERROR;
+
+  /* check for zero pivots */
+  for (i=0; i<m; ++i) {
+    if (! mat->aval[diag[i]]) {
+      hypre_sprintf(msgBuf_dh, "zero diagonal in local row %i", i+1);
+      SET_V_ERROR(msgBuf_dh);
+    }
+  }
+  END_FUNC_DH
+}
+
 /*---------------------------------------------------------------
  * next two are used by Factor_dhPrintXXX methods
  *---------------------------------------------------------------*/
@@ -46,6 +46,7 @@ struct _factor_dh {
   HYPRE_Real   *work_x_hi;  /* recv values from higher nabors; also used as
                                work vector when solving Ux=y for x.
                             */
+  HYPRE_Real   *work_jac;   /* scratch for Jacobi triangular solves */
   HYPRE_Real   *sendbufLo, *sendbufHi;
   HYPRE_Int          *sendindLo, *sendindHi;
   HYPRE_Int          sendlenLo, sendlenHi;
@@ -57,6 +58,17 @@ struct _factor_dh {
   hypre_MPI_Request  requests[MAX_MPI_TASKS];
   hypre_MPI_Status   status[MAX_MPI_TASKS];  
 
+  /* level schedules for thread-parallel triangular solves (see
+     Factor_dhSolveLevelsSetup); rows of level l of L are
+     levelRowsL[levelPtrL[l]] ... levelRowsL[levelPtrL[l+1]-1], and
+     levels are stored in solve order.  The first splitLevelL levels
+     hold the rows solved before the boundary exchange, ditto for U.
+  */
+  HYPRE_Int    numLevelsL, splitLevelL;
+  HYPRE_Int    *levelPtrL, *levelRowsL;
+  HYPRE_Int    numLevelsU, splitLevelU;
+  HYPRE_Int    *levelPtrU, *levelRowsU;
+
   bool debug;
 };
 
@@ -76,9 +88,23 @@ extern void Factor_dhReallocate(Factor_dh F, HYPRE_Int used, HYPRE_Int additiona
   /* adopted from ParaSails, by Edmond Chow */
 extern void Factor_dhSolveSetup(Factor_dh mat, SubdomainGraph_dh sg);
 
+extern void Factor_dhSolveLevelsSetup(Factor_dh mat, HYPRE_Int split);
+  /* builds level schedules of L and U for thread-parallel triangular
+     solves; rows [0,split) and [split,m) are scheduled separately.
+   */
+
 
 extern void Factor_dhSolve(HYPRE_Real *rhs, HYPRE_Real *lhs, Euclid_dh ctx);
 extern void Factor_dhSolveSeq(HYPRE_Real *rhs, HYPRE_Real *lhs, Euclid_dh ctx);
+extern void Factor_dhSolveJacobi(HYPRE_Real *rhs, HYPRE_Real *lhs, Euclid_dh ctx);
+  /* approximates the triangular solves by ctx->triSweeps Jacobi
+     sweeps on L and on U; for sequential, block Jacobi and PILU factors.
+   */
+
+extern void Factor_dhFixedPointSweeps(Factor_dh mat, HYPRE_Int sweeps);
+  /* on entry, aval holds the values of A on the ILU pattern; on return,
+     the ILU factors after "sweeps" fixed-point sweeps.  Local factors only.
+   */
 
   /* functions for monitoring stability */
 extern HYPRE_Real Factor_dhCondEst(Factor_dh mat, Euclid_dh ctx);
@@ -306,6 +306,11 @@ HYPRE_Int numeric_row_private(HYPRE_Int localRow, HYPRE_Int beg_row, HYPRE_Int e
     }
   }
 
+  /* with fixed-point factorization, the row keeps the values of A;
+     see Factor_dhFixedPointSweeps()
+  */
+  if (ctx->factorSweeps) goto END_OF_FUNCTION;
+
   for (j=rp[localRow]; j<diag[localRow]; ++j) {
     row = cval[j];
     pc = work[row];
@@ -330,5 +335,7 @@ HYPRE_Int numeric_row_private(HYPRE_Int localRow, HYPRE_Int beg_row, HYPRE_Int e
   }
 #endif
 
+END_OF_FUNCTION: ;
+
   END_FUNC_VAL(0)
 }
@@ -593,6 +593,11 @@ HYPRE_Int numeric_row_private(HYPRE_Int localRow,
 /*hypre_fprintf(stderr, "local row= %i\n", 1+localRow);
 */
 
+  /* with fixed-point factorization, the row keeps the values of A;
+     see Factor_dhFixedPointSweeps()
+  */
+  if (ctx->factorSweeps) goto END_OF_FUNCTION;
+
 
   for (j=rp[localRow]; j<diag[localRow]; ++j) {
     row = cval[j];     /* previously factored row */
@@ -634,6 +639,8 @@ hypre_fprintf(stderr, "pv= %g; pc= %g\n", pv, pc);
   }
 #endif
 
+END_OF_FUNCTION: ;
+
   END_FUNC_VAL(0)
 }
 
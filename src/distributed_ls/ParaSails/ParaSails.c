@@ -30,8 +30,6 @@
 #include "LoadBal.h"
 #include "ParaSails.h"
 
-#include "_hypre_lapack.h"
-
 #define ROW_PRUNED_REQ_TAG        221
 #define ROW_STORED_REQ_TAG        222
 #define ROW_REPI_TAG              223
@@ -992,36 +990,172 @@ static void ConstructPatternForEachRowExt(HYPRE_Int symmetric,
     RowPattDestroy(row_patt2);
 }
 
+/*--------------------------------------------------------------------------
+ * DenseCholesky - Cholesky factorization A = L L^T of the n-by-n SPD
+ * matrix "a" (column-major), computed in place in the lower triangle.
+ * Returns 0, or j+1 if the leading minor of order j+1 is not positive.
+ * Unlike the LAPACK routines in hypre (translated by f2c, with static
+ * local variables), this and the next functions are reentrant, so they
+ * can be called from several threads.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int DenseCholesky(HYPRE_Int n, HYPRE_Real *a)
+{
+    HYPRE_Int i, j, k;
+    HYPRE_Real ajj, t, *aj, *ak;
+
+    for (j=0; j<n; j++)
+    {
+        aj = a + j*n;
+        ajj = aj[j];
+        if (ajj <= 0.0)
+            return j+1;
+        ajj = sqrt(ajj);
+        aj[j] = ajj;
+        for (i=j+1; i<n; i++)
+            aj[i] /= ajj;
+
+        /* update the trailing lower triangle */
+        for (k=j+1; k<n; k++)
+        {
+            ak = a + k*n;
+            t = aj[k];
+            for (i=k; i<n; i++)
+                ak[i] -= aj[i] * t;
+        }
+    }
+
+    return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * DenseCholeskySolve - Solve L L^T x = b in place in "b", where L is the
+ * factor computed by DenseCholesky.
+ *--------------------------------------------------------------------------*/
+
+static void DenseCholeskySolve(HYPRE_Int n, HYPRE_Real *a, HYPRE_Real *b)
+{
+    HYPRE_Int i, j;
+    HYPRE_Real *aj;
+
+    for (j=0; j<n; j++)
+    {
+        aj = a + j*n;
+        b[j] /= aj[j];
+        for (i=j+1; i<n; i++)
+            b[i] -= aj[i] * b[j];
+    }
+
+    for (j=n-1; j>=0; j--)
+    {
+        aj = a + j*n;
+        for (i=j+1; i<n; i++)
+            b[j] -= aj[i] * b[i];
+        b[j] /= aj[j];
+    }
+}
+
+/*--------------------------------------------------------------------------
+ * DenseLeastSquares - Solve min ||A x - b|| for the m-by-n matrix "a"
+ * (column-major, m >= n, full rank) by Householder QR.  "a" is
+ * overwritten, and the solution is returned in the first n entries of "b".
+ * Returns 0, or k+1 if column k is (numerically exactly) dependent.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int DenseLeastSquares(HYPRE_Int m, HYPRE_Int n, HYPRE_Real *a,
+  HYPRE_Real *b)
+{
+    HYPRE_Int i, j, k;
+    HYPRE_Real norm, alpha, vtv, s, *ak, *aj;
+
+    if (m < n)
+        return 1;
+
+    for (k=0; k<n; k++)
+    {
+        ak = a + k*m;
+
+        norm = 0.0;
+        for (i=k; i<m; i++)
+            norm += ak[i] * ak[i];
+        norm = sqrt(norm);
+        if (norm == 0.0)
+            return k+1;
+
+        /* Householder vector v = x - alpha e_1, stored in ak[k:m] */
+        alpha = (ak[k] > 0.0 ? -norm : norm);
+        vtv = 2.0 * norm * (norm + ABS(ak[k]));
+        ak[k] -= alpha;
+
+        /* apply I - 2 v v^T / (v^T v) to the remaining columns and b */
+        for (j=k+1; j<n; j++)
+        {
+            aj = a + j*m;
+            s = 0.0;
+            for (i=k; i<m; i++)
+                s += ak[i] * aj[i];
+            s = 2.0 * s / vtv;
+            for (i=k; i<m; i++)
+                aj[i] -= s * ak[i];
+        }
+        s = 0.0;
+        for (i=k; i<m; i++)
+            s += ak[i] * b[i];
+        s = 2.0 * s / vtv;
+        for (i=k; i<m; i++)
+            b[i] -= s * ak[i];
+
+        ak[k] = alpha;
+    }
+
+    /* back substitution with R */
+    for (k=n-1; k>=0; k--)
+    {
+        s = b[k];
+        for (j=k+1; j<n; j++)
+            s -= a[k + j*m] * b[j];
+        b[k] = s / a[k + k*m];
+    }
+
+    return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * DiagonalLocations - Return an array with the local index (in "numb")
+ * of the diagonal entry of each row local_beg_row, ..., mat->end_row.
+ * This is done before the threaded loops, since NumberingGlobalToLocal
+ * may insert into the numbering.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int *DiagonalLocations(Matrix *mat, HYPRE_Int local_beg_row,
+  Numbering *numb)
+{
+    HYPRE_Int row, *diag_loc;
+
+    diag_loc = hypre_TAlloc(HYPRE_Int, mat->end_row - local_beg_row + 1,
+        HYPRE_MEMORY_HOST);
+    for (row=local_beg_row; row<=mat->end_row; row++)
+        NumberingGlobalToLocal(numb, 1, &row, &diag_loc[row - local_beg_row]);
+
+    return diag_loc;
+}
+
 /*--------------------------------------------------------------------------
  * ComputeValuesSym
+ *
+ * The rows are computed independently, in parallel if threads are
+ * available; each thread has its own marker array and dense workspace,
+ * and the stored rows are only read.
  *--------------------------------------------------------------------------*/
 
 static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
   HYPRE_Int local_beg_row, Numbering *numb, HYPRE_Int symmetric)
 {
-    HYPRE_Int *marker;
+    HYPRE_Int *diag_loc;
     HYPRE_Int row, maxlen, len, *ind;
     HYPRE_Real *val;
 
-    HYPRE_Real *ahat, *ahatp;
-    HYPRE_Int i, j, len2, *ind2, loc;
-    HYPRE_Real *val2, temp;
-    HYPRE_Real time0, time1, timet = 0.0, timea = 0.0;
-
-    HYPRE_Real ahatcost = 0.0;
-
-    HYPRE_Real error = 0;
-
-#ifndef ESSL
-    char uplo = 'L';
-    HYPRE_Int one = 1;
-    HYPRE_Int info;
-#endif
-
-    /* Allocate and initialize full length marker array */
-    marker = hypre_TAlloc(HYPRE_Int, numb->num_ind , HYPRE_MEMORY_HOST);
-    for (i=0; i<numb->num_ind; i++)
-        marker[i] = -1;
+    HYPRE_Int error = 0;
 
     /* Determine the length of the longest row of M on this processor */
     /* This determines the maximum storage required for the ahat matrix */
@@ -1032,6 +1166,22 @@ static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
         maxlen = (len > maxlen ? len : maxlen);
     }
 
+    diag_loc = DiagonalLocations(mat, local_beg_row, numb);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(row,len,ind,val) reduction(+:error)
+#endif
+    {
+    HYPRE_Int *marker;
+    HYPRE_Real *ahat, *ahatp;
+    HYPRE_Int i, j, len2, *ind2, loc;
+    HYPRE_Real *val2, temp;
+
+    /* Allocate and initialize full length marker array */
+    marker = hypre_TAlloc(HYPRE_Int, numb->num_ind , HYPRE_MEMORY_HOST);
+    for (i=0; i<numb->num_ind; i++)
+        marker[i] = -1;
+
 #ifdef ESSL
     ahat = hypre_TAlloc(HYPRE_Real, maxlen*(maxlen+1)/2 , HYPRE_MEMORY_HOST);
 #else
@@ -1039,6 +1189,9 @@ static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
 #endif
 
     /* Compute values for row "row" of approximate inverse */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for schedule(static)
+#endif
     for (row=local_beg_row; row<=mat->end_row; row++)
     {
         /* Retrieve local indices */
@@ -1050,15 +1203,11 @@ static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
 
         /* Initialize ahat to zero */
 #ifdef ESSL
-/*        bzero((char *) ahat, len*(len+1)/2 * sizeof(HYPRE_Real));*/
         memset(ahat, 0, len*(len+1)/2 * sizeof(HYPRE_Real));
 #else
-/*        bzero((char *) ahat, len*len * sizeof(HYPRE_Real));*/
         memset(ahat, 0, len*len * sizeof(HYPRE_Real));
 #endif
 
-        time0 = hypre_MPI_Wtime();
-
         /* Form ahat matrix, entries correspond to indices in "ind" only */
         ahatp = ahat;
         for (i=0; i<len; i++)
@@ -1111,15 +1260,9 @@ static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
 #endif
         }
 
-        time1 = hypre_MPI_Wtime();
-        timea += (time1-time0);
-        ahatcost += (HYPRE_Real) (len*len2);
-
         /* Set the right-hand side */
-/*        bzero((char *) val, len*sizeof(HYPRE_Real));*/
         memset(val, 0, len*sizeof(HYPRE_Real));
-        NumberingGlobalToLocal(numb, 1, &row, &loc);
-        loc = marker[loc];
+        loc = marker[diag_loc[row - local_beg_row]];
         assert(loc != -1);
         val[loc] = 1.0;
 
@@ -1127,41 +1270,18 @@ static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
         for (i=0; i<len; i++)
             marker[ind[i]] = -1;
 
-        time0 = hypre_MPI_Wtime();
-
 #ifdef ESSL
         dppf(ahat, len, 1);
         dpps(ahat, len, val, 1);
 #else
-        /* Solve local linear system - factor phase */
-        hypre_dpotrf(&uplo, &len, ahat, &len, &info);
-        if (info != 0)
-        {
-#if 0
-            hypre_printf("Matrix may not be symmetric positive definite.\n");
-            hypre_printf("ParaSails: row %d, dpotrf returned %d.\n", row, info);
-            hypre_printf("ParaSails: len %d, ahat: %f %f %f %f\n", len,
-                ahat[0], ahat[1], ahat[2], ahat[3]);
-            PARASAILS_EXIT;
-#endif
-            error = 1;
-        }
-
-        /* Solve local linear system - solve phase */
-        hypre_dpotrs(&uplo, &len, &one, ahat, &len, val, &len, &info);
-        if (info != 0)
+        /* Solve local linear system */
+        if (DenseCholesky(len, ahat) != 0)
         {
-#if 0
-            hypre_printf("ParaSails: row %d, dpotrs returned %d.\n", row, info);
-            hypre_printf("ParaSails: len %d, ahat: %f %f %f %f\n", len,
-                ahat[0], ahat[1], ahat[2], ahat[3]);
-            PARASAILS_EXIT;
-#endif
+            /* Matrix may not be symmetric positive definite */
             error = 1;
         }
+        DenseCholeskySolve(len, ahat, val);
 #endif
-        time1 = hypre_MPI_Wtime();
-        timet += (time1-time0);
 
         /* Scale the result */
         temp = 1.0 / sqrt(ABS(val[loc]));
@@ -1171,51 +1291,50 @@ static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
 
     free(marker);
     free(ahat);
-
-#if 0
-    {
-    HYPRE_Int mype;
-    hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &mype);
-    hypre_printf("%d: Time for ahat: %f, for local solves: %f\n", mype, timea, timet);
-    hypre_printf("%d: ahatcost: %7.1e, numrows: %d, maxlen: %d\n",
-        mype, ahatcost, mat->end_row-local_beg_row+1, maxlen);
-    fflush(stdout);
     }
-#endif
+
+    free(diag_loc);
 
     return error;
 }
 
 /*--------------------------------------------------------------------------
  * ComputeValuesNonsym
+ *
+ * Threaded like ComputeValuesSym.
  *--------------------------------------------------------------------------*/
 
 static HYPRE_Int ComputeValuesNonsym(StoredRows *stored_rows, Matrix *mat,
   HYPRE_Int local_beg_row, Numbering *numb)
 {
-    HYPRE_Int *marker;
-    HYPRE_Real *ahat, *ahatp, *bhat;
-    HYPRE_Real *work;
-    HYPRE_Int ahat_size = 10000, bhat_size = 1000, work_size = 2000*64;
-
+    HYPRE_Int *diag_loc;
     HYPRE_Int row, len, *ind;
     HYPRE_Real *val;
 
+    HYPRE_Int error = 0;
+
+    diag_loc = DiagonalLocations(mat, local_beg_row, numb);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(row,len,ind,val) reduction(+:error)
+#endif
+    {
+    HYPRE_Int *marker;
+    HYPRE_Real *ahat, *ahatp, *bhat;
+    HYPRE_Int ahat_size = 10000, bhat_size = 1000;
+
     HYPRE_Int i, j, len2, *ind2, loc;
     HYPRE_Real *val2;
-    HYPRE_Real time0, time1, timet = 0.0, timea = 0.0;
 
     HYPRE_Int npat;
     HYPRE_Int pattsize = 1000;
     HYPRE_Int *patt = hypre_TAlloc(HYPRE_Int, pattsize, HYPRE_MEMORY_HOST);
 
+#ifdef ESSL
     HYPRE_Int info;
-
-    HYPRE_Int error = 0;
-
-#ifndef ESSL
-    char trans = 'N';
-    HYPRE_Int one = 1;
+    HYPRE_Real *work;
+    HYPRE_Int work_size = 2000*64;
+    work = hypre_CTAlloc(HYPRE_Real, work_size, HYPRE_MEMORY_HOST);
 #endif
 
     /* Allocate and initialize marker array */
@@ -1227,20 +1346,20 @@ static HYPRE_Int ComputeValuesNonsym(StoredRows *stored_rows, Matrix *mat,
 
     bhat = hypre_TAlloc(HYPRE_Real, bhat_size , HYPRE_MEMORY_HOST);
     ahat = hypre_TAlloc(HYPRE_Real, ahat_size , HYPRE_MEMORY_HOST);
-    work = hypre_CTAlloc(HYPRE_Real, work_size, HYPRE_MEMORY_HOST);
 
     /* Compute values for row "row" of approximate inverse */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for schedule(static)
+#endif
     for (row=local_beg_row; row<=mat->end_row; row++)
     {
-        time0 = hypre_MPI_Wtime();
-
         /* Retrieve local indices */
         MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
 
         npat = 0;
 
         /* Put the diagonal entry into the marker array */
-        NumberingGlobalToLocal(numb, 1, &row, &loc);
+        loc = diag_loc[row - local_beg_row];
         marker[loc] = npat;
         patt[npat++] = loc;
 
@@ -1275,7 +1394,6 @@ static HYPRE_Int ComputeValuesNonsym(StoredRows *stored_rows, Matrix *mat,
         }
 
         /* Initialize ahat to zero */
-/*        bzero((char *) ahat, len*npat * sizeof(HYPRE_Real));*/
         memset(ahat, 0, len*npat * sizeof(HYPRE_Real));
 
         /* Form ahat matrix, entries correspond to indices in "ind" only */
@@ -1292,9 +1410,6 @@ static HYPRE_Int ComputeValuesNonsym(StoredRows *stored_rows, Matrix *mat,
             ahatp += npat;
         }
 
-        time1 = hypre_MPI_Wtime();
-        timea += (time1-time0);
-
         /* Reallocate bhat if necessary */
         if (npat > bhat_size)
         {
@@ -1304,10 +1419,8 @@ static HYPRE_Int ComputeValuesNonsym(StoredRows *stored_rows, Matrix *mat,
         }
 
         /* Set the right-hand side, bhat */
-/*        bzero((char *) bhat, npat*sizeof(HYPRE_Real));*/
         memset(bhat, 0, npat*sizeof(HYPRE_Real));
-        NumberingGlobalToLocal(numb, 1, &row, &loc);
-        loc = marker[loc];
+        loc = marker[diag_loc[row - local_beg_row]];
         assert(loc != -1);
         bhat[loc] = 1.0;
 
@@ -1315,25 +1428,14 @@ static HYPRE_Int ComputeValuesNonsym(StoredRows *stored_rows, Matrix *mat,
         for (i=0; i<npat; i++)
             marker[patt[i]] = -1;
 
-        time0 = hypre_MPI_Wtime();
-
 #ifdef ESSL
         /* rhs in bhat, and put solution in val */
         dgells(0, ahat, npat, bhat, npat, val, len, NULL, 1.e-12, npat, len, 1,
             &info, work, work_size);
 #else
         /* rhs in bhat, and put solution in bhat */
-        hypre_dgels(&trans, &npat, &len, &one, ahat, &npat,
-            bhat, &npat, work, &work_size, &info);
-
-        if (info != 0)
+        if (DenseLeastSquares(npat, len, ahat, bhat) != 0)
         {
-#if 0
-            hypre_printf("ParaSails: row %d, dgels returned %d.\n", row, info);
-            hypre_printf("ParaSails: len %d, ahat: %f %f %f %f\n", len,
-                ahat[0], ahat[1], ahat[2], ahat[3]);
-            PARASAILS_EXIT;
-#endif
             error = 1;
         }
 
@@ -1341,24 +1443,18 @@ static HYPRE_Int ComputeValuesNonsym(StoredRows *stored_rows, Matrix *mat,
         for (j=0; j<len; j++)
             val[j] = bhat[j];
 #endif
-        time1 = hypre_MPI_Wtime();
-        timet += (time1-time0);
     }
 
     free(patt);
     free(marker);
     free(bhat);
     free(ahat);
+#ifdef ESSL
     free(work);
-
-#if 0
-    {
-    HYPRE_Int mype;
-    hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &mype);
-    hypre_printf("%d: Time for ahat: %f, for local solves: %f\n", mype, timea, timet);
-    fflush(stdout);
-    }
 #endif
+    }
+
+    free(diag_loc);
 
     return error;
 }
@@ -68,10 +68,12 @@ typedef struct
 
    void*                         A;
    void*                         matvecData;
+   void*                         matMultiVecData;
    void*                         precondData;
 
    void*                         B;
    void*                         matvecDataB;
+   void*                         matMultiVecDataB;
    void*                         T;
    void*                         matvecDataT;
 
@@ -137,6 +139,14 @@ hypre_LOBPCGDestroy( void *pcg_vdata )
          (*(mv->MatvecDestroy))(pcg_data->matvecDataB);
          pcg_data->matvecDataB = NULL;
       }
+      if ( pcg_data->matMultiVecData != NULL ) {
+         (*(mv->MatMultiVecDestroy))(pcg_data->matMultiVecData);
+         pcg_data->matMultiVecData = NULL;
+      }
+      if ( pcg_data->matMultiVecDataB != NULL ) {
+         (*(mv->MatMultiVecDestroy))(pcg_data->matMultiVecDataB);
+         pcg_data->matMultiVecDataB = NULL;
+      }
       if ( pcg_data->matvecDataT != NULL ) {
          (*(mv->MatvecDestroy))(pcg_data->matvecDataT);
          pcg_data->matvecDataT = NULL;
@@ -164,6 +174,13 @@ hypre_LOBPCGSetup( void *pcg_vdata, void *A, void *b, void *x )
       (*(mv->MatvecDestroy))(pcg_data->matvecData);
    (pcg_data->matvecData) = (*(mv->MatvecCreate))(A, x);
 
+   if ( pcg_data->matMultiVecData != NULL )
+      (*(mv->MatMultiVecDestroy))(pcg_data->matMultiVecData);
+   if ( mv->MatMultiVec != NULL )
+      (pcg_data->matMultiVecData) = (*(mv->MatMultiVecCreate))(A, x);
+   else
+      (pcg_data->matMultiVecData) = NULL;
+
    if ( precond_setup != NULL ) {
       if ( pcg_data->T == NULL )
          precond_setup(precond_data, A, b, x);
@@ -190,6 +207,13 @@ hypre_LOBPCGSetupB( void *pcg_vdata, void *B, void *x )
    else
       (pcg_data->matvecDataB) = NULL;
 
+   if ( pcg_data->matMultiVecDataB != NULL )
+      (*(mv->MatMultiVecDestroy))(pcg_data->matMultiVecDataB);
+   if ( B != NULL && mv->MatMultiVec != NULL )
+      (pcg_data->matMultiVecDataB) = (*(mv->MatMultiVecCreate))(B, x);
+   else
+      (pcg_data->matMultiVecDataB) = NULL;
+
    return hypre_error_flag;
 }
 
@@ -351,12 +375,21 @@ hypre_LOBPCGMultiPreconditioner( void *data, void * x, void*  y )
    ii->Eval( hypre_LOBPCGPreconditioner, data, x, y );
 }
 
+/* the operators are applied to all vectors of the block at once
+   when the matvec functions provide a MatMultiVec */
+
 void
 hypre_LOBPCGMultiOperatorA( void *data, void * x, void*  y )
 {
    hypre_LOBPCGData *pcg_data = (hypre_LOBPCGData*)data;
    mv_InterfaceInterpreter* ii = pcg_data->interpreter;
-  
+   HYPRE_MatvecFunctions * mv = pcg_data->matvecFunctions;
+
+   if ( pcg_data->matMultiVecData != NULL ) {
+      (*(mv->MatMultiVec))(pcg_data->matMultiVecData, 1.0, pcg_data->A, x, 0.0, y);
+      return;
+   }
+
    ii->Eval( hypre_LOBPCGOperatorA, data, x, y );
 }
 
@@ -365,7 +398,13 @@ hypre_LOBPCGMultiOperatorB( void *data, void * x, void*  y )
 {
    hypre_LOBPCGData *pcg_data = (hypre_LOBPCGData*)data;
    mv_InterfaceInterpreter* ii = pcg_data->interpreter;
-  
+   HYPRE_MatvecFunctions * mv = pcg_data->matvecFunctions;
+
+   if ( pcg_data->matMultiVecDataB != NULL ) {
+      (*(mv->MatMultiVec))(pcg_data->matMultiVecDataB, 1.0, pcg_data->B, x, 0.0, y);
+      return;
+   }
+
    ii->Eval( hypre_LOBPCGOperatorB, data, x, y );
 }
 
@@ -481,8 +520,10 @@ HYPRE_LOBPCGCreate( mv_InterfaceInterpreter* ii, HYPRE_MatvecFunctions* mv,
    pcg_data->matvecFunctions             = mv;
 
    (pcg_data->matvecData)	       	= NULL;
+   (pcg_data->matMultiVecData)	       	= NULL;
    (pcg_data->B)	       			= NULL;
    (pcg_data->matvecDataB)	       	= NULL;
+   (pcg_data->matMultiVecDataB)       	= NULL;
    (pcg_data->T)	       			= NULL;
    (pcg_data->matvecDataT)	       	= NULL;
    (pcg_data->precondData)	       	= NULL;
@@ -215,7 +215,9 @@ hypre_GMRESSetup( void *gmres_vdata,
    if ((gmres_data -> matvec_data) == NULL)
       (gmres_data -> matvec_data) = (*(gmres_functions->MatvecCreate))(A, x);
  
+   HYPRE_PROFILE_BEGIN("Krylov.precond_setup", -1);
    precond_setup(precond_data, A, b, x);
+   HYPRE_PROFILE_END("Krylov.precond_setup");
  
    /*-----------------------------------------------------
     * Allocate space for log info
@@ -306,6 +308,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
    guard_zero_residual = 0.0;
 
    (*(gmres_functions->CommInfo))(A,&my_id,&num_procs);
+   HYPRE_PROFILE_BEGIN("GMRES.solve", -1);
    if ( logging>0 || print_level>0 )
    {
       norms          = (gmres_data -> norms);
@@ -328,7 +331,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
    (*(gmres_functions->CopyVector))(b,p[0]);
 
    /* compute initial residual */
+   HYPRE_PROFILE_BEGIN("Krylov.matvec", -1);
    (*(gmres_functions->Matvec))(matvec_data,-1.0, A, x, 1.0, p[0]);
+   HYPRE_PROFILE_END("Krylov.matvec");
 
    b_norm = sqrt((*(gmres_functions->InnerProd))(b,b));
    real_r_norm_old = b_norm;
@@ -352,6 +357,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
       }
       hypre_error(HYPRE_ERROR_GENERIC);
+      HYPRE_PROFILE_END("GMRES.solve");
       return hypre_error_flag;
    }
 
@@ -377,6 +383,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
       }
       hypre_error(HYPRE_ERROR_GENERIC);
+      HYPRE_PROFILE_END("GMRES.solve");
       return hypre_error_flag;
    }
 
@@ -452,6 +459,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
            if (rel_change)  hypre_TFreeF(rs_2,gmres_functions);
            for (i=0; i < k_dim+1; i++) hypre_TFreeF(hh[i],gmres_functions);
            hypre_TFreeF(hh,gmres_functions); 
+	   HYPRE_PROFILE_END("GMRES.solve");
 	   return hypre_error_flag;
            
 	}
@@ -464,7 +472,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
                              * relative change is on*/
            {
               (*(gmres_functions->CopyVector))(b,r);
+              HYPRE_PROFILE_BEGIN("Krylov.matvec", -1);
               (*(gmres_functions->Matvec))(matvec_data,-1.0,A,x,1.0,r);
+              HYPRE_PROFILE_END("Krylov.matvec");
               r_norm = sqrt((*(gmres_functions->InnerProd))(r,r));
               if (r_norm  <= epsilon)
               {
@@ -493,8 +503,12 @@ hypre_GMRESSolve(void  *gmres_vdata,
            i++;
            iter++;
            (*(gmres_functions->ClearVector))(r);
+           HYPRE_PROFILE_BEGIN("Krylov.precond", -1);
            precond(precond_data, A, p[i-1], r);
+           HYPRE_PROFILE_END("Krylov.precond");
+           HYPRE_PROFILE_BEGIN("Krylov.matvec", -1);
            (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i]);
+           HYPRE_PROFILE_END("Krylov.matvec");
            /* modified Gram_Schmidt */
            for (j=0; j < i; j++)
            {
@@ -606,7 +620,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
                     
                  (*(gmres_functions->ClearVector))(r);
                  /* find correction (in r) */
+                 HYPRE_PROFILE_BEGIN("Krylov.precond", -1);
                  precond(precond_data, A, w, r);
+                 HYPRE_PROFILE_END("Krylov.precond");
                  /* copy current solution (x) to w (don't want to over-write x)*/
                  (*(gmres_functions->CopyVector))(x,w);
 
@@ -649,7 +665,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
                        (*(gmres_functions->Axpy))(rs_2[i-1], p[i-1], w);
                        (*(gmres_functions->ClearVector))(r);
                        /* apply the preconditioner */
+                       HYPRE_PROFILE_BEGIN("Krylov.precond", -1);
                        precond(precond_data, A, w, r);
+                       HYPRE_PROFILE_END("Krylov.precond");
                        /* now r contains x_i - x_i-1 */          
                     }
                     /* find the norm of x_i - x_i-1 */          
@@ -701,7 +719,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
 
 	(*(gmres_functions->ClearVector))(r);
 	/* find correction (in r) */
+        HYPRE_PROFILE_BEGIN("Krylov.precond", -1);
         precond(precond_data, A, w, r);
+        HYPRE_PROFILE_END("Krylov.precond");
 
         /* update current solution x (in x) */
 	(*(gmres_functions->Axpy))(1.0,r,x);
@@ -718,7 +738,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
 
            /* calculate actual residual norm*/
            (*(gmres_functions->CopyVector))(b,r);
+           HYPRE_PROFILE_BEGIN("Krylov.matvec", -1);
            (*(gmres_functions->Matvec))(matvec_data,-1.0,A,x,1.0,r);
+           HYPRE_PROFILE_END("Krylov.matvec");
            real_r_norm_new = r_norm = sqrt( (*(gmres_functions->InnerProd))(r,r) );
 
            if (r_norm <= epsilon)
@@ -743,7 +765,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
                     (*(gmres_functions->Axpy))(rs[i-1], p[i-1], w);
                     (*(gmres_functions->ClearVector))(r);
                     /* apply the preconditioner */
+                    HYPRE_PROFILE_BEGIN("Krylov.precond", -1);
                     precond(precond_data, A, w, r);
+                    HYPRE_PROFILE_END("Krylov.precond");
                     /* find the norm of x_i - x_i-1 */          
                     w_norm = sqrt( (*(gmres_functions->InnerProd))(r,r) );
                     relative_error= w_norm/x_norm;
@@ -845,6 +869,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
    }
    hypre_TFreeF(hh,gmres_functions); 
 
+   HYPRE_PROFILE_END("GMRES.solve");
    return hypre_error_flag;
 }
 
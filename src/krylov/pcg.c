@@ -220,7 +220,9 @@ hypre_PCGSetup( void *pcg_vdata,
       (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
    (pcg_data -> matvec_data) = (*(pcg_functions->MatvecCreate))(A, x);
 
+   HYPRE_PROFILE_BEGIN("Krylov.precond_setup", -1);
    precond_setup(precond_data, A, b, x);
+   HYPRE_PROFILE_END("Krylov.precond_setup");
 
    /*-----------------------------------------------------
     * Allocate space for log info
@@ -317,6 +319,7 @@ hypre_PCGSolve( void *pcg_vdata,
    (pcg_data -> converged) = 0;
 
    (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
+   HYPRE_PROFILE_BEGIN("PCG.solve", -1);
 
    /*-----------------------------------------------------------------------
     * With relative change convergence test on, it is possible to attempt
@@ -343,7 +346,9 @@ hypre_PCGSolve( void *pcg_vdata,
    {
       /* bi_prod = <C*b,b> */
       (*(pcg_functions->ClearVector))(p);
+      HYPRE_PROFILE_BEGIN("Krylov.precond", -1);
       precond(precond_data, A, b, p);
+      HYPRE_PROFILE_END("Krylov.precond");
       bi_prod = (*(pcg_functions->InnerProd))(p, b);
       if (print_level > 1 && my_id == 0)
           hypre_printf("<C*b,b>: %e\n",bi_prod);
@@ -368,6 +373,7 @@ hypre_PCGSolve( void *pcg_vdata,
         hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
       }
       hypre_error(HYPRE_ERROR_GENERIC);
+      HYPRE_PROFILE_END("PCG.solve");
       return hypre_error_flag;
    }
 
@@ -402,6 +408,7 @@ hypre_PCGSolve( void *pcg_vdata,
          rel_norms[i] = 0.0;
       }
 
+      HYPRE_PROFILE_END("PCG.solve");
       return hypre_error_flag;
       /* In this case, for the original parcsr pcg, the code would take special
          action to force iterations even though the exact value was known. */
@@ -410,12 +417,16 @@ hypre_PCGSolve( void *pcg_vdata,
    /* r = b - Ax */
    (*(pcg_functions->CopyVector))(b, r);
 
+   HYPRE_PROFILE_BEGIN("Krylov.matvec", -1);
    (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   HYPRE_PROFILE_END("Krylov.matvec");
 
    //hypre_ParVectorUpdateHost(r);
    /* p = C*r */
    (*(pcg_functions->ClearVector))(p);
+   HYPRE_PROFILE_BEGIN("Krylov.precond", -1);
    precond(precond_data, A, r, p);
+   HYPRE_PROFILE_END("Krylov.precond");
 
    /* gamma = <r,p> */
    gamma = (*(pcg_functions->InnerProd))(r,p);
@@ -439,6 +450,7 @@ hypre_PCGSolve( void *pcg_vdata,
         hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
       }
       hypre_error(HYPRE_ERROR_GENERIC);
+      HYPRE_PROFILE_END("PCG.solve");
       return hypre_error_flag;
    }
 
@@ -487,7 +499,9 @@ hypre_PCGSolve( void *pcg_vdata,
       recompute_true_residual = recompute_residual_p && !(i%recompute_residual_p);
 
       /* s = A*p */
+      HYPRE_PROFILE_BEGIN("Krylov.matvec", -1);
       (*(pcg_functions->Matvec))(matvec_data, 1.0, A, p, 0.0, s);
+      HYPRE_PROFILE_END("Krylov.matvec");
 
       /* alpha = gamma / <s,p> */
       sdotp = (*(pcg_functions->InnerProd))(s, p);
@@ -516,7 +530,9 @@ hypre_PCGSolve( void *pcg_vdata,
             hypre_printf("Recomputing the residual...\n");
          }
          (*(pcg_functions->CopyVector))(b, r);
+         HYPRE_PROFILE_BEGIN("Krylov.matvec", -1);
          (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         HYPRE_PROFILE_END("Krylov.matvec");
       }
 
       /* residual-based stopping criteria: ||r_new-r_old|| < rtol ||b|| */
@@ -536,7 +552,9 @@ hypre_PCGSolve( void *pcg_vdata,
 
       /* s = C*r */
       (*(pcg_functions->ClearVector))(s);
+      HYPRE_PROFILE_BEGIN("Krylov.precond", -1);
       precond(precond_data, A, r, s);
+      HYPRE_PROFILE_END("Krylov.precond");
 
       /* gamma = <r,s> */
       gamma = (*(pcg_functions->InnerProd))(r, s);
@@ -616,7 +634,9 @@ hypre_PCGSolve( void *pcg_vdata,
       {
          /* r = b - Ax */
          (*(pcg_functions->CopyVector))(b, r);
+         HYPRE_PROFILE_BEGIN("Krylov.matvec", -1);
          (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         HYPRE_PROFILE_END("Krylov.matvec");
 
          /* set i_prod for convergence test */
          if (two_norm)
@@ -625,7 +645,9 @@ hypre_PCGSolve( void *pcg_vdata,
          {
             /* s = C*r */
             (*(pcg_functions->ClearVector))(s);
+            HYPRE_PROFILE_BEGIN("Krylov.precond", -1);
             precond(precond_data, A, r, s);
+            HYPRE_PROFILE_END("Krylov.precond");
             /* iprod = gamma = <r,s> */
             i_prod = (*(pcg_functions->InnerProd))(r, s);
          }
@@ -722,6 +744,7 @@ hypre_PCGSolve( void *pcg_vdata,
    else /* actually, we'll never get here... */
       (pcg_data -> rel_residual_norm) = 0.0;
 
+   HYPRE_PROFILE_END("PCG.solve");
    return hypre_error_flag;
 }
 
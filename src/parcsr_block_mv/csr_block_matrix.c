@@ -583,6 +583,63 @@ hypre_CSRBlockMatrixBlockNorm(HYPRE_Int norm_type, HYPRE_Complex* data, HYPRE_Re
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRBlockMatrixBlockMultAddKernel
+ * (o = i1 * i2 + beta * o, see hypre_CSR_BLOCK_KERNEL)
+ *--------------------------------------------------------------------------*/
+hypre_CSR_BLOCK_KERNEL void
+hypre_CSRBlockMatrixBlockMultAddKernel(HYPRE_Complex* i1,
+                                       HYPRE_Complex* i2,
+                                       HYPRE_Complex beta,
+                                       HYPRE_Complex* o,
+                                       HYPRE_Int block_size)
+{
+   HYPRE_Int    i, j, k;
+   HYPRE_Complex ddata;
+
+   if (beta == 0.0)
+   {
+      for (i = 0; i < block_size; i++)
+      {
+         for (j = 0; j < block_size; j++)
+         {
+            ddata = 0.0;
+            for (k = 0; k < block_size; k++)
+            {
+               ddata += i1[i*block_size + k] * i2[k*block_size + j];
+            }
+            o[i*block_size + j] = ddata;
+         }
+      }
+   }
+   else if (beta == 1.0)
+   {
+      for(i = 0; i < block_size; i++)
+      {
+         for(j = 0; j < block_size; j++)
+         {
+            ddata = o[i*block_size + j];
+            for(k = 0; k < block_size; k++)
+               ddata += i1[i*block_size + k] * i2[k*block_size + j];
+            o[i*block_size + j] = ddata;
+         }
+      }
+   }
+   else
+   {
+      for(i = 0; i < block_size; i++)
+      {
+         for(j = 0; j < block_size; j++)
+         {
+            ddata = beta * o[i*block_size + j];
+            for(k = 0; k < block_size; k++)
+               ddata += i1[i*block_size + k] * i2[k*block_size + j];
+            o[i*block_size + j] = ddata;
+         }
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRBlockMatrixBlockMultAdd
  * (o = i1 * i2 + beta * o) 
@@ -602,53 +659,27 @@ hypre_CSRBlockMatrixBlockMultAdd(HYPRE_Complex* i1,
           &block_size, &beta, o, &block_size);
    }
 #else
+   switch (block_size)
    {
-      HYPRE_Int    i, j, k;
-      HYPRE_Complex ddata;
-
-      if (beta == 0.0)
-      {
-         for (i = 0; i < block_size; i++)
-         {
-            for (j = 0; j < block_size; j++)
-            {
-               ddata = 0.0;
-               for (k = 0; k < block_size; k++)
-               {
-                  ddata += i1[i*block_size + k] * i2[k*block_size + j];
-               }
-               o[i*block_size + j] = ddata;
-            }
-         }
-      }
-      else if (beta == 1.0)
-      {
-         for(i = 0; i < block_size; i++)
-         {
-            for(j = 0; j < block_size; j++)
-            {
-               ddata = o[i*block_size + j];
-               for(k = 0; k < block_size; k++)
-                  ddata += i1[i*block_size + k] * i2[k*block_size + j];
-               o[i*block_size + j] = ddata;
-            }
-         }
-      }
-      else
-      {
-         for(i = 0; i < block_size; i++)
-         {
-            for(j = 0; j < block_size; j++)
-            {
-               ddata = beta * o[i*block_size + j];
-               for(k = 0; k < block_size; k++)
-                  ddata += i1[i*block_size + k] * i2[k*block_size + j];
-               o[i*block_size + j] = ddata;
-            }
-         }
-      }
+      case 2:
+         hypre_CSRBlockMatrixBlockMultAddKernel(i1, i2, beta, o, 2);
+         break;
+      case 3:
+         hypre_CSRBlockMatrixBlockMultAddKernel(i1, i2, beta, o, 3);
+         break;
+      case 4:
+         hypre_CSRBlockMatrixBlockMultAddKernel(i1, i2, beta, o, 4);
+         break;
+      case 5:
+         hypre_CSRBlockMatrixBlockMultAddKernel(i1, i2, beta, o, 5);
+         break;
+      case 6:
+         hypre_CSRBlockMatrixBlockMultAddKernel(i1, i2, beta, o, 6);
+         break;
+      default:
+         hypre_CSRBlockMatrixBlockMultAddKernel(i1, i2, beta, o, block_size);
+         break;
    }
-   
 #endif
 
    return 0;
@@ -853,6 +884,72 @@ hypre_CSRBlockMatrixBlockMultAddDiag3(HYPRE_Complex* i1,
       
    return 0;
 }
+/*--------------------------------------------------------------------------
+ * hypre_CSRBlockMatrixBlockMatvecKernel
+ * (ov = alpha* mat * v + beta * ov, see hypre_CSR_BLOCK_KERNEL)
+ *--------------------------------------------------------------------------*/
+hypre_CSR_BLOCK_KERNEL void
+hypre_CSRBlockMatrixBlockMatvecKernel(HYPRE_Complex alpha,
+                                      HYPRE_Complex* mat,
+                                      HYPRE_Complex* v,
+                                      HYPRE_Complex beta,
+                                      HYPRE_Complex* ov,
+                                      HYPRE_Int block_size)
+{
+   HYPRE_Int    i, j;
+   HYPRE_Complex ddata;
+
+   /* if alpha = 0, then no matvec */
+   if (alpha == 0.0)
+   {
+      for (j = 0; j < block_size; j++)
+      {
+         ov[j] *= beta;
+      }
+      return;
+   }
+
+   /* ov = (beta/alpha) * ov; */
+   ddata = beta / alpha;
+   if (ddata != 1.0)
+   {
+      if (ddata == 0.0)
+      {
+         for (j = 0; j < block_size; j++)
+         {
+            ov[j] = 0.0;
+         }
+      }
+      else 
+      {
+         for (j = 0; j < block_size; j++)
+         {
+            ov[j] *= ddata;
+         }
+      }
+   }
+
+   /* ov = ov + mat*v */
+   for (i = 0; i < block_size; i++)
+   {
+      ddata =  ov[i];
+      for (j = 0; j < block_size; j++)
+      {
+         ddata += mat[i*block_size + j] * v[j];
+      }
+      ov[i] = ddata;
+   }
+
+   /* ov = alpha*ov */
+   if (alpha != 1.0)
+   {
+      for (j = 0; j < block_size; j++)
+      {
+         ov[j] *= alpha;
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRBlockMatrixBlockMatvec
  * (ov = alpha* mat * v + beta * ov)
@@ -879,68 +976,140 @@ hypre_CSRBlockMatrixBlockMatvec(HYPRE_Complex alpha,
    }
    
 #else
+   switch (block_size)
+   {
+      case 2:
+         hypre_CSRBlockMatrixBlockMatvecKernel(alpha, mat, v, beta, ov, 2);
+         break;
+      case 3:
+         hypre_CSRBlockMatrixBlockMatvecKernel(alpha, mat, v, beta, ov, 3);
+         break;
+      case 4:
+         hypre_CSRBlockMatrixBlockMatvecKernel(alpha, mat, v, beta, ov, 4);
+         break;
+      case 5:
+         hypre_CSRBlockMatrixBlockMatvecKernel(alpha, mat, v, beta, ov, 5);
+         break;
+      case 6:
+         hypre_CSRBlockMatrixBlockMatvecKernel(alpha, mat, v, beta, ov, 6);
+         break;
+      default:
+         hypre_CSRBlockMatrixBlockMatvecKernel(alpha, mat, v, beta, ov, block_size);
+         break;
+   }
+#endif
+
+   return ierr;
+   
+}
+
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBlockMatrixBlockInvMatvecKernel
+ * (ov = mat^{-1} * v by GE with partial pivoting, see hypre_CSR_BLOCK_KERNEL)
+ * mat_i is scratch space of size block_size^2
+ *--------------------------------------------------------------------------*/
+hypre_CSR_BLOCK_KERNEL HYPRE_Int
+hypre_CSRBlockMatrixBlockInvMatvecKernel(HYPRE_Complex* mat, HYPRE_Complex* v,
+                                         HYPRE_Complex* ov, HYPRE_Complex* mat_i,
+                                         HYPRE_Int block_size)
+{
+   HYPRE_Int m, j, k;
+   HYPRE_Int piv_row;
+   HYPRE_Real eps;
+   HYPRE_Complex factor;
+   HYPRE_Complex piv, tmp;
+   eps = 1.0e-6;
+
+   /* copy v to ov and mat to mat_i*/
+   for (k = 0; k < block_size; k++)   
    {
-      HYPRE_Int    i, j;
-      HYPRE_Complex ddata;
+      ov[k] = v[k];
+      for (j=0; j<block_size; j++)
+      {
+         mat_i[k*block_size + j] =  mat[k*block_size + j];
+      }
+   }
+   /* start ge  - turning m_i into U factor (don't save L - just apply to 
+      rhs - which is ov)*/
+   /* we do partial pivoting for size */
+
+   /* loop through the rows (row k) */ 
+   for (k = 0; k < block_size-1; k++)
+   {
+      piv = mat_i[k*block_size+k];
+      piv_row = k;
 
-      /* if alpha = 0, then no matvec */
-      if (alpha == 0.0)
+      /* find the largest pivot in position k*/
+      for (j=k+1; j < block_size; j++)         
       {
-         for (j = 0; j < block_size; j++)
+         if (hypre_cabs(mat_i[j*block_size+k]) > hypre_cabs(piv))
          {
-            ov[j] *= beta;
+            piv =  mat_i[j*block_size+k];
+            piv_row = j;
          }
-         return ierr;
+
       }
-      
-      /* ov = (beta/alpha) * ov; */
-      ddata = beta / alpha;
-      if (ddata != 1.0)
+      if (piv_row !=k) /* do a row exchange  - rows k and piv_row*/
       {
-         if (ddata == 0.0)
+         for (j=0; j < block_size; j++)
          {
-            for (j = 0; j < block_size; j++)
-            {
-               ov[j] = 0.0;
-            }
+            tmp = mat_i[k*block_size + j];
+            mat_i[k*block_size + j] = mat_i[piv_row*block_size + j];
+            mat_i[piv_row*block_size + j] = tmp;
          }
-         else 
+         tmp = ov[k];
+         ov[k] = ov[piv_row];
+         ov[piv_row] = tmp;
+      }
+      /* end of pivoting */
+
+      if (hypre_cabs(piv) > eps)
+      {
+         /* now we can factor into U */
+         for (j = k+1; j < block_size; j++)
          {
-            for (j = 0; j < block_size; j++)
+            factor = mat_i[j*block_size+k]/piv;
+            for (m = k+1; m < block_size; m++)
             {
-               ov[j] *= ddata;
+               mat_i[j*block_size+m]  -= factor * mat_i[k*block_size+m];
             }
+            /* Elimination step for rhs */ 
+            ov[j]  -= factor * ov[k];
          }
       }
-      
-      /* ov = ov + mat*v */
-      for (i = 0; i < block_size; i++)
+      else
       {
-         ddata =  ov[i];
-         for (j = 0; j < block_size; j++)
-         {
-            ddata += mat[i*block_size + j] * v[j];
-         }
-         ov[i] = ddata;
+         /* hypre_printf("Block of matrix is nearly singular: zero pivot error\n");  */
+         return(-1);
       }
-      
-      /* ov = alpha*ov */
-      if (alpha != 1.0)
+   }
+
+   /* we also need to check the pivot in the last row to see if it is zero */  
+   k = block_size - 1; /* last row */
+   if ( hypre_cabs(mat_i[k*block_size+k]) < eps)
+   {
+      /* hypre_printf("Block of matrix is nearly singular: zero pivot error\n");  */
+      return(-1);
+   }
+
+   /* Back Substitution  - do rhs (U is now in m_i1)*/
+   for (k = block_size-1; k > 0; --k)
+   {
+      ov[k] /= mat_i[k*block_size+k];
+      for (j = 0; j < k; j++)
       {
-         for (j = 0; j < block_size; j++)
+         if (mat_i[j*block_size+k] != 0.0)
          {
-            ov[j] *= alpha;
+            ov[j] -= ov[k] * mat_i[j*block_size+k];
          }
       }
    }
-   
-#endif
+   ov[0] /= mat_i[0];
 
-   return ierr;
-   
+   return 0;
 }
 
-
 /*--------------------------------------------------------------------------
  * hypre_CSRBlockMatrixBlockInvMatvec
  * (ov = mat^{-1} * v) 
@@ -952,18 +1121,17 @@ hypre_CSRBlockMatrixBlockInvMatvec(HYPRE_Complex* mat, HYPRE_Complex* v,
                                    HYPRE_Complex* ov, HYPRE_Int block_size)
 {
    HYPRE_Int ierr = 0;
-   HYPRE_Complex *mat_i;
-
-   mat_i = hypre_CTAlloc(HYPRE_Complex,  block_size*block_size, HYPRE_MEMORY_HOST);
 
 #if LB_VERSION
    {
 
+      HYPRE_Complex *mat_i;
       HYPRE_Int one, info;
       HYPRE_Int *piv;
       HYPRE_Int sz;
       
       
+      mat_i = hypre_CTAlloc(HYPRE_Complex,  block_size*block_size, HYPRE_MEMORY_HOST);
       one = 1;
       piv = hypre_CTAlloc(HYPRE_Int,  block_size, HYPRE_MEMORY_HOST);
       sz = block_size*block_size;
@@ -993,131 +1161,54 @@ hypre_CSRBlockMatrixBlockInvMatvec(HYPRE_Complex* mat, HYPRE_Complex* v,
          return(-1);
       }
 
+      hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
       hypre_TFree(piv, HYPRE_MEMORY_HOST);
 
    }
    
 #else
    {
-      HYPRE_Int m, j, k;
-      HYPRE_Int piv_row;
-      HYPRE_Real eps;
-      HYPRE_Complex factor;
-      HYPRE_Complex piv, tmp;
-      eps = 1.0e-6;
-      
-      if (block_size ==1 )
-      {
-         if (hypre_cabs(mat[0]) > 1e-10)
-         {
-            ov[0] = v[0]/mat[0];
-            hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
-            return(ierr);
-         }
-         else
-         {
-            /* hypre_printf("GE zero pivot error\n"); */
-            hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
-            return(-1);
-         }
-      }
-      else
+      /* small blocks are factored in stack scratch space - this is called
+         once per row in the block smoothers, so avoid the allocation */
+      HYPRE_Complex  mat_s[hypre_CSR_BLOCK_MAX_FIXED*hypre_CSR_BLOCK_MAX_FIXED];
+      HYPRE_Complex *mat_i;
+
+      switch (block_size)
       {
-         /* copy v to ov and mat to mat_i*/
-         for (k = 0; k < block_size; k++)   
-         {
-            ov[k] = v[k];
-            for (j=0; j<block_size; j++)
-            {
-               mat_i[k*block_size + j] =  mat[k*block_size + j];
-            }
-         }
-         /* start ge  - turning m_i into U factor (don't save L - just apply to 
-            rhs - which is ov)*/
-         /* we do partial pivoting for size */
-         
-         /* loop through the rows (row k) */ 
-         for (k = 0; k < block_size-1; k++)
-         {
-            piv = mat_i[k*block_size+k];
-            piv_row = k;
-            
-            /* find the largest pivot in position k*/
-            for (j=k+1; j < block_size; j++)         
+         case 1:
+            if (hypre_cabs(mat[0]) > 1e-10)
             {
-               if (hypre_cabs(mat_i[j*block_size+k]) > hypre_cabs(piv))
-               {
-                  piv =  mat_i[j*block_size+k];
-                  piv_row = j;
-               }
-               
-            }
-            if (piv_row !=k) /* do a row exchange  - rows k and piv_row*/
-            {
-               for (j=0; j < block_size; j++)
-               {
-                  tmp = mat_i[k*block_size + j];
-                  mat_i[k*block_size + j] = mat_i[piv_row*block_size + j];
-                  mat_i[piv_row*block_size + j] = tmp;
-               }
-               tmp = ov[k];
-               ov[k] = ov[piv_row];
-               ov[piv_row] = tmp;
-            }
-            /* end of pivoting */
-            
-            if (hypre_cabs(piv) > eps)
-            {
-               /* now we can factor into U */
-               for (j = k+1; j < block_size; j++)
-               {
-                  factor = mat_i[j*block_size+k]/piv;
-                  for (m = k+1; m < block_size; m++)
-                  {
-                     mat_i[j*block_size+m]  -= factor * mat_i[k*block_size+m];
-                  }
-                  /* Elimination step for rhs */ 
-                  ov[j]  -= factor * ov[k];
-               }
+               ov[0] = v[0]/mat[0];
             }
             else
             {
-               /* hypre_printf("Block of matrix is nearly singular: zero pivot error\n");  */
-               hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
-               return(-1);
+               /* hypre_printf("GE zero pivot error\n"); */
+               ierr = -1;
             }
-         }
-
-         /* we also need to check the pivot in the last row to see if it is zero */  
-         k = block_size - 1; /* last row */
-         if ( hypre_cabs(mat_i[k*block_size+k]) < eps)
-         {
-            /* hypre_printf("Block of matrix is nearly singular: zero pivot error\n");  */
+            break;
+         case 2:
+            ierr = hypre_CSRBlockMatrixBlockInvMatvecKernel(mat, v, ov, mat_s, 2);
+            break;
+         case 3:
+            ierr = hypre_CSRBlockMatrixBlockInvMatvecKernel(mat, v, ov, mat_s, 3);
+            break;
+         case 4:
+            ierr = hypre_CSRBlockMatrixBlockInvMatvecKernel(mat, v, ov, mat_s, 4);
+            break;
+         case 5:
+            ierr = hypre_CSRBlockMatrixBlockInvMatvecKernel(mat, v, ov, mat_s, 5);
+            break;
+         case 6:
+            ierr = hypre_CSRBlockMatrixBlockInvMatvecKernel(mat, v, ov, mat_s, 6);
+            break;
+         default:
+            mat_i = hypre_CTAlloc(HYPRE_Complex,  block_size*block_size, HYPRE_MEMORY_HOST);
+            ierr = hypre_CSRBlockMatrixBlockInvMatvecKernel(mat, v, ov, mat_i, block_size);
             hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
-            return(-1);
-         }
-         
-         /* Back Substitution  - do rhs (U is now in m_i1)*/
-         for (k = block_size-1; k > 0; --k)
-         {
-            ov[k] /= mat_i[k*block_size+k];
-            for (j = 0; j < k; j++)
-            {
-               if (mat_i[j*block_size+k] != 0.0)
-               {
-                  ov[j] -= ov[k] * mat_i[j*block_size+k];
-               }
-            }
-         }
-         ov[0] /= mat_i[0];
-         
+            break;
       }
-      
    }
 #endif
-  
-
-   hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
    
    return (ierr);
 }
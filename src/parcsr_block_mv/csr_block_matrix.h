@@ -60,6 +60,28 @@ typedef struct
 #define hypre_CSRBlockMatrixNumNonzeros(matrix)  ((matrix) -> num_nonzeros)
 #define hypre_CSRBlockMatrixOwnsData(matrix)     ((matrix) -> owns_data)
 
+/*--------------------------------------------------------------------------
+ * Small-block kernels
+ *
+ * The block matvec and the block helpers below (called once per block entry
+ * by the relaxation, interpolation and RAP routines) are written as kernels
+ * taking the block size as an argument.  For block sizes up to
+ * hypre_CSR_BLOCK_MAX_FIXED they are called with a literal size, so each
+ * size gets an inlined copy with fully unrolled loops that the compiler can
+ * vectorize.  Larger blocks use the generic loops.  The kernels must not
+ * contain OpenMP regions (these are outlined before inlining, with the block
+ * size as a runtime value), so the threaded loops calling them are written
+ * out once per literal size.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_CSR_BLOCK_MAX_FIXED 6
+
+#if defined(__GNUC__)
+#define hypre_CSR_BLOCK_KERNEL static inline __attribute__((always_inline))
+#else
+#define hypre_CSR_BLOCK_KERNEL static inline
+#endif
+
 /*--------------------------------------------------------------------------
  * other functions for the CSR Block Matrix structure
  *--------------------------------------------------------------------------*/
@@ -20,6 +20,66 @@
 #include "../seq_mv/seq_mv.h"
 #include <assert.h>
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRBlockMatrixMatvecRow
+ * (y_i += A_i*x for block row i, see hypre_CSR_BLOCK_KERNEL)
+ *
+ * The OpenMP loops over the rows are in the callers, one per literal block
+ * size: a parallel region inside an inlined kernel would be outlined before
+ * the kernel is inlined, leaving blk_size a runtime value.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSR_BLOCK_KERNEL void
+hypre_CSRBlockMatrixMatvecRow(HYPRE_Complex *A_data, HYPRE_Int *A_i,
+                              HYPRE_Int *A_j, HYPRE_Int i,
+                              HYPRE_Complex *x_data, HYPRE_Complex *y_data,
+                              HYPRE_Int blk_size)
+{
+   HYPRE_Int         b1, b2, jj, bnnz=blk_size*blk_size;
+   HYPRE_Complex     temp;
+
+   for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+   {
+      for (b1 = 0; b1 < blk_size; b1++)
+      {
+         temp = y_data[i*blk_size+b1];
+         for (b2 = 0; b2 < blk_size; b2++)
+            temp += A_data[jj*bnnz+b1*blk_size+b2] * x_data[A_j[jj]*blk_size+b2];
+         y_data[i*blk_size+b1] = temp;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBlockMatrixMatvecTRow
+ * (y += A_i^T*x_i for block row i, see hypre_CSRBlockMatrixMatvecRow)
+ *
+ * Different rows scatter into the same entries of y, so threads must use
+ * separate copies of y.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSR_BLOCK_KERNEL void
+hypre_CSRBlockMatrixMatvecTRow(HYPRE_Complex *A_data, HYPRE_Int *A_i,
+                               HYPRE_Int *A_j, HYPRE_Int i,
+                               HYPRE_Complex *x_data, HYPRE_Complex *y_data,
+                               HYPRE_Int blk_size)
+{
+   HYPRE_Int         j, jj, b1, b2, bnnz=blk_size*blk_size;
+
+   for (jj = A_i[i]; jj < A_i[i+1]; jj++) /*each nonzero in that row*/
+   {
+      j = A_j[jj]; /*col */
+      for (b1 = 0; b1 < blk_size; b1++) /*row */
+      {
+         for (b2 = 0; b2 < blk_size; b2++) /*col*/
+         {
+            y_data[j*blk_size+b2] +=
+               A_data[jj*bnnz+b1*blk_size+b2] * x_data[i*blk_size + b1];
+         }
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRBlockMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -40,7 +100,7 @@ hypre_CSRBlockMatrixMatvec(HYPRE_Complex alpha, hypre_CSRBlockMatrix *A,
    HYPRE_Int         x_size = hypre_VectorSize(x);
    HYPRE_Int         y_size = hypre_VectorSize(y);
 
-   HYPRE_Int         i, b1, b2, jj, bnnz=blk_size*blk_size;
+   HYPRE_Int         i;
    HYPRE_Int         ierr = 0;
    HYPRE_Complex     temp;
 
@@ -103,22 +163,50 @@ hypre_CSRBlockMatrixMatvec(HYPRE_Complex alpha, hypre_CSRBlockMatrix *A,
     * y += A*x
     *-----------------------------------------------------------------*/
 
+   switch (blk_size)
+   {
+      case 2:
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,jj,b1,b2,temp) HYPRE_SMP_SCHEDULE
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
-
-   for (i = 0; i < num_rows; i++)
-   {
-      for (jj = A_i[i]; jj < A_i[i+1]; jj++)
-      {
-         for (b1 = 0; b1 < blk_size; b1++)
-         {
-            temp = y_data[i*blk_size+b1];
-            for (b2 = 0; b2 < blk_size; b2++)
-               temp += A_data[jj*bnnz+b1*blk_size+b2] * x_data[A_j[jj]*blk_size+b2];
-            y_data[i*blk_size+b1] = temp;
-         }
-      }
+         for (i = 0; i < num_rows; i++)
+            hypre_CSRBlockMatrixMatvecRow(A_data, A_i, A_j, i, x_data, y_data, 2);
+         break;
+      case 3:
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+            hypre_CSRBlockMatrixMatvecRow(A_data, A_i, A_j, i, x_data, y_data, 3);
+         break;
+      case 4:
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+            hypre_CSRBlockMatrixMatvecRow(A_data, A_i, A_j, i, x_data, y_data, 4);
+         break;
+      case 5:
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+            hypre_CSRBlockMatrixMatvecRow(A_data, A_i, A_j, i, x_data, y_data, 5);
+         break;
+      case 6:
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+            hypre_CSRBlockMatrixMatvecRow(A_data, A_i, A_j, i, x_data, y_data, 6);
+         break;
+      default:
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+            hypre_CSRBlockMatrixMatvecRow(A_data, A_i, A_j, i, x_data, y_data, blk_size);
+         break;
    }
 
    /*-----------------------------------------------------------------
@@ -165,13 +253,12 @@ hypre_CSRBlockMatrixMatvecT( HYPRE_Complex         alpha,
    HYPRE_Int         y_size = hypre_VectorSize(y);
 
    HYPRE_Complex     temp;
+   HYPRE_Complex    *y_work;
    
-   HYPRE_Int         i, j, jj;
+   HYPRE_Int         i, j, num_threads, work_size;
    HYPRE_Int         ierr  = 0;
-   HYPRE_Int         b1, b2;
    
    HYPRE_Int         blk_size = hypre_CSRBlockMatrixBlockSize(A);
-   HYPRE_Int         bnnz=blk_size*blk_size;
 
    /*---------------------------------------------------------------------
     *  Check for size compatibility.  MatvecT returns ierr = 1 if
@@ -237,24 +324,82 @@ hypre_CSRBlockMatrixMatvecT( HYPRE_Complex         alpha,
     * y += A^T*x
     *-----------------------------------------------------------------*/
  
+   num_threads = hypre_NumThreads();
+   if (num_threads > 1)
+   {
+      /* one copy of y per thread, summed below */
+      work_size = num_cols*blk_size;
+      y_work = hypre_CTAlloc(HYPRE_Complex, num_threads*work_size, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      y_work = y_data;
+      work_size = 0;
+   }
+
+   switch (blk_size)
+   {
+      case 2:
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i, jj,j, b1, b2) HYPRE_SMP_SCHEDULE
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
-    
-   for (i = 0; i < num_rows; i++)
+         for (i = 0; i < num_rows; i++)
+            hypre_CSRBlockMatrixMatvecTRow(A_data, A_i, A_j, i, x_data,
+                                           y_work + hypre_GetThreadNum()*work_size, 2);
+         break;
+      case 3:
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+            hypre_CSRBlockMatrixMatvecTRow(A_data, A_i, A_j, i, x_data,
+                                           y_work + hypre_GetThreadNum()*work_size, 3);
+         break;
+      case 4:
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+            hypre_CSRBlockMatrixMatvecTRow(A_data, A_i, A_j, i, x_data,
+                                           y_work + hypre_GetThreadNum()*work_size, 4);
+         break;
+      case 5:
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+            hypre_CSRBlockMatrixMatvecTRow(A_data, A_i, A_j, i, x_data,
+                                           y_work + hypre_GetThreadNum()*work_size, 5);
+         break;
+      case 6:
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+            hypre_CSRBlockMatrixMatvecTRow(A_data, A_i, A_j, i, x_data,
+                                           y_work + hypre_GetThreadNum()*work_size, 6);
+         break;
+      default:
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+            hypre_CSRBlockMatrixMatvecTRow(A_data, A_i, A_j, i, x_data,
+                                           y_work + hypre_GetThreadNum()*work_size, blk_size);
+         break;
+   }
+
+   if (num_threads > 1)
    {
-      for (jj = A_i[i]; jj < A_i[i+1]; jj++) /*each nonzero in that row*/
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < work_size; i++)
       {
-         for (b1 = 0; b1 < blk_size; b1++) /*row */
-         {
-            for (b2 = 0; b2 < blk_size; b2++) /*col*/
-            {
-               j = A_j[jj]; /*col */
-               y_data[j*blk_size+b2] +=
-                  A_data[jj*bnnz+b1*blk_size+b2] * x_data[i*blk_size + b1];
-            }
-         }
+         for (j = 0; j < num_threads; j++)
+            y_data[i] += y_work[j*work_size + i];
       }
+      hypre_TFree(y_work, HYPRE_MEMORY_HOST);
    }
       
    /*-----------------------------------------------------------------
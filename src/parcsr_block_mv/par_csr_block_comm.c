@@ -103,6 +103,15 @@ hypre_ParCSRBlockCommHandleCreate(HYPRE_Int job,
       }
    }
 
+   if (hypre_comm_stats_active && (job == 1 || job == 2))
+   {
+      hypre_ParCSRCommPkgNumExchanges(comm_pkg) ++;
+      hypre_ParCSRCommPkgNumMessages(comm_pkg) += (job == 1) ? num_sends : num_recvs;
+      hypre_ParCSRCommPkgNumBytes(comm_pkg) += (HYPRE_Real) bnnz * sizeof(HYPRE_Complex) *
+         ((job == 1) ? hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) :
+                       hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs));
+   }
+
    /*--------------------------------------------------------------------
     * set up comm_handle and return
     *--------------------------------------------------------------------*/
@@ -125,6 +134,7 @@ HYPRE_Int
 hypre_ParCSRBlockCommHandleDestroy(hypre_ParCSRCommHandle *comm_handle)
 {
    hypre_MPI_Status          *status0;
+   HYPRE_Real                 wait_start = 0.0;
 
    if ( comm_handle==NULL ) return hypre_error_flag;
 
@@ -132,8 +142,17 @@ hypre_ParCSRBlockCommHandleDestroy(hypre_ParCSRCommHandle *comm_handle)
    {
       status0 = hypre_CTAlloc(hypre_MPI_Status, 
                               hypre_ParCSRCommHandleNumRequests(comm_handle), HYPRE_MEMORY_HOST);
+      if (hypre_comm_stats_active)
+      {
+         wait_start = hypre_MPI_Wtime();
+      }
       hypre_MPI_Waitall(hypre_ParCSRCommHandleNumRequests(comm_handle),
                         hypre_ParCSRCommHandleRequests(comm_handle), status0);
+      if (hypre_comm_stats_active && hypre_ParCSRCommHandleCommPkg(comm_handle))
+      {
+         hypre_ParCSRCommPkgWaitTime(hypre_ParCSRCommHandleCommPkg(comm_handle)) +=
+            hypre_MPI_Wtime() - wait_start;
+      }
       hypre_TFree(status0, HYPRE_MEMORY_HOST);
    }
 
@@ -226,6 +226,36 @@ hypre_F90_IFACE(hypre_euclidsetilut, HYPRE_EUCLIDSETILUT)
       hypre_F90_PassReal (drop_tol) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_EuclidSetFactorSweeps
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_euclidsetfactorsweeps, HYPRE_EUCLIDSETFACTORSWEEPS)
+   (hypre_F90_Obj *solver,
+    hypre_F90_Int *sweeps,
+    hypre_F90_Int *ierr)
+{
+   *ierr = (hypre_F90_Int) HYPRE_EuclidSetFactorSweeps(
+      hypre_F90_PassObj (HYPRE_Solver, solver),
+      hypre_F90_PassInt (sweeps) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_EuclidSetTriSolveSweeps
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_euclidsettrisolvesweeps, HYPRE_EUCLIDSETTRISOLVESWEEPS)
+   (hypre_F90_Obj *solver,
+    hypre_F90_Int *sweeps,
+    hypre_F90_Int *ierr)
+{
+   *ierr = (hypre_F90_Int) HYPRE_EuclidSetTriSolveSweeps(
+      hypre_F90_PassObj (HYPRE_Solver, solver),
+      hypre_F90_PassInt (sweeps) );
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -243,6 +243,17 @@ HYPRE_Int HYPRE_ADSSetAMGOptions(HYPRE_Solver solver,
                                  Pmax);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ADSSetAMGBlockMode
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int HYPRE_ADSSetAMGBlockMode(HYPRE_Solver solver,
+                                   HYPRE_Int block_mode)
+{
+   return hypre_ADSSetAMGBlockMode((void *) solver,
+                                   block_mode);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ADSGetNumIterations
  *--------------------------------------------------------------------------*/
@@ -177,6 +177,28 @@ HYPRE_Int HYPRE_AMSSetProjectionFrequency(HYPRE_Solver solver,
                                           projection_frequency);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_AMSSetNumericRefresh
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int HYPRE_AMSSetNumericRefresh(HYPRE_Solver solver,
+                                     HYPRE_Int numeric_refresh)
+{
+   return hypre_AMSSetNumericRefresh((void *) solver,
+                                     numeric_refresh);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_AMSSetConcurrentSubspaces
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int HYPRE_AMSSetConcurrentSubspaces(HYPRE_Solver solver,
+                                          HYPRE_Int concurrent_subspaces)
+{
+   return hypre_AMSSetConcurrentSubspaces((void *) solver,
+                                          concurrent_subspaces);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_AMSSetMaxIter
  *--------------------------------------------------------------------------*/
@@ -279,6 +301,17 @@ HYPRE_Int HYPRE_AMSSetAlphaAMGCoarseRelaxType(HYPRE_Solver solver,
                                               alpha_coarse_relax_type);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_AMSSetAlphaAMGBlockMode
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int HYPRE_AMSSetAlphaAMGBlockMode(HYPRE_Solver solver,
+                                        HYPRE_Int alpha_block_mode)
+{
+   return hypre_AMSSetAlphaAMGBlockMode((void *) solver,
+                                        alpha_block_mode);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_AMSSetBetaAMGOptions
  *--------------------------------------------------------------------------*/
@@ -417,3 +417,24 @@ HYPRE_EuclidSetILUT(HYPRE_Solver solver,
   END_FUNC_VAL(0)
 }
 
+HYPRE_Int
+HYPRE_EuclidSetFactorSweeps(HYPRE_Solver solver,
+                            HYPRE_Int    sweeps)
+{
+  char str_sweeps[8];
+  START_FUNC_DH
+  hypre_sprintf(str_sweeps,"%d",sweeps);
+  Parser_dhInsert(parser_dh, "-factorSweeps", str_sweeps); HYPRE_EUCLID_ERRCHKA;
+  END_FUNC_VAL(0)
+}
+
+HYPRE_Int
+HYPRE_EuclidSetTriSolveSweeps(HYPRE_Solver solver,
+                              HYPRE_Int    sweeps)
+{
+  char str_sweeps[8];
+  START_FUNC_DH
+  hypre_sprintf(str_sweeps,"%d",sweeps);
+  Parser_dhInsert(parser_dh, "-triSweeps", str_sweeps); HYPRE_EUCLID_ERRCHKA;
+  END_FUNC_VAL(0)
+}
@@ -1479,6 +1479,19 @@ HYPRE_BoomerAMGSetCoordinates (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetCoordinates ( (void *) solver, coordinates ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetStructCoordinates
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetStructCoordinates (HYPRE_Solver  solver,
+                                     HYPRE_Int     ndim,
+                                     HYPRE_Int    *region,
+                                     HYPRE_Int    *index)
+{
+   return (hypre_BoomerAMGSetStructCoordinates ( (void *) solver, ndim, region, index ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetChebyOrder
  *--------------------------------------------------------------------------*/
@@ -1728,6 +1741,43 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetReuseInterp
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetReuseInterp (HYPRE_Solver solver,
+                               HYPRE_Int    reuse_interp)
+{
+   return (hypre_BoomerAMGSetReuseInterp ( (void *) solver, reuse_interp ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetCommStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetCommStats (HYPRE_Solver solver,
+                             HYPRE_Int    comm_stats)
+{
+   return (hypre_BoomerAMGSetCommStats ( (void *) solver, comm_stats ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGPrintCommStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGPrintCommStats (HYPRE_Solver solver)
+{
+   if (!solver)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   return (hypre_BoomerAMGCommStats ( (void *) solver ) );
+}
+
 #ifdef HAVE_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
@@ -141,6 +141,409 @@ aux_indexFromMask( HYPRE_Int n, HYPRE_Int* mask, HYPRE_Int* index ) {
 }
 
 
+/* ParCSR multivector kernels.
+
+   The vectors of a ParCSR temporary multivector all have the same
+   parallel layout, so block operations can work directly on the local
+   arrays: the local parts of all products are computed in one cache
+   blocked pass over the rows (HYPRE_PARCSR_MV_BLOCK rows at a time) and
+   the Gram matrices need a single allreduce instead of one per entry. */
+
+#define HYPRE_PARCSR_MV_BLOCK 256
+
+static HYPRE_Int
+hypre_ParCSRMultiVectorCollect( mv_TempMultiVector* x, HYPRE_Complex** px ) {
+
+  HYPRE_Int i, m;
+
+  for ( i = m = 0; i < x->numVectors; i++ )
+    if ( x->mask == NULL || x->mask[i] )
+      px[m++] = hypre_VectorData(hypre_ParVectorLocalVector(
+                                   (hypre_ParVector*)x->vector[i]));
+
+  return m;
+}
+
+static HYPRE_Int
+hypre_ParCSRMultiVectorLocalSize( mv_TempMultiVector* x ) {
+
+  if ( x->numVectors < 1 )
+    return 0;
+
+  return hypre_VectorSize(hypre_ParVectorLocalVector(
+                            (hypre_ParVector*)x->vector[0]));
+}
+
+/* xy = x'*y, one allreduce for the whole block */
+
+void
+hypre_ParCSRMultiVectorByMultiVector( void* x_, void* y_,
+                                      HYPRE_Int xyGHeight, HYPRE_Int xyHeight,
+                                      HYPRE_Int xyWidth, HYPRE_Complex* xyVal ) {
+
+  HYPRE_Int i, j, mx, my, n;
+  HYPRE_Complex** px;
+  HYPRE_Complex** py;
+  HYPRE_Complex* local;
+  HYPRE_Complex* global;
+  mv_TempMultiVector* x;
+  mv_TempMultiVector* y;
+  MPI_Comm comm;
+
+  x = (mv_TempMultiVector*)x_;
+  y = (mv_TempMultiVector*)y_;
+  hypre_assert( x != NULL && y != NULL );
+
+  px = hypre_CTAlloc(HYPRE_Complex*, x->numVectors, HYPRE_MEMORY_HOST);
+  py = hypre_CTAlloc(HYPRE_Complex*, y->numVectors, HYPRE_MEMORY_HOST);
+  mx = hypre_ParCSRMultiVectorCollect( x, px );
+  my = hypre_ParCSRMultiVectorCollect( y, py );
+  hypre_assert( mx == xyHeight && my == xyWidth );
+
+  if ( mx < 1 || my < 1 ) {
+    hypre_TFree(px, HYPRE_MEMORY_HOST);
+    hypre_TFree(py, HYPRE_MEMORY_HOST);
+    return;
+  }
+
+  n = hypre_ParCSRMultiVectorLocalSize( x );
+  comm = hypre_ParVectorComm((hypre_ParVector*)x->vector[0]);
+
+  local = hypre_CTAlloc(HYPRE_Complex, mx*my, HYPRE_MEMORY_HOST);
+  global = hypre_CTAlloc(HYPRE_Complex, mx*my, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_PROFILE
+  hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,j)
+#endif
+  {
+    HYPRE_Int begin, end, r, r0, r1;
+    HYPRE_Complex s;
+    HYPRE_Complex* acc;
+
+    hypre_GetSimpleThreadPartition( &begin, &end, n );
+    acc = hypre_CTAlloc(HYPRE_Complex, mx*my, HYPRE_MEMORY_HOST);
+
+    for ( r0 = begin; r0 < end; r0 += HYPRE_PARCSR_MV_BLOCK ) {
+      r1 = hypre_min( end, r0 + HYPRE_PARCSR_MV_BLOCK );
+      for ( j = 0; j < my; j++ )
+        for ( i = 0; i < mx; i++ ) {
+          s = 0.0;
+          for ( r = r0; r < r1; r++ )
+            s += hypre_conj(py[j][r]) * px[i][r];
+          acc[i + j*mx] += s;
+        }
+    }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical
+#endif
+    for ( i = 0; i < mx*my; i++ )
+      local[i] += acc[i];
+
+    hypre_TFree(acc, HYPRE_MEMORY_HOST);
+  }
+
+#ifdef HYPRE_PROFILE
+  hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+  hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+
+  hypre_MPI_Allreduce( local, global, mx*my, HYPRE_MPI_COMPLEX,
+                       hypre_MPI_SUM, comm );
+
+#ifdef HYPRE_PROFILE
+  hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+  for ( j = 0; j < my; j++ )
+    for ( i = 0; i < mx; i++ )
+      xyVal[i + j*xyGHeight] = global[i + j*mx];
+
+  hypre_TFree(local, HYPRE_MEMORY_HOST);
+  hypre_TFree(global, HYPRE_MEMORY_HOST);
+  hypre_TFree(px, HYPRE_MEMORY_HOST);
+  hypre_TFree(py, HYPRE_MEMORY_HOST);
+}
+
+/* diag = diag(x'*y), one allreduce for all entries */
+
+void
+hypre_ParCSRMultiVectorByMultiVectorDiag( void* x_, void* y_,
+                                          HYPRE_Int* mask, HYPRE_Int n,
+                                          HYPRE_Complex* diag ) {
+
+  HYPRE_Int i, r, m, mx, my, size;
+  HYPRE_Complex** px;
+  HYPRE_Complex** py;
+  HYPRE_Complex* local;
+  HYPRE_Complex* global;
+  HYPRE_Complex s;
+  HYPRE_Int* index;
+  mv_TempMultiVector* x;
+  mv_TempMultiVector* y;
+
+  x = (mv_TempMultiVector*)x_;
+  y = (mv_TempMultiVector*)y_;
+  hypre_assert( x != NULL && y != NULL );
+
+  px = hypre_CTAlloc(HYPRE_Complex*, x->numVectors, HYPRE_MEMORY_HOST);
+  py = hypre_CTAlloc(HYPRE_Complex*, y->numVectors, HYPRE_MEMORY_HOST);
+  mx = hypre_ParCSRMultiVectorCollect( x, px );
+  my = hypre_ParCSRMultiVectorCollect( y, py );
+  m = aux_maskCount( n, mask );
+  hypre_assert( mx == my && mx == m );
+  (void) mx; (void) my; /* only checked in debug builds */
+
+  if ( m < 1 ) {
+    hypre_TFree(px, HYPRE_MEMORY_HOST);
+    hypre_TFree(py, HYPRE_MEMORY_HOST);
+    return;
+  }
+
+  size = hypre_ParCSRMultiVectorLocalSize( x );
+  local = hypre_CTAlloc(HYPRE_Complex, m, HYPRE_MEMORY_HOST);
+  global = hypre_CTAlloc(HYPRE_Complex, m, HYPRE_MEMORY_HOST);
+
+  for ( i = 0; i < m; i++ ) {
+    s = 0.0;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(r) reduction(+:s) HYPRE_SMP_SCHEDULE
+#endif
+    for ( r = 0; r < size; r++ )
+      s += hypre_conj(py[i][r]) * px[i][r];
+    local[i] = s;
+  }
+
+#ifdef HYPRE_PROFILE
+  hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+
+  hypre_MPI_Allreduce( local, global, m, HYPRE_MPI_COMPLEX, hypre_MPI_SUM,
+                       hypre_ParVectorComm((hypre_ParVector*)x->vector[0]) );
+
+#ifdef HYPRE_PROFILE
+  hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+  index = hypre_CTAlloc(HYPRE_Int, m, HYPRE_MEMORY_HOST);
+  aux_indexFromMask( n, mask, index );
+  for ( i = 0; i < m; i++ )
+    diag[index[i]-1] = global[i];
+
+  hypre_TFree(index, HYPRE_MEMORY_HOST);
+  hypre_TFree(local, HYPRE_MEMORY_HOST);
+  hypre_TFree(global, HYPRE_MEMORY_HOST);
+  hypre_TFree(px, HYPRE_MEMORY_HOST);
+  hypre_TFree(py, HYPRE_MEMORY_HOST);
+}
+
+/* y = x*r (clear_y != 0) or y = x*r + y (clear_y == 0) */
+
+static void
+hypre_ParCSRMultiVectorByMatrixAux( void* x_,
+                                    HYPRE_Int rGHeight, HYPRE_Int rHeight,
+                                    HYPRE_Int rWidth, HYPRE_Complex* rVal,
+                                    void* y_, HYPRE_Int clear_y ) {
+
+  HYPRE_Int i, j, mx, my, n;
+  HYPRE_Complex** px;
+  HYPRE_Complex** py;
+  mv_TempMultiVector* x;
+  mv_TempMultiVector* y;
+
+  x = (mv_TempMultiVector*)x_;
+  y = (mv_TempMultiVector*)y_;
+  hypre_assert( x != NULL && y != NULL );
+
+  px = hypre_CTAlloc(HYPRE_Complex*, x->numVectors, HYPRE_MEMORY_HOST);
+  py = hypre_CTAlloc(HYPRE_Complex*, y->numVectors, HYPRE_MEMORY_HOST);
+  mx = hypre_ParCSRMultiVectorCollect( x, px );
+  my = hypre_ParCSRMultiVectorCollect( y, py );
+  hypre_assert( mx == rHeight && my == rWidth );
+
+  n = hypre_ParCSRMultiVectorLocalSize( y );
+
+#ifdef HYPRE_PROFILE
+  hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,j)
+#endif
+  {
+    HYPRE_Int begin, end, r, r0, r1;
+    HYPRE_Complex c;
+
+    hypre_GetSimpleThreadPartition( &begin, &end, n );
+
+    for ( r0 = begin; r0 < end; r0 += HYPRE_PARCSR_MV_BLOCK ) {
+      r1 = hypre_min( end, r0 + HYPRE_PARCSR_MV_BLOCK );
+      for ( j = 0; j < my; j++ ) {
+        if ( clear_y )
+          for ( r = r0; r < r1; r++ )
+            py[j][r] = 0.0;
+        for ( i = 0; i < mx; i++ ) {
+          c = rVal[i + j*rGHeight];
+          for ( r = r0; r < r1; r++ )
+            py[j][r] += c * px[i][r];
+        }
+      }
+    }
+  }
+
+#ifdef HYPRE_PROFILE
+  hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+  hypre_TFree(px, HYPRE_MEMORY_HOST);
+  hypre_TFree(py, HYPRE_MEMORY_HOST);
+}
+
+void
+hypre_ParCSRMultiVectorByMatrix( void* x_,
+                                 HYPRE_Int rGHeight, HYPRE_Int rHeight,
+                                 HYPRE_Int rWidth, HYPRE_Complex* rVal,
+                                 void* y_ ) {
+
+  hypre_ParCSRMultiVectorByMatrixAux( x_, rGHeight, rHeight, rWidth, rVal,
+                                      y_, 1 );
+}
+
+void
+hypre_ParCSRMultiVectorXapy( void* x_,
+                             HYPRE_Int rGHeight, HYPRE_Int rHeight,
+                             HYPRE_Int rWidth, HYPRE_Complex* rVal,
+                             void* y_ ) {
+
+  hypre_ParCSRMultiVectorByMatrixAux( x_, rGHeight, rHeight, rWidth, rVal,
+                                      y_, 0 );
+}
+
+/* Matrix by multivector product for LOBPCG (cf. HYPRE_MatvecFunctions).
+   The active vectors are packed into a contiguous ParCSR multivector so
+   that A is applied to all of them in one hypre_ParCSRMatrixMatvec. */
+
+typedef struct {
+  hypre_ParVector* x;
+  hypre_ParVector* y;
+} hypre_ParCSRMatMultiVecData;
+
+void*
+hypre_ParCSRMatMultiVecCreate( void* A, void* x ) {
+
+  return (void*)hypre_CTAlloc(hypre_ParCSRMatMultiVecData, 1, HYPRE_MEMORY_HOST);
+}
+
+HYPRE_Int
+hypre_ParCSRMatMultiVecDestroy( void* data_ ) {
+
+  hypre_ParCSRMatMultiVecData* data = (hypre_ParCSRMatMultiVecData*)data_;
+
+  if ( data != NULL ) {
+    if ( data->x != NULL )
+      hypre_ParVectorDestroy( data->x );
+    if ( data->y != NULL )
+      hypre_ParVectorDestroy( data->y );
+    hypre_TFree(data, HYPRE_MEMORY_HOST);
+  }
+
+  return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParCSRMatMultiVec( void* data_, HYPRE_Complex alpha, void* A_,
+                         void* x_, HYPRE_Complex beta, void* y_ ) {
+
+  hypre_ParCSRMatMultiVecData* data = (hypre_ParCSRMatMultiVecData*)data_;
+  hypre_ParCSRMatrix* A = (hypre_ParCSRMatrix*)A_;
+  mv_TempMultiVector* x = (mv_TempMultiVector*)x_;
+  mv_TempMultiVector* y = (mv_TempMultiVector*)y_;
+  HYPRE_Complex** px;
+  HYPRE_Complex** py;
+  HYPRE_Complex* xw;
+  HYPRE_Complex* yw;
+  HYPRE_Int i, r, mx, my, nx, ny;
+
+  hypre_assert( data != NULL && x != NULL && y != NULL );
+
+  px = hypre_CTAlloc(HYPRE_Complex*, x->numVectors, HYPRE_MEMORY_HOST);
+  py = hypre_CTAlloc(HYPRE_Complex*, y->numVectors, HYPRE_MEMORY_HOST);
+  mx = hypre_ParCSRMultiVectorCollect( x, px );
+  my = hypre_ParCSRMultiVectorCollect( y, py );
+  hypre_assert( mx == my );
+  (void) my; /* only checked in debug builds */
+
+  if ( mx < 1 ) {
+    hypre_TFree(px, HYPRE_MEMORY_HOST);
+    hypre_TFree(py, HYPRE_MEMORY_HOST);
+    return hypre_error_flag;
+  }
+
+  nx = hypre_ParCSRMultiVectorLocalSize( x );
+  ny = hypre_ParCSRMultiVectorLocalSize( y );
+
+  /* (re)create the work multivectors when the number of active vectors
+     changes */
+  if ( data->x == NULL || hypre_ParVectorNumVectors(data->x) != mx ) {
+    hypre_ParVector* sx = (hypre_ParVector*)x->vector[0];
+    hypre_ParVector* sy = (hypre_ParVector*)y->vector[0];
+
+    if ( data->x != NULL )
+      hypre_ParVectorDestroy( data->x );
+    if ( data->y != NULL )
+      hypre_ParVectorDestroy( data->y );
+
+    data->x = hypre_ParMultiVectorCreate( hypre_ParVectorComm(sx),
+                                          hypre_ParVectorGlobalSize(sx),
+                                          hypre_ParVectorPartitioning(sx), mx );
+    hypre_ParVectorInitialize( data->x );
+    hypre_ParVectorSetPartitioningOwner( data->x, 0 );
+    data->y = hypre_ParMultiVectorCreate( hypre_ParVectorComm(sy),
+                                          hypre_ParVectorGlobalSize(sy),
+                                          hypre_ParVectorPartitioning(sy), mx );
+    hypre_ParVectorInitialize( data->y );
+    hypre_ParVectorSetPartitioningOwner( data->y, 0 );
+  }
+
+  xw = hypre_VectorData(hypre_ParVectorLocalVector(data->x));
+  yw = hypre_VectorData(hypre_ParVectorLocalVector(data->y));
+
+  for ( i = 0; i < mx; i++ ) {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+    for ( r = 0; r < nx; r++ )
+      xw[i*nx + r] = px[i][r];
+  }
+  if ( beta != 0.0 )
+    for ( i = 0; i < mx; i++ ) {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+      for ( r = 0; r < ny; r++ )
+        yw[i*ny + r] = py[i][r];
+    }
+
+  hypre_ParCSRMatrixMatvec( alpha, A, data->x, beta, data->y );
+
+  for ( i = 0; i < mx; i++ ) {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+    for ( r = 0; r < ny; r++ )
+      py[i][r] = yw[i*ny + r];
+  }
+
+  hypre_TFree(px, HYPRE_MEMORY_HOST);
+  hypre_TFree(py, HYPRE_MEMORY_HOST);
+
+  return hypre_error_flag;
+}
+
 /* The function below is a temporary one that fills the multivector 
    part of the HYPRE_InterfaceInterpreter structure with pointers 
    that come from the temporary implementation of the multivector 
@@ -186,10 +589,20 @@ HYPRE_TempParCSRSetupInterpreter( mv_InterfaceInterpreter *i )
   return 0;
 }
 
+/* Same as above, but the block products use the ParCSR multivector
+   kernels (one allreduce per Gram block) */
+
 HYPRE_Int
 HYPRE_ParCSRSetupInterpreter( mv_InterfaceInterpreter *i )
 {
-  return HYPRE_TempParCSRSetupInterpreter( i );
+  HYPRE_TempParCSRSetupInterpreter( i );
+
+  i->MultiInnerProd = hypre_ParCSRMultiVectorByMultiVector;
+  i->MultiInnerProdDiag = hypre_ParCSRMultiVectorByMultiVectorDiag;
+  i->MultiVecMat = hypre_ParCSRMultiVectorByMatrix;
+  i->MultiXapy = hypre_ParCSRMultiVectorXapy;
+
+  return 0;
 }
 
 HYPRE_Int 
@@ -199,9 +612,9 @@ HYPRE_ParCSRSetupMatvec(HYPRE_MatvecFunctions * mv)
   mv->Matvec = hypre_ParKrylovMatvec;
   mv->MatvecDestroy = hypre_ParKrylovMatvecDestroy;
 
-  mv->MatMultiVecCreate = NULL;
-  mv->MatMultiVec = NULL;
-  mv->MatMultiVecDestroy = NULL;
+  mv->MatMultiVecCreate = hypre_ParCSRMatMultiVecCreate;
+  mv->MatMultiVec = hypre_ParCSRMatMultiVec;
+  mv->MatMultiVecDestroy = hypre_ParCSRMatMultiVecDestroy;
 
   return 0;
 }
@@ -109,6 +109,9 @@ HYPRE_Int HYPRE_BoomerAMGSetup(HYPRE_Solver       solver,
  * If used as a preconditioner, this function should be passed
  * to the iterative solver {\tt SetPrecond} function.
  *
+ * If {\tt b} and {\tt x} are multivectors, all right-hand sides are
+ * cycled together and the iteration stops once every column has converged.
+ *
  * @param solver [IN] solver or preconditioner object to be applied.
  * @param A [IN] ParCSR matrix, matrix of the linear system to be solved
  * @param b [IN] right hand side of the linear system to be solved
@@ -715,8 +718,20 @@ HYPRE_Int HYPRE_BoomerAMGSetGridRelaxType(HYPRE_Solver  solver,
  * 16 & Chebyshev\\
  * 17 & FCF-Jacobi\\
  * 18 & $\ell_1$-scaled jacobi\\
+ * 20 & block Jacobi (block mode) \\
+ * 23 & hybrid block Gauss-Seidel (block mode) \\
+ * 26 & hybrid symmetric block Gauss-Seidel (block mode) \\
+ * 29 & block Gaussian elimination (block mode, only on coarsest level) \\
  * \hline
  * \end{tabular}
+ *
+ * Choosing a block smoother (20 or larger) or a block interpolation (10, 11
+ * or 20 and larger) switches BoomerAMG to block mode, where the matrices on
+ * all levels are stored as block matrices with one block per node.  In block
+ * mode, scalar smoothers are replaced by the closest block smoother (Jacobi
+ * variants by 20, symmetric Gauss-Seidel variants by 26, all others by 23)
+ * and the coarsest level is solved with 29, which is factored once in the
+ * setup.
  **/
 HYPRE_Int HYPRE_BoomerAMGSetRelaxType(HYPRE_Solver  solver,
                                       HYPRE_Int     relax_type);
@@ -1148,6 +1163,39 @@ HYPRE_Int HYPRE_BoomerAMGSetRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                       HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) If set to 1, a setup called on a solver that has already been
+ * set up keeps the coarse grids and interpolation operators of the previous
+ * setup and only recomputes the coarse-grid operators and the smoother data
+ * for the new matrix values.  This is meant for sequences of matrices with
+ * the same sparsity pattern and similar values.  The option is ignored (a
+ * full setup is done) in block mode, with a restriction other than P^T,
+ * with additive cycles, non-Galerkin coarse grids or interpolation vectors,
+ * and when the row distribution of the matrix has changed.  The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetReuseInterp(HYPRE_Solver solver,
+                                        HYPRE_Int    reuse_interp);
+
+/**
+ * (Optional) If set to 1, the communication packages of the operators and
+ * interpolation matrices count their exchanges, messages, bytes sent and the
+ * time spent waiting for messages, starting with the setup.  With a print
+ * level of 1 or 3 the setup statistics then include, per level and operator,
+ * the number of neighbors and these counters (minimum, average and maximum
+ * over the processes).  The counters are reset each time they are printed.
+ * Setting it back to 0 or destroying the solver stops the counting, unless
+ * another solver still collects statistics.  The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetCommStats(HYPRE_Solver solver,
+                                      HYPRE_Int    comm_stats);
+
+/**
+ * Prints the communication statistics accumulated since the setup or the
+ * previous print (see HYPRE\_BoomerAMGSetCommStats), e.g. after a solve, and
+ * resets them.
+ **/
+HYPRE_Int HYPRE_BoomerAMGPrintCommStats(HYPRE_Solver solver);
+
 /*
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -1171,6 +1219,28 @@ HYPRE_Int HYPRE_BoomerAMGSetCoordDim (HYPRE_Solver solver,
  **/
 HYPRE_Int HYPRE_BoomerAMGSetCoordinates (HYPRE_Solver  solver,
                                          float        *coordinates);
+
+/**
+ * (Optional) Provides logically structured grid indices for the local rows,
+ * which BoomerAMG uses to coarsen structured parts of the problem
+ * geometrically.  For row i, {\tt index[ndim*i+d]} is its index in
+ * direction d ({\tt ndim} = 1, 2 or 3) within structured region
+ * {\tt region[i]}.  Rows with a negative region number are unstructured and
+ * are coarsened algebraically; if {\tt region} is NULL, all rows belong to
+ * region 0.
+ *
+ * On the structured rows, each level semicoarsens the direction with the
+ * strongest couplings (as PFMG does) and interpolates F-points from their
+ * two neighbors in that direction with the collapsed-stencil weights; the
+ * remaining rows use PMIS and direct interpolation.  The option overrides
+ * the coarsening and interpolation types on those levels, and is ignored
+ * for systems problems, nodal coarsening and aggressive coarsening.
+ * The arrays are not copied and must not be freed before the setup.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetStructCoordinates (HYPRE_Solver  solver,
+                                               HYPRE_Int     ndim,
+                                               HYPRE_Int    *region,
+                                               HYPRE_Int    *index);
 #ifdef HAVE_DSUPERLU
 /*
  * HYPRE_BoomerAMGSetDSLUThreshold
@@ -1538,6 +1608,24 @@ HYPRE_Int HYPRE_EuclidSetRowScale(HYPRE_Solver solver,
 HYPRE_Int HYPRE_EuclidSetILUT(HYPRE_Solver solver,
                               HYPRE_Real   drop_tol);
 
+/**
+ * If sweeps > 0, the values of the ILU(k) factors are computed by
+ * this many fixed-point sweeps over the entries of the factors, which
+ * are independent and run thread-parallel, instead of by Gaussian
+ * elimination.  Only for a single MPI task or block Jacobi.  Default: 0
+ **/
+HYPRE_Int HYPRE_EuclidSetFactorSweeps(HYPRE_Solver solver,
+                                      HYPRE_Int    sweeps);
+
+/**
+ * If sweeps > 0, each triangular solve is replaced by this many Jacobi
+ * sweeps, so the preconditioner is applied with matvec-like kernels
+ * only.  This is an approximation of the ILU preconditioner; a few
+ * sweeps usually suffice.  Default: 0 (exact triangular solves)
+ **/
+HYPRE_Int HYPRE_EuclidSetTriSolveSweeps(HYPRE_Solver solver,
+                                        HYPRE_Int    sweeps);
+
 /*@}*/
 
 /*--------------------------------------------------------------------------
@@ -1758,6 +1846,40 @@ HYPRE_Int HYPRE_AMSSetInteriorNodes(HYPRE_Solver    solver,
 HYPRE_Int HYPRE_AMSSetProjectionFrequency(HYPRE_Solver solver,
                                           HYPRE_Int    projection_frequency);
 
+/**
+ * (Optional) If set to 1, a repeated call of HYPRE\_AMSSetup with a matrix
+ * that differs from the previous one only in its values (e.g. a new
+ * conductivity in a time stepping loop) does a numeric refresh.  The
+ * discrete gradient, the Nedelec interpolation and the coarse grids and
+ * interpolation operators of the auxiliary AMG solvers are reused, and only
+ * the smoother data, the Galerkin products $G^T A G$, $\Pi^T A \Pi$ and the
+ * auxiliary AMG coarse-grid operators are recomputed.  Poisson matrices given
+ * by the user are not recomputed, but their auxiliary solvers are refreshed
+ * with their current values.  A full setup is always done with interior
+ * nodes and with cycle type 9.  The default is 0.
+ **/
+HYPRE_Int HYPRE_AMSSetNumericRefresh(HYPRE_Solver solver,
+                                     HYPRE_Int    numeric_refresh);
+
+/**
+ * (Optional) If set to 1, the additive cycle types (2, 4, 6, 8, 12 and 14)
+ * apply the auxiliary space corrections that share the same residual
+ * concurrently, each AMG V-cycle with its own team of OpenMP threads.  The
+ * corrections are summed in the usual order, so the iterates only change if
+ * the auxiliary smoothers depend on the number of threads, since each team
+ * has fewer threads.
+ * This requires OpenMP and at least as many threads as concurrent
+ * corrections.  With more than one MPI task, the auxiliary AMG solvers get
+ * private duplicates of the communicator, so that their halo exchanges
+ * overlap; this needs MPI initialized with MPI\_THREAD\_MULTIPLE and
+ * auxiliary matrices computed by AMS.  Otherwise, or if an auxiliary solver
+ * uses the LAPACK-based Gaussian elimination (relax types 29, 98 and 99), the
+ * corrections are applied one after the other.  Must be called before
+ * HYPRE\_AMSSetup.  The default is 0.
+ **/
+HYPRE_Int HYPRE_AMSSetConcurrentSubspaces(HYPRE_Solver solver,
+                                          HYPRE_Int    concurrent_subspaces);
+
 /**
  * (Optional) Sets maximum number of iterations, if AMS is used
  * as a solver. To use AMS as a preconditioner, set the maximum
@@ -1847,6 +1969,18 @@ HYPRE_Int HYPRE_AMSSetAlphaAMGOptions(HYPRE_Solver solver,
 HYPRE_Int HYPRE_AMSSetAlphaAMGCoarseRelaxType(HYPRE_Solver solver,
                                               HYPRE_Int    alpha_coarse_relax_type);
 
+/**
+ * (Optional) If set to 1, the AMG solver for $B_\Pi$ stores $\Pi^T A \Pi$
+ * and its coarse grids as matrices of dim x dim blocks (one block per pair
+ * of vertices) and uses nodal coarsening, block interpolation and symmetric
+ * hybrid block Gauss-Seidel smoothing, also on the coarsest level.  The
+ * aggressive coarsening levels and the coarse relaxation type set for
+ * $B_\Pi$ are ignored in this mode.  This only applies when AMS computes
+ * $\Pi^T A \Pi$ itself.  The default is $0$.
+ **/
+HYPRE_Int HYPRE_AMSSetAlphaAMGBlockMode(HYPRE_Solver solver,
+                                        HYPRE_Int    alpha_block_mode);
+
 /**
  * (Optional) Sets AMG parameters for $B_G$.
  * The defaults are $10$, $1$, $3$, $0.25$, $0$, $0$. See the user's manual for more details.
@@ -2070,7 +2204,8 @@ HYPRE_Int HYPRE_ADSSetCycleType(HYPRE_Solver solver ,
 /**
  * (Optional) Control how much information is printed during the
  * solution iterations.
- * The default is $1$ (print residual norm at each step).
+ * The default is $1$ (print residual norm at each step). A value larger
+ * than $1$ also prints the wall clock time of each phase of the setup.
  **/
 HYPRE_Int HYPRE_ADSSetPrintLevel(HYPRE_Solver solver ,
                                  HYPRE_Int    print_level);
@@ -2132,6 +2267,16 @@ HYPRE_Int HYPRE_ADSSetAMGOptions(HYPRE_Solver solver ,
                                  HYPRE_Int    interp_type ,
                                  HYPRE_Int    Pmax);
 
+/**
+ * (Optional) If set to 1, the AMG solver for $B_\Pi$ stores $\Pi^T A \Pi$
+ * and its coarse grids as matrices of 3 x 3 blocks and uses nodal
+ * coarsening, block interpolation and block smoothing, see
+ * HYPRE\_AMSSetAlphaAMGBlockMode.  The AMS solver for $B_C$ uses the same
+ * mode for its vector Poisson problem.  The default is $0$.
+ **/
+HYPRE_Int HYPRE_ADSSetAMGBlockMode(HYPRE_Solver solver ,
+                                   HYPRE_Int    block_mode);
+
 /**
  * Returns the number of iterations taken.
  **/
@@ -2178,6 +2323,20 @@ HYPRE_Int HYPRE_ParCSRPCGSolve(HYPRE_Solver       solver,
                                HYPRE_ParVector    b,
                                HYPRE_ParVector    x);
 
+/**
+ * Solve for several right-hand sides at once.  The vectors {\tt b} and
+ * {\tt x} are multivectors (see {\tt HYPRE\_ParMultiVectorCreate}) with the
+ * same number of columns.  Each column is iterated with the stopping test
+ * set by {\tt SetTol}, {\tt SetAbsoluteTol} and {\tt SetTwoNorm}, but the
+ * matvecs, preconditioner applications and inner products of all columns
+ * are performed together.  The iteration count and relative residual norm
+ * reported afterwards are those of the slowest column.
+ **/
+HYPRE_Int HYPRE_ParCSRPCGSolveMulti(HYPRE_Solver       solver,
+                                    HYPRE_ParCSRMatrix A,
+                                    HYPRE_ParVector    b,
+                                    HYPRE_ParVector    x);
+
 HYPRE_Int HYPRE_ParCSRPCGSetTol(HYPRE_Solver solver,
                                 HYPRE_Real   tol);
 
@@ -3301,6 +3460,9 @@ HYPRE_MGRSetRelaxType(HYPRE_Solver solver, HYPRE_Int relax_type );
  * \begin{tabular}{|c|l|} \hline
  * 0 & Single-level relaxation sweeps for F-relaxation as prescribed by {\tt MGRSetRelaxType} \\
  * 1 & Multi-level relaxation strategy for F-relaxation (V(1,0) cycle currently supported). \\
+ * 2 & Single-level relaxation sweeps on the F-point submatrix $A_{ff}$, extracted once \\
+ *   & during setup (relaxation type 0 uses block Jacobi with cached inverses of the \\
+ *   & F-point blocks of each node). \\
  * \hline
  * \end{tabular} 
  **/
@@ -3398,6 +3560,39 @@ HYPRE_Int HYPRE_MGRSetCoarseSolver(HYPRE_Solver          solver,
                              HYPRE_PtrToParSolverFcn  coarse_grid_solver_setup,
                              HYPRE_Solver          coarse_grid_solver );
 
+/*--------------------------------------------------------------------------
+ * HYPRE_MGRSetNumericRefresh
+ *--------------------------------------------------------------------------*/
+/**
+ * (Optional) If set to 1, a repeated call of HYPRE\_MGRSetup with a matrix
+ * that has the sparsity pattern and row distribution of the previous one
+ * (e.g. the next Newton iteration of an implicit simulation) does a numeric
+ * refresh.  The CF splittings, the patterns of the interpolation and
+ * restriction operators and of the coarse grids, and the coarse grid solver
+ * are kept, and only their values, the global smoother and the F-relaxation
+ * data are recomputed.  The coarse grid solver is set up again as prescribed
+ * by {\tt HYPRE\_MGRSetCoarseGridRefreshFrequency}.  A full setup is done
+ * with interpolation or restriction types larger than 2 and when the number
+ * of levels or the row distribution has changed.  The default is 0.
+ **/
+HYPRE_Int
+HYPRE_MGRSetNumericRefresh( HYPRE_Solver solver, HYPRE_Int numeric_refresh );
+
+/*--------------------------------------------------------------------------
+ * HYPRE_MGRSetCoarseGridRefreshFrequency
+ *--------------------------------------------------------------------------*/
+/**
+ * (Optional) With numeric refresh, do a full setup of the coarse grid
+ * solver only on every {\tt refresh\_freq}-th refresh.  On the other
+ * refreshes, a BoomerAMG coarse grid solver is set up again with
+ * {\tt HYPRE\_BoomerAMGSetReuseInterp}, so it keeps its coarse grids and
+ * interpolation and only recomputes its coarse grid operators; any other
+ * coarse grid solver keeps its previous setup.  If 0, no full setup of the
+ * coarse grid solver is done.  The default is 1.
+ **/
+HYPRE_Int
+HYPRE_MGRSetCoarseGridRefreshFrequency( HYPRE_Solver solver, HYPRE_Int refresh_freq );
+
 /*--------------------------------------------------------------------------
  * HYPRE_MGRSetPrintLevel
  *--------------------------------------------------------------------------*/
@@ -3605,6 +3800,19 @@ GenerateCoordinates(MPI_Comm  comm,
                     HYPRE_Int r,
                     HYPRE_Int coorddim);
 
+HYPRE_Int*
+GenerateStructCoordinates(MPI_Comm  comm,
+                          HYPRE_Int nx,
+                          HYPRE_Int ny,
+                          HYPRE_Int nz,
+                          HYPRE_Int P,
+                          HYPRE_Int Q,
+                          HYPRE_Int R,
+                          HYPRE_Int p,
+                          HYPRE_Int q,
+                          HYPRE_Int r,
+                          HYPRE_Int ndim);
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -106,6 +106,24 @@ HYPRE_MGRSetCoarseSolver(HYPRE_Solver          solver,
 									   (void *) coarse_grid_solver ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_MGRSetNumericRefresh
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_MGRSetNumericRefresh( HYPRE_Solver solver, HYPRE_Int numeric_refresh )
+{
+   return hypre_MGRSetNumericRefresh(solver, numeric_refresh);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_MGRSetCoarseGridRefreshFrequency
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_MGRSetCoarseGridRefreshFrequency( HYPRE_Solver solver, HYPRE_Int refresh_freq )
+{
+   return hypre_MGRSetCoarseGridRefreshFrequency(solver, refresh_freq);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_MGRSetMaxLevels
  *--------------------------------------------------------------------------*/
@@ -83,6 +83,35 @@ HYPRE_ParCSRPCGSolve( HYPRE_Solver solver,
                            (HYPRE_Vector) x ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPCGSolveMulti
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int 
+HYPRE_ParCSRPCGSolveMulti( HYPRE_Solver solver,
+                           HYPRE_ParCSRMatrix A,
+                           HYPRE_ParVector b,
+                           HYPRE_ParVector x      )
+{
+   if (!solver)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (!b || !x ||
+       hypre_ParVectorNumVectors((hypre_ParVector *) b) !=
+       hypre_ParVectorNumVectors((hypre_ParVector *) x))
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   return( hypre_ParCSRPCGSolveMulti( (void *) solver,
+                                      (hypre_ParCSRMatrix *) A,
+                                      (hypre_ParVector *) b,
+                                      (hypre_ParVector *) x ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRPCGSetTol
  *--------------------------------------------------------------------------*/
@@ -247,17 +276,37 @@ HYPRE_ParCSRDiagScale( HYPRE_Solver solver,
    hypre_ParCSRMatrix *A = (hypre_ParCSRMatrix *) HA;
    hypre_ParVector    *y = (hypre_ParVector *) Hy;
    hypre_ParVector    *x = (hypre_ParVector *) Hx;
-   HYPRE_Real *x_data = hypre_VectorData(hypre_ParVectorLocalVector(x));
-   HYPRE_Real *y_data = hypre_VectorData(hypre_ParVectorLocalVector(y));
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+   HYPRE_Real *x_data = hypre_VectorData(x_local);
+   HYPRE_Real *y_data = hypre_VectorData(y_local);
    HYPRE_Real *A_data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(A));
    HYPRE_Int *A_i = hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(A));
-   HYPRE_Int local_size = hypre_VectorSize(hypre_ParVectorLocalVector(x));
-   HYPRE_Int i, ierr = 0;
-
-   for (i=0; i < local_size; i++)
+   HYPRE_Int local_size = hypre_VectorSize(x_local);
+   HYPRE_Int num_vectors = hypre_VectorNumVectors(x_local);
+   HYPRE_Int x_vs = hypre_VectorVectorStride(x_local);
+   HYPRE_Int x_is = hypre_VectorIndexStride(x_local);
+   HYPRE_Int y_vs = hypre_VectorVectorStride(y_local);
+   HYPRE_Int y_is = hypre_VectorIndexStride(y_local);
+   HYPRE_Int i, j, ierr = 0;
+
+   if (num_vectors == 1)
    {
-      x_data[i] = y_data[i]/A_data[A_i[i]];
-   } 
+      for (i=0; i < local_size; i++)
+      {
+         x_data[i] = y_data[i]/A_data[A_i[i]];
+      }
+   }
+   else
+   {
+      for (j=0; j < num_vectors; j++)
+      {
+         for (i=0; i < local_size; i++)
+         {
+            x_data[j*x_vs+i*x_is] = y_data[j*y_vs+i*y_is]/A_data[A_i[i]];
+         }
+      }
+   }
  
    return ierr;
 }
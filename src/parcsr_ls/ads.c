@@ -57,6 +57,7 @@ void * hypre_ADSCreate()
    ads_data -> B_Pi_theta = 0.25;      /* strength threshold */
    ads_data -> B_Pi_interp_type = 0;   /* interpolation type */
    ads_data -> B_Pi_Pmax = 0;          /* max nonzero elements in interp. rows */
+   ads_data -> B_Pi_block_mode = 0;    /* scalar storage of A_Pi */
 
    /* The rest of the fields are initialized using the Set functions */
 
@@ -447,6 +448,22 @@ HYPRE_Int hypre_ADSSetAMGOptions(void *solver,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ADSSetAMGBlockMode
+ *
+ * If set to 1, B_Pi treats A_Pi = Pi^T A Pi as a matrix of 3 x 3 blocks (see
+ * hypre_BoomerAMGSetBlockMode), and so does the B_Pi solver inside B_C.
+ * Default value: 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_ADSSetAMGBlockMode(void *solver,
+                                   HYPRE_Int B_Pi_block_mode)
+{
+   hypre_ADSData *ads_data = (hypre_ADSData *) solver;
+   ads_data -> B_Pi_block_mode = B_Pi_block_mode;
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ADSComputePi
  *
@@ -565,19 +582,28 @@ HYPRE_Int hypre_ADSComputePi(hypre_ParCSRMatrix *A,
          HYPRE_Int *Pi_diag_J = hypre_CSRMatrixJ(Pi_diag);
          HYPRE_Real *Pi_diag_data = hypre_CSRMatrixData(Pi_diag);
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
          for (i = 0; i < F2V_diag_nrows+1; i++)
             Pi_diag_I[i] = 3 * F2V_diag_I[i];
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,d) HYPRE_SMP_SCHEDULE
+#endif
          for (i = 0; i < F2V_diag_nnz; i++)
             for (d = 0; d < 3; d++)
                Pi_diag_J[3*i+d] = 3*F2V_diag_J[i]+d;
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j) HYPRE_SMP_SCHEDULE
+#endif
          for (i = 0; i < F2V_diag_nrows; i++)
             for (j = F2V_diag_I[i]; j < F2V_diag_I[i+1]; j++)
             {
-               *Pi_diag_data++ = RT100_data[i];
-               *Pi_diag_data++ = RT010_data[i];
-               *Pi_diag_data++ = RT001_data[i];
+               Pi_diag_data[3*j]   = RT100_data[i];
+               Pi_diag_data[3*j+1] = RT010_data[i];
+               Pi_diag_data[3*j+2] = RT001_data[i];
             }
       }
 
@@ -600,21 +626,35 @@ HYPRE_Int hypre_ADSComputePi(hypre_ParCSRMatrix *A,
          HYPRE_Int *Pi_cmap = hypre_ParCSRMatrixColMapOffd(Pi);
 
          if (F2V_offd_ncols)
+         {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
             for (i = 0; i < F2V_offd_nrows+1; i++)
                Pi_offd_I[i] = 3 * F2V_offd_I[i];
+         }
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,d) HYPRE_SMP_SCHEDULE
+#endif
          for (i = 0; i < F2V_offd_nnz; i++)
             for (d = 0; d < 3; d++)
                Pi_offd_J[3*i+d] = 3*F2V_offd_J[i]+d;
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j) HYPRE_SMP_SCHEDULE
+#endif
          for (i = 0; i < F2V_offd_nrows; i++)
             for (j = F2V_offd_I[i]; j < F2V_offd_I[i+1]; j++)
             {
-               *Pi_offd_data++ = RT100_data[i];
-               *Pi_offd_data++ = RT010_data[i];
-               *Pi_offd_data++ = RT001_data[i];
+               Pi_offd_data[3*j]   = RT100_data[i];
+               Pi_offd_data[3*j+1] = RT010_data[i];
+               Pi_offd_data[3*j+2] = RT001_data[i];
             }
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,d) HYPRE_SMP_SCHEDULE
+#endif
          for (i = 0; i < F2V_offd_ncols; i++)
             for (d = 0; d < 3; d++)
                Pi_cmap[3*i+d] = 3*F2V_cmap[i]+d;
@@ -779,6 +819,9 @@ HYPRE_Int hypre_ADSComputePixyz(hypre_ParCSRMatrix *A,
          HYPRE_Int *Piz_diag_J = hypre_CSRMatrixJ(Piz_diag);
          HYPRE_Real *Piz_diag_data = hypre_CSRMatrixData(Piz_diag);
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
          for (i = 0; i < F2V_diag_nrows+1; i++)
          {
             Pix_diag_I[i] = F2V_diag_I[i];
@@ -786,6 +829,9 @@ HYPRE_Int hypre_ADSComputePixyz(hypre_ParCSRMatrix *A,
             Piz_diag_I[i] = F2V_diag_I[i];
          }
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
          for (i = 0; i < F2V_diag_nnz; i++)
          {
             Pix_diag_J[i] = F2V_diag_J[i];
@@ -793,12 +839,15 @@ HYPRE_Int hypre_ADSComputePixyz(hypre_ParCSRMatrix *A,
             Piz_diag_J[i] = F2V_diag_J[i];
          }
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j) HYPRE_SMP_SCHEDULE
+#endif
          for (i = 0; i < F2V_diag_nrows; i++)
             for (j = F2V_diag_I[i]; j < F2V_diag_I[i+1]; j++)
             {
-               *Pix_diag_data++ = RT100_data[i];
-               *Piy_diag_data++ = RT010_data[i];
-               *Piz_diag_data++ = RT001_data[i];
+               Pix_diag_data[j] = RT100_data[i];
+               Piy_diag_data[j] = RT010_data[i];
+               Piz_diag_data[j] = RT001_data[i];
             }
       }
 
@@ -833,13 +882,21 @@ HYPRE_Int hypre_ADSComputePixyz(hypre_ParCSRMatrix *A,
          HYPRE_Int *Piz_cmap = hypre_ParCSRMatrixColMapOffd(Piz);
 
          if (F2V_offd_ncols)
+         {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
             for (i = 0; i < F2V_offd_nrows+1; i++)
             {
                Pix_offd_I[i] = F2V_offd_I[i];
                Piy_offd_I[i] = F2V_offd_I[i];
                Piz_offd_I[i] = F2V_offd_I[i];
             }
+         }
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
          for (i = 0; i < F2V_offd_nnz; i++)
          {
             Pix_offd_J[i] = F2V_offd_J[i];
@@ -847,14 +904,20 @@ HYPRE_Int hypre_ADSComputePixyz(hypre_ParCSRMatrix *A,
             Piz_offd_J[i] = F2V_offd_J[i];
          }
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j) HYPRE_SMP_SCHEDULE
+#endif
          for (i = 0; i < F2V_offd_nrows; i++)
             for (j = F2V_offd_I[i]; j < F2V_offd_I[i+1]; j++)
             {
-               *Pix_offd_data++ = RT100_data[i];
-               *Piy_offd_data++ = RT010_data[i];
-               *Piz_offd_data++ = RT001_data[i];
+               Pix_offd_data[j] = RT100_data[i];
+               Piy_offd_data[j] = RT010_data[i];
+               Piz_offd_data[j] = RT001_data[i];
             }
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
          for (i = 0; i < F2V_offd_ncols; i++)
          {
             Pix_cmap[i] = F2V_cmap[i];
@@ -899,8 +962,13 @@ HYPRE_Int hypre_ADSSetup(void *solver,
    hypre_ADSData *ads_data = (hypre_ADSData *) solver;
    hypre_AMSData *ams_data;
 
+   /* wall clock times of the setup phases, reported for print_level > 1 */
+   HYPRE_Real setup_time[6], wtime;
+
    ads_data -> A = A;
 
+   wtime = hypre_MPI_Wtime();
+
    /* Make sure that the first entry in each row is the diagonal one. */
    /* hypre_CSRMatrixReorder(hypre_ParCSRMatrixDiag(ads_data -> A)); */
 
@@ -917,6 +985,9 @@ HYPRE_Int hypre_ADSSetup(void *solver,
                                    &ads_data->A_min_eig_est);
    }
 
+   setup_time[0] = hypre_MPI_Wtime() - wtime;
+   setup_time[1] = setup_time[2] = setup_time[4] = setup_time[5] = 0.0;
+
    /* Create the AMS solver on the range of C^T */
    {
       HYPRE_AMSCreate(&ads_data -> B_C);
@@ -968,6 +1039,7 @@ HYPRE_Int hypre_ADSSetup(void *solver,
                                   ads_data -> B_C_agg_levels, ads_data -> B_C_relax_type,
                                   ads_data -> B_C_theta, ads_data -> B_C_interp_type,
                                   ads_data -> B_C_Pmax);
+      HYPRE_AMSSetAlphaAMGBlockMode(ads_data -> B_C, ads_data -> B_Pi_block_mode);
       /* No need to call HYPRE_AMSSetBetaAMGOptions */
 
       /* Construct the coarse space matrix by RAP */
@@ -983,6 +1055,7 @@ HYPRE_Int hypre_ADSSetup(void *solver,
 
          C_owned_col_starts = hypre_ParCSRMatrixOwnsColStarts(ads_data -> C);
 
+         wtime = hypre_MPI_Wtime();
          hypre_BoomerAMGBuildCoarseOperator(ads_data -> C,
                                             ads_data -> A,
                                             ads_data -> C,
@@ -994,13 +1067,18 @@ HYPRE_Int hypre_ADSSetup(void *solver,
 
          hypre_ParCSRMatrixOwnsColStarts(ads_data -> C) = C_owned_col_starts;
          hypre_ParCSRMatrixOwnsRowStarts(ads_data -> A_C) = 0;
+         setup_time[1] = hypre_MPI_Wtime() - wtime;
       }
 
+      wtime = hypre_MPI_Wtime();
       HYPRE_AMSSetup(ads_data -> B_C, (HYPRE_ParCSRMatrix)ads_data -> A_C, 0, 0);
+      setup_time[2] = hypre_MPI_Wtime() - wtime;
    }
 
    ams_data = (hypre_AMSData *) ads_data -> B_C;
 
+   wtime = hypre_MPI_Wtime();
+
    if (ads_data -> Pi == NULL && ads_data -> Pix == NULL)
    {
       if (ads_data -> cycle_type > 10)
@@ -1030,6 +1108,7 @@ HYPRE_Int hypre_ADSSetup(void *solver,
                             ams_data -> Piz,
                             &ads_data -> Pi);
    }
+   setup_time[3] = hypre_MPI_Wtime() - wtime;
 
    if (ads_data -> cycle_type > 10)
    /* Create the AMG solvers on the range of Pi{x,y,z}^T */
@@ -1081,6 +1160,7 @@ HYPRE_Int hypre_ADSSetup(void *solver,
                                        ads_data -> B_Pi_relax_type, 3);
 
       /* Construct the coarse space matrices by RAP */
+      wtime = hypre_MPI_Wtime();
       if (!hypre_ParCSRMatrixCommPkg(ads_data -> Pix))
          hypre_MatvecCommPkgCreate(ads_data -> Pix);
       P_owned_col_starts = hypre_ParCSRMatrixOwnsRowStarts(ads_data -> Pix);
@@ -1093,10 +1173,14 @@ HYPRE_Int hypre_ADSSetup(void *solver,
          hypre_ParCSRMatrixOwnsRowStarts(ads_data -> A_Pix) = 0;
          hypre_ParCSRMatrixOwnsColStarts(ads_data -> A_Pix) = 0;
       }
+      setup_time[4] += hypre_MPI_Wtime() - wtime;
+      wtime = hypre_MPI_Wtime();
       HYPRE_BoomerAMGSetup(ads_data -> B_Pix,
                            (HYPRE_ParCSRMatrix)ads_data -> A_Pix,
                            0, 0);
+      setup_time[5] += hypre_MPI_Wtime() - wtime;
 
+      wtime = hypre_MPI_Wtime();
       if (!hypre_ParCSRMatrixCommPkg(ads_data -> Piy))
          hypre_MatvecCommPkgCreate(ads_data -> Piy);
       P_owned_col_starts = hypre_ParCSRMatrixOwnsRowStarts(ads_data -> Piy);
@@ -1109,10 +1193,14 @@ HYPRE_Int hypre_ADSSetup(void *solver,
          hypre_ParCSRMatrixOwnsRowStarts(ads_data -> A_Piy) = 0;
          hypre_ParCSRMatrixOwnsColStarts(ads_data -> A_Piy) = 0;
       }
+      setup_time[4] += hypre_MPI_Wtime() - wtime;
+      wtime = hypre_MPI_Wtime();
       HYPRE_BoomerAMGSetup(ads_data -> B_Piy,
                            (HYPRE_ParCSRMatrix)ads_data -> A_Piy,
                            0, 0);
+      setup_time[5] += hypre_MPI_Wtime() - wtime;
 
+      wtime = hypre_MPI_Wtime();
       if (!hypre_ParCSRMatrixCommPkg(ads_data -> Piz))
          hypre_MatvecCommPkgCreate(ads_data -> Piz);
       P_owned_col_starts = hypre_ParCSRMatrixOwnsRowStarts(ads_data -> Piz);
@@ -1125,9 +1213,12 @@ HYPRE_Int hypre_ADSSetup(void *solver,
          hypre_ParCSRMatrixOwnsRowStarts(ads_data -> A_Piz) = 0;
          hypre_ParCSRMatrixOwnsColStarts(ads_data -> A_Piz) = 0;
       }
+      setup_time[4] += hypre_MPI_Wtime() - wtime;
+      wtime = hypre_MPI_Wtime();
       HYPRE_BoomerAMGSetup(ads_data -> B_Piz,
                            (HYPRE_ParCSRMatrix)ads_data -> A_Piz,
                            0, 0);
+      setup_time[5] += hypre_MPI_Wtime() - wtime;
    }
    else
    /* Create the AMG solver on the range of Pi^T */
@@ -1153,6 +1244,7 @@ HYPRE_Int hypre_ADSSetup(void *solver,
          is a 3 x 3 block system. */
       if (!ads_data -> A_Pi)
       {
+         wtime = hypre_MPI_Wtime();
          if (!hypre_ParCSRMatrixCommPkg(ads_data -> Pi))
             hypre_MatvecCommPkgCreate(ads_data -> Pi);
 
@@ -1163,14 +1255,19 @@ HYPRE_Int hypre_ADSSetup(void *solver,
                                             ads_data -> A,
                                             ads_data -> Pi,
                                             &ads_data -> A_Pi);
+         setup_time[4] = hypre_MPI_Wtime() - wtime;
 
          HYPRE_BoomerAMGSetNumFunctions(ads_data -> B_Pi, 3);
          /* HYPRE_BoomerAMGSetNodal(ads_data -> B_Pi, 1); */
+         if (ads_data -> B_Pi_block_mode)
+            hypre_BoomerAMGSetBlockMode(ads_data -> B_Pi);
       }
 
+      wtime = hypre_MPI_Wtime();
       HYPRE_BoomerAMGSetup(ads_data -> B_Pi,
                            (HYPRE_ParCSRMatrix)ads_data -> A_Pi,
                            0, 0);
+      setup_time[5] = hypre_MPI_Wtime() - wtime;
    }
 
    /* Allocate temporary vectors */
@@ -1192,6 +1289,27 @@ HYPRE_Int hypre_ADSSetup(void *solver,
       ads_data -> g2 = hypre_ParVectorInDomainOf(ads_data -> Pi);
    }
 
+   if (ads_data -> print_level > 1)
+   {
+      HYPRE_Real max_time[6];
+      HYPRE_Int my_id;
+      MPI_Comm comm = hypre_ParCSRMatrixComm(A);
+
+      hypre_MPI_Comm_rank(comm, &my_id);
+      hypre_MPI_Allreduce(setup_time, max_time, 6, HYPRE_MPI_REAL,
+                          hypre_MPI_MAX, comm);
+      if (my_id == 0)
+      {
+         hypre_printf("\nADS setup times (max over processors):\n");
+         hypre_printf("   smoother setup         : %e\n", max_time[0]);
+         hypre_printf("   RAP for C^T A C        : %e\n", max_time[1]);
+         hypre_printf("   AMS setup on C^T A C   : %e\n", max_time[2]);
+         hypre_printf("   Pi construction        : %e\n", max_time[3]);
+         hypre_printf("   RAP for Pi^T A Pi      : %e\n", max_time[4]);
+         hypre_printf("   AMG setup on Pi^T A Pi : %e\n", max_time[5]);
+      }
+   }
+
    return hypre_error_flag;
 }
 
@@ -1334,7 +1452,8 @@ HYPRE_Int hypre_ADSSolve(void *solver,
                                ads_data -> r0,
                                ads_data -> g0,
                                cycle,
-                               z);
+                               z,
+                               0);
 
       /* Compute new residual norms */
       if (ads_data -> maxit > 1)
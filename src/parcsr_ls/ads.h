@@ -89,6 +89,8 @@ typedef struct
    HYPRE_Real B_Pi_theta;
    HYPRE_Int B_Pi_interp_type;
    HYPRE_Int B_Pi_Pmax;
+   /* Store the coarse grids of B_Pi (and of B_Pi in B_C) as 3 x 3 blocks? */
+   HYPRE_Int B_Pi_block_mode;
 
    /* Temporary vectors */
    hypre_ParVector *r0, *g0, *r1, *g1, *r2, *g2;
@@ -152,6 +154,7 @@ typedef struct
 #define hypre_ADSDataAMGStrengthThreshold(ads_data) ((ads_data)->B_Pi_theta)
 #define hypre_ADSDataAMGInterpType(ads_data) ((ads_data)->B_Pi_interp_type)
 #define hypre_ADSDataAMGPmax(ads_data) ((ads_data)->B_Pi_Pmax)
+#define hypre_ADSDataAMGBlockMode(ads_data) ((ads_data)->B_Pi_block_mode)
 
 /* Temporary vectors */
 #define hypre_ADSDataTempFaceVectorR(ads_data) ((ads_data)->r0)
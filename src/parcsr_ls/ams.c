@@ -464,6 +464,33 @@ HYPRE_Int hypre_ParVectorBlockGather(hypre_ParVector *x,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetBlockMode
+ *
+ * Switch the BoomerAMG solver B for a system with a fixed number of unknowns
+ * per node (set by HYPRE_BoomerAMGSetNumFunctions) to block mode. There, the
+ * matrices on all levels are stored as hypre_ParCSRBlockMatrix, the nodal
+ * coarsening uses the Frobenius norms of the blocks (computed by
+ * hypre_BoomerAMGBlockCreateNodalA), the interpolation uses the diagonal
+ * blocks, and the smoother is symmetric hybrid block Gauss-Seidel. Aggressive
+ * coarsening is not available for block matrices, and the coarsest level is
+ * smoothed instead of solved directly, since the matrix may be singular.
+ * The row sum dependency weakening is turned off, because all entries of the
+ * nodal matrix are positive.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_BoomerAMGSetBlockMode(HYPRE_Solver B)
+{
+   HYPRE_BoomerAMGSetNodal(B, 1);
+   HYPRE_BoomerAMGSetMaxRowSum(B, 1.0);
+   HYPRE_BoomerAMGSetAggNumLevels(B, 0);
+   HYPRE_BoomerAMGSetInterpType(B, 21);
+   HYPRE_BoomerAMGSetRelaxType(B, 26);
+   HYPRE_BoomerAMGSetCycleRelaxType(B, 26, 3);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_BoomerAMGBlockSolve
  *
@@ -538,6 +565,9 @@ HYPRE_Int hypre_ParCSRMatrixFixZeroRows(hypre_ParCSRMatrix *A)
    /* a row will be considered zero if its l1 norm is less than eps */
    HYPRE_Real eps = 0.0; /* DBL_EPSILON * 1e+4; */
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,l1_norm) HYPRE_SMP_SCHEDULE
+#endif
    for (i = 0; i < num_rows; i++)
    {
       l1_norm = 0.0;
@@ -850,6 +880,7 @@ void * hypre_AMSCreate()
    ams_data -> B_Pi_theta = 0.25;      /* strength threshold */
    ams_data -> B_Pi_interp_type = 0;   /* interpolation type */
    ams_data -> B_Pi_Pmax = 0;          /* max nonzero elements in interp. rows */
+   ams_data -> B_Pi_block_mode = 0;    /* scalar storage of A_Pi */
    ams_data -> beta_is_zero = 0;       /* the problem has a mass term */
 
    /* By default, do l1-GS smoothing on the coarsest grid */
@@ -878,6 +909,12 @@ void * hypre_AMSCreate()
    ams_data -> g1  = NULL;
    ams_data -> r2  = NULL;
    ams_data -> g2  = NULL;
+   ams_data -> r3  = NULL;
+   ams_data -> g3  = NULL;
+   ams_data -> r4  = NULL;
+   ams_data -> g4  = NULL;
+   ams_data -> r5  = NULL;
+   ams_data -> g5  = NULL;
 
    ams_data -> Pix    = NULL;
    ams_data -> Piy    = NULL;
@@ -903,6 +940,15 @@ void * hypre_AMSCreate()
    ams_data -> owns_A_G  = 0;
    ams_data -> owns_A_Pi = 0;
 
+   ams_data -> numeric_refresh = 0;
+   ams_data -> concurrent_subspaces = 0;
+   ams_data -> use_concurrent = 0;
+   ams_data -> A_G_comm   = hypre_MPI_COMM_NULL;
+   ams_data -> A_Pi_comm  = hypre_MPI_COMM_NULL;
+   ams_data -> A_Pix_comm = hypre_MPI_COMM_NULL;
+   ams_data -> A_Piy_comm = hypre_MPI_COMM_NULL;
+   ams_data -> A_Piz_comm = hypre_MPI_COMM_NULL;
+
    return (void *) ams_data;
 }
 
@@ -969,6 +1015,18 @@ HYPRE_Int hypre_AMSDestroy(void *solver)
       hypre_ParVectorDestroy(ams_data -> r2);
    if (ams_data -> g2)
       hypre_ParVectorDestroy(ams_data -> g2);
+   if (ams_data -> r3)
+      hypre_ParVectorDestroy(ams_data -> r3);
+   if (ams_data -> g3)
+      hypre_ParVectorDestroy(ams_data -> g3);
+   if (ams_data -> r4)
+      hypre_ParVectorDestroy(ams_data -> r4);
+   if (ams_data -> g4)
+      hypre_ParVectorDestroy(ams_data -> g4);
+   if (ams_data -> r5)
+      hypre_ParVectorDestroy(ams_data -> r5);
+   if (ams_data -> g5)
+      hypre_ParVectorDestroy(ams_data -> g5);
 
    if (ams_data -> G0)
       hypre_ParCSRMatrixDestroy(ams_data -> A);
@@ -982,6 +1040,18 @@ HYPRE_Int hypre_AMSDestroy(void *solver)
    if (ams_data -> A_l1_norms)
       hypre_TFree(ams_data -> A_l1_norms, HYPRE_MEMORY_SHARED);
 
+   /* the auxiliary matrices and AMG solvers using these are gone */
+   if (ams_data -> A_G_comm != hypre_MPI_COMM_NULL)
+      hypre_MPI_Comm_free(&ams_data -> A_G_comm);
+   if (ams_data -> A_Pi_comm != hypre_MPI_COMM_NULL)
+      hypre_MPI_Comm_free(&ams_data -> A_Pi_comm);
+   if (ams_data -> A_Pix_comm != hypre_MPI_COMM_NULL)
+      hypre_MPI_Comm_free(&ams_data -> A_Pix_comm);
+   if (ams_data -> A_Piy_comm != hypre_MPI_COMM_NULL)
+      hypre_MPI_Comm_free(&ams_data -> A_Piy_comm);
+   if (ams_data -> A_Piz_comm != hypre_MPI_COMM_NULL)
+      hypre_MPI_Comm_free(&ams_data -> A_Piz_comm);
+
    /* G, x, y ,z, Gx, Gy and Gz are not destroyed */
 
    if (ams_data)
@@ -1202,6 +1272,59 @@ HYPRE_Int hypre_AMSSetProjectionFrequency(void *solver,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AMSSetNumericRefresh
+ *
+ * If set to 1, a repeated call of hypre_AMSSetup() with a matrix that differs
+ * from the previous one only in its values keeps G, Pi and the coarse grids
+ * and interpolation operators of the auxiliary AMG solvers, and recomputes
+ * only the Galerkin products and the smoother data (see hypre_AMSSetupNumeric).
+ *
+ * The default value is 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_AMSSetNumericRefresh(void *solver,
+                                     HYPRE_Int numeric_refresh)
+{
+   hypre_AMSData *ams_data = (hypre_AMSData *) solver;
+   ams_data -> numeric_refresh = numeric_refresh;
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMSSetConcurrentSubspaces
+ *
+ * If set to 1, the additive cycle types (2, 4, 6, 8, 12 and 14) apply the
+ * consecutive corrections that share the saved residual concurrently, each
+ * auxiliary AMG V-cycle with its own OpenMP thread team. The corrections are
+ * still summed in the sequential order, so the result only changes if the
+ * auxiliary smoothers depend on the number of threads (e.g. the hybrid
+ * Gauss-Seidel relaxations), since each team has fewer threads.
+ *
+ * This requires OpenMP and more than one thread. With more than one MPI task,
+ * each auxiliary matrix (and the AMG hierarchy built from it) gets a private
+ * duplicate of the communicator of A, so that the halo exchanges of the
+ * concurrent V-cycles proceed independently and their latency-bound coarse
+ * levels overlap. This needs MPI initialized with MPI_THREAD_MULTIPLE and
+ * auxiliary matrices constructed by AMS (not given by the user).
+ *
+ * The corrections are applied one after the other if these conditions do not
+ * hold, or if an auxiliary AMG solver uses one of the LAPACK-based Gaussian
+ * elimination relaxations (types 29, 98 and 99), which are not reentrant.
+ *
+ * Must be set before hypre_AMSSetup().
+ *
+ * The default value is 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_AMSSetConcurrentSubspaces(void *solver,
+                                          HYPRE_Int concurrent_subspaces)
+{
+   hypre_AMSData *ams_data = (hypre_AMSData *) solver;
+   ams_data -> concurrent_subspaces = concurrent_subspaces;
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AMSSetMaxIter
  *
@@ -1341,6 +1464,22 @@ HYPRE_Int hypre_AMSSetAlphaAMGOptions(void *solver,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AMSSetAlphaAMGBlockMode
+ *
+ * If set to 1, B_Pi treats A_Pi = Pi^T A Pi as a matrix of dim x dim blocks
+ * (see hypre_BoomerAMGSetBlockMode). Only used when A_Pi is computed by AMS
+ * with the nodal ordering of Pi. Default value: 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_AMSSetAlphaAMGBlockMode(void *solver,
+                                        HYPRE_Int B_Pi_block_mode)
+{
+   hypre_AMSData *ams_data = (hypre_AMSData *) solver;
+   ams_data -> B_Pi_block_mode = B_Pi_block_mode;
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AMSSetAlphaAMGCoarseRelaxType
  *
@@ -1987,6 +2126,182 @@ HYPRE_Int hypre_AMSComputeGPi(hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AMSConcurrentRelaxType
+ *
+ * Can an auxiliary AMG solver with this relaxation type run concurrently with
+ * the others? The Gaussian elimination with pivoting (relax types 98 and 99,
+ * and 29 in block mode) calls the f2c LAPACK routines, which keep their local
+ * variables in static storage.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int hypre_AMSConcurrentRelaxType(HYPRE_Int relax_type)
+{
+   return (relax_type != 29 && relax_type != 98 && relax_type != 99);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMSSetSubspaceComm
+ *
+ * Move the auxiliary matrix A_P to the private communicator *comm_ptr, a
+ * duplicate of the communicator of A created on the first call, and rebuild
+ * its communication package. The AMG hierarchy built from A_P inherits the
+ * communicator, so the messages of its V-cycles can not be matched by those
+ * of another subspace solved concurrently.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int hypre_AMSSetSubspaceComm(hypre_ParCSRMatrix *A,
+                                          hypre_ParCSRMatrix *A_P,
+                                          MPI_Comm *comm_ptr)
+{
+   if (*comm_ptr == hypre_MPI_COMM_NULL)
+      hypre_MPI_Comm_dup(hypre_ParCSRMatrixComm(A), comm_ptr);
+
+   hypre_ParCSRMatrixComm(A_P) = *comm_ptr;
+
+   if (hypre_ParCSRMatrixCommPkg(A_P))
+   {
+      hypre_MatvecCommPkgDestroy(hypre_ParCSRMatrixCommPkg(A_P));
+      hypre_ParCSRMatrixCommPkg(A_P) = NULL;
+   }
+   if (hypre_ParCSRMatrixCommPkgT(A_P))
+   {
+      hypre_MatvecCommPkgDestroy(hypre_ParCSRMatrixCommPkgT(A_P));
+      hypre_ParCSRMatrixCommPkgT(A_P) = NULL;
+   }
+   hypre_MatvecCommPkgCreate(A_P);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMSRefreshGalerkin
+ *
+ * Replace *A_P_ptr = P^T A_old P by P^T A P. The new matrix takes over the
+ * ownership of the coarse partitioning from the old one.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int hypre_AMSRefreshGalerkin(hypre_ParCSRMatrix *P,
+                                          hypre_ParCSRMatrix *A,
+                                          hypre_ParCSRMatrix **A_P_ptr)
+{
+   hypre_ParCSRMatrix *A_P_old = *A_P_ptr;
+   hypre_ParCSRMatrix *A_P;
+   HYPRE_Int P_owned_col_starts = hypre_ParCSRMatrixOwnsColStarts(P);
+
+   hypre_BoomerAMGBuildCoarseOperator(P, A, P, &A_P);
+
+   hypre_ParCSRMatrixOwnsColStarts(P) = P_owned_col_starts;
+   hypre_ParCSRMatrixOwnsRowStarts(A_P) = hypre_ParCSRMatrixOwnsRowStarts(A_P_old);
+   hypre_ParCSRMatrixOwnsColStarts(A_P) = hypre_ParCSRMatrixOwnsColStarts(A_P_old);
+   hypre_ParCSRMatrixOwnsRowStarts(A_P_old) = 0;
+   hypre_ParCSRMatrixOwnsColStarts(A_P_old) = 0;
+   hypre_ParCSRMatrixDestroy(A_P_old);
+
+   /* Make sure that A_P has no zero rows */
+   hypre_ParCSRMatrixFixZeroRows(A_P);
+
+   *A_P_ptr = A_P;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMSSetupNumeric
+ *
+ * Repeated setup in the numeric refresh mode. G, Pi (or Pi{x,y,z}) and the
+ * coarse grids and interpolation operators of the auxiliary AMG solvers are
+ * kept from the previous setup. Only the smoother data for A, the Galerkin
+ * products G^T A G and Pi^T A Pi (unless given by the user) and the coarse
+ * grid operators of the auxiliary AMG hierarchies are recomputed.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int hypre_AMSSetupNumeric(hypre_AMSData *ams_data,
+                                       hypre_ParCSRMatrix *A)
+{
+   ams_data -> A = A;
+
+   if (!hypre_ParCSRMatrixCommPkg(ams_data -> A))
+      hypre_MatvecCommPkgCreate(ams_data -> A);
+
+   /* Compute the l1 norm of the rows of A */
+   if (ams_data -> A_relax_type >= 1 && ams_data -> A_relax_type <= 4)
+   {
+      hypre_TFree(ams_data -> A_l1_norms, HYPRE_MEMORY_SHARED);
+      hypre_ParCSRComputeL1Norms(ams_data -> A, ams_data -> A_relax_type,
+                                 NULL, &ams_data -> A_l1_norms);
+   }
+
+   /* Chebyshev? */
+   if (ams_data -> A_relax_type == 16)
+   {
+      hypre_ParCSRMaxEigEstimateCG(ams_data->A, 1, 10,
+                                   &ams_data->A_max_eig_est,
+                                   &ams_data->A_min_eig_est);
+   }
+
+   /* The AMG solver on the range of G^T */
+   if (ams_data -> B_G)
+   {
+      if (ams_data -> owns_A_G)
+         hypre_AMSRefreshGalerkin(ams_data -> G, ams_data -> A, &ams_data -> A_G);
+      if (ams_data -> A_G_comm != hypre_MPI_COMM_NULL)
+         hypre_AMSSetSubspaceComm(ams_data -> A, ams_data -> A_G, &ams_data -> A_G_comm);
+
+      HYPRE_BoomerAMGSetReuseInterp(ams_data -> B_G, 1);
+      HYPRE_BoomerAMGSetup(ams_data -> B_G,
+                           (HYPRE_ParCSRMatrix)ams_data -> A_G,
+                           0, 0);
+   }
+
+   /* The AMG solvers on the range of Pi{x,y,z}^T */
+   if (ams_data -> B_Pix)
+   {
+      hypre_AMSRefreshGalerkin(ams_data -> Pix, ams_data -> A, &ams_data -> A_Pix);
+      if (ams_data -> A_Pix_comm != hypre_MPI_COMM_NULL)
+         hypre_AMSSetSubspaceComm(ams_data -> A, ams_data -> A_Pix, &ams_data -> A_Pix_comm);
+      HYPRE_BoomerAMGSetReuseInterp(ams_data -> B_Pix, 1);
+      HYPRE_BoomerAMGSetup(ams_data -> B_Pix,
+                           (HYPRE_ParCSRMatrix)ams_data -> A_Pix,
+                           0, 0);
+
+      hypre_AMSRefreshGalerkin(ams_data -> Piy, ams_data -> A, &ams_data -> A_Piy);
+      if (ams_data -> A_Piy_comm != hypre_MPI_COMM_NULL)
+         hypre_AMSSetSubspaceComm(ams_data -> A, ams_data -> A_Piy, &ams_data -> A_Piy_comm);
+      HYPRE_BoomerAMGSetReuseInterp(ams_data -> B_Piy, 1);
+      HYPRE_BoomerAMGSetup(ams_data -> B_Piy,
+                           (HYPRE_ParCSRMatrix)ams_data -> A_Piy,
+                           0, 0);
+
+      if (ams_data -> Piz)
+      {
+         hypre_AMSRefreshGalerkin(ams_data -> Piz, ams_data -> A, &ams_data -> A_Piz);
+         if (ams_data -> A_Piz_comm != hypre_MPI_COMM_NULL)
+            hypre_AMSSetSubspaceComm(ams_data -> A, ams_data -> A_Piz, &ams_data -> A_Piz_comm);
+         HYPRE_BoomerAMGSetReuseInterp(ams_data -> B_Piz, 1);
+         HYPRE_BoomerAMGSetup(ams_data -> B_Piz,
+                              (HYPRE_ParCSRMatrix)ams_data -> A_Piz,
+                              0, 0);
+      }
+   }
+
+   /* The AMG solver on the range of Pi^T */
+   if (ams_data -> B_Pi)
+   {
+      if (ams_data -> owns_A_Pi)
+         hypre_AMSRefreshGalerkin(ams_data -> Pi, ams_data -> A, &ams_data -> A_Pi);
+      if (ams_data -> A_Pi_comm != hypre_MPI_COMM_NULL)
+         hypre_AMSSetSubspaceComm(ams_data -> A, ams_data -> A_Pi, &ams_data -> A_Pi_comm);
+
+      HYPRE_BoomerAMGSetReuseInterp(ams_data -> B_Pi, 1);
+      HYPRE_BoomerAMGSetup(ams_data -> B_Pi,
+                           (HYPRE_ParCSRMatrix)ams_data -> A_Pi,
+                           0, 0);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AMSSetup
  *
@@ -2007,8 +2322,36 @@ HYPRE_Int hypre_AMSSetup(void *solver,
 
    HYPRE_Int input_info = 0;
 
+   /* Repeated setup with only new values in A (the temporary vectors are
+      allocated at the end of the first setup) */
+   if (ams_data -> numeric_refresh && ams_data -> r0 &&
+       !ams_data -> interior_nodes && ams_data -> cycle_type != 9)
+      return hypre_AMSSetupNumeric(ams_data, A);
+
    ams_data -> A = A;
 
+   /* Can the additive corrections run concurrently, and do they need private
+      communicators for that? (see hypre_AMSSetConcurrentSubspaces) */
+   ams_data -> use_concurrent = 0;
+   if (ams_data -> concurrent_subspaces &&
+       hypre_AMSConcurrentRelaxType(ams_data -> B_G_relax_type) &&
+       hypre_AMSConcurrentRelaxType(ams_data -> B_G_coarse_relax_type) &&
+       hypre_AMSConcurrentRelaxType(ams_data -> B_Pi_relax_type) &&
+       hypre_AMSConcurrentRelaxType(ams_data -> B_Pi_coarse_relax_type))
+   {
+      HYPRE_Int num_procs, provided;
+
+      hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A), &num_procs);
+      hypre_MPI_Query_thread(&provided);
+
+      if (num_procs == 1)
+         ams_data -> use_concurrent = 1;
+      else if (provided == hypre_MPI_THREAD_MULTIPLE &&
+               (!ams_data -> A_G || ams_data -> owns_A_G) &&
+               (!ams_data -> A_Pi || ams_data -> owns_A_Pi))
+         ams_data -> use_concurrent = 2;
+   }
+
    /* Modifications for problems with zero-conductivity regions */
    if (ams_data -> interior_nodes)
    {
@@ -2280,6 +2623,9 @@ HYPRE_Int hypre_AMSSetup(void *solver,
          ams_data -> owns_A_G = 1;
       }
 
+      if (ams_data -> use_concurrent == 2)
+         hypre_AMSSetSubspaceComm(ams_data -> A, ams_data -> A_G, &ams_data -> A_G_comm);
+
       HYPRE_BoomerAMGSetup(ams_data -> B_G,
                            (HYPRE_ParCSRMatrix)ams_data -> A_G,
                            0, 0);
@@ -2359,6 +2705,9 @@ HYPRE_Int hypre_AMSSetup(void *solver,
          for some kinds of boundary conditions with contact). */
       hypre_ParCSRMatrixFixZeroRows(ams_data -> A_Pix);
 
+      if (ams_data -> use_concurrent == 2)
+         hypre_AMSSetSubspaceComm(ams_data -> A, ams_data -> A_Pix, &ams_data -> A_Pix_comm);
+
       HYPRE_BoomerAMGSetup(ams_data -> B_Pix,
                            (HYPRE_ParCSRMatrix)ams_data -> A_Pix,
                            0, 0);
@@ -2380,6 +2729,9 @@ HYPRE_Int hypre_AMSSetup(void *solver,
          for some kinds of boundary conditions with contact). */
       hypre_ParCSRMatrixFixZeroRows(ams_data -> A_Piy);
 
+      if (ams_data -> use_concurrent == 2)
+         hypre_AMSSetSubspaceComm(ams_data -> A, ams_data -> A_Piy, &ams_data -> A_Piy_comm);
+
       HYPRE_BoomerAMGSetup(ams_data -> B_Piy,
                            (HYPRE_ParCSRMatrix)ams_data -> A_Piy,
                            0, 0);
@@ -2403,6 +2755,9 @@ HYPRE_Int hypre_AMSSetup(void *solver,
             for some kinds of boundary conditions with contact). */
          hypre_ParCSRMatrixFixZeroRows(ams_data -> A_Piz);
 
+         if (ams_data -> use_concurrent == 2)
+            hypre_AMSSetSubspaceComm(ams_data -> A, ams_data -> A_Piz, &ams_data -> A_Piz_comm);
+
          HYPRE_BoomerAMGSetup(ams_data -> B_Piz,
                               (HYPRE_ParCSRMatrix)ams_data -> A_Piz,
                               0, 0);
@@ -2576,7 +2931,11 @@ HYPRE_Int hypre_AMSSetup(void *solver,
          ams_data -> owns_A_Pi = 1;
 
          if (ams_data -> cycle_type != 20)
+         {
             HYPRE_BoomerAMGSetNumFunctions(ams_data -> B_Pi, ams_data -> dim);
+            if (ams_data -> B_Pi_block_mode)
+               hypre_BoomerAMGSetBlockMode(ams_data -> B_Pi);
+         }
          else
             HYPRE_BoomerAMGSetNumFunctions(ams_data -> B_Pi, ams_data -> dim + 1);
          /* HYPRE_BoomerAMGSetNodal(ams_data -> B_Pi, 1); */
@@ -2586,6 +2945,9 @@ HYPRE_Int hypre_AMSSetup(void *solver,
          some kinds of boundary conditions with contact). */
       hypre_ParCSRMatrixFixZeroRows(ams_data -> A_Pi);
 
+      if (ams_data -> use_concurrent == 2)
+         hypre_AMSSetSubspaceComm(ams_data -> A, ams_data -> A_Pi, &ams_data -> A_Pi_comm);
+
       HYPRE_BoomerAMGSetup(ams_data -> B_Pi,
                            (HYPRE_ParCSRMatrix)ams_data -> A_Pi,
                            0, 0);
@@ -2608,6 +2970,29 @@ HYPRE_Int hypre_AMSSetup(void *solver,
    {
       ams_data -> r2 = hypre_ParVectorInDomainOf(ams_data -> Pi);
       ams_data -> g2 = hypre_ParVectorInDomainOf(ams_data -> Pi);
+      if (ams_data -> A_Pi_comm != hypre_MPI_COMM_NULL)
+      {
+         hypre_ParVectorComm(ams_data -> r2) = ams_data -> A_Pi_comm;
+         hypre_ParVectorComm(ams_data -> g2) = ams_data -> A_Pi_comm;
+      }
+   }
+   if (ams_data -> use_concurrent)
+   {
+      if (ams_data -> A_Pix)
+      {
+         ams_data -> r3 = hypre_ParVectorInRangeOf(ams_data -> A_Pix);
+         ams_data -> g3 = hypre_ParVectorInRangeOf(ams_data -> A_Pix);
+      }
+      if (ams_data -> A_Piy)
+      {
+         ams_data -> r4 = hypre_ParVectorInRangeOf(ams_data -> A_Piy);
+         ams_data -> g4 = hypre_ParVectorInRangeOf(ams_data -> A_Piy);
+      }
+      if (ams_data -> A_Piz)
+      {
+         ams_data -> r5 = hypre_ParVectorInRangeOf(ams_data -> A_Piz);
+         ams_data -> g5 = hypre_ParVectorInRangeOf(ams_data -> A_Piz);
+      }
    }
 
    return hypre_error_flag;
@@ -2626,7 +3011,7 @@ HYPRE_Int hypre_AMSSolve(void *solver,
 {
    hypre_AMSData *ams_data = (hypre_AMSData *) solver;
 
-   HYPRE_Int i, my_id = -1;
+   HYPRE_Int i, my_id = -1, concurrent = 0;
    HYPRE_Real r0_norm, r_norm, b_norm, relative_resid = 0, old_resid;
 
    char cycle[30];
@@ -2655,6 +3040,15 @@ HYPRE_Int hypre_AMSSolve(void *solver,
    ri[3] = ams_data -> r1;     gi[3] = ams_data -> g1;
    ri[4] = ams_data -> r1;     gi[4] = ams_data -> g1;
 
+   /* concurrent additive corrections need their own vertex vectors */
+   if (ams_data -> use_concurrent && hypre_NumThreads() > 1)
+   {
+      concurrent = 1;
+      if (ams_data -> r3) { ri[2] = ams_data -> r3; gi[2] = ams_data -> g3; }
+      if (ams_data -> r4) { ri[3] = ams_data -> r4; gi[3] = ams_data -> g4; }
+      if (ams_data -> r5) { ri[4] = ams_data -> r5; gi[4] = ams_data -> g5; }
+   }
+
    /* may need to create an additional temporary vector for relaxation */
    if (hypre_NumThreads() > 1 ||  ams_data -> A_relax_type == 16)
    {
@@ -2803,7 +3197,8 @@ HYPRE_Int hypre_AMSSolve(void *solver,
                                ams_data -> r0,
                                ams_data -> g0,
                                cycle,
-                               z);
+                               z,
+                               concurrent);
 
       /* Compute new residual norms */
       if (ams_data -> maxit > 1)
@@ -2844,6 +3239,76 @@ HYPRE_Int hypre_AMSSolve(void *solver,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSubspacePrecConcurrent
+ *
+ * Apply the additive corrections y += P[i] B[i]^{-1} P[i]^t r0 for the
+ * num_sub subspaces in sub[]. The restrictions and the final sum are done in
+ * the given order, and only the subspace solves run concurrently, each with
+ * its own OpenMP thread team, so the result matches the sequential version.
+ * The vectors r[i] and g[i] must be distinct for the subspaces in sub[].
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRSubspacePrecConcurrent( HYPRE_Int              num_sub,
+                                    HYPRE_Int             *sub,
+                                    hypre_ParCSRMatrix   **A,
+                                    HYPRE_Solver          *B,
+                                    HYPRE_PtrToSolverFcn  *HB,
+                                    hypre_ParCSRMatrix   **P,
+                                    hypre_ParVector      **r,
+                                    hypre_ParVector      **g,
+                                    hypre_ParVector       *y,
+                                    hypre_ParVector       *r0,
+                                    hypre_ParVector       *g0 )
+{
+   HYPRE_Int i, k;
+
+   for (k = 0; k < num_sub; k++)
+   {
+      i = sub[k];
+      hypre_ParCSRMatrixMatvecT(1.0, P[i], r0, 0.0, r[i]);
+      hypre_ParVectorSetConstantValues(g[i], 0.0);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   {
+      HYPRE_Int num_threads = hypre_NumThreads();
+      hypre_int max_levels = omp_get_max_active_levels();
+
+      /* split the threads into one team per subspace solve */
+      if (max_levels < 2)
+         omp_set_max_active_levels(2);
+#pragma omp parallel for private(i,k) num_threads(num_sub) schedule(static,1)
+      for (k = 0; k < num_sub; k++)
+      {
+         i = sub[k];
+         omp_set_num_threads(num_threads / num_sub + (k < num_threads % num_sub));
+         (*HB[i]) (B[i], (HYPRE_Matrix)A[i],
+                   (HYPRE_Vector)r[i], (HYPRE_Vector)g[i]);
+      }
+      omp_set_max_active_levels(max_levels);
+      omp_set_num_threads(num_threads);
+   }
+#else
+   for (k = 0; k < num_sub; k++)
+   {
+      i = sub[k];
+      (*HB[i]) (B[i], (HYPRE_Matrix)A[i],
+                (HYPRE_Vector)r[i], (HYPRE_Vector)g[i]);
+   }
+#endif
+
+   for (k = 0; k < num_sub; k++)
+   {
+      i = sub[k];
+      hypre_ParCSRMatrixMatvec(1.0, P[i], g[i], 0.0, g0);
+      hypre_ParVectorAxpy(1.0, g0, y);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRSubspacePrec
  *
@@ -2854,7 +3319,9 @@ HYPRE_Int hypre_AMSSolve(void *solver,
  * are temporary vectors. A0_* are the fine grid smoothing parameters.
  *
  * The default mode is multiplicative, '+' changes the next correction
- * to additive, based on residual computed at '('.
+ * to additive, based on residual computed at '('. If concurrent is nonzero,
+ * a run of such additive corrections (e.g. "+1+2") is applied concurrently,
+ * see hypre_ParCSRSubspacePrecConcurrent.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int hypre_ParCSRSubspacePrec(/* fine space matrix */
@@ -2890,10 +3357,13 @@ HYPRE_Int hypre_ParCSRSubspacePrec(/* fine space matrix */
                                    hypre_ParVector *g0,
                                    char *cycle,
                                    /* temporary vector */
-                                   hypre_ParVector *z)
+                                   hypre_ParVector *z,
+                                   /* apply additive corrections concurrently? */
+                                   HYPRE_Int concurrent)
 {
-   char *op;
+   char *op, *next;
    HYPRE_Int use_saved_residual = 0;
+   HYPRE_Int sub[5], num_sub, j, k;
 
    for (op = cycle; *op != '\0'; op++)
    {
@@ -2911,6 +3381,31 @@ HYPRE_Int hypre_ParCSRSubspacePrec(/* fine space matrix */
       /* switch to additive correction */
       else if (*op == '+')
       {
+         /* collect the run of nonempty additive corrections starting here */
+         num_sub = 0;
+         for (next = op; concurrent && num_sub < 5 &&
+                 next[0] == '+' && next[1] >= '1' && next[1] <= '5'; next += 2)
+         {
+            j = next[1] - '1';
+            if (!A[j]) continue;
+            for (k = 0; k < num_sub; k++)
+               if (r[sub[k]] == r[j] || g[sub[k]] == g[j])
+                  break;
+            if (k < num_sub) break;
+            sub[num_sub++] = j;
+         }
+
+         if (num_sub > 1 && num_sub <= hypre_NumThreads())
+         {
+            hypre_ParCSRSubspacePrecConcurrent(num_sub, sub, A, B, HB, P,
+                                               r, g, y, r0, g0);
+            /* as in the sequential loop, a trailing empty subspace leaves
+               the next correction additive */
+            use_saved_residual = !A[next[-1] - '1'];
+            op = next - 1;
+            continue;
+         }
+
          use_saved_residual = 1;
          continue;
       }
@@ -56,6 +56,18 @@ typedef struct
    /* Does the solver own the coarse grid matrices? */
    HYPRE_Int owns_A_G, owns_A_Pi;
 
+   /* Does a repeated setup keep G, Pi and the auxiliary AMG coarse grids? */
+   HYPRE_Int numeric_refresh;
+
+   /* Run the independent corrections of additive cycles concurrently? */
+   HYPRE_Int concurrent_subspaces;
+   /* Can they run concurrently after the last setup? 0 (no), 1 (yes, with a
+      single MPI task) or 2 (yes, with the private communicators below) */
+   HYPRE_Int use_concurrent;
+   /* Private communicators of the auxiliary matrices (MPI_COMM_NULL if the
+      concurrent corrections run on a single MPI task or are not used) */
+   MPI_Comm A_G_comm, A_Pi_comm, A_Pix_comm, A_Piy_comm, A_Piz_comm;
+
    /* Coordinates of the vertices (z = 0 if dim == 2) */
    hypre_ParVector *x, *y, *z;
 
@@ -109,9 +121,13 @@ typedef struct
    HYPRE_Real B_Pi_theta;
    HYPRE_Int B_Pi_interp_type;
    HYPRE_Int B_Pi_Pmax;
+   /* Store the coarse grids of B_Pi as dim x dim block matrices? */
+   HYPRE_Int B_Pi_block_mode;
 
    /* Temporary vectors */
    hypre_ParVector *r0, *g0, *r1, *g1, *r2, *g2;
+   /* Separate vertex vectors for B_Pi{x,y,z} in concurrent additive cycles */
+   hypre_ParVector *r3, *g3, *r4, *g4, *r5, *g5;
 
    /* Output log info */
    HYPRE_Int num_iterations;
@@ -170,6 +186,7 @@ typedef struct
 #define hypre_AMSDataPoissonAlphaAMGAggLevels(ams_data) ((ams_data)->B_Pi_agg_levels)
 #define hypre_AMSDataPoissonAlphaAMGRelaxType(ams_data) ((ams_data)->B_Pi_relax_type)
 #define hypre_AMSDataPoissonAlphaAMGStrengthThreshold(ams_data) ((ams_data)->B_Pi_theta)
+#define hypre_AMSDataPoissonAlphaAMGBlockMode(ams_data) ((ams_data)->B_Pi_block_mode)
 
 #define hypre_AMSDataPoissonBetaAMGCoarsenType(ams_data) ((ams_data)->B_G_coarsen_type)
 #define hypre_AMSDataPoissonBetaAMGAggLevels(ams_data) ((ams_data)->B_G_agg_levels)
@@ -357,6 +357,11 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataRtemp(amg_data)  = NULL;
    hypre_ParAMGDataPtemp(amg_data)  = NULL;
    hypre_ParAMGDataZtemp(amg_data)  = NULL;
+   hypre_ParAMGDataMultiNumVectors(amg_data) = 0;
+   hypre_ParAMGDataMultiNumLevels(amg_data)  = 0;
+   hypre_ParAMGDataFMultiArray(amg_data)     = NULL;
+   hypre_ParAMGDataUMultiArray(amg_data)     = NULL;
+   hypre_ParAMGDataVtempMultiArray(amg_data) = NULL;
    hypre_ParAMGDataFArray(amg_data) = NULL;
    hypre_ParAMGDataUArray(amg_data) = NULL;
    hypre_ParAMGDataDofFunc(amg_data) = NULL;
@@ -388,6 +393,12 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataCoordDim(amg_data) = 0;
    hypre_ParAMGDataCoordinates(amg_data) = NULL;
 
+   hypre_ParAMGDataStructNDim(amg_data) = 0;
+   hypre_ParAMGDataStructRegion(amg_data) = NULL;
+   hypre_ParAMGDataStructIndex(amg_data) = NULL;
+   hypre_ParAMGDataStructRegionArray(amg_data) = NULL;
+   hypre_ParAMGDataStructIndexArray(amg_data) = NULL;
+
   /* for fitting vectors for interp */ 
    hypre_BoomerAMGSetInterpVecVariant(amg_data, 0);
    hypre_BoomerAMGSetInterpVectors(amg_data, 0, NULL); 
@@ -414,12 +425,17 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataAMat(amg_data) = NULL;
    hypre_ParAMGDataBVec(amg_data) = NULL;
    hypre_ParAMGDataCommInfo(amg_data) = NULL;
+   hypre_ParAMGDataAPiv(amg_data) = NULL;
+   hypre_ParAMGDataASingular(amg_data) = 0;
 
    hypre_ParAMGDataNonGalerkinTol(amg_data) = nongalerkin_tol;
    hypre_ParAMGDataNonGalTolArray(amg_data) = NULL;
 
    hypre_ParAMGDataRAP2(amg_data) = 0;
    hypre_ParAMGDataKeepTranspose(amg_data) = 0;
+   hypre_ParAMGDataReuseInterp(amg_data) = 0;
+   hypre_ParAMGDataCommStats(amg_data) = 0;
+   hypre_ParAMGDataCommStatsOn(amg_data) = 0;
    
 /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointKeepMarkerArray(amg_data) = NULL;
@@ -454,6 +470,11 @@ hypre_BoomerAMGDestroy( void *data )
 
    HYPRE_ANNOTATION_BEGIN("BoomerAMG.destroy");
 
+   if (hypre_ParAMGDataCommStatsOn(amg_data))
+   {
+      hypre_comm_stats_active--;
+   }
+
 #ifdef HAVE_DSUPERLU
    if (hypre_ParAMGDataDSLUThreshold(amg_data) > 0)
       hypre_SLUDistDestroy(hypre_ParAMGDataDSLUSolver(amg_data));
@@ -626,6 +647,7 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_ParVectorDestroy(hypre_ParAMGDataPtemp(amg_data));
    if (hypre_ParAMGDataZtemp(amg_data))
       hypre_ParVectorDestroy(hypre_ParAMGDataZtemp(amg_data));
+   hypre_BoomerAMGDestroyMultiVectors(amg_data);
 
    if (hypre_ParAMGDataDofFuncArray(amg_data))
    {
@@ -634,6 +656,16 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataDofFuncArray(amg_data), HYPRE_MEMORY_HOST);
       hypre_ParAMGDataDofFuncArray(amg_data) = NULL;
    }
+   if (hypre_ParAMGDataStructIndexArray(amg_data))
+   {
+      for (i=1; i < num_levels; i++)
+      {
+         hypre_TFree(hypre_ParAMGDataStructRegionArray(amg_data)[i], HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataStructIndexArray(amg_data)[i], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(hypre_ParAMGDataStructRegionArray(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataStructIndexArray(amg_data), HYPRE_MEMORY_HOST);
+   }
    if (hypre_ParAMGDataRestriction(amg_data))
    {
      hypre_TFree(hypre_ParAMGDataRBlockArray(amg_data),HYPRE_MEMORY_HOST);
@@ -746,6 +778,7 @@ hypre_BoomerAMGDestroy( void *data )
    if (hypre_ParAMGDataAMat(amg_data)) hypre_TFree(hypre_ParAMGDataAMat(amg_data), HYPRE_MEMORY_HOST);
    if (hypre_ParAMGDataBVec(amg_data)) hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST);
    if (hypre_ParAMGDataCommInfo(amg_data)) hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
+   if (hypre_ParAMGDataAPiv(amg_data)) hypre_TFree(hypre_ParAMGDataAPiv(amg_data), HYPRE_MEMORY_HOST);
 
    if (new_comm != hypre_MPI_COMM_NULL) 
    {
@@ -2642,6 +2675,37 @@ hypre_BoomerAMGSetCoordinates( void *data,
   return (ierr);
 }
 
+/*--------------------------------------------------------------------------
+ * Logically structured grid indices of the local rows (see par_coordinates.c);
+ * the arrays are not copied and must persist through the setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetStructCoordinates( void      *data,
+                                     HYPRE_Int  ndim,
+                                     HYPRE_Int *region,
+                                     HYPRE_Int *index )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (index && (ndim < 1 || ndim > 3))
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataStructNDim(amg_data) = index ? ndim : 0;
+   hypre_ParAMGDataStructRegion(amg_data) = region;
+   hypre_ParAMGDataStructIndex(amg_data) = index;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Routines to set the problem data parameters
  *--------------------------------------------------------------------------*/
@@ -4065,6 +4129,42 @@ hypre_BoomerAMGSetKeepTranspose( void   *data,
   return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetReuseInterp( void   *data,
+                               HYPRE_Int   reuse_interp)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+  hypre_ParAMGDataReuseInterp(amg_data) = reuse_interp;
+  return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetCommStats( void   *data,
+                             HYPRE_Int   comm_stats)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+  hypre_ParAMGDataCommStats(amg_data) = comm_stats;
+  /* stop counting, unless other solvers still do */
+  if (!comm_stats && hypre_ParAMGDataCommStatsOn(amg_data))
+  {
+     hypre_comm_stats_active--;
+     hypre_ParAMGDataCommStatsOn(amg_data) = 0;
+  }
+  return hypre_error_flag;
+}
+
 #ifdef HAVE_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
@@ -159,6 +159,13 @@ typedef struct
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
 
+   /* multivector work space for solves with several right-hand sides */
+   HYPRE_Int          multi_num_vectors;
+   HYPRE_Int          multi_num_levels;
+   hypre_ParVector  **F_multi_array;
+   hypre_ParVector  **U_multi_array;
+   hypre_ParVector  **Vtemp_multi_array;
+
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int                 gsmg;        /* nonzero indicates use of GSMG */
    HYPRE_Int                 num_samples; /* number of sample vectors */
@@ -185,6 +192,13 @@ typedef struct
    HYPRE_Int      coorddim;
    float    *coordinates;
 
+   /* logically structured grid data for geometric coarsening */
+   HYPRE_Int      struct_ndim;
+   HYPRE_Int     *struct_region;
+   HYPRE_Int     *struct_index;
+   HYPRE_Int    **struct_region_array;
+   HYPRE_Int    **struct_index_array;
+
    /* data for fitting vectors in interpolation */
    HYPRE_Int               num_interp_vectors;
    HYPRE_Int               num_levels_interp_vectors; /* not set by user */
@@ -209,6 +223,8 @@ typedef struct
    HYPRE_Real *A_mat;
    HYPRE_Real *b_vec;
    HYPRE_Int *comm_info;
+   HYPRE_Int *A_piv;   /* pivots of the LU factors in A_mat (block mode) */
+   HYPRE_Int  A_singular; /* A_mat singular, coarsest level is relaxed instead */
 
    /* information for multiplication with Lambda - additive AMG */
    HYPRE_Int      additive;
@@ -229,6 +245,14 @@ typedef struct
    HYPRE_Int rap2;
 
    HYPRE_Int keepTranspose;
+
+   /* reuse the coarse grids and interpolation in a repeated setup */
+   HYPRE_Int reuse_interp;
+
+   /* collect and print communication statistics of the hierarchy */
+   HYPRE_Int comm_stats;
+   /* does this solver hold a reference on hypre_comm_stats_active? */
+   HYPRE_Int comm_stats_on;
 	
    /* information for preserving indeces as coarse grid points */
    HYPRE_Int C_point_coarse_level;
@@ -376,6 +400,11 @@ typedef struct
 #define hypre_ParAMGDataRtemp(amg_data) ((amg_data)->Rtemp)
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
+#define hypre_ParAMGDataMultiNumVectors(amg_data) ((amg_data)->multi_num_vectors)
+#define hypre_ParAMGDataMultiNumLevels(amg_data) ((amg_data)->multi_num_levels)
+#define hypre_ParAMGDataFMultiArray(amg_data) ((amg_data)->F_multi_array)
+#define hypre_ParAMGDataUMultiArray(amg_data) ((amg_data)->U_multi_array)
+#define hypre_ParAMGDataVtempMultiArray(amg_data) ((amg_data)->Vtemp_multi_array)
 
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
@@ -403,6 +432,12 @@ typedef struct
 #define hypre_ParAMGDataCoordDim(amg_data) ((amg_data)->coorddim)
 #define hypre_ParAMGDataCoordinates(amg_data) ((amg_data)->coordinates)
 
+#define hypre_ParAMGDataStructNDim(amg_data) ((amg_data)->struct_ndim)
+#define hypre_ParAMGDataStructRegion(amg_data) ((amg_data)->struct_region)
+#define hypre_ParAMGDataStructIndex(amg_data) ((amg_data)->struct_index)
+#define hypre_ParAMGDataStructRegionArray(amg_data) ((amg_data)->struct_region_array)
+#define hypre_ParAMGDataStructIndexArray(amg_data) ((amg_data)->struct_index_array)
+
 
 #define hypre_ParAMGNumInterpVectors(amg_data) ((amg_data)->num_interp_vectors)
 #define hypre_ParAMGNumLevelsInterpVectors(amg_data) ((amg_data)->num_levels_interp_vectors)
@@ -427,6 +462,8 @@ typedef struct
 #define hypre_ParAMGDataAMat(amg_data) ((amg_data)->A_mat)
 #define hypre_ParAMGDataBVec(amg_data) ((amg_data)->b_vec)
 #define hypre_ParAMGDataCommInfo(amg_data) ((amg_data)->comm_info)
+#define hypre_ParAMGDataAPiv(amg_data) ((amg_data)->A_piv)
+#define hypre_ParAMGDataASingular(amg_data) ((amg_data)->A_singular)
 
 /* additive AMG parameters */
 #define hypre_ParAMGDataAdditive(amg_data) ((amg_data)->additive)
@@ -451,6 +488,9 @@ typedef struct
 
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
+#define hypre_ParAMGDataReuseInterp(amg_data) ((amg_data)->reuse_interp)
+#define hypre_ParAMGDataCommStats(amg_data) ((amg_data)->comm_stats)
+#define hypre_ParAMGDataCommStatsOn(amg_data) ((amg_data)->comm_stats_on)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataCPointKeepMarkerArray(amg_data) ((amg_data)-> C_point_marker_array)
@@ -0,0 +1,870 @@
+/*BHEADER**********************************************************************
+ * Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+ * Produced at the Lawrence Livermore National Laboratory.
+ * This file is part of HYPRE.  See file COPYRIGHT for details.
+ *
+ * HYPRE is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License (as published by the Free
+ * Software Foundation) version 2.1 dated February 1999.
+ *
+ * $Revision$
+ ***********************************************************************EHEADER*/
+
+/******************************************************************************
+ *
+ * AMG solve routines for several right-hand sides.
+ *
+ * The right-hand sides and solutions are stored as multivectors
+ * (hypre_ParMultiVectorCreate).  All columns are cycled together so that the
+ * level matrices are streamed once per matvec or relaxation sweep, no matter
+ * how many right-hand sides are solved.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGDestroyMultiVectors
+ *
+ * Frees the multivector work space allocated by hypre_BoomerAMGSolveMulti.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGDestroyMultiVectors( void *amg_vdata )
+{
+   hypre_ParAMGData *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int         num_levels = hypre_ParAMGDataMultiNumLevels(amg_data);
+   hypre_ParVector **F_multi    = hypre_ParAMGDataFMultiArray(amg_data);
+   hypre_ParVector **U_multi    = hypre_ParAMGDataUMultiArray(amg_data);
+   hypre_ParVector **Vtemp_multi = hypre_ParAMGDataVtempMultiArray(amg_data);
+   HYPRE_Int         j;
+
+   /* level 0 vectors belong to the user */
+   for (j = 1; j < num_levels; j++)
+   {
+      hypre_ParVectorDestroy(F_multi[j]);
+      hypre_ParVectorDestroy(U_multi[j]);
+   }
+   for (j = 0; j < num_levels; j++)
+   {
+      hypre_ParVectorDestroy(Vtemp_multi[j]);
+   }
+   hypre_TFree(F_multi, HYPRE_MEMORY_HOST);
+   hypre_TFree(U_multi, HYPRE_MEMORY_HOST);
+   hypre_TFree(Vtemp_multi, HYPRE_MEMORY_HOST);
+
+   hypre_ParAMGDataFMultiArray(amg_data)     = NULL;
+   hypre_ParAMGDataUMultiArray(amg_data)     = NULL;
+   hypre_ParAMGDataVtempMultiArray(amg_data) = NULL;
+   hypre_ParAMGDataMultiNumVectors(amg_data) = 0;
+   hypre_ParAMGDataMultiNumLevels(amg_data)  = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCreateMultiVectors
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGCreateMultiVectors( hypre_ParAMGData *amg_data,
+                                   HYPRE_Int         num_vectors )
+{
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array    = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParVector    **F_multi;
+   hypre_ParVector    **U_multi;
+   hypre_ParVector    **Vtemp_multi;
+   MPI_Comm             comm;
+   HYPRE_Int            j;
+
+   if (hypre_ParAMGDataMultiNumVectors(amg_data) == num_vectors &&
+       hypre_ParAMGDataMultiNumLevels(amg_data) == num_levels)
+   {
+      return hypre_error_flag;
+   }
+   hypre_BoomerAMGDestroyMultiVectors(amg_data);
+
+   F_multi     = hypre_CTAlloc(hypre_ParVector *, num_levels, HYPRE_MEMORY_HOST);
+   U_multi     = hypre_CTAlloc(hypre_ParVector *, num_levels, HYPRE_MEMORY_HOST);
+   Vtemp_multi = hypre_CTAlloc(hypre_ParVector *, num_levels, HYPRE_MEMORY_HOST);
+
+   for (j = 0; j < num_levels; j++)
+   {
+      comm = hypre_ParCSRMatrixComm(A_array[j]);
+      if (j > 0)
+      {
+         F_multi[j] = hypre_ParMultiVectorCreate(comm,
+                                                 hypre_ParCSRMatrixGlobalNumRows(A_array[j]),
+                                                 hypre_ParCSRMatrixRowStarts(A_array[j]),
+                                                 num_vectors);
+         hypre_ParVectorInitialize(F_multi[j]);
+         hypre_ParVectorSetPartitioningOwner(F_multi[j], 0);
+
+         U_multi[j] = hypre_ParMultiVectorCreate(comm,
+                                                 hypre_ParCSRMatrixGlobalNumRows(A_array[j]),
+                                                 hypre_ParCSRMatrixRowStarts(A_array[j]),
+                                                 num_vectors);
+         hypre_ParVectorInitialize(U_multi[j]);
+         hypre_ParVectorSetPartitioningOwner(U_multi[j], 0);
+      }
+      Vtemp_multi[j] = hypre_ParMultiVectorCreate(comm,
+                                                  hypre_ParCSRMatrixGlobalNumRows(A_array[j]),
+                                                  hypre_ParCSRMatrixRowStarts(A_array[j]),
+                                                  num_vectors);
+      hypre_ParVectorInitialize(Vtemp_multi[j]);
+      hypre_ParVectorSetPartitioningOwner(Vtemp_multi[j], 0);
+   }
+
+   hypre_ParAMGDataFMultiArray(amg_data)     = F_multi;
+   hypre_ParAMGDataUMultiArray(amg_data)     = U_multi;
+   hypre_ParAMGDataVtempMultiArray(amg_data) = Vtemp_multi;
+   hypre_ParAMGDataMultiNumVectors(amg_data) = num_vectors;
+   hypre_ParAMGDataMultiNumLevels(amg_data)  = num_levels;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiCycleSupported
+ *
+ * Returns 1 if the current hierarchy and cycle options can be applied to all
+ * columns at once by hypre_BoomerAMGCycleMulti.  Otherwise the columns are
+ * solved one at a time.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiCycleSupported( hypre_ParAMGData *amg_data )
+{
+   HYPRE_Int  num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int  additive        = hypre_ParAMGDataAdditive(amg_data);
+   HYPRE_Int  mult_additive   = hypre_ParAMGDataMultAdditive(amg_data);
+   HYPRE_Int  simple          = hypre_ParAMGDataSimple(amg_data);
+   HYPRE_Int  k, relax_type;
+
+   if (num_levels < 2 ||
+       hypre_ParAMGDataBlockMode(amg_data) ||
+       hypre_ParAMGDataSmoothNumLevels(amg_data) > 0 ||
+       hypre_ParAMGDataGridRelaxPoints(amg_data) != NULL ||
+       hypre_ParAMGDataParticipate(amg_data))
+   {
+      return 0;
+   }
+
+   if ((additive >= 0 && additive < num_levels) ||
+       (mult_additive >= 0 && mult_additive < num_levels) ||
+       (simple >= 0 && simple < num_levels))
+   {
+      return 0;
+   }
+
+#ifdef HAVE_DSUPERLU
+   if (hypre_ParAMGDataDSLUSolver(amg_data) != NULL)
+   {
+      return 0;
+   }
+#endif
+
+   for (k = 1; k < 4; k++)
+   {
+      relax_type = grid_relax_type[k];
+      if (relax_type != 0 && relax_type != 3 && relax_type != 4 && relax_type != 6)
+      {
+         /* direct solves are applied column by column on the coarsest grid */
+         if (k < 3 || (relax_type != 9 && relax_type != 99))
+         {
+            return 0;
+         }
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulti
+ *
+ * Relaxation for all columns of the multivectors f and u.  Each matrix row
+ * is read once and applied to every column.  Supported relax types are
+ *
+ *    0 - weighted Jacobi
+ *    3 - hybrid Gauss-Seidel/SOR, forward solve
+ *    4 - hybrid Gauss-Seidel/SOR, backward solve
+ *    6 - hybrid symmetric Gauss-Seidel/SSOR
+ *
+ * with the same updates (including the thread partitioning) as
+ * hypre_BoomerAMGRelax.  Vtemp must be a multivector of the same shape.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMulti( hypre_ParCSRMatrix *A,
+                           hypre_ParVector    *f,
+                           HYPRE_Int          *cf_marker,
+                           HYPRE_Int           relax_type,
+                           HYPRE_Int           relax_points,
+                           HYPRE_Real          relax_weight,
+                           HYPRE_Real          omega,
+                           hypre_ParVector    *u,
+                           hypre_ParVector    *Vtemp )
+{
+   MPI_Comm                comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix        *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real             *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int              *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix        *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real             *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int              *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int              *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg    *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int               n             = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_Vector           *u_local       = hypre_ParVectorLocalVector(u);
+   hypre_Vector           *f_local       = hypre_ParVectorLocalVector(f);
+   hypre_Vector           *v_local       = hypre_ParVectorLocalVector(Vtemp);
+   HYPRE_Real             *u_data        = hypre_VectorData(u_local);
+   HYPRE_Real             *f_data        = hypre_VectorData(f_local);
+   HYPRE_Real             *v_data        = hypre_VectorData(v_local);
+   HYPRE_Int               num_vectors   = hypre_VectorNumVectors(u_local);
+   HYPRE_Int               u_vs          = hypre_VectorVectorStride(u_local);
+   HYPRE_Int               u_is          = hypre_VectorIndexStride(u_local);
+   HYPRE_Int               f_vs          = hypre_VectorVectorStride(f_local);
+   HYPRE_Int               f_is          = hypre_VectorIndexStride(f_local);
+   HYPRE_Int               v_vs          = hypre_VectorVectorStride(v_local);
+   HYPRE_Int               v_is          = hypre_VectorIndexStride(v_local);
+
+   hypre_ParCSRCommHandle **comm_handle;
+   HYPRE_Real            **v_buf_data;
+   HYPRE_Real             *Vext_data = NULL;
+   HYPRE_Real             *res_data;
+
+   HYPRE_Int               num_procs, num_threads;
+   HYPRE_Int               num_sends, begin, end;
+   HYPRE_Int               weighted, use_vtemp;
+   HYPRE_Int               i, ii, j, jj, jv, t, pass, num_passes;
+   HYPRE_Real              one_minus_weight = 1.0 - relax_weight;
+   HYPRE_Real              one_minus_omega  = 1.0 - omega;
+   HYPRE_Real              prod             = 1.0 - relax_weight*omega;
+
+   if (relax_type != 0 && relax_type != 3 && relax_type != 4 && relax_type != 6)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   num_threads = hypre_NumThreads();
+
+   /*-----------------------------------------------------------------
+    * Get the off-processor values of all columns of u
+    *-----------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      begin     = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+      end       = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+      Vext_data   = hypre_CTAlloc(HYPRE_Real, num_vectors*num_cols_offd,
+                                  HYPRE_MEMORY_HOST);
+      v_buf_data  = hypre_CTAlloc(HYPRE_Real *, num_vectors, HYPRE_MEMORY_HOST);
+      comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle *, num_vectors,
+                                  HYPRE_MEMORY_HOST);
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         v_buf_data[jv] = hypre_CTAlloc(HYPRE_Real, end - begin, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = begin; i < end; i++)
+         {
+            v_buf_data[jv][i - begin] =
+               u_data[jv*u_vs + hypre_ParCSRCommPkgSendMapElmt(comm_pkg,i)*u_is];
+         }
+         comm_handle[jv] = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data[jv],
+                                                        &Vext_data[jv*num_cols_offd]);
+      }
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         hypre_ParCSRCommHandleDestroy(comm_handle[jv]);
+         hypre_TFree(v_buf_data[jv], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+   }
+
+   /*-----------------------------------------------------------------
+    * Copy the current approximation when the update needs it
+    *-----------------------------------------------------------------*/
+
+   weighted  = (relax_weight != 1 || omega != 1);
+   use_vtemp = (relax_type == 0 || weighted || num_threads > 1);
+   if (use_vtemp)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jv) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            v_data[jv*v_vs + i*v_is] = u_data[jv*u_vs + i*u_is];
+         }
+      }
+   }
+
+   /* per thread: res, res0, res2 for every column */
+   res_data = hypre_CTAlloc(HYPRE_Real, 3*num_vectors*num_threads, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------
+    * Weighted Jacobi
+    *-----------------------------------------------------------------*/
+
+   if (relax_type == 0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,ii,jj,jv,t) HYPRE_SMP_SCHEDULE
+#endif
+      for (t = 0; t < num_threads; t++)
+      {
+         HYPRE_Real *res  = res_data + 3*num_vectors*t;
+         HYPRE_Int   size = n/num_threads;
+         HYPRE_Int   rest = n - size*num_threads;
+         HYPRE_Int   ns   = (t < rest) ? t*size+t : t*size+rest;
+         HYPRE_Int   ne   = (t < rest) ? (t+1)*size+t+1 : (t+1)*size+rest;
+         HYPRE_Real  a;
+
+         for (i = ns; i < ne; i++)
+         {
+            if ( (relax_points == 0 || cf_marker[i] == relax_points) &&
+                 A_diag_data[A_diag_i[i]] != 0.0 )
+            {
+               for (jv = 0; jv < num_vectors; jv++)
+               {
+                  res[jv] = f_data[jv*f_vs + i*f_is];
+               }
+               for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+               {
+                  ii = A_diag_j[jj];
+                  a  = A_diag_data[jj];
+                  for (jv = 0; jv < num_vectors; jv++)
+                  {
+                     res[jv] -= a * v_data[jv*v_vs + ii*v_is];
+                  }
+               }
+               for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+               {
+                  ii = A_offd_j[jj];
+                  a  = A_offd_data[jj];
+                  for (jv = 0; jv < num_vectors; jv++)
+                  {
+                     res[jv] -= a * Vext_data[jv*num_cols_offd + ii];
+                  }
+               }
+               a = A_diag_data[A_diag_i[i]];
+               for (jv = 0; jv < num_vectors; jv++)
+               {
+                  u_data[jv*u_vs + i*u_is] *= one_minus_weight;
+                  u_data[jv*u_vs + i*u_is] += relax_weight * res[jv] / a;
+               }
+            }
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * Hybrid Gauss-Seidel / SOR: Gauss-Seidel within each thread's block
+    * of rows, Jacobi between blocks and processors.
+    *-----------------------------------------------------------------*/
+
+   else
+   {
+      num_passes = (relax_type == 6) ? 2 : 1;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,ii,j,jj,jv,t,pass) HYPRE_SMP_SCHEDULE
+#endif
+      for (t = 0; t < num_threads; t++)
+      {
+         HYPRE_Real *res  = res_data + 3*num_vectors*t;
+         HYPRE_Real *res0 = res + num_vectors;
+         HYPRE_Real *res2 = res0 + num_vectors;
+         HYPRE_Int   size = n/num_threads;
+         HYPRE_Int   rest = n - size*num_threads;
+         HYPRE_Int   ns   = (t < rest) ? t*size+t : t*size+rest;
+         HYPRE_Int   ne   = (t < rest) ? (t+1)*size+t+1 : (t+1)*size+rest;
+         HYPRE_Real  a;
+
+         for (pass = 0; pass < num_passes; pass++)
+         {
+            HYPRE_Int backward = (relax_type == 4 || pass == 1);
+
+            for (j = ns; j < ne; j++)
+            {
+               i = backward ? (ne - 1 - (j - ns)) : j;
+
+               if ( (relax_points != 0 && cf_marker[i] != relax_points) ||
+                    A_diag_data[A_diag_i[i]] == 0.0 )
+               {
+                  continue;
+               }
+
+               for (jv = 0; jv < num_vectors; jv++)
+               {
+                  res[jv]  = f_data[jv*f_vs + i*f_is];
+                  res0[jv] = 0.0;
+                  res2[jv] = 0.0;
+               }
+               for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+               {
+                  ii = A_diag_j[jj];
+                  a  = A_diag_data[jj];
+                  if (ii >= ns && ii < ne)
+                  {
+                     if (weighted)
+                     {
+                        for (jv = 0; jv < num_vectors; jv++)
+                        {
+                           res0[jv] -= a * u_data[jv*u_vs + ii*u_is];
+                           res2[jv] += a * v_data[jv*v_vs + ii*v_is];
+                        }
+                     }
+                     else
+                     {
+                        for (jv = 0; jv < num_vectors; jv++)
+                        {
+                           res[jv] -= a * u_data[jv*u_vs + ii*u_is];
+                        }
+                     }
+                  }
+                  else
+                  {
+                     for (jv = 0; jv < num_vectors; jv++)
+                     {
+                        res[jv] -= a * v_data[jv*v_vs + ii*v_is];
+                     }
+                  }
+               }
+               for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+               {
+                  ii = A_offd_j[jj];
+                  a  = A_offd_data[jj];
+                  for (jv = 0; jv < num_vectors; jv++)
+                  {
+                     res[jv] -= a * Vext_data[jv*num_cols_offd + ii];
+                  }
+               }
+               a = A_diag_data[A_diag_i[i]];
+               if (weighted)
+               {
+                  for (jv = 0; jv < num_vectors; jv++)
+                  {
+                     u_data[jv*u_vs + i*u_is] *= prod;
+                     u_data[jv*u_vs + i*u_is] += relax_weight*(omega*res[jv] + res0[jv] +
+                                                 one_minus_omega*res2[jv]) / a;
+                  }
+               }
+               else
+               {
+                  for (jv = 0; jv < num_vectors; jv++)
+                  {
+                     u_data[jv*u_vs + i*u_is] = res[jv] / a;
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   hypre_TFree(res_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCycleMulti
+ *
+ * One cycle for all columns of the multivectors in F_array and U_array.
+ * Follows hypre_BoomerAMGCycle for the options accepted by
+ * hypre_BoomerAMGMultiCycleSupported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGCycleMulti( void              *amg_vdata,
+                           hypre_ParVector  **F_array,
+                           hypre_ParVector  **U_array )
+{
+   hypre_ParAMGData    *amg_data = (hypre_ParAMGData*) amg_vdata;
+
+   hypre_ParCSRMatrix **A_array          = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array          = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array          = hypre_ParAMGDataRArray(amg_data);
+   hypre_ParVector    **Vtemp_array      = hypre_ParAMGDataVtempMultiArray(amg_data);
+   HYPRE_Int          **CF_marker_array  = hypre_ParAMGDataCFMarkerArray(amg_data);
+   HYPRE_Int            num_levels       = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            cycle_type       = hypre_ParAMGDataCycleType(amg_data);
+   HYPRE_Int           *num_grid_sweeps  = hypre_ParAMGDataNumGridSweeps(amg_data);
+   HYPRE_Int           *grid_relax_type  = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int            relax_order      = hypre_ParAMGDataRelaxOrder(amg_data);
+   HYPRE_Real          *relax_weight     = hypre_ParAMGDataRelaxWeight(amg_data);
+   HYPRE_Real          *omega            = hypre_ParAMGDataOmega(amg_data);
+   HYPRE_Int            restri_type      = hypre_ParAMGDataRestriction(amg_data);
+   HYPRE_Real           cycle_op_count   = hypre_ParAMGDataCycleOpCount(amg_data);
+   HYPRE_Int            num_vectors      = hypre_ParVectorNumVectors(F_array[0]);
+
+   hypre_ParVector    **F_single         = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector    **U_single         = hypre_ParAMGDataUArray(amg_data);
+
+   HYPRE_Int           *lev_counter;
+   HYPRE_Int            relax_points[2];
+   HYPRE_Int            num_relax_points;
+   HYPRE_Int            level, fine_grid, coarse_grid;
+   HYPRE_Int            cycle_param, relax_type, num_sweep;
+   HYPRE_Int            Not_Finished;
+   HYPRE_Int            j, jv, k, ip;
+
+   lev_counter = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+
+   /* see hypre_BoomerAMGCycle for a description of the cycling control */
+   lev_counter[0] = 1;
+   for (k = 1; k < num_levels; ++k)
+   {
+      lev_counter[k] = cycle_type;
+   }
+
+   level = 0;
+   cycle_param = 1;
+   Not_Finished = 1;
+
+   while (Not_Finished)
+   {
+      num_sweep  = num_grid_sweeps[cycle_param];
+      relax_type = grid_relax_type[cycle_param];
+
+      if (relax_type == 9 || relax_type == 99)
+      {
+         /* Gaussian elimination, one column at a time */
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            hypre_ParMultiVectorGetColumn(F_array[level], jv, F_single[level]);
+            hypre_ParMultiVectorGetColumn(U_array[level], jv, U_single[level]);
+            hypre_GaussElimSolve(amg_data, level, relax_type);
+            hypre_ParMultiVectorSetColumn(U_array[level], jv, U_single[level]);
+         }
+      }
+      else
+      {
+         if (relax_order == 1 && cycle_param < 3)
+         {
+            num_relax_points = 2;
+            relax_points[0] = (cycle_param < 2) ?  1 : -1;
+            relax_points[1] = (cycle_param < 2) ? -1 :  1;
+         }
+         else
+         {
+            num_relax_points = 1;
+            relax_points[0] = 0;
+         }
+
+         for (j = 0; j < num_sweep; j++)
+         {
+            cycle_op_count += num_vectors *
+               hypre_ParCSRMatrixDNumNonzeros(A_array[level]);
+
+            for (ip = 0; ip < num_relax_points; ip++)
+            {
+               hypre_BoomerAMGRelaxMulti(A_array[level], F_array[level],
+                                         CF_marker_array[level], relax_type,
+                                         relax_points[ip], relax_weight[level],
+                                         omega[level], U_array[level],
+                                         Vtemp_array[level]);
+            }
+         }
+      }
+
+      /*------------------------------------------------------------------
+       * Decrement the control counter and determine which grid to visit next
+       *-----------------------------------------------------------------*/
+
+      --lev_counter[level];
+
+      if (lev_counter[level] >= 0 && level != num_levels-1)
+      {
+         /* restrict the residual of all columns */
+         fine_grid = level;
+         coarse_grid = level + 1;
+
+         hypre_ParVectorSetConstantValues(U_array[coarse_grid], 0.0);
+
+         hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A_array[fine_grid], U_array[fine_grid],
+                                            1.0, F_array[fine_grid], Vtemp_array[fine_grid]);
+         if (restri_type)
+         {
+            hypre_ParCSRMatrixMatvec(1.0, R_array[fine_grid], Vtemp_array[fine_grid],
+                                     0.0, F_array[coarse_grid]);
+         }
+         else
+         {
+            hypre_ParCSRMatrixMatvecT(1.0, R_array[fine_grid], Vtemp_array[fine_grid],
+                                      0.0, F_array[coarse_grid]);
+         }
+
+         ++level;
+         lev_counter[level] = hypre_max(lev_counter[level], cycle_type);
+         cycle_param = 1;
+         if (level == num_levels-1) cycle_param = 3;
+      }
+      else if (level != 0)
+      {
+         /* interpolate and add the correction of all columns */
+         fine_grid = level - 1;
+         coarse_grid = level;
+
+         hypre_ParCSRMatrixMatvec(1.0, P_array[fine_grid], U_array[coarse_grid],
+                                  1.0, U_array[fine_grid]);
+
+         --level;
+         cycle_param = 2;
+      }
+      else
+      {
+         Not_Finished = 0;
+      }
+   }
+
+   hypre_ParAMGDataCycleOpCount(amg_data) = cycle_op_count;
+
+   hypre_TFree(lev_counter, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSolveMulti
+ *
+ * Solves A u_j = f_j for all columns j of the multivectors f and u.  The
+ * iteration stops when every column satisfies the convergence test of
+ * hypre_BoomerAMGSolve; the reported relative residual is the largest one
+ * over all columns.  Options that hypre_BoomerAMGCycleMulti does not
+ * support are handled by solving the columns one after the other.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSolveMulti( void               *amg_vdata,
+                           hypre_ParCSRMatrix *A,
+                           hypre_ParVector    *f,
+                           hypre_ParVector    *u )
+{
+   MPI_Comm            comm        = hypre_ParCSRMatrixComm(A);
+   hypre_ParAMGData   *amg_data    = (hypre_ParAMGData*) amg_vdata;
+
+   HYPRE_Int           amg_print_level = hypre_ParAMGDataPrintLevel(amg_data);
+   HYPRE_Int           converge_type   = hypre_ParAMGDataConvergeType(amg_data);
+   HYPRE_Real          tol             = hypre_ParAMGDataTol(amg_data);
+   HYPRE_Int           min_iter        = hypre_ParAMGDataMinIter(amg_data);
+   HYPRE_Int           max_iter        = hypre_ParAMGDataMaxIter(amg_data);
+   HYPRE_Int           num_vectors     = hypre_ParVectorNumVectors(f);
+   hypre_ParCSRMatrix **A_array        = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParVector   **F_array         = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector   **U_array         = hypre_ParAMGDataUArray(amg_data);
+   hypre_ParVector   **F_multi;
+   hypre_ParVector   **U_multi;
+   hypre_ParVector    *Vtemp;
+
+   hypre_ParVector    *f_col, *u_col;
+   hypre_ParVector    *F0, *U0;
+
+   HYPRE_Real         *resid_nrm, *resid_nrm_init, *rhs_norm;
+   HYPRE_Real          relative_resid, max_relative_resid;
+   HYPRE_Int           cycle_count, max_cycle_count;
+   HYPRE_Int           check_resid;
+   HYPRE_Int           my_id, jv;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   A_array[0] = A;
+
+   /*-----------------------------------------------------------------------
+    * Fall back to one column at a time
+    *-----------------------------------------------------------------------*/
+
+   if (!hypre_BoomerAMGMultiCycleSupported(amg_data))
+   {
+      F0 = F_array[0];
+      U0 = U_array[0];
+
+      f_col = hypre_ParVectorCreate(comm, hypre_ParVectorGlobalSize(f),
+                                    hypre_ParVectorPartitioning(f));
+      hypre_ParVectorInitialize(f_col);
+      hypre_ParVectorSetPartitioningOwner(f_col, 0);
+      u_col = hypre_ParVectorCreate(comm, hypre_ParVectorGlobalSize(u),
+                                    hypre_ParVectorPartitioning(u));
+      hypre_ParVectorInitialize(u_col);
+      hypre_ParVectorSetPartitioningOwner(u_col, 0);
+
+      max_cycle_count = 0;
+      max_relative_resid = 0.0;
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         hypre_ParMultiVectorGetColumn(f, jv, f_col);
+         hypre_ParMultiVectorGetColumn(u, jv, u_col);
+         hypre_BoomerAMGSolve(amg_vdata, A, f_col, u_col);
+         hypre_ParMultiVectorSetColumn(u, jv, u_col);
+
+         max_cycle_count = hypre_max(max_cycle_count,
+                                     hypre_ParAMGDataNumIterations(amg_data));
+         max_relative_resid = hypre_max(max_relative_resid,
+                                        hypre_ParAMGDataRelativeResidualNorm(amg_data));
+      }
+      hypre_ParAMGDataNumIterations(amg_data) = max_cycle_count;
+      hypre_ParAMGDataRelativeResidualNorm(amg_data) = max_relative_resid;
+
+      hypre_ParVectorDestroy(f_col);
+      hypre_ParVectorDestroy(u_col);
+      F_array[0] = F0;
+      U_array[0] = U0;
+
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Set up the multivector hierarchy
+    *-----------------------------------------------------------------------*/
+
+   hypre_BoomerAMGCreateMultiVectors(amg_data, num_vectors);
+   F_multi = hypre_ParAMGDataFMultiArray(amg_data);
+   U_multi = hypre_ParAMGDataUMultiArray(amg_data);
+   Vtemp   = hypre_ParAMGDataVtempMultiArray(amg_data)[0];
+   F_multi[0] = f;
+   U_multi[0] = u;
+
+   resid_nrm      = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   resid_nrm_init = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   rhs_norm       = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+
+   check_resid = (amg_print_level > 1 || tol > 0.);
+   max_relative_resid = 1.0;
+
+   if (check_resid)
+   {
+      hypre_ParVectorCopy(f, Vtemp);
+      if (tol > 0)
+      {
+         hypre_ParCSRMatrixMatvec(1.0, A, u, -1.0, Vtemp);
+      }
+      hypre_ParMultiVectorInnerProd(Vtemp, Vtemp, resid_nrm_init);
+      if (converge_type == 0)
+      {
+         hypre_ParMultiVectorInnerProd(f, f, rhs_norm);
+      }
+
+      max_relative_resid = 0.0;
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         resid_nrm_init[jv] = sqrt(resid_nrm_init[jv]);
+         rhs_norm[jv]       = sqrt(rhs_norm[jv]);
+         if (resid_nrm_init[jv] != resid_nrm_init[jv])
+         {
+            if (amg_print_level > 0)
+            {
+               hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+               hypre_printf("ERROR -- hypre_BoomerAMGSolveMulti: INFs and/or NaNs detected in input.\n");
+               hypre_printf("User probably placed non-numerics in supplied A, x_0, or b.\n");
+               hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+            }
+            hypre_error(HYPRE_ERROR_GENERIC);
+            hypre_TFree(resid_nrm, HYPRE_MEMORY_HOST);
+            hypre_TFree(resid_nrm_init, HYPRE_MEMORY_HOST);
+            hypre_TFree(rhs_norm, HYPRE_MEMORY_HOST);
+            return hypre_error_flag;
+         }
+         if (converge_type != 0)
+         {
+            relative_resid = 1.0;
+         }
+         else if (rhs_norm[jv])
+         {
+            relative_resid = resid_nrm_init[jv] / rhs_norm[jv];
+         }
+         else
+         {
+            relative_resid = resid_nrm_init[jv];
+         }
+         max_relative_resid = hypre_max(max_relative_resid, relative_resid);
+      }
+   }
+
+   if (my_id == 0 && amg_print_level > 1)
+   {
+      hypre_printf("\n\nAMG SOLUTION INFO (%d right-hand sides):\n", num_vectors);
+      hypre_printf("                 max relative\n");
+      hypre_printf("                 residual\n");
+      hypre_printf("                 --------\n");
+      hypre_printf("    Initial      %e\n", max_relative_resid);
+   }
+
+   /*-----------------------------------------------------------------------
+    *    Main cycle loop
+    *-----------------------------------------------------------------------*/
+
+   cycle_count = 0;
+   while ( (max_relative_resid >= tol || cycle_count < min_iter) &&
+           cycle_count < max_iter )
+   {
+      hypre_ParAMGDataCycleOpCount(amg_data) = 0;
+      hypre_BoomerAMGCycleMulti(amg_data, F_multi, U_multi);
+
+      if (check_resid)
+      {
+         hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, Vtemp);
+         hypre_ParMultiVectorInnerProd(Vtemp, Vtemp, resid_nrm);
+
+         max_relative_resid = 0.0;
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            resid_nrm[jv] = sqrt(resid_nrm[jv]);
+            if (converge_type != 0)
+            {
+               relative_resid = resid_nrm_init[jv] ?
+                  resid_nrm[jv] / resid_nrm_init[jv] : resid_nrm[jv];
+            }
+            else if (rhs_norm[jv])
+            {
+               relative_resid = resid_nrm[jv] / rhs_norm[jv];
+            }
+            else
+            {
+               relative_resid = resid_nrm[jv];
+            }
+            max_relative_resid = hypre_max(max_relative_resid, relative_resid);
+         }
+         hypre_ParAMGDataRelativeResidualNorm(amg_data) = max_relative_resid;
+      }
+
+      ++cycle_count;
+      hypre_ParAMGDataNumIterations(amg_data) = cycle_count;
+
+      if (my_id == 0 && amg_print_level > 1)
+      {
+         hypre_printf("    Cycle %2d     %e\n", cycle_count, max_relative_resid);
+      }
+   }
+
+   if (cycle_count == max_iter && tol > 0.)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   F_multi[0] = NULL;
+   U_multi[0] = NULL;
+
+   hypre_TFree(resid_nrm, HYPRE_MEMORY_HOST);
+   hypre_TFree(resid_nrm_init, HYPRE_MEMORY_HOST);
+   hypre_TFree(rhs_norm, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -24,6 +24,27 @@
  *
  *****************************************************************************/
 
+/*****************************************************************************
+ * hypre_BoomerAMGBlockRelaxType
+ *
+ * Block smoother used in block mode in place of a scalar smoother: the
+ * Jacobi variants (0, 7, 18) become block Jacobi (20), the symmetric
+ * Gauss-Seidel variants (6, 8) become symmetric hybrid block Gauss-Seidel
+ * (26) and all other smoothers hybrid block Gauss-Seidel (23).
+ *****************************************************************************/
+
+static HYPRE_Int
+hypre_BoomerAMGBlockRelaxType( HYPRE_Int relax_type )
+{
+   if (relax_type >= 20)
+      return relax_type;
+   if (relax_type == 0 || relax_type == 7 || relax_type == 18)
+      return 20;
+   if (relax_type == 6 || relax_type == 8)
+      return 26;
+   return 23;
+}
+
 /*****************************************************************************
  * hypre_BoomerAMGSetup
  *****************************************************************************/
@@ -52,6 +73,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int                **CF_marker_array;   
    HYPRE_Int                **dof_func_array;   
    HYPRE_Int                 *dof_func;
+   HYPRE_Int                **struct_region_array;
+   HYPRE_Int                **struct_index_array;
+   HYPRE_Int                  struct_ndim;
+   HYPRE_Int                  struct_cdir = -1;
    HYPRE_Int                 *col_offd_S_to_A, *col_offd_Sabs_to_A = NULL;
    HYPRE_Int                 *col_offd_SN_to_AN;
    HYPRE_Real          *relax_weight;
@@ -189,6 +214,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int addlvl = hypre_max(mult_addlvl, additive);
    HYPRE_Int rap2 = hypre_ParAMGDataRAP2(amg_data);
    HYPRE_Int keepTranspose = hypre_ParAMGDataKeepTranspose(amg_data);
+   HYPRE_Int reuse_interp = 0;
 
    HYPRE_Int                **C_point_marker_array;
    HYPRE_Int    local_coarse_size;
@@ -274,6 +300,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    R_array = hypre_ParAMGDataRArray(amg_data);
    CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
    dof_func_array = hypre_ParAMGDataDofFuncArray(amg_data);
+   struct_region_array = hypre_ParAMGDataStructRegionArray(amg_data);
+   struct_index_array = hypre_ParAMGDataStructIndexArray(amg_data);
+   struct_ndim = hypre_ParAMGDataStructNDim(amg_data);
    local_size = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
 
  
@@ -286,6 +315,27 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    C_point_marker_array = hypre_ParAMGDataCPointKeepMarkerArray(amg_data);
 
    HYPRE_ANNOTATION_BEGIN("BoomerAMG.setup");
+   HYPRE_PROFILE_BEGIN("AMG.setup", -1);
+
+   /* count the communication of the hierarchy from here on; the counters
+      of the operator are restarted so they cover this setup only */
+   if (hypre_ParAMGDataCommStats(amg_data))
+   {
+      hypre_ParCSRCommPkg *A_comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+
+      if (!hypre_ParAMGDataCommStatsOn(amg_data))
+      {
+         hypre_comm_stats_active++;
+         hypre_ParAMGDataCommStatsOn(amg_data) = 1;
+      }
+      if (A_comm_pkg)
+      {
+         hypre_ParCSRCommPkgNumExchanges(A_comm_pkg) = 0;
+         hypre_ParCSRCommPkgNumMessages(A_comm_pkg)  = 0;
+         hypre_ParCSRCommPkgNumBytes(A_comm_pkg)     = 0.0;
+         hypre_ParCSRCommPkgWaitTime(A_comm_pkg)     = 0.0;
+      }
+   }
    
    /* change in definition of standard and multipass interpolation, by
       eliminating interp_type 9 and 5 and setting sep_weight instead
@@ -332,11 +382,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       
       for (i=1; i < 3; i++)
       {
-         if (grid_relax_type[i] < 20)
-         {
-            grid_relax_type[i] = 23;
-         }
-         
+         grid_relax_type[i] = hypre_BoomerAMGBlockRelaxType(grid_relax_type[i]);
       }
       if (grid_relax_type[3] < 20) grid_relax_type[3] = 29;  /* GE */
  
@@ -352,8 +398,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
       for (i=0; i < 3; i++)
       {
-         if (grid_relax_type[i] < 20)      
-            grid_relax_type[i] = 23;
+         grid_relax_type[i] = hypre_BoomerAMGBlockRelaxType(grid_relax_type[i]);
       }
              
       if (grid_relax_type[3] < 20) grid_relax_type[3] = 29; /* GE */
@@ -367,6 +412,22 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    /* end of systems checks */
 
+   /* In a repeated setup, keep the coarse grids and interpolation of the
+      previous hierarchy if requested and if only the values of A changed */
+   if (hypre_ParAMGDataReuseInterp(amg_data) && old_num_levels > 1 &&
+       old_num_levels <= max_levels && P_array && P_array[0] &&
+       !block_mode && !restri_type && addlvl == -1 && interp_vec_variant == 0 &&
+       nongalerk_num_tol == 0 && nongal_tol_array == NULL)
+   {
+      HYPRE_Int same_rows;
+
+      same_rows = (hypre_ParCSRMatrixGlobalNumRows(A) ==
+                   hypre_ParCSRMatrixGlobalNumRows(P_array[0]) &&
+                   local_size == hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(P_array[0])));
+      hypre_MPI_Allreduce(&same_rows, &reuse_interp, 1, HYPRE_MPI_INT,
+                          hypre_MPI_MIN, comm);
+   }
+
    /* free up storage in case of new setup without prvious destroy */
 
    if (A_array || A_block_array || P_array || P_block_array || CF_marker_array || 
@@ -376,6 +437,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       {
          if (A_array[j])
          {
+            /* the kept P_array[j-1] takes back the coarse partitioning */
+            if (reuse_interp && hypre_ParCSRMatrixOwnsRowStarts(A_array[j]) &&
+                hypre_ParCSRMatrixRowStarts(A_array[j]) ==
+                hypre_ParCSRMatrixColStarts(P_array[j-1]))
+            {
+               hypre_ParCSRMatrixOwnsRowStarts(A_array[j]) = 0;
+               hypre_ParCSRMatrixOwnsColStarts(P_array[j-1]) = 1;
+            }
             hypre_ParCSRMatrixDestroy(A_array[j]);
             A_array[j] = NULL;
          }
@@ -388,14 +457,27 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
         
 
 
+         if (reuse_interp)
+         {
+            continue;
+         }
+
          if (dof_func_array[j])
          {
             hypre_TFree(dof_func_array[j], HYPRE_MEMORY_HOST);
             dof_func_array[j] = NULL;
          }
+
+         if (struct_index_array && struct_index_array[j])
+         {
+            hypre_TFree(struct_region_array[j], HYPRE_MEMORY_HOST);
+            hypre_TFree(struct_index_array[j], HYPRE_MEMORY_HOST);
+            struct_region_array[j] = NULL;
+            struct_index_array[j] = NULL;
+         }
       }
 
-      for (j = 0; j < old_num_levels-1; j++)
+      for (j = 0; j < old_num_levels-1 && !reuse_interp; j++)
       {
          if (P_array[j])
          {
@@ -406,7 +488,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          if (P_block_array[j])
          {
             hypre_ParCSRBlockMatrixDestroy(P_block_array[j]);
-            P_array[j] = NULL;
+            P_block_array[j] = NULL;
          }
          /* RL */
          if (R_array[j])
@@ -418,19 +500,19 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          if (R_block_array[j])
          {
             hypre_ParCSRBlockMatrixDestroy(R_block_array[j]);
-            R_array[j] = NULL;
+            R_block_array[j] = NULL;
          }
       }
 
 /* Special case use of CF_marker_array when old_num_levels == 1
    requires us to attempt this deallocation every time */
-      if (CF_marker_array[0])
+      if (CF_marker_array[0] && !reuse_interp)
       {
         hypre_TFree(CF_marker_array[0], HYPRE_MEMORY_HOST);
         CF_marker_array[0] = NULL;
       }
 
-      for (j = 1; j < old_num_levels-1; j++)
+      for (j = 1; j < old_num_levels-1 && !reuse_interp; j++)
       {
          if (CF_marker_array[j])
          {
@@ -458,6 +540,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_ParVectorDestroy(hypre_ParAMGDataZtemp(amg_data));
          hypre_ParAMGDataZtemp(amg_data) = NULL;
       }
+      hypre_BoomerAMGDestroyMultiVectors(amg_data);
    
       if (hypre_ParAMGDataACoarse(amg_data))
       {
@@ -492,6 +575,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 	 hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
 	 hypre_ParAMGDataCommInfo(amg_data) = NULL;
       }
+      if (hypre_ParAMGDataAPiv(amg_data)) 
+      {
+	 hypre_TFree(hypre_ParAMGDataAPiv(amg_data), HYPRE_MEMORY_HOST);
+	 hypre_ParAMGDataAPiv(amg_data) = NULL;
+      }
+      hypre_ParAMGDataASingular(amg_data) = 0;
    
       if (new_comm != hypre_MPI_COMM_NULL)
       {
@@ -607,6 +696,11 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       CF_marker_array = hypre_CTAlloc(HYPRE_Int*, max_levels, HYPRE_MEMORY_HOST);
    if (dof_func_array == NULL)
       dof_func_array = hypre_CTAlloc(HYPRE_Int*, max_levels, HYPRE_MEMORY_HOST);
+   if (struct_ndim && struct_index_array == NULL)
+   {
+      struct_region_array = hypre_CTAlloc(HYPRE_Int*, max_levels, HYPRE_MEMORY_HOST);
+      struct_index_array = hypre_CTAlloc(HYPRE_Int*, max_levels, HYPRE_MEMORY_HOST);
+   }
    if (num_functions > 1 && dof_func == NULL)
    {
       first_local_row = hypre_ParCSRMatrixFirstRowIndex(A);
@@ -650,6 +744,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    if (block_mode)
    {
+      if (A_block_array[0])
+      {
+         hypre_ParCSRBlockMatrixDestroy(A_block_array[0]);
+      }
       A_block_array[0] =  hypre_ParCSRBlockMatrixConvertFromParCSRMatrix(
          A_array[0], num_functions);
       hypre_ParCSRBlockMatrixSetNumNonzeros(A_block_array[0]);
@@ -661,6 +759,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_ParAMGDataCFMarkerArray(amg_data) = CF_marker_array;
    hypre_ParAMGDataCPointKeepMarkerArray(amg_data) = C_point_marker_array;
    hypre_ParAMGDataDofFuncArray(amg_data) = dof_func_array;
+   if (struct_index_array)
+   {
+      /* the finest level uses the user's arrays */
+      struct_region_array[0] = hypre_ParAMGDataStructRegion(amg_data);
+      struct_index_array[0] = hypre_ParAMGDataStructIndex(amg_data);
+      hypre_ParAMGDataStructRegionArray(amg_data) = struct_region_array;
+      hypre_ParAMGDataStructIndexArray(amg_data) = struct_index_array;
+   }
    hypre_ParAMGDataAArray(amg_data) = A_array;
    hypre_ParAMGDataPArray(amg_data) = P_array;
    
@@ -820,6 +926,87 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataSmoother(amg_data) = smoother;
    }
 
+   /*-----------------------------------------------------
+    *  Numeric re-setup: the coarse grids and interpolation
+    *  operators are kept, only the coarse-grid operators
+    *  are recomputed
+    *-----------------------------------------------------*/
+
+   if (reuse_interp)
+   {
+      for (level = 0; level < old_num_levels-1; level++)
+      {
+         if (level > 0)
+         {
+            F_array[level] =
+               hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[level]),
+                                     hypre_ParCSRMatrixGlobalNumRows(A_array[level]),
+                                     hypre_ParCSRMatrixRowStarts(A_array[level]));
+            hypre_ParVectorInitialize(F_array[level]);
+            hypre_ParVectorSetPartitioningOwner(F_array[level],0);
+
+            U_array[level] =
+               hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[level]),
+                                     hypre_ParCSRMatrixGlobalNumRows(A_array[level]),
+                                     hypre_ParCSRMatrixRowStarts(A_array[level]));
+            hypre_ParVectorInitialize(U_array[level]);
+            hypre_ParVectorSetPartitioningOwner(U_array[level],0);
+         }
+
+         if (debug_flag==1) wall_time = time_getWallclockSeconds();
+         HYPRE_PROFILE_BEGIN("AMG.RAP", level);
+
+         /* the saved transpose of P is recomputed with the product */
+         if (hypre_ParCSRMatrixDiagT(P_array[level]))
+         {
+            hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(P_array[level]));
+            hypre_ParCSRMatrixDiagT(P_array[level]) = NULL;
+         }
+         if (hypre_ParCSRMatrixOffdT(P_array[level]))
+         {
+            hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(P_array[level]));
+            hypre_ParCSRMatrixOffdT(P_array[level]) = NULL;
+         }
+
+         if (rap2)
+         {
+            /* Use two matrix products to generate A_H */
+            hypre_ParCSRMatrix *Q = NULL;
+            Q = hypre_ParMatmul(A_array[level],P_array[level]);
+            A_H = hypre_ParTMatmul(P_array[level],Q);
+            hypre_ParCSRMatrixOwnsRowStarts(A_H) = 1;
+            hypre_ParCSRMatrixOwnsColStarts(A_H) = 0;
+            hypre_ParCSRMatrixOwnsColStarts(P_array[level]) = 0;
+            if (num_procs > 1) hypre_MatvecCommPkgCreate(A_H);
+            /* Delete AP */
+            hypre_ParCSRMatrixDestroy(Q);
+         }
+         else
+         {
+            hypre_BoomerAMGBuildCoarseOperatorKT(P_array[level], A_array[level],
+                                                 P_array[level], keepTranspose, &A_H);
+         }
+         HYPRE_PROFILE_END("AMG.RAP");
+
+         if (debug_flag==1)
+         {
+            wall_time = time_getWallclockSeconds() - wall_time;
+            hypre_printf("Proc = %d    Level = %d    Build Coarse Operator Time = %f\n",
+                         my_id,level, wall_time);
+            fflush(NULL);
+         }
+
+         /* dropping in A_H */
+         hypre_ParCSRMatrixDropSmallEntries(A_H, hypre_ParAMGDataADropTol(amg_data));
+         hypre_ParCSRMatrixSetNumNonzeros(A_H);
+         hypre_ParCSRMatrixSetDNumNonzeros(A_H);
+         A_array[level+1] = A_H;
+      }
+
+      coarse_size = hypre_ParCSRMatrixGlobalNumRows(A_array[level]);
+      not_finished_coarsening = 0;
+   }
+
    /*-----------------------------------------------------
     *  Enter Coarsening Loop
     *-----------------------------------------------------*/
@@ -929,6 +1116,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          /**** Get the Strength Matrix ****/        
 
+         HYPRE_PROFILE_BEGIN("AMG.strength", level);
          if (hypre_ParAMGDataGSMG(amg_data) == 0)
 	 {
 	    if (nodal) /* if we are solving systems and 
@@ -999,9 +1187,32 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 	 }
 
 
+         HYPRE_PROFILE_END("AMG.strength");
+
          /**** Do the appropriate coarsening ****/ 
 
-         if (nodal == 0) /* no nodal coarsening */
+         HYPRE_PROFILE_BEGIN("AMG.coarsen", level);
+
+         /* structured grid indices: semicoarsen the structured rows as long
+            as the previous level did (the arrays may be empty on some procs) */
+         if (struct_ndim && (level == 0 || struct_cdir > -1) && nodal == 0 &&
+             num_functions == 1 && agg_num_levels == 0)
+         {
+            hypre_BoomerAMGCoarsenStruct(S, A_array[level], struct_ndim,
+                                         struct_region_array[level],
+                                         struct_index_array[level],
+                                         debug_flag, &CF_marker, &struct_cdir);
+         }
+
+         if (struct_cdir > -1)
+         {
+            if (debug_flag == 3)
+            {
+               hypre_printf("Proc = %d    Level = %d    Struct coarsening in direction %d\n",
+                            my_id, level, struct_cdir);
+            }
+         }
+         else if (nodal == 0) /* no nodal coarsening */
          { 
            if (coarsen_type == 6)
                hypre_BoomerAMGCoarsenFalgout(S, A_array[level], measure_type,
@@ -1600,6 +1811,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             coarse_size = coarse_pnts_global[num_procs];
 #endif
  xxxxxxxxxxxxxxxxxxxxxxxxx change for min_coarse_size */ 
+            HYPRE_PROFILE_END("AMG.coarsen");
             if (debug_flag==1)
             {
                wall_time = time_getWallclockSeconds() - wall_time;
@@ -1649,8 +1861,18 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             }
 
             if (debug_flag==1) wall_time = time_getWallclockSeconds();
+            HYPRE_PROFILE_BEGIN("AMG.interp", level);
 
-            if (interp_type == 4) 
+            if (struct_cdir > -1)
+            {
+               hypre_BoomerAMGBuildStructInterp(A_array[level], CF_marker,
+                                                coarse_pnts_global, struct_ndim,
+                                                struct_region_array[level],
+                                                struct_index_array[level], struct_cdir,
+                                                debug_flag, trunc_factor, P_max_elmts, &P);
+               hypre_TFree(col_offd_S_to_A, HYPRE_MEMORY_HOST);
+            }
+            else if (interp_type == 4) 
             {
                hypre_BoomerAMGBuildMultipass(A_array[level], CF_marker, 
                                              S, coarse_pnts_global, num_functions, dof_func_array[level], 
@@ -1957,7 +2179,18 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          if (num_functions > 1 && nodal > -1 && (!block_mode) )
 	    dof_func_array[level+1] = coarse_dof_func;
 
-         
+         /* coarse grid indices for the next structured level */
+         if (struct_cdir > -1)
+         {
+            hypre_BoomerAMGCoarsenStructCoordinates(
+               hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A_array[level])),
+               CF_marker, struct_ndim, struct_region_array[level],
+               struct_index_array[level], struct_cdir,
+               &struct_region_array[level+1], &struct_index_array[level+1]);
+         }
+
+         /* aggressive coarsening builds P as part of the coarsening */
+         HYPRE_PROFILE_END("AMG.coarsen");
       
       } /* end of if max_levels > 1 */
 
@@ -2321,6 +2554,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_TFree(SmoothVecs, HYPRE_MEMORY_HOST);
       SmoothVecs = NULL;
 
+      HYPRE_PROFILE_END("AMG.interp");
       if (debug_flag==1)
       {
          wall_time = time_getWallclockSeconds() - wall_time;
@@ -2334,6 +2568,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
        *--------------------------------------------------------------*/
 
       if (debug_flag==1) wall_time = time_getWallclockSeconds();
+      HYPRE_PROFILE_BEGIN("AMG.RAP", level);
 
       if (block_mode)
       {
@@ -2437,6 +2672,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
       }
 
+      HYPRE_PROFILE_END("AMG.RAP");
       if (debug_flag==1)
       {
          wall_time = time_getWallclockSeconds() - wall_time;
@@ -2475,20 +2711,28 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
    }  /* end of coarsening loop: while (not_finished_coarsening) */
 
-   /* redundant coarse grid solve */
-   if (  (seq_threshold >= coarse_threshold) && (coarse_size > coarse_threshold) && (level != max_levels-1))
+   /* close the phase left open when coarsening stopped early */
+   HYPRE_PROFILE_END("AMG.coarsen");
+   HYPRE_PROFILE_END("AMG.interp");
+
+   /* redundant coarse grid solve (not available in block mode) */
+   if (  !block_mode && (seq_threshold >= coarse_threshold) && (coarse_size > coarse_threshold) && (level != max_levels-1))
    {
       hypre_seqAMGSetup( amg_data, level, coarse_threshold);
 
    }
 #ifdef HAVE_DSUPERLU
-   else if (  ((dslu_threshold >= coarse_threshold) && (coarse_size > coarse_threshold) && (level != max_levels-1)))
+   else if (  !block_mode && ((dslu_threshold >= coarse_threshold) && (coarse_size > coarse_threshold) && (level != max_levels-1)))
    {
       HYPRE_Solver dslu_solver;
       hypre_SLUDistSetup(&dslu_solver, A_array[level], amg_print_level);
       hypre_ParAMGDataDSLUSolver(amg_data) = dslu_solver;
    }
 #endif
+   else if (block_mode && grid_relax_type[3] == 29)  /* block Gaussian elimination on coarsest level */
+   {
+      hypre_BlockGaussElimSetup(amg_data, level);
+   }
    else if (grid_relax_type[3] == 9 || grid_relax_type[3] == 99)  /*use of Gaussian elimination on coarsest level */
    {
       if (coarse_size <= coarse_threshold)
@@ -3045,6 +3289,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 }
 #endif
 
+   HYPRE_PROFILE_END("AMG.setup");
    HYPRE_ANNOTATION_END("BoomerAMG.setup");
  
    return(hypre_error_flag);
@@ -90,7 +90,14 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    hypre_ParVector  *Vtemp;
    hypre_ParVector  *Residual;
 
+   /* several right-hand sides are cycled together */
+   if (hypre_ParVectorNumVectors(f) > 1)
+   {
+      return hypre_BoomerAMGSolveMulti(amg_vdata, A, f, u);
+   }
+
    HYPRE_ANNOTATION_BEGIN("BoomerAMG.solve");
+   HYPRE_PROFILE_BEGIN("AMG.solve", -1);
    hypre_MPI_Comm_size(comm, &num_procs);   
    hypre_MPI_Comm_rank(comm,&my_id);
 
@@ -195,6 +202,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
           hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
         }
         hypre_error(HYPRE_ERROR_GENERIC);
+        HYPRE_PROFILE_END("AMG.solve");
         HYPRE_ANNOTATION_END("BoomerAMG.solve");
         return hypre_error_flag;
      }
@@ -384,6 +392,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
       hypre_TFree(num_variables, HYPRE_MEMORY_HOST);
    }
+   HYPRE_PROFILE_END("AMG.solve");
    HYPRE_ANNOTATION_END("BoomerAMG.solve");
    
    return hypre_error_flag;
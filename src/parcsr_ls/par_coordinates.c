@@ -84,3 +84,896 @@ GenerateCoordinates( MPI_Comm comm,
 
    return coord;
 }
+
+/*--------------------------------------------------------------------------
+ * GenerateStructCoordinates
+ *
+ * Integer analogue of GenerateCoordinates: returns the logical grid index
+ * (ix,iy,iz) of each local row of the generated Laplacians, skipping the
+ * directions with only one point, for HYPRE_BoomerAMGSetStructCoordinates.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int *
+GenerateStructCoordinates( MPI_Comm  comm,
+                           HYPRE_Int nx,
+                           HYPRE_Int ny,
+                           HYPRE_Int nz,
+                           HYPRE_Int P,
+                           HYPRE_Int Q,
+                           HYPRE_Int R,
+                           HYPRE_Int p,
+                           HYPRE_Int q,
+                           HYPRE_Int r,
+                           HYPRE_Int ndim )
+{
+   HYPRE_Int ix, iy, iz;
+   HYPRE_Int cnt;
+
+   HYPRE_Int local_num_rows;
+
+   HYPRE_Int *nx_part;
+   HYPRE_Int *ny_part;
+   HYPRE_Int *nz_part;
+
+   HYPRE_Int *index;
+
+   if (ndim < 1 || ndim > 3)
+   {
+      return NULL;
+   }
+
+   hypre_GeneratePartitioning(nx,P,&nx_part);
+   hypre_GeneratePartitioning(ny,Q,&ny_part);
+   hypre_GeneratePartitioning(nz,R,&nz_part);
+
+   local_num_rows = (nx_part[p+1] - nx_part[p]) *
+                    (ny_part[q+1] - ny_part[q]) *
+                    (nz_part[r+1] - nz_part[r]);
+
+   index = hypre_CTAlloc(HYPRE_Int, ndim*local_num_rows, HYPRE_MEMORY_HOST);
+
+   cnt = 0;
+   for (iz = nz_part[r]; iz < nz_part[r+1]; iz++)
+   {
+      for (iy = ny_part[q]; iy < ny_part[q+1]; iy++)
+      {
+         for (ix = nx_part[p]; ix < nx_part[p+1]; ix++)
+         {
+            if (nx > 1) index[cnt++] = ix;
+            if (ny > 1) index[cnt++] = iy;
+            if (nz > 1) index[cnt++] = iz;
+         }
+      }
+   }
+
+   hypre_TFree(nx_part, HYPRE_MEMORY_HOST);
+   hypre_TFree(ny_part, HYPRE_MEMORY_HOST);
+   hypre_TFree(nz_part, HYPRE_MEMORY_HOST);
+
+   return index;
+}
+
+/*--------------------------------------------------------------------------
+ * Structured-grid hints for BoomerAMG.
+ *
+ * Each row i may carry a structured region number region[i] >= 0 together
+ * with its logical index index[ndim*i+d] inside that region; rows with
+ * region[i] < 0 are unstructured.  A NULL region array means that all rows
+ * belong to region 0.  On the structured rows BoomerAMG then coarsens like
+ * PFMG: one direction cdir (the one with the strongest couplings) is
+ * semicoarsened by keeping the even indices, and F-points interpolate from
+ * their two cdir neighbors with the collapsed-stencil weights.  All other
+ * rows are treated algebraically.
+ *--------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGStructCoordinatesOffd
+ *
+ * Gathers region numbers and indices of the off-processor columns of A.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGStructCoordinatesOffd( hypre_ParCSRMatrix  *A,
+                                      HYPRE_Int            ndim,
+                                      HYPRE_Int           *region,
+                                      HYPRE_Int           *index,
+                                      HYPRE_Int          **region_offd_ptr,
+                                      HYPRE_Int          **index_offd_ptr )
+{
+   hypre_ParCSRCommPkg     *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommHandle  *comm_handle;
+   HYPRE_Int                num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+
+   HYPRE_Int  *region_offd = NULL;
+   HYPRE_Int  *index_offd = NULL;
+   HYPRE_Int  *int_buf_data;
+   HYPRE_Int  *int_recv_data;
+   HYPRE_Int   num_sends, num_elmts;
+   HYPRE_Int   d, i, j;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   num_elmts = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+   region_offd   = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+   index_offd    = hypre_CTAlloc(HYPRE_Int, ndim*num_cols_offd, HYPRE_MEMORY_HOST);
+   int_buf_data  = hypre_CTAlloc(HYPRE_Int, num_elmts, HYPRE_MEMORY_HOST);
+   int_recv_data = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+
+   for (j = 0; j < num_elmts; j++)
+   {
+      i = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j);
+      int_buf_data[j] = region ? region[i] : 0;
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf_data, region_offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   for (d = 0; d < ndim; d++)
+   {
+      for (j = 0; j < num_elmts; j++)
+      {
+         i = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j);
+         int_buf_data[j] = index[ndim*i+d];
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf_data, int_recv_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      for (j = 0; j < num_cols_offd; j++)
+      {
+         index_offd[ndim*j+d] = int_recv_data[j];
+      }
+   }
+
+   hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(int_recv_data, HYPRE_MEMORY_HOST);
+
+   *region_offd_ptr = region_offd;
+   *index_offd_ptr  = index_offd;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGStructOffset
+ *
+ * Returns the direction d if index_j - index_i is +/- the unit vector in d,
+ * and -1 otherwise.  The offset itself is returned in *offset_ptr.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGStructOffset( HYPRE_Int   ndim,
+                             HYPRE_Int  *index_i,
+                             HYPRE_Int  *index_j,
+                             HYPRE_Int  *offset_ptr )
+{
+   HYPRE_Int d, dir = -1, offset = 0;
+
+   for (d = 0; d < ndim; d++)
+   {
+      if (index_j[d] != index_i[d])
+      {
+         if (dir > -1 || hypre_abs(index_j[d] - index_i[d]) != 1)
+         {
+            return -1;
+         }
+         dir = d;
+         offset = index_j[d] - index_i[d];
+      }
+   }
+   *offset_ptr = offset;
+
+   return dir;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCoarsenStruct
+ *
+ * Semicoarsens the structured rows of A in the direction of strongest
+ * coupling and splits the remaining rows with PMIS.  Structured rows that
+ * have no neighbor in that direction are left to PMIS as well, and F-points
+ * without any C-neighbor in A are promoted to C afterwards so that every
+ * F-point can be interpolated.  On return *cdir_ptr holds the coarsening
+ * direction, or -1 if the structured rows carry no coupling, in which case
+ * no CF_marker is created.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGCoarsenStruct( hypre_ParCSRMatrix  *S,
+                              hypre_ParCSRMatrix  *A,
+                              HYPRE_Int            ndim,
+                              HYPRE_Int           *region,
+                              HYPRE_Int           *index,
+                              HYPRE_Int            debug_flag,
+                              HYPRE_Int          **CF_marker_ptr,
+                              HYPRE_Int           *cdir_ptr )
+{
+   MPI_Comm                 comm     = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg     *comm_pkg;
+   hypre_ParCSRCommHandle  *comm_handle;
+
+   hypre_CSRMatrix  *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real       *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int        *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int        *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix  *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real       *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int        *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int        *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int         num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int         num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+
+   HYPRE_Int  *region_offd, *index_offd;
+   HYPRE_Int  *CF_marker = NULL;
+   HYPRE_Int  *CF_marker_offd = NULL;
+   HYPRE_Int  *eligible;
+   HYPRE_Int  *int_buf_data;
+   HYPRE_Real  coupling[3], global_coupling[3];
+   HYPRE_Int   num_sends, num_elmts;
+   HYPRE_Int   num_unstruct, global_num_unstruct;
+   HYPRE_Int   cdir, dir, offset, reg_i, reg_j, has_c;
+   HYPRE_Int   d, i, j, jj;
+
+   *cdir_ptr = -1;
+   if (ndim < 1 || ndim > 3)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   hypre_BoomerAMGStructCoordinatesOffd(A, ndim, region, index,
+                                        &region_offd, &index_offd);
+   comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+
+   /*-----------------------------------------------------------------------
+    * Choose the semicoarsening direction: the one with the largest sum of
+    * |a_ij| over pairs of structured neighbors in that direction.
+    *-----------------------------------------------------------------------*/
+
+   for (d = 0; d < 3; d++)
+   {
+      coupling[d] = 0.0;
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      reg_i = region ? region[i] : 0;
+      if (reg_i < 0) continue;
+
+      for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+      {
+         j = A_diag_j[jj];
+         reg_j = region ? region[j] : 0;
+         if (reg_j != reg_i) continue;
+         dir = hypre_BoomerAMGStructOffset(ndim, &index[ndim*i], &index[ndim*j], &offset);
+         if (dir > -1) coupling[dir] += fabs(A_diag_data[jj]);
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+      {
+         j = A_offd_j[jj];
+         if (region_offd[j] != reg_i) continue;
+         dir = hypre_BoomerAMGStructOffset(ndim, &index[ndim*i], &index_offd[ndim*j], &offset);
+         if (dir > -1) coupling[dir] += fabs(A_offd_data[jj]);
+      }
+   }
+   hypre_MPI_Allreduce(coupling, global_coupling, 3, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+   cdir = 0;
+   for (d = 1; d < ndim; d++)
+   {
+      if (global_coupling[d] > global_coupling[cdir]) cdir = d;
+   }
+   if (global_coupling[cdir] == 0.0)
+   {
+      hypre_TFree(region_offd, HYPRE_MEMORY_HOST);
+      hypre_TFree(index_offd, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * A structured row is coarsened geometrically if it has a neighbor of
+    * its own region in direction cdir.
+    *-----------------------------------------------------------------------*/
+
+   eligible = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   num_unstruct = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      reg_i = region ? region[i] : 0;
+      if (reg_i >= 0)
+      {
+         for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1] && !eligible[i]; jj++)
+         {
+            j = A_diag_j[jj];
+            reg_j = region ? region[j] : 0;
+            if (reg_j == reg_i &&
+                hypre_BoomerAMGStructOffset(ndim, &index[ndim*i], &index[ndim*j], &offset) == cdir)
+            {
+               eligible[i] = 1;
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1] && !eligible[i]; jj++)
+         {
+            j = A_offd_j[jj];
+            if (region_offd[j] == reg_i &&
+                hypre_BoomerAMGStructOffset(ndim, &index[ndim*i], &index_offd[ndim*j], &offset) == cdir)
+            {
+               eligible[i] = 1;
+            }
+         }
+      }
+      if (!eligible[i]) num_unstruct++;
+   }
+   hypre_MPI_Allreduce(&num_unstruct, &global_num_unstruct, 1, HYPRE_MPI_INT, hypre_MPI_SUM, comm);
+
+   /* algebraic splitting of the rows that are not coarsened geometrically */
+   if (global_num_unstruct)
+   {
+      hypre_BoomerAMGCoarsenPMIS(S, A, 0, debug_flag, &CF_marker);
+   }
+   else
+   {
+      CF_marker = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   }
+
+   for (i = 0; i < num_rows; i++)
+   {
+      if (eligible[i])
+      {
+         CF_marker[i] = (index[ndim*i+cdir] & 1) ? -1 : 1;
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Promote F-points that have no C-neighbor at all
+    *-----------------------------------------------------------------------*/
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   num_elmts = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   int_buf_data   = hypre_CTAlloc(HYPRE_Int, num_elmts, HYPRE_MEMORY_HOST);
+   CF_marker_offd = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_elmts; j++)
+   {
+      int_buf_data[j] = CF_marker[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf_data, CF_marker_offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      /* weakly connected rows (SF_PT) are left to the smoother */
+      if (CF_marker[i] > 0 || CF_marker[i] == -3) continue;
+
+      has_c = 0;
+      for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1] && !has_c; jj++)
+      {
+         if (A_diag_data[jj] != 0.0 && CF_marker[A_diag_j[jj]] > 0) has_c = 1;
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i+1] && !has_c; jj++)
+      {
+         if (A_offd_data[jj] != 0.0 && CF_marker_offd[A_offd_j[jj]] > 0) has_c = 1;
+      }
+      if (has_c)
+      {
+         if (CF_marker[i] == 0) CF_marker[i] = -1;
+      }
+      else
+      {
+         /* isolated rows become SF_PT, everything else C */
+         has_c = (A_offd_i[i+1] > A_offd_i[i]);
+         for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1] && !has_c; jj++)
+         {
+            if (A_diag_data[jj] != 0.0) has_c = 1;
+         }
+         CF_marker[i] = has_c ? 1 : -3;
+      }
+   }
+
+   hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(eligible, HYPRE_MEMORY_HOST);
+   hypre_TFree(region_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(index_offd, HYPRE_MEMORY_HOST);
+
+   *CF_marker_ptr = CF_marker;
+   *cdir_ptr = cdir;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildStructInterp
+ *
+ * Interpolation for a splitting produced by hypre_BoomerAMGCoarsenStruct.
+ * A structured F-point whose stencil lies in its own region and reaches at
+ * most one index away in direction cdir gets the PFMG weights
+ *
+ *    w_-/+ = - (sum of a_ij at cdir offset -/+1) / (sum of a_ij at offset 0)
+ *
+ * on its two cdir neighbors.  All other F-points use direct interpolation
+ * from the C-points in their row of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGBuildStructInterp( hypre_ParCSRMatrix   *A,
+                                  HYPRE_Int            *CF_marker,
+                                  HYPRE_Int            *num_cpts_global,
+                                  HYPRE_Int             ndim,
+                                  HYPRE_Int            *region,
+                                  HYPRE_Int            *index,
+                                  HYPRE_Int             cdir,
+                                  HYPRE_Int             debug_flag,
+                                  HYPRE_Real            trunc_factor,
+                                  HYPRE_Int             max_elmts,
+                                  hypre_ParCSRMatrix  **P_ptr )
+{
+   MPI_Comm                 comm     = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg     *comm_pkg;
+   hypre_ParCSRCommHandle  *comm_handle;
+
+   hypre_CSRMatrix  *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real       *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int        *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int        *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix  *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real       *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int        *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int        *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int         n_fine          = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int         num_cols_A_offd = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_ParCSRMatrix  *P;
+   hypre_CSRMatrix     *P_diag;
+   hypre_CSRMatrix     *P_offd;
+   HYPRE_Real          *P_diag_data;
+   HYPRE_Int           *P_diag_i;
+   HYPRE_Int           *P_diag_j;
+   HYPRE_Real          *P_offd_data;
+   HYPRE_Int           *P_offd_i;
+   HYPRE_Int           *P_offd_j;
+   HYPRE_Int            P_diag_size, P_offd_size;
+   HYPRE_Int            num_cols_P_offd;
+   HYPRE_Int           *col_map_offd_P = NULL;
+   HYPRE_Int           *P_marker;
+
+   HYPRE_Int  *region_offd, *index_offd;
+   HYPRE_Int  *CF_marker_offd = NULL;
+   HYPRE_Int  *fine_to_coarse;
+   HYPRE_Int  *fine_to_coarse_offd = NULL;
+   HYPRE_Int  *int_buf_data;
+   HYPRE_Int   num_sends, num_elmts;
+   HYPRE_Int   total_global_cpts, my_first_cpt;
+   HYPRE_Int   my_id, num_procs;
+   HYPRE_Int   n_cpts, cnt_diag, cnt_offd;
+
+   HYPRE_Int   reg_i, reg_j, offset, dir, stencil;
+   HYPRE_Int   jm, jp, jm_offd, jp_offd;
+   HYPRE_Int  *index_j;
+   HYPRE_Real  center, lower, upper, diagonal, a_ij;
+   HYPRE_Real  sum, sum_c, alpha;
+   HYPRE_Real  wall_time = 0.0;
+   HYPRE_Int   i, j, jj, k;
+
+   if (debug_flag == 4) wall_time = time_getWallclockSeconds();
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   my_first_cpt = num_cpts_global[0];
+   if (my_id == (num_procs -1)) total_global_cpts = num_cpts_global[1];
+   hypre_MPI_Bcast(&total_global_cpts, 1, HYPRE_MPI_INT, num_procs-1, comm);
+#else
+   my_first_cpt = num_cpts_global[my_id];
+   total_global_cpts = num_cpts_global[num_procs];
+#endif
+
+   hypre_BoomerAMGStructCoordinatesOffd(A, ndim, region, index,
+                                        &region_offd, &index_offd);
+   comm_pkg  = hypre_ParCSRMatrixCommPkg(A);
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   num_elmts = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+   /*-----------------------------------------------------------------------
+    * Exchange CF_marker and the global coarse numbers
+    *-----------------------------------------------------------------------*/
+
+   int_buf_data   = hypre_CTAlloc(HYPRE_Int, num_elmts, HYPRE_MEMORY_HOST);
+   CF_marker_offd = hypre_CTAlloc(HYPRE_Int, num_cols_A_offd, HYPRE_MEMORY_HOST);
+   fine_to_coarse_offd = hypre_CTAlloc(HYPRE_Int, num_cols_A_offd, HYPRE_MEMORY_HOST);
+   fine_to_coarse = hypre_CTAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
+
+   n_cpts = 0;
+   P_diag_size = 0;
+   P_offd_size = 0;
+   for (i = 0; i < n_fine; i++)
+   {
+      if (CF_marker[i] >= 0)
+      {
+         fine_to_coarse[i] = my_first_cpt + n_cpts++;
+         P_diag_size++;
+      }
+      else
+      {
+         fine_to_coarse[i] = -1;
+         P_diag_size += A_diag_i[i+1] - A_diag_i[i] - 1;
+         P_offd_size += A_offd_i[i+1] - A_offd_i[i];
+      }
+   }
+
+   for (j = 0; j < num_elmts; j++)
+   {
+      int_buf_data[j] = CF_marker[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf_data, CF_marker_offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   for (j = 0; j < num_elmts; j++)
+   {
+      int_buf_data[j] = fine_to_coarse[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf_data, fine_to_coarse_offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /*-----------------------------------------------------------------------
+    * Fill P, using an upper bound for its size
+    *-----------------------------------------------------------------------*/
+
+   P_diag_i    = hypre_CTAlloc(HYPRE_Int,  n_fine+1, HYPRE_MEMORY_HOST);
+   P_diag_j    = hypre_CTAlloc(HYPRE_Int,  P_diag_size, HYPRE_MEMORY_HOST);
+   P_diag_data = hypre_CTAlloc(HYPRE_Real, P_diag_size, HYPRE_MEMORY_HOST);
+   P_offd_i    = hypre_CTAlloc(HYPRE_Int,  n_fine+1, HYPRE_MEMORY_HOST);
+   P_offd_j    = hypre_CTAlloc(HYPRE_Int,  P_offd_size, HYPRE_MEMORY_HOST);
+   P_offd_data = hypre_CTAlloc(HYPRE_Real, P_offd_size, HYPRE_MEMORY_HOST);
+
+   cnt_diag = 0;
+   cnt_offd = 0;
+   for (i = 0; i < n_fine; i++)
+   {
+      if (CF_marker[i] >= 0)
+      {
+         P_diag_j[cnt_diag] = fine_to_coarse[i] - my_first_cpt;
+         P_diag_data[cnt_diag++] = 1.0;
+         P_diag_i[i+1] = cnt_diag;
+         P_offd_i[i+1] = cnt_offd;
+         continue;
+      }
+
+      /*--------------------------------------------------------------------
+       * Try the collapsed stencil first
+       *--------------------------------------------------------------------*/
+
+      reg_i = region ? region[i] : 0;
+      stencil = (reg_i >= 0);
+      center = A_diag_data[A_diag_i[i]];
+      lower = 0.0;
+      upper = 0.0;
+      jm = jp = jm_offd = jp_offd = -1;
+      for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1] && stencil; jj++)
+      {
+         j = A_diag_j[jj];
+         reg_j = region ? region[j] : 0;
+         index_j = &index[ndim*j];
+         offset = index_j[cdir] - index[ndim*i+cdir];
+         if (reg_j != reg_i || hypre_abs(offset) > 1)
+         {
+            stencil = 0;
+            break;
+         }
+         if (offset < 0)
+         {
+            lower += A_diag_data[jj];
+            if (hypre_BoomerAMGStructOffset(ndim, &index[ndim*i], index_j, &dir) == cdir)
+            {
+               jm = j;
+            }
+         }
+         else if (offset > 0)
+         {
+            upper += A_diag_data[jj];
+            if (hypre_BoomerAMGStructOffset(ndim, &index[ndim*i], index_j, &dir) == cdir)
+            {
+               jp = j;
+            }
+         }
+         else
+         {
+            center += A_diag_data[jj];
+         }
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i+1] && stencil; jj++)
+      {
+         j = A_offd_j[jj];
+         index_j = &index_offd[ndim*j];
+         offset = index_j[cdir] - index[ndim*i+cdir];
+         if (region_offd[j] != reg_i || hypre_abs(offset) > 1)
+         {
+            stencil = 0;
+            break;
+         }
+         if (offset < 0)
+         {
+            lower += A_offd_data[jj];
+            if (hypre_BoomerAMGStructOffset(ndim, &index[ndim*i], index_j, &dir) == cdir)
+            {
+               jm_offd = j;
+            }
+         }
+         else if (offset > 0)
+         {
+            upper += A_offd_data[jj];
+            if (hypre_BoomerAMGStructOffset(ndim, &index[ndim*i], index_j, &dir) == cdir)
+            {
+               jp_offd = j;
+            }
+         }
+         else
+         {
+            center += A_offd_data[jj];
+         }
+      }
+      if (stencil)
+      {
+         if (center == 0.0) stencil = 0;
+         if (lower != 0.0 &&
+             !((jm > -1 && CF_marker[jm] >= 0) ||
+               (jm_offd > -1 && CF_marker_offd[jm_offd] >= 0))) stencil = 0;
+         if (upper != 0.0 &&
+             !((jp > -1 && CF_marker[jp] >= 0) ||
+               (jp_offd > -1 && CF_marker_offd[jp_offd] >= 0))) stencil = 0;
+      }
+
+      if (stencil)
+      {
+         if (lower != 0.0)
+         {
+            if (jm > -1)
+            {
+               P_diag_j[cnt_diag] = fine_to_coarse[jm] - my_first_cpt;
+               P_diag_data[cnt_diag++] = -lower/center;
+            }
+            else
+            {
+               P_offd_j[cnt_offd] = jm_offd;
+               P_offd_data[cnt_offd++] = -lower/center;
+            }
+         }
+         if (upper != 0.0)
+         {
+            if (jp > -1)
+            {
+               P_diag_j[cnt_diag] = fine_to_coarse[jp] - my_first_cpt;
+               P_diag_data[cnt_diag++] = -upper/center;
+            }
+            else
+            {
+               P_offd_j[cnt_offd] = jp_offd;
+               P_offd_data[cnt_offd++] = -upper/center;
+            }
+         }
+         P_diag_i[i+1] = cnt_diag;
+         P_offd_i[i+1] = cnt_offd;
+         continue;
+      }
+
+      /*--------------------------------------------------------------------
+       * Direct interpolation from the C-points in the row of A; couplings
+       * with the sign of the diagonal are lumped into the diagonal
+       *--------------------------------------------------------------------*/
+
+      center = A_diag_data[A_diag_i[i]];
+      diagonal = center;
+      sum = 0.0;
+      sum_c = 0.0;
+      for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+      {
+         a_ij = A_diag_data[jj];
+         if (a_ij*center < 0.0)
+         {
+            sum += a_ij;
+            if (CF_marker[A_diag_j[jj]] >= 0) sum_c += a_ij;
+         }
+         else
+         {
+            diagonal += a_ij;
+         }
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+      {
+         a_ij = A_offd_data[jj];
+         if (a_ij*center < 0.0)
+         {
+            sum += a_ij;
+            if (CF_marker_offd[A_offd_j[jj]] >= 0) sum_c += a_ij;
+         }
+         else
+         {
+            diagonal += a_ij;
+         }
+      }
+
+      if (sum_c != 0.0 && diagonal != 0.0)
+      {
+         alpha = -sum/(sum_c*diagonal);
+         for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+         {
+            j = A_diag_j[jj];
+            a_ij = A_diag_data[jj];
+            if (CF_marker[j] >= 0 && a_ij*center < 0.0)
+            {
+               P_diag_j[cnt_diag] = fine_to_coarse[j] - my_first_cpt;
+               P_diag_data[cnt_diag++] = alpha * a_ij;
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            j = A_offd_j[jj];
+            a_ij = A_offd_data[jj];
+            if (CF_marker_offd[j] >= 0 && a_ij*center < 0.0)
+            {
+               P_offd_j[cnt_offd] = j;
+               P_offd_data[cnt_offd++] = alpha * a_ij;
+            }
+         }
+      }
+      P_diag_i[i+1] = cnt_diag;
+      P_offd_i[i+1] = cnt_offd;
+   }
+
+   P_diag_size = cnt_diag;
+   P_offd_size = cnt_offd;
+   P_diag_j    = hypre_TReAlloc(P_diag_j,    HYPRE_Int,  P_diag_size, HYPRE_MEMORY_HOST);
+   P_diag_data = hypre_TReAlloc(P_diag_data, HYPRE_Real, P_diag_size, HYPRE_MEMORY_HOST);
+   P_offd_j    = hypre_TReAlloc(P_offd_j,    HYPRE_Int,  P_offd_size, HYPRE_MEMORY_HOST);
+   P_offd_data = hypre_TReAlloc(P_offd_data, HYPRE_Real, P_offd_size, HYPRE_MEMORY_HOST);
+
+   P = hypre_ParCSRMatrixCreate(comm,
+                                hypre_ParCSRMatrixGlobalNumRows(A),
+                                total_global_cpts,
+                                hypre_ParCSRMatrixColStarts(A),
+                                num_cpts_global,
+                                0,
+                                P_diag_size,
+                                P_offd_size);
+
+   P_diag = hypre_ParCSRMatrixDiag(P);
+   hypre_CSRMatrixData(P_diag) = P_diag_data;
+   hypre_CSRMatrixI(P_diag) = P_diag_i;
+   hypre_CSRMatrixJ(P_diag) = P_diag_j;
+   P_offd = hypre_ParCSRMatrixOffd(P);
+   hypre_CSRMatrixData(P_offd) = P_offd_data;
+   hypre_CSRMatrixI(P_offd) = P_offd_i;
+   hypre_CSRMatrixJ(P_offd) = P_offd_j;
+   hypre_ParCSRMatrixOwnsRowStarts(P) = 0;
+
+   /* Compress P, removing coefficients smaller than trunc_factor * Max */
+
+   if (trunc_factor != 0.0 || max_elmts > 0)
+   {
+      hypre_BoomerAMGInterpTruncation(P, trunc_factor, max_elmts);
+      P_offd_i = hypre_CSRMatrixI(P_offd);
+      P_offd_j = hypre_CSRMatrixJ(P_offd);
+      P_offd_size = P_offd_i[n_fine];
+   }
+
+   num_cols_P_offd = 0;
+   if (P_offd_size)
+   {
+      P_marker = hypre_CTAlloc(HYPRE_Int, num_cols_A_offd, HYPRE_MEMORY_HOST);
+      for (k = 0; k < P_offd_size; k++)
+      {
+         j = P_offd_j[k];
+         if (!P_marker[j])
+         {
+            num_cols_P_offd++;
+            P_marker[j] = 1;
+         }
+      }
+
+      col_map_offd_P = hypre_CTAlloc(HYPRE_Int, num_cols_P_offd, HYPRE_MEMORY_HOST);
+      j = 0;
+      for (k = 0; k < num_cols_P_offd; k++)
+      {
+         while (P_marker[j] == 0) j++;
+         col_map_offd_P[k] = j++;
+      }
+
+      for (k = 0; k < P_offd_size; k++)
+      {
+         P_offd_j[k] = hypre_BinarySearch(col_map_offd_P, P_offd_j[k],
+                                          num_cols_P_offd);
+      }
+      hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
+   }
+
+   for (i = 0; i < n_fine; i++)
+   {
+      if (CF_marker[i] == -3) CF_marker[i] = -1;
+   }
+
+   if (num_cols_P_offd)
+   {
+      hypre_ParCSRMatrixColMapOffd(P) = col_map_offd_P;
+      hypre_CSRMatrixNumCols(P_offd) = num_cols_P_offd;
+   }
+
+   hypre_GetCommPkgRTFromCommPkgA(P, A, fine_to_coarse_offd);
+
+   *P_ptr = P;
+
+   hypre_TFree(region_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(index_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
+   hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
+
+   if (debug_flag == 4)
+   {
+      wall_time = time_getWallclockSeconds() - wall_time;
+      hypre_printf("Proc = %d     Interp: Build StructInterp = %f\n",
+                   my_id, wall_time);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCoarsenStructCoordinates
+ *
+ * Region numbers and indices of the C-points of a structured splitting.
+ * C-points with an even index in direction cdir keep their region and get
+ * the index halved in that direction; all other C-points become
+ * unstructured on the coarse grid.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGCoarsenStructCoordinates( HYPRE_Int    num_rows,
+                                         HYPRE_Int   *CF_marker,
+                                         HYPRE_Int    ndim,
+                                         HYPRE_Int   *region,
+                                         HYPRE_Int   *index,
+                                         HYPRE_Int    cdir,
+                                         HYPRE_Int  **coarse_region_ptr,
+                                         HYPRE_Int  **coarse_index_ptr )
+{
+   HYPRE_Int  *coarse_region;
+   HYPRE_Int  *coarse_index;
+   HYPRE_Int   num_coarse, reg_i;
+   HYPRE_Int   d, i, ic;
+
+   num_coarse = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (CF_marker[i] > 0) num_coarse++;
+   }
+
+   coarse_region = hypre_CTAlloc(HYPRE_Int, num_coarse, HYPRE_MEMORY_HOST);
+   coarse_index  = hypre_CTAlloc(HYPRE_Int, ndim*num_coarse, HYPRE_MEMORY_HOST);
+
+   ic = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (CF_marker[i] > 0)
+      {
+         reg_i = region ? region[i] : 0;
+         if (index[ndim*i+cdir] & 1) reg_i = -1;
+         coarse_region[ic] = reg_i;
+         for (d = 0; d < ndim; d++)
+         {
+            coarse_index[ndim*ic+d] = index[ndim*i+d];
+         }
+         if (reg_i >= 0)
+         {
+            coarse_index[ndim*ic+cdir] /= 2;
+         }
+         ic++;
+      }
+   }
+
+   *coarse_region_ptr = coarse_region;
+   *coarse_index_ptr  = coarse_index;
+
+   return hypre_error_flag;
+}
@@ -258,6 +258,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 #ifdef HYPRE_USING_CALIPER
    cali_set_int(iter_attr, level);
 #endif
+   HYPRE_PROFILE_BEGIN("AMG.cycle", -1);
    
    while (Not_Finished)
    {
@@ -300,6 +301,12 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
            Aux_F = F_array[level];
 	}
         relax_type = grid_relax_type[cycle_param];
+        /* the coarsest block matrix is singular: relax instead of block GE */
+        if (block_mode && relax_type == 29 && cycle_param == 3 &&
+            hypre_ParAMGDataASingular(amg_data))
+        {
+           relax_type = grid_relax_type[1];
+        }
       }
       else /* AB: 4/08: removed the max_levels > 1 check - should do this when max-levels = 1 also */
       {
@@ -318,6 +325,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
       else
          l1_norms_level = NULL;
 
+      HYPRE_PROFILE_BEGIN("AMG.relax", level);
+
       if (cycle_param == 3 && seq_cg)
       {
          hypre_seqAMGCycle(amg_data, level, F_array, U_array);
@@ -418,6 +427,10 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
               { /* Gaussian elimination */
                  hypre_GaussElimSolve(amg_data, level, relax_type);
               }
+              else if (block_mode && relax_type == 29 && cycle_param == 3)
+              { /* block Gaussian elimination, factored in the setup */
+                 hypre_BlockGaussElimSolve(amg_data, level);
+              }
               else if (relax_type == 18)
               {   /* L1 - Jacobi*/
                  if (relax_order == 1 && cycle_param < 3)
@@ -589,6 +602,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
         }
       }
 
+      HYPRE_PROFILE_END("AMG.relax");
+
       /*------------------------------------------------------------------
        * Decrement the control counter and determine which grid to visit next
        *-----------------------------------------------------------------*/
@@ -608,6 +623,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          fine_grid = level;
          coarse_grid = level + 1;
 
+         HYPRE_PROFILE_BEGIN("AMG.restrict", fine_grid);
+
          hypre_ParVectorSetConstantValues(U_array[coarse_grid], 0.0);
 
          alpha = -1.0;
@@ -658,6 +675,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
             }
          }
 
+         HYPRE_PROFILE_END("AMG.restrict");
+
          ++level;
          lev_counter[level] = hypre_max(lev_counter[level],cycle_type);
          cycle_param = 1;
@@ -680,6 +699,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          coarse_grid = level;
          alpha = 1.0;
          beta = 1.0;
+         HYPRE_PROFILE_BEGIN("AMG.prolong", fine_grid);
          if (block_mode)
          {
             hypre_ParCSRBlockMatrixMatvec(alpha, P_block_array[fine_grid],
@@ -695,6 +715,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 	    //printf("par_cycle.c 6 done %d\n",level);
          }
 
+         HYPRE_PROFILE_END("AMG.prolong");
+
          --level;
          cycle_param = 2;
          
@@ -711,6 +733,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 #ifdef HYPRE_USING_CALIPER
    cali_end(iter_attr);  /* unset "iter" */
 #endif
+   HYPRE_PROFILE_END("AMG.cycle");
    
    hypre_ParAMGDataCycleOpCount(amg_data) = cycle_op_count;
 
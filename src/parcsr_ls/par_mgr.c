@@ -96,7 +96,16 @@ hypre_MGRCreate()
   
   (mgr_data -> Frelax_method) = 0;
   (mgr_data -> FrelaxVcycleData) = NULL;
+  (mgr_data -> A_ff_array) = NULL;
+  (mgr_data -> Aff_diaginv) = NULL;
+  (mgr_data -> Aff_block_size) = NULL;
+  (mgr_data -> F_fine_array) = NULL;
+  (mgr_data -> U_fine_array) = NULL;
   (mgr_data -> max_local_lvls) = 10;
+
+  (mgr_data -> numeric_refresh) = 0;
+  (mgr_data -> coarse_grid_refresh_freq) = 1;
+  (mgr_data -> num_refresh_setups) = 0;
   
   (mgr_data -> print_coarse_system) = 0;
 
@@ -259,6 +268,8 @@ hypre_MGRDestroy( void *data )
     hypre_TFree(mgr_data -> FrelaxVcycleData, HYPRE_MEMORY_HOST);
     mgr_data -> FrelaxVcycleData = NULL;
   }  
+  /* data for compact F-relaxation */
+  hypre_MGRDestroyFrelaxAffData(mgr_data, num_coarse_levels);
   /* data for reserved coarse nodes */
   if(mgr_data -> reserved_coarse_indexes)
   {
@@ -380,6 +391,40 @@ hypre_MGRSetNonCpointsToFpoints( void      *mgr_vdata, HYPRE_Int nonCptToFptFlag
    return hypre_error_flag;
 }
 
+/* Destroy data for compact F-relaxation */
+HYPRE_Int
+hypre_MGRDestroyFrelaxAffData( void *mgr_vdata, HYPRE_Int num_levels )
+{
+  hypre_ParMGRData *mgr_data = (hypre_ParMGRData*) mgr_vdata;
+  HYPRE_Int i;
+
+  if (mgr_data -> A_ff_array)
+  {
+    for (i = 0; i < num_levels; i++)
+    {
+      if ((mgr_data -> A_ff_array)[i])
+        hypre_ParCSRMatrixDestroy((mgr_data -> A_ff_array)[i]);
+      if ((mgr_data -> F_fine_array)[i])
+        hypre_ParVectorDestroy((mgr_data -> F_fine_array)[i]);
+      if ((mgr_data -> U_fine_array)[i])
+        hypre_ParVectorDestroy((mgr_data -> U_fine_array)[i]);
+      hypre_TFree((mgr_data -> Aff_diaginv)[i], HYPRE_MEMORY_HOST);
+    }
+    hypre_TFree(mgr_data -> A_ff_array, HYPRE_MEMORY_HOST);
+    hypre_TFree(mgr_data -> F_fine_array, HYPRE_MEMORY_HOST);
+    hypre_TFree(mgr_data -> U_fine_array, HYPRE_MEMORY_HOST);
+    hypre_TFree(mgr_data -> Aff_diaginv, HYPRE_MEMORY_HOST);
+    hypre_TFree(mgr_data -> Aff_block_size, HYPRE_MEMORY_HOST);
+    (mgr_data -> A_ff_array) = NULL;
+    (mgr_data -> F_fine_array) = NULL;
+    (mgr_data -> U_fine_array) = NULL;
+    (mgr_data -> Aff_diaginv) = NULL;
+    (mgr_data -> Aff_block_size) = NULL;
+  }
+
+  return hypre_error_flag;
+}
+
 /* Initialize/ set block data information */
 HYPRE_Int
 hypre_MGRSetCpointsByBlock( void      *mgr_vdata,
@@ -1143,6 +1188,148 @@ hypre_MGRBuildP( hypre_ParCSRMatrix   *A,
 	return(0);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_MGRRefreshP
+ *
+ * Recompute in place the values of an operator P built by hypre_MGRBuildP
+ * for the same CF_marker and a matrix A with the sparsity pattern of the
+ * one P was built from.  The entries of an F-row of P are the C-columns of
+ * the same row of A in the same order, so no new pattern is formed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_MGRRefreshP( hypre_ParCSRMatrix   *A,
+                   HYPRE_Int            *CF_marker,
+                   HYPRE_Int             method,
+                   hypre_ParCSRMatrix   *P )
+{
+	MPI_Comm 	      comm = hypre_ParCSRMatrixComm(A);
+	hypre_ParCSRCommPkg     *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+	hypre_ParCSRCommHandle  *comm_handle;
+
+	hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+	HYPRE_Real      *A_diag_data = hypre_CSRMatrixData(A_diag);
+	HYPRE_Int       *A_diag_i = hypre_CSRMatrixI(A_diag);
+	HYPRE_Int       *A_diag_j = hypre_CSRMatrixJ(A_diag);
+
+	hypre_CSRMatrix *A_offd         = hypre_ParCSRMatrixOffd(A);
+	HYPRE_Real      *A_offd_data    = hypre_CSRMatrixData(A_offd);
+	HYPRE_Int       *A_offd_i = hypre_CSRMatrixI(A_offd);
+	HYPRE_Int       *A_offd_j = hypre_CSRMatrixJ(A_offd);
+	HYPRE_Int        num_cols_A_offd = hypre_CSRMatrixNumCols(A_offd);
+
+	hypre_CSRMatrix *P_diag = hypre_ParCSRMatrixDiag(P);
+	HYPRE_Real      *P_diag_data = hypre_CSRMatrixData(P_diag);
+	HYPRE_Int       *P_diag_i = hypre_CSRMatrixI(P_diag);
+	hypre_CSRMatrix *P_offd = hypre_ParCSRMatrixOffd(P);
+	HYPRE_Real      *P_offd_data = hypre_CSRMatrixData(P_offd);
+	HYPRE_Int       *P_offd_i = hypre_CSRMatrixI(P_offd);
+
+	HYPRE_Int        n_fine = hypre_CSRMatrixNumRows(A_diag);
+	HYPRE_Int       *CF_marker_offd = NULL;
+	HYPRE_Int       *int_buf_data;
+	HYPRE_Int        num_procs, num_sends, index, start;
+	HYPRE_Int        i, j, jj, jj_counter, jj_counter_offd, mismatch;
+	HYPRE_Real       a_inv, scale;
+
+	hypre_MPI_Comm_size(comm, &num_procs);
+
+	if (hypre_CSRMatrixNumRows(P_diag) != n_fine)
+	{
+		hypre_error_in_arg(4);
+		return hypre_error_flag;
+	}
+
+	/*-------------------------------------------------------------------
+	 * Get the CF_marker data for the off-processor columns
+	 *-------------------------------------------------------------------*/
+
+	if (num_cols_A_offd) CF_marker_offd = hypre_CTAlloc(HYPRE_Int,  num_cols_A_offd, HYPRE_MEMORY_HOST);
+
+	if (!comm_pkg)
+	{
+		hypre_MatvecCommPkgCreate(A);
+		comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+	}
+
+	num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+	int_buf_data = hypre_CTAlloc(HYPRE_Int,  hypre_ParCSRCommPkgSendMapStart(comm_pkg,
+																			num_sends), HYPRE_MEMORY_HOST);
+
+	index = 0;
+	for (i = 0; i < num_sends; i++)
+	{
+		start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+		for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
+			int_buf_data[index++]
+				= CF_marker[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j)];
+	}
+
+	comm_handle = hypre_ParCSRCommHandleCreate( 11, comm_pkg, int_buf_data,
+												CF_marker_offd);
+	hypre_ParCSRCommHandleDestroy(comm_handle);
+
+	/*-----------------------------------------------------------------------
+	 *  Loop over fine grid points.
+	 *-----------------------------------------------------------------------*/
+
+	mismatch = 0;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,jj_counter,jj_counter_offd,a_inv,scale) reduction(+:mismatch) HYPRE_SMP_SCHEDULE
+#endif
+	for (i = 0; i < n_fine; i++)
+	{
+		/* C-point: the row of P is the identity */
+		if (CF_marker[i] >= 0)
+		{
+			P_diag_data[P_diag_i[i]] = 1.0;
+			continue;
+		}
+
+		a_inv = 0.0;
+		for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+		{
+			if (A_diag_j[jj] == i)
+				a_inv = 1.0/A_diag_data[jj];
+		}
+		if (method == 0)
+			scale = 0.0;
+		else if (method == 1)
+			scale = -1.0;
+		else
+			scale = -a_inv;
+
+		jj_counter = P_diag_i[i];
+		for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+		{
+			if (CF_marker[A_diag_j[jj]] >= 0 && jj_counter < P_diag_i[i+1])
+				P_diag_data[jj_counter++] = scale*A_diag_data[jj];
+		}
+		if (jj_counter != P_diag_i[i+1]) mismatch++;
+
+		if (num_procs > 1)
+		{
+			jj_counter_offd = P_offd_i[i];
+			for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+			{
+				if (CF_marker_offd[A_offd_j[jj]] >= 0 && jj_counter_offd < P_offd_i[i+1])
+					P_offd_data[jj_counter_offd++] = scale*A_offd_data[jj];
+			}
+			if (jj_counter_offd != P_offd_i[i+1]) mismatch++;
+		}
+	}
+
+	if (mismatch)
+	{
+		hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Sparsity pattern of A does not match P in hypre_MGRRefreshP\n");
+	}
+
+	hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
+	hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
+
+	return hypre_error_flag;
+}
+
 
 /* Interpolation for MGR - Dynamic Row Sum method */
 
@@ -2541,6 +2728,29 @@ hypre_MGRSetFRelaxMethod( void *mgr_vdata, HYPRE_Int relax_method )
    (mgr_data -> Frelax_method) = relax_method;
    return hypre_error_flag;
 }
+/* Set numeric refresh of a previous setup: 0=full setup, 1=refresh values
+*/
+HYPRE_Int
+hypre_MGRSetNumericRefresh( void *mgr_vdata, HYPRE_Int numeric_refresh )
+{
+   hypre_ParMGRData   *mgr_data = (hypre_ParMGRData*) mgr_vdata;
+   (mgr_data -> numeric_refresh) = numeric_refresh;
+   return hypre_error_flag;
+}
+/* Set how often a numeric refresh also sets up the coarse grid solver again
+*/
+HYPRE_Int
+hypre_MGRSetCoarseGridRefreshFrequency( void *mgr_vdata, HYPRE_Int refresh_freq )
+{
+   hypre_ParMGRData   *mgr_data = (hypre_ParMGRData*) mgr_vdata;
+   if (refresh_freq < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (mgr_data -> coarse_grid_refresh_freq) = refresh_freq;
+   return hypre_error_flag;
+}
 /* Set the type of the restriction type
  * for computing restriction operator
 */
@@ -2684,6 +2894,206 @@ hypre_MGRBuildAff( MPI_Comm comm, HYPRE_Int local_num_variables, HYPRE_Int num_f
   return 0;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_MGRExtractAff
+ *
+ * Extract the F-point submatrix A_ff of A (CF_marker == FMRK) as a ParCSR
+ * matrix of its own.  Unlike hypre_MGRBuildAff, no triple product is formed:
+ * the F rows and columns are copied directly, so A_ff carries no explicit
+ * zeros and keeps the diagonal entry first in each row.  The F-points keep
+ * their relative order, i.e. local row k of A_ff is the k-th local F-point.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_MGRExtractAff( hypre_ParCSRMatrix  *A,
+                     HYPRE_Int           *CF_marker,
+                     hypre_ParCSRMatrix **A_ff_ptr )
+{
+   MPI_Comm                comm = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg    *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommHandle *comm_handle;
+
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real      *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int       *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int        n           = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_A_offd = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_ParCSRMatrix *A_ff;
+   hypre_CSRMatrix    *A_ff_diag, *A_ff_offd;
+   HYPRE_Real         *A_ff_diag_data, *A_ff_offd_data;
+   HYPRE_Int          *A_ff_diag_i, *A_ff_diag_j, *A_ff_offd_i, *A_ff_offd_j;
+   HYPRE_Int          *col_map_offd_A_ff;
+
+   HYPRE_Int  *CF_marker_copy, *coarse_dof_func = NULL, *fpts_global;
+   HYPRE_Int  *fine_index, *fine_index_offd = NULL, *offd_map = NULL;
+   HYPRE_Int  *int_buf_data;
+   HYPRE_Int   num_procs, my_id, num_sends, index, start;
+   HYPRE_Int   nf, total_global_fpts, my_first_fpt;
+   HYPRE_Int   num_cols_A_ff_offd, nnz_diag, nnz_offd;
+   HYPRE_Int   i, j, k;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+
+   /* global numbering of the F-points */
+   CF_marker_copy = hypre_CTAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      CF_marker_copy[i] = (CF_marker[i] == FMRK) ? CMRK : FMRK;
+   }
+   hypre_BoomerAMGCoarseParms(comm, n, 1, NULL, CF_marker_copy,
+                              &coarse_dof_func, &fpts_global);
+   hypre_TFree(CF_marker_copy, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   my_first_fpt = fpts_global[0];
+   if (my_id == (num_procs -1)) total_global_fpts = fpts_global[1];
+   hypre_MPI_Bcast(&total_global_fpts, 1, HYPRE_MPI_INT, num_procs-1, comm);
+#else
+   my_first_fpt = fpts_global[my_id];
+   total_global_fpts = fpts_global[num_procs];
+#endif
+
+   /* local F index of every row, -1 for the other points */
+   fine_index = hypre_CTAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   nf = 0;
+   for (i = 0; i < n; i++)
+   {
+      fine_index[i] = (CF_marker[i] == FMRK) ? nf++ : -1;
+   }
+
+   /* global F index of the off-processor columns, -1 for the other points */
+   if (num_cols_A_offd)
+   {
+      fine_index_offd = hypre_CTAlloc(HYPRE_Int, num_cols_A_offd, HYPRE_MEMORY_HOST);
+      offd_map = hypre_CTAlloc(HYPRE_Int, num_cols_A_offd, HYPRE_MEMORY_HOST);
+   }
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   int_buf_data = hypre_CTAlloc(HYPRE_Int,
+                                hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                HYPRE_MEMORY_HOST);
+   index = 0;
+   for (i = 0; i < num_sends; i++)
+   {
+      start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+      for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
+      {
+         k = fine_index[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+         int_buf_data[index++] = (k < 0) ? -1 : k + my_first_fpt;
+      }
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf_data,
+                                              fine_index_offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
+
+   /* the F columns of A_offd, in the (increasing) order of col_map_offd */
+   num_cols_A_ff_offd = 0;
+   for (i = 0; i < num_cols_A_offd; i++)
+   {
+      offd_map[i] = (fine_index_offd[i] < 0) ? -1 : num_cols_A_ff_offd++;
+   }
+
+   /* count the nonzeros */
+   nnz_diag = nnz_offd = 0;
+   for (i = 0; i < n; i++)
+   {
+      if (fine_index[i] < 0)
+      {
+         continue;
+      }
+      for (j = A_diag_i[i]; j < A_diag_i[i+1]; j++)
+      {
+         if (fine_index[A_diag_j[j]] >= 0)
+         {
+            nnz_diag++;
+         }
+      }
+      for (j = A_offd_i[i]; j < A_offd_i[i+1]; j++)
+      {
+         if (offd_map[A_offd_j[j]] >= 0)
+         {
+            nnz_offd++;
+         }
+      }
+   }
+
+   A_ff = hypre_ParCSRMatrixCreate(comm, total_global_fpts, total_global_fpts,
+                                   fpts_global, fpts_global,
+                                   num_cols_A_ff_offd, nnz_diag, nnz_offd);
+   hypre_ParCSRMatrixOwnsRowStarts(A_ff) = 1;
+   hypre_ParCSRMatrixOwnsColStarts(A_ff) = 0;
+   hypre_ParCSRMatrixInitialize(A_ff);
+
+   A_ff_diag      = hypre_ParCSRMatrixDiag(A_ff);
+   A_ff_diag_i    = hypre_CSRMatrixI(A_ff_diag);
+   A_ff_diag_j    = hypre_CSRMatrixJ(A_ff_diag);
+   A_ff_diag_data = hypre_CSRMatrixData(A_ff_diag);
+   A_ff_offd      = hypre_ParCSRMatrixOffd(A_ff);
+   A_ff_offd_i    = hypre_CSRMatrixI(A_ff_offd);
+   A_ff_offd_j    = hypre_CSRMatrixJ(A_ff_offd);
+   A_ff_offd_data = hypre_CSRMatrixData(A_ff_offd);
+   col_map_offd_A_ff = hypre_ParCSRMatrixColMapOffd(A_ff);
+
+   /* copy the F rows and columns */
+   nnz_diag = nnz_offd = 0;
+   A_ff_diag_i[0] = A_ff_offd_i[0] = 0;
+   for (i = 0; i < n; i++)
+   {
+      if ((k = fine_index[i]) < 0)
+      {
+         continue;
+      }
+      for (j = A_diag_i[i]; j < A_diag_i[i+1]; j++)
+      {
+         if (fine_index[A_diag_j[j]] >= 0)
+         {
+            A_ff_diag_j[nnz_diag] = fine_index[A_diag_j[j]];
+            A_ff_diag_data[nnz_diag++] = A_diag_data[j];
+         }
+      }
+      for (j = A_offd_i[i]; j < A_offd_i[i+1]; j++)
+      {
+         if (offd_map[A_offd_j[j]] >= 0)
+         {
+            A_ff_offd_j[nnz_offd] = offd_map[A_offd_j[j]];
+            A_ff_offd_data[nnz_offd++] = A_offd_data[j];
+         }
+      }
+      A_ff_diag_i[k+1] = nnz_diag;
+      A_ff_offd_i[k+1] = nnz_offd;
+   }
+   for (i = 0; i < num_cols_A_offd; i++)
+   {
+      if (offd_map[i] >= 0)
+      {
+         col_map_offd_A_ff[offd_map[i]] = fine_index_offd[i];
+      }
+   }
+
+   hypre_MatvecCommPkgCreate(A_ff);
+
+   hypre_TFree(fine_index, HYPRE_MEMORY_HOST);
+   hypre_TFree(fine_index_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_map, HYPRE_MEMORY_HOST);
+
+   *A_ff_ptr = A_ff;
+
+   return hypre_error_flag;
+}
+
 /* Get pointer to coarse grid matrix for MGR solver */
 HYPRE_Int
 hypre_MGRGetCoarseGridMatrix( void *mgr_vdata, hypre_ParCSRMatrix **RAP )
@@ -96,6 +96,21 @@ typedef struct
   HYPRE_Int Frelax_method;
   /* V-cycle F relaxation method */
   hypre_ParAMGData    **FrelaxVcycleData;
+  /* compact F relaxation method: F-point submatrices, the inverses of their
+     diagonal blocks and F-point work vectors, per level */
+  hypre_ParCSRMatrix  **A_ff_array;
+  HYPRE_Real          **Aff_diaginv;
+  HYPRE_Int            *Aff_block_size;
+  hypre_ParVector     **F_fine_array;
+  hypre_ParVector     **U_fine_array;
+
+  /* numeric refresh: a repeated setup keeps the CF splittings, the
+     patterns of P, R and the coarse grids, and the coarse solver, and only
+     recomputes values; the coarse solver gets a full setup on every
+     coarse_grid_refresh_freq-th refresh */
+  HYPRE_Int   numeric_refresh;
+  HYPRE_Int   coarse_grid_refresh_freq;
+  HYPRE_Int   num_refresh_setups;
 
   HYPRE_Int   max_local_lvls;
   
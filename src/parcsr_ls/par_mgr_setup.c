@@ -13,6 +13,264 @@
 #include "par_mgr.h"
 #include "par_amg.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_MGRSetupL1Norms
+ *
+ * Compute the l1 norms used by the F-relaxation on each level.  With the
+ * compact F-relaxation (Frelax_method = 2) they are those of A_ff.
+ *--------------------------------------------------------------------------*/
+static HYPRE_Int
+hypre_MGRSetupL1Norms( hypre_ParMGRData *mgr_data,
+                       HYPRE_Int         num_c_levels )
+{
+   hypre_ParCSRMatrix  **A_array = (mgr_data -> A_array);
+   HYPRE_Int           **CF_marker_array = (mgr_data -> CF_marker_array);
+   HYPRE_Int             relax_type = (mgr_data -> relax_type);
+   HYPRE_Int             relax_order = (mgr_data -> relax_order);
+   HYPRE_Int             Frelax_method = (mgr_data -> Frelax_method);
+   HYPRE_Int             num_threads = hypre_NumThreads();
+   HYPRE_Real          **l1_norms = NULL;
+   HYPRE_Int             j;
+
+   if (	relax_type == 8 || relax_type == 13 || relax_type == 14 || relax_type == 18 )
+   {
+      l1_norms = hypre_CTAlloc(HYPRE_Real *,  num_c_levels, HYPRE_MEMORY_HOST);
+      (mgr_data -> l1_norms) = l1_norms;
+   }
+   for (j = 0; j < num_c_levels; j++)
+   {
+      /* the compact F-relaxation sweeps over A_ff, so take its l1 norms */
+      hypre_ParCSRMatrix *A_relax = A_array[j];
+      HYPRE_Int *CF_relax = CF_marker_array[j];
+
+      if (Frelax_method == 2)
+      {
+         A_relax = (mgr_data -> A_ff_array)[j];
+         CF_relax = NULL;
+      }
+      if (num_threads == 1)
+      {
+         if (relax_type == 8 || relax_type == 13 || relax_type == 14)
+         {
+            if (relax_order)
+               hypre_ParCSRComputeL1Norms(A_relax, 4, CF_relax, &l1_norms[j]);
+            else
+               hypre_ParCSRComputeL1Norms(A_relax, 4, NULL, &l1_norms[j]);
+         }
+         else if (relax_type == 18)
+         {
+            if (relax_order)
+               hypre_ParCSRComputeL1Norms(A_relax, 1, CF_relax, &l1_norms[j]);
+            else
+               hypre_ParCSRComputeL1Norms(A_relax, 1, NULL, &l1_norms[j]);
+         }
+      }
+      else
+      {
+         if (relax_type == 8 || relax_type == 13 || relax_type == 14)
+         {
+            if (relax_order)
+               hypre_ParCSRComputeL1NormsThreads(A_relax, 4, num_threads, CF_relax , &l1_norms[j]);
+            else
+               hypre_ParCSRComputeL1NormsThreads(A_relax, 4, num_threads, NULL, &l1_norms[j]);
+         }
+         else if (relax_type == 18)
+         {
+            if (relax_order)
+               hypre_ParCSRComputeL1NormsThreads(A_relax, 1, num_threads, CF_relax , &l1_norms[j]);
+            else
+               hypre_ParCSRComputeL1NormsThreads(A_relax, 1, num_threads, NULL, &l1_norms[j]);
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MGRReplaceMatrixData
+ *
+ * Move the local matrices, the offd column map and the communication
+ * package of A_new into A and destroy A_new.  A keeps its address and its
+ * partitionings, so the vectors and solvers that refer to A see the new
+ * operator.
+ *--------------------------------------------------------------------------*/
+static HYPRE_Int
+hypre_MGRReplaceMatrixData( hypre_ParCSRMatrix *A,
+                            hypre_ParCSRMatrix *A_new )
+{
+   hypre_CSRMatrix      *diag         = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix      *offd         = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int            *col_map_offd = hypre_ParCSRMatrixColMapOffd(A);
+   hypre_ParCSRCommPkg  *comm_pkg     = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommPkg  *comm_pkgT    = hypre_ParCSRMatrixCommPkgT(A);
+   hypre_CSRMatrix      *diagT        = hypre_ParCSRMatrixDiagT(A);
+   hypre_CSRMatrix      *offdT        = hypre_ParCSRMatrixOffdT(A);
+
+   hypre_ParCSRMatrixDiag(A)       = hypre_ParCSRMatrixDiag(A_new);
+   hypre_ParCSRMatrixOffd(A)       = hypre_ParCSRMatrixOffd(A_new);
+   hypre_ParCSRMatrixColMapOffd(A) = hypre_ParCSRMatrixColMapOffd(A_new);
+   hypre_ParCSRMatrixCommPkg(A)    = hypre_ParCSRMatrixCommPkg(A_new);
+   hypre_ParCSRMatrixCommPkgT(A)   = hypre_ParCSRMatrixCommPkgT(A_new);
+   hypre_ParCSRMatrixDiagT(A)      = hypre_ParCSRMatrixDiagT(A_new);
+   hypre_ParCSRMatrixOffdT(A)      = hypre_ParCSRMatrixOffdT(A_new);
+   hypre_ParCSRMatrixSetNumNonzeros(A);
+   hypre_ParCSRMatrixSetDNumNonzeros(A);
+
+   hypre_ParCSRMatrixDiag(A_new)       = diag;
+   hypre_ParCSRMatrixOffd(A_new)       = offd;
+   hypre_ParCSRMatrixColMapOffd(A_new) = col_map_offd;
+   hypre_ParCSRMatrixCommPkg(A_new)    = comm_pkg;
+   hypre_ParCSRMatrixCommPkgT(A_new)   = comm_pkgT;
+   hypre_ParCSRMatrixDiagT(A_new)      = diagT;
+   hypre_ParCSRMatrixOffdT(A_new)      = offdT;
+
+   /* a coarse grid matrix shares its partitionings with the old one */
+   if (hypre_ParCSRMatrixRowStarts(A_new) == hypre_ParCSRMatrixRowStarts(A) ||
+       hypre_ParCSRMatrixRowStarts(A_new) == hypre_ParCSRMatrixColStarts(A))
+      hypre_ParCSRMatrixOwnsRowStarts(A_new) = 0;
+   if (hypre_ParCSRMatrixColStarts(A_new) == hypre_ParCSRMatrixRowStarts(A) ||
+       hypre_ParCSRMatrixColStarts(A_new) == hypre_ParCSRMatrixColStarts(A))
+      hypre_ParCSRMatrixOwnsColStarts(A_new) = 0;
+   hypre_ParCSRMatrixDestroy(A_new);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MGRRefreshSetup
+ *
+ * Numeric refresh of a previous setup for a matrix A with the same sparsity
+ * pattern and row distribution.  The CF splittings are kept, P and R are
+ * updated in place, and the coarse grid matrices are recomputed and moved
+ * into the existing level matrices.  The global smoother and the
+ * F-relaxation data are set up again.  The coarse grid solver gets a full
+ * setup on every coarse_grid_refresh_freq-th refresh; in between, a
+ * BoomerAMG coarse solver reuses its coarse grids and interpolation.
+ *--------------------------------------------------------------------------*/
+static HYPRE_Int
+hypre_MGRRefreshSetup( hypre_ParMGRData   *mgr_data,
+                       hypre_ParCSRMatrix *A,
+                       hypre_ParVector    *f,
+                       hypre_ParVector    *u )
+{
+   MPI_Comm              comm = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int             num_c_levels = (mgr_data -> num_coarse_levels);
+   hypre_ParCSRMatrix  **A_array = (mgr_data -> A_array);
+   hypre_ParCSRMatrix  **P_array = (mgr_data -> P_array);
+   hypre_ParCSRMatrix  **RT_array = (mgr_data -> RT_array);
+   HYPRE_Int           **CF_marker_array = (mgr_data -> CF_marker_array);
+   hypre_ParVector     **F_array = (mgr_data -> F_array);
+   hypre_ParVector     **U_array = (mgr_data -> U_array);
+   hypre_ParAMGData    **FrelaxVcycleData = (mgr_data -> FrelaxVcycleData);
+   HYPRE_Int             interp_type = (mgr_data -> interp_type);
+   HYPRE_Int             restrict_type = (mgr_data -> restrict_type);
+   HYPRE_Int             relax_type = (mgr_data -> relax_type);
+   HYPRE_Int             Frelax_method = (mgr_data -> Frelax_method);
+   HYPRE_Int             global_smooth_type = (mgr_data -> global_smooth_type);
+   HYPRE_Int             refresh_freq = (mgr_data -> coarse_grid_refresh_freq);
+   HYPRE_Int             full_coarse_setup;
+   HYPRE_Int	(*coarse_grid_solver_setup)(void*,void*,void*,void*) = (HYPRE_Int (*)(void*, void*, void*, void*)) (mgr_data -> coarse_grid_solver_setup);
+
+   hypre_ParCSRMatrix   *AT = NULL;
+   hypre_ParCSRMatrix   *RAP_ptr = NULL;
+   hypre_ParCSRMatrix   *A_ff = NULL;
+   HYPRE_Int             lev, last_level;
+
+   A_array[0] = A;
+   F_array[0] = f;
+   U_array[0] = u;
+
+   /* global smoother */
+   if (global_smooth_type == 0)
+   {
+      hypre_blockRelax_setup(A,(mgr_data -> block_size),(mgr_data -> reserved_coarse_size),&(mgr_data -> diaginv));
+   }
+   else if (global_smooth_type == 8)
+   {
+      if (mgr_data -> global_smoother)
+         HYPRE_EuclidDestroy(mgr_data -> global_smoother);
+      HYPRE_EuclidCreate(comm, &(mgr_data -> global_smoother));
+      HYPRE_EuclidSetLevel(mgr_data -> global_smoother, 0);
+      HYPRE_EuclidSetBJ(mgr_data -> global_smoother, 1);
+      HYPRE_EuclidSetup(mgr_data -> global_smoother, A, f, u);
+   }
+
+   /* P, R and the coarse grid matrices */
+   for (lev = 0; lev < num_c_levels; lev++)
+   {
+      last_level = (lev == num_c_levels-1);
+
+      hypre_MGRRefreshP(A_array[lev], CF_marker_array[lev], interp_type, P_array[lev]);
+
+      hypre_ParCSRMatrixTranspose(A_array[lev], &AT, 1);
+      hypre_MGRRefreshP(AT, CF_marker_array[lev], last_level ? restrict_type : 2, RT_array[lev]);
+      hypre_ParCSRMatrixDestroy(AT);
+
+      hypre_BoomerAMGBuildCoarseOperator(RT_array[lev], A_array[lev], P_array[lev], &RAP_ptr);
+      hypre_MGRReplaceMatrixData(last_level ? (mgr_data -> RAP) : A_array[lev+1], RAP_ptr);
+   }
+
+   /* coarse grid solver: a BoomerAMG solver keeps its coarse grids and
+      interpolation between full setups on every refresh_freq-th refresh */
+   (mgr_data -> num_refresh_setups) ++;
+   full_coarse_setup = (refresh_freq > 0 && (mgr_data -> num_refresh_setups) % refresh_freq == 0);
+   if (coarse_grid_solver_setup == (HYPRE_Int (*)(void*, void*, void*, void*)) hypre_BoomerAMGSetup ||
+       coarse_grid_solver_setup == (HYPRE_Int (*)(void*, void*, void*, void*)) HYPRE_BoomerAMGSetup)
+   {
+      hypre_BoomerAMGSetReuseInterp((mgr_data -> coarse_grid_solver), !full_coarse_setup);
+      coarse_grid_solver_setup((mgr_data -> coarse_grid_solver), (mgr_data -> RAP),
+                               F_array[num_c_levels], U_array[num_c_levels]);
+      hypre_BoomerAMGSetReuseInterp((mgr_data -> coarse_grid_solver), 0);
+   }
+   else if (full_coarse_setup)
+   {
+      coarse_grid_solver_setup((mgr_data -> coarse_grid_solver), (mgr_data -> RAP),
+                               F_array[num_c_levels], U_array[num_c_levels]);
+   }
+
+   /* F-relaxation data */
+   if (Frelax_method == 2)
+   {
+      for (lev = 0; lev < num_c_levels; lev++)
+      {
+         hypre_MGRExtractAff(A_array[lev], CF_marker_array[lev], &A_ff);
+         hypre_MGRReplaceMatrixData((mgr_data -> A_ff_array)[lev], A_ff);
+         if (relax_type == 0)
+            hypre_blockRelax_setup((mgr_data -> A_ff_array)[lev], (mgr_data -> Aff_block_size)[lev], 0,
+                                   &(mgr_data -> Aff_diaginv)[lev]);
+      }
+   }
+
+   if ((mgr_data -> l1_norms))
+   {
+      for (lev = 0; lev < num_c_levels; lev++)
+      {
+         hypre_TFree((mgr_data -> l1_norms)[lev], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree((mgr_data -> l1_norms), HYPRE_MEMORY_HOST);
+   }
+   hypre_MGRSetupL1Norms(mgr_data, num_c_levels);
+
+   if (Frelax_method == 1)
+   {
+      for (lev = 0; lev < num_c_levels; lev++)
+      {
+         hypre_MGRDestroyFrelaxVcycleData(FrelaxVcycleData[lev]);
+         FrelaxVcycleData[lev] = (hypre_ParAMGData*) hypre_MGRCreateFrelaxVcycleData();
+         (FrelaxVcycleData[lev] -> Vtemp) = (mgr_data -> Vtemp);
+         (FrelaxVcycleData[lev] -> Ztemp) = (mgr_data -> Ztemp);
+         hypre_MGRSetupFrelaxVcycleData(mgr_data, A_array[lev], F_array[lev], U_array[lev], lev);
+      }
+   }
+
+   /* the maximum number of iterations may have changed */
+   hypre_TFree((mgr_data -> rel_res_norms), HYPRE_MEMORY_HOST);
+   (mgr_data -> rel_res_norms) = hypre_CTAlloc(HYPRE_Real, (mgr_data -> max_iter), HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /* Setup MGR data */
 HYPRE_Int
 hypre_MGRSetup( void               *mgr_vdata,
@@ -24,7 +282,7 @@ hypre_MGRSetup( void               *mgr_vdata,
 	hypre_ParMGRData   *mgr_data = (hypre_ParMGRData*) mgr_vdata;
 
 	HYPRE_Int       cnt,i,j, final_coarse_size, block_size, idx, row, **block_cf_marker;
-	HYPRE_Int	   lev, num_coarsening_levs, last_level, num_c_levels, num_threads,nc,index_i,cflag;
+	HYPRE_Int	   lev, num_coarsening_levs, last_level, num_c_levels, nc,index_i,cflag;
 	HYPRE_Int	   debug_flag = 0;
 
 	hypre_ParCSRMatrix  *RT = NULL;
@@ -37,7 +295,6 @@ hypre_MGRSetup( void               *mgr_vdata,
 	HYPRE_Int * col_offd_ST_to_AT = NULL;
 	HYPRE_Int * dof_func_buff = NULL;
 	HYPRE_Int * coarse_pnts_global = NULL;
-	HYPRE_Real         **l1_norms = NULL;
 
 	hypre_ParVector     *Ztemp;
 	hypre_ParVector     *Vtemp;
@@ -49,7 +306,6 @@ hypre_MGRSetup( void               *mgr_vdata,
 	HYPRE_Int  logging = (mgr_data -> logging);
 //	HYPRE_Int  print_level = (mgr_data -> print_level);
 	HYPRE_Int  relax_type = (mgr_data -> relax_type);
-	HYPRE_Int  relax_order = (mgr_data -> relax_order);
 	HYPRE_Int  interp_type = (mgr_data -> interp_type);
   HYPRE_Int  restrict_type = (mgr_data -> restrict_type);
 	HYPRE_Int num_interp_sweeps = (mgr_data -> num_interp_sweeps);
@@ -91,8 +347,6 @@ hypre_MGRSetup( void               *mgr_vdata,
 
 	/* ----- begin -----*/
 
-	num_threads = hypre_NumThreads();
-
   block_size = (mgr_data -> block_size);
   block_cf_marker = (mgr_data -> block_cf_marker);
   
@@ -162,6 +416,24 @@ hypre_MGRSetup( void               *mgr_vdata,
 
 		return hypre_error_flag;
 	}
+
+  /* Numeric refresh: reuse the splittings and operator patterns of the
+     previous setup if the levels and the row distribution are unchanged */
+  if ((mgr_data -> numeric_refresh) && old_num_coarse_levels > 0 &&
+      old_num_coarse_levels == max_num_coarse_levels && P_array && P_array[0] &&
+      (mgr_data -> RAP) && interp_type < 3 && restrict_type < 3 &&
+      (Frelax_method != 1 || FrelaxVcycleData) &&
+      (Frelax_method != 2 || (mgr_data -> A_ff_array)))
+  {
+     HYPRE_Int same_rows, refresh;
+
+     same_rows = (hypre_ParCSRMatrixGlobalNumRows(A) ==
+                  hypre_ParCSRMatrixGlobalNumRows(P_array[0]) &&
+                  n == hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(P_array[0])));
+     hypre_MPI_Allreduce(&same_rows, &refresh, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+     if (refresh)
+        return hypre_MGRRefreshSetup(mgr_data, A, f, u);
+  }
 	
 /*
   if ((mgr_data -> level_coarse_indexes) != NULL)
@@ -290,6 +562,9 @@ hypre_MGRSetup( void               *mgr_vdata,
    // reset pointer to NULL
    (mgr_data -> FrelaxVcycleData) = FrelaxVcycleData;
 
+   /* Free previously allocated compact F-relaxation data */
+   hypre_MGRDestroyFrelaxAffData(mgr_data, old_num_coarse_levels);
+
   /* destroy final coarse grid matrix, if not previously destroyed */
   if((mgr_data -> RAP))
   {
@@ -608,49 +883,67 @@ hypre_MGRSetup( void               *mgr_vdata,
    /* setup coarse grid solver */
    coarse_grid_solver_setup((mgr_data -> coarse_grid_solver), RAP_ptr, F_array[num_c_levels], U_array[num_c_levels]);
 
-   /* Setup smoother for fine grid */
-   if (	relax_type == 8 || relax_type == 13 || relax_type == 14 || relax_type == 18 )
-   {
-      l1_norms = hypre_CTAlloc(HYPRE_Real *,  num_c_levels, HYPRE_MEMORY_HOST);
-      (mgr_data -> l1_norms) = l1_norms;
-   }
-   for (j = 0; j < num_c_levels; j++)
+   /* Setup compact F-relaxation for Frelax_method = 2: extract A_ff once per
+      level and, for Jacobi, invert its diagonal blocks */
+   if (Frelax_method == 2)
    {
-      if (num_threads == 1)
+      (mgr_data -> A_ff_array) = hypre_CTAlloc(hypre_ParCSRMatrix*, num_c_levels, HYPRE_MEMORY_HOST);
+      (mgr_data -> Aff_diaginv) = hypre_CTAlloc(HYPRE_Real*, num_c_levels, HYPRE_MEMORY_HOST);
+      (mgr_data -> Aff_block_size) = hypre_CTAlloc(HYPRE_Int, num_c_levels, HYPRE_MEMORY_HOST);
+      (mgr_data -> F_fine_array) = hypre_CTAlloc(hypre_ParVector*, num_c_levels, HYPRE_MEMORY_HOST);
+      (mgr_data -> U_fine_array) = hypre_CTAlloc(hypre_ParVector*, num_c_levels, HYPRE_MEMORY_HOST);
+      for (j = 0; j < num_c_levels; j++)
       {
-         if (relax_type == 8 || relax_type == 13 || relax_type == 14)
+         hypre_ParCSRMatrix *A_ff;
+
+         hypre_MGRExtractAff(A_array[j], CF_marker_array[j], &A_ff);
+         (mgr_data -> A_ff_array)[j] = A_ff;
+
+         (mgr_data -> F_fine_array)[j] =
+            hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_ff),
+                                  hypre_ParCSRMatrixGlobalNumRows(A_ff),
+                                  hypre_ParCSRMatrixRowStarts(A_ff));
+         hypre_ParVectorInitialize((mgr_data -> F_fine_array)[j]);
+         hypre_ParVectorSetPartitioningOwner((mgr_data -> F_fine_array)[j],0);
+
+         (mgr_data -> U_fine_array)[j] =
+            hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_ff),
+                                  hypre_ParCSRMatrixGlobalNumRows(A_ff),
+                                  hypre_ParCSRMatrixRowStarts(A_ff));
+         hypre_ParVectorInitialize((mgr_data -> U_fine_array)[j]);
+         hypre_ParVectorSetPartitioningOwner((mgr_data -> U_fine_array)[j],0);
+
+         /* The F-points of a node are consecutive in A_ff and form one
+            diagonal block, provided every node has the same number of
+            F-points (no reserved or extra coarse points on this level). */
+         (mgr_data -> Aff_block_size)[j] = 1;
+         if (reserved_coarse_size == 0)
          {
-            if (relax_order)
-               hypre_ParCSRComputeL1Norms(A_array[j], 4, CF_marker_array[j], &l1_norms[j]);
-            else
-               hypre_ParCSRComputeL1Norms(A_array[j], 4, NULL, &l1_norms[j]);
-         }
-         else if (relax_type == 18)
-         {
-            if (relax_order)
-               hypre_ParCSRComputeL1Norms(A_array[j], 1, CF_marker_array[j], &l1_norms[j]);
-            else
-               hypre_ParCSRComputeL1Norms(A_array[j], 1, NULL, &l1_norms[j]);
-         }
-      }
-      else
-      {
-         if (relax_type == 8 || relax_type == 13 || relax_type == 14)
-         {
-            if (relax_order)
-               hypre_ParCSRComputeL1NormsThreads(A_array[j], 4, num_threads, CF_marker_array[j] , &l1_norms[j]);
-            else
-               hypre_ParCSRComputeL1NormsThreads(A_array[j], 4, num_threads, NULL, &l1_norms[j]);
-         }
-         else if (relax_type == 18)
-         {
-            if (relax_order)
-               hypre_ParCSRComputeL1NormsThreads(A_array[j], 1, num_threads, CF_marker_array[j] , &l1_norms[j]);
-            else
-               hypre_ParCSRComputeL1NormsThreads(A_array[j], 1, num_threads, NULL, &l1_norms[j]);
+            HYPRE_Int node_size = (j == 0) ? block_size : (mgr_data -> block_num_coarse_indexes)[j-1];
+            HYPRE_Int node_fpts = node_size - (mgr_data -> block_num_coarse_indexes)[j];
+            HYPRE_Int nloc_j = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A_array[j]));
+
+            if (node_fpts > 1 && nloc_j % node_size == 0)
+            {
+               for (i = 0; i < nloc_j; i += node_size)
+               {
+                  for (cnt = 0, idx = i; idx < i+node_size; idx++)
+                     if (CF_marker_array[j][idx] == FMRK) cnt++;
+                  if (cnt != node_fpts) break;
+               }
+               if (i == nloc_j)
+                  (mgr_data -> Aff_block_size)[j] = node_fpts;
+            }
          }
+
+         if (relax_type == 0)
+            hypre_blockRelax_setup(A_ff, (mgr_data -> Aff_block_size)[j], 0,
+                                   &(mgr_data -> Aff_diaginv)[j]);
       }
    }
+
+   /* Setup smoother for fine grid */
+   hypre_MGRSetupL1Norms(mgr_data, num_c_levels);
    
    /* Setup Vcycle data for Frelax_method > 0 */
    if(Frelax_method == 1)
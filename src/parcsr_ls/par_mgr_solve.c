@@ -431,6 +431,99 @@ hypre_MGRFrelaxVcycle ( void   *Frelax_vdata, hypre_ParVector *f, hypre_ParVecto
   return Solve_err_flag;
 }
 
+/*--------------------------------------------------------------------
+ * hypre_MGRFrelaxAff
+ *
+ * F-relaxation on the submatrix A_ff extracted in the setup
+ * (Frelax_method = 2).  The F-part of the residual is gathered into a
+ * compact vector r_f, nsweeps sweeps on A_ff e_f = r_f are done starting
+ * from e_f = 0, and e_f is added to the F-points of u.  For Jacobi this is
+ * the same iteration as masked F-point sweeps over A, but the sweeps only
+ * touch the F-rows and F-columns.  On the coarse levels u is zero on entry,
+ * so the residual is f and no matvec is needed.
+ *--------------------------------------------------------------------*/
+static HYPRE_Int
+hypre_MGRFrelaxAff( hypre_ParMGRData *mgr_data,
+                    HYPRE_Int         level,
+                    hypre_ParVector  *f,
+                    hypre_ParVector  *u )
+{
+   hypre_ParCSRMatrix *A         = (mgr_data -> A_array)[level];
+   hypre_ParCSRMatrix *A_ff      = (mgr_data -> A_ff_array)[level];
+   HYPRE_Int          *CF_marker = (mgr_data -> CF_marker_array)[level];
+   HYPRE_Real         *diaginv   = (mgr_data -> Aff_diaginv)[level];
+   HYPRE_Int           blk_size  = (mgr_data -> Aff_block_size)[level];
+   hypre_ParVector    *F_fine    = (mgr_data -> F_fine_array)[level];
+   hypre_ParVector    *U_fine    = (mgr_data -> U_fine_array)[level];
+   hypre_ParVector    *Vtemp     = (mgr_data -> Vtemp);
+   hypre_ParVector    *Ztemp     = (mgr_data -> Ztemp);
+   HYPRE_Real         *l1_norms  = NULL;
+   HYPRE_Int           nsweeps   = (mgr_data -> num_relax_sweeps);
+   HYPRE_Int           relax_type = (mgr_data -> relax_type);
+   HYPRE_Real          relax_weight = (mgr_data -> relax_weight);
+   HYPRE_Real          omega     = (mgr_data -> omega);
+
+   HYPRE_Int    n     = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int    n_ff  = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A_ff));
+   HYPRE_Real  *u_data      = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real  *f_fine_data = hypre_VectorData(hypre_ParVectorLocalVector(F_fine));
+   HYPRE_Real  *u_fine_data = hypre_VectorData(hypre_ParVectorLocalVector(U_fine));
+   HYPRE_Real  *r_data;
+   HYPRE_Int    Vtemp_size, Ztemp_size;
+   HYPRE_Int    i, k, sweep;
+
+   if (mgr_data -> l1_norms)
+      l1_norms = (mgr_data -> l1_norms)[level];
+
+   /* r_f = (f - A u)_F */
+   if (level == 0)
+   {
+      hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, Vtemp);
+      r_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   }
+   else
+   {
+      r_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   }
+   for (i = 0, k = 0; i < n; i++)
+   {
+      if (CF_marker[i] == FMRK)
+         f_fine_data[k++] = r_data[i];
+   }
+   hypre_ParVectorSetConstantValues(U_fine, 0.0);
+
+   /* the level work vectors are long enough to serve A_ff */
+   Vtemp_size = hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp));
+   Ztemp_size = hypre_VectorSize(hypre_ParVectorLocalVector(Ztemp));
+   hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp)) = n_ff;
+   hypre_VectorSize(hypre_ParVectorLocalVector(Ztemp)) = n_ff;
+
+   for (sweep = 0; sweep < nsweeps; sweep++)
+   {
+      if (relax_type == 0)
+         hypre_block_jacobi(A_ff, F_fine, U_fine, blk_size, n_ff/blk_size, 0,
+                            diaginv, Vtemp);
+      else if (relax_type == 18)
+         hypre_ParCSRRelax_L1_Jacobi(A_ff, F_fine, NULL, 0, relax_weight,
+                                     l1_norms, U_fine, Vtemp);
+      else
+         hypre_BoomerAMGRelax(A_ff, F_fine, NULL, relax_type, 0, relax_weight,
+                              omega, l1_norms, U_fine, Vtemp, Ztemp);
+   }
+
+   hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp)) = Vtemp_size;
+   hypre_VectorSize(hypre_ParVectorLocalVector(Ztemp)) = Ztemp_size;
+
+   /* u_F = u_F + e_f */
+   for (i = 0, k = 0; i < n; i++)
+   {
+      if (CF_marker[i] == FMRK)
+         u_data[i] += u_fine_data[k++];
+   }
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_MGRCycle( void               *mgr_vdata,
                   hypre_ParVector    **F_array,
@@ -539,6 +632,11 @@ hypre_MGRCycle( void               *mgr_vdata,
 		      for(i=0; i<nsweeps; i++)
                          hypre_MGRFrelaxVcycle(FrelaxVcycleData[level], F_array[level], U_array[level]);
                    } 
+                   else if (Frelax_method == 2)
+                   {
+                      /* compact relaxation on the extracted A_ff */
+                      Solve_err_flag = hypre_MGRFrelaxAff(mgr_data, fine_grid, F_array[fine_grid], U_array[fine_grid]);
+                   }
                    else 
                    {
                       for (i=0; i<nsweeps; i++)
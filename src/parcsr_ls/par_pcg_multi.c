@@ -0,0 +1,298 @@
+/*BHEADER**********************************************************************
+ * Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+ * Produced at the Lawrence Livermore National Laboratory.
+ * This file is part of HYPRE.  See file COPYRIGHT for details.
+ *
+ * HYPRE is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License (as published by the Free
+ * Software Foundation) version 2.1 dated February 1999.
+ *
+ * $Revision$
+ ***********************************************************************EHEADER*/
+
+/******************************************************************************
+ *
+ * ParCSR PCG for several right-hand sides
+ *
+ * Runs one independent conjugate gradient iteration per column of the
+ * multivectors b and x.  The iterations share every matvec, preconditioner
+ * application and (fused) inner product, so the matrix and the AMG hierarchy
+ * are read once per iteration for all columns.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRPCGApplyPrecondMulti
+ *
+ * Applies the preconditioner to all columns of r.  Preconditioners known to
+ * accept multivectors are called once; all others are called per column.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRPCGApplyPrecondMulti( hypre_PCGData      *pcg_data,
+                                  hypre_ParCSRMatrix *A,
+                                  hypre_ParVector    *r,
+                                  hypre_ParVector    *s,
+                                  hypre_ParVector    *r_col,
+                                  hypre_ParVector    *s_col )
+{
+   HYPRE_Int  (*precond)()  = (pcg_data -> functions) -> precond;
+   void        *precond_data = pcg_data -> precond_data;
+   HYPRE_Int    num_vectors  = hypre_ParVectorNumVectors(r);
+   HYPRE_Int    j;
+
+   if ( precond == (HYPRE_Int (*)()) HYPRE_BoomerAMGSolve ||
+        precond == (HYPRE_Int (*)()) HYPRE_ParCSRDiagScale ||
+        precond == (HYPRE_Int (*)()) hypre_ParKrylovIdentity )
+   {
+      precond(precond_data, A, r, s);
+   }
+   else
+   {
+      for (j = 0; j < num_vectors; j++)
+      {
+         hypre_ParMultiVectorGetColumn(r, j, r_col);
+         hypre_ParVectorSetConstantValues(s_col, 0.0);
+         precond(precond_data, A, r_col, s_col);
+         hypre_ParMultiVectorSetColumn(s, j, s_col);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRPCGSolveMulti
+ *
+ * Solves A x_j = b_j for every column j of the multivectors b and x with the
+ * parameters and preconditioner of the PCG solver pcg_vdata.  Each column
+ * uses the stopping test of hypre_PCGSolve with tol, a_tol and two_norm;
+ * a converged column is left unchanged while the others continue.  The
+ * iteration count is that of the slowest column and the relative residual
+ * norm is the largest one.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRPCGSolveMulti( void               *pcg_vdata,
+                           hypre_ParCSRMatrix *A,
+                           hypre_ParVector    *b,
+                           hypre_ParVector    *x )
+{
+   hypre_PCGData    *pcg_data    = (hypre_PCGData *) pcg_vdata;
+   MPI_Comm          comm        = hypre_ParCSRMatrixComm(A);
+   HYPRE_Real        r_tol       = (pcg_data -> tol);
+   HYPRE_Real        a_tol       = (pcg_data -> a_tol);
+   HYPRE_Int         max_iter    = (pcg_data -> max_iter);
+   HYPRE_Int         two_norm    = (pcg_data -> two_norm);
+   HYPRE_Int         print_level = (pcg_data -> print_level);
+   HYPRE_Int         num_vectors = hypre_ParVectorNumVectors(b);
+   HYPRE_Int         global_size = hypre_ParVectorGlobalSize(b);
+   HYPRE_Int        *partitioning = hypre_ParVectorPartitioning(b);
+
+   hypre_ParVector  *r, *p, *s;
+   hypre_ParVector  *r_col, *s_col;
+
+   HYPRE_Real       *bi_prod, *i_prod, *eps, *gamma, *gamma_old, *sdotp;
+   HYPRE_Complex    *alpha, *beta, *ones;
+   HYPRE_Int        *active;
+   HYPRE_Int         num_active, i, j, my_id;
+   HYPRE_Real        rel_norm, max_rel_norm;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   bi_prod   = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   i_prod    = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   eps       = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   gamma     = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   gamma_old = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   sdotp     = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   alpha     = hypre_CTAlloc(HYPRE_Complex, num_vectors, HYPRE_MEMORY_HOST);
+   beta      = hypre_CTAlloc(HYPRE_Complex, num_vectors, HYPRE_MEMORY_HOST);
+   ones      = hypre_CTAlloc(HYPRE_Complex, num_vectors, HYPRE_MEMORY_HOST);
+   active    = hypre_CTAlloc(HYPRE_Int, num_vectors, HYPRE_MEMORY_HOST);
+
+   r = hypre_ParMultiVectorCreate(comm, global_size, partitioning, num_vectors);
+   hypre_ParVectorInitialize(r);
+   hypre_ParVectorSetPartitioningOwner(r, 0);
+   p = hypre_ParMultiVectorCreate(comm, global_size, partitioning, num_vectors);
+   hypre_ParVectorInitialize(p);
+   hypre_ParVectorSetPartitioningOwner(p, 0);
+   s = hypre_ParMultiVectorCreate(comm, global_size, partitioning, num_vectors);
+   hypre_ParVectorInitialize(s);
+   hypre_ParVectorSetPartitioningOwner(s, 0);
+   r_col = hypre_ParVectorCreate(comm, global_size, partitioning);
+   hypre_ParVectorInitialize(r_col);
+   hypre_ParVectorSetPartitioningOwner(r_col, 0);
+   s_col = hypre_ParVectorCreate(comm, global_size, partitioning);
+   hypre_ParVectorInitialize(s_col);
+   hypre_ParVectorSetPartitioningOwner(s_col, 0);
+
+   /* compute eps */
+   if (two_norm)
+   {
+      hypre_ParMultiVectorInnerProd(b, b, bi_prod);
+   }
+   else
+   {
+      hypre_ParVectorSetConstantValues(p, 0.0);
+      hypre_ParCSRPCGApplyPrecondMulti(pcg_data, A, b, p, r_col, s_col);
+      hypre_ParMultiVectorInnerProd(p, b, bi_prod);
+   }
+
+   num_active = 0;
+   for (j = 0; j < num_vectors; j++)
+   {
+      ones[j] = 1.0;
+      if (bi_prod[j] > 0.0)
+      {
+         eps[j] = hypre_max(r_tol*r_tol, a_tol*a_tol/bi_prod[j]);
+         active[j] = 1;
+         num_active++;
+      }
+      else
+      {
+         /* b_j = 0, so the exact solution is x_j = 0 */
+         hypre_ParMultiVectorGetColumn(b, j, r_col);
+         hypre_ParMultiVectorSetColumn(x, j, r_col);
+         active[j] = 0;
+      }
+   }
+
+   /* r = b - Ax */
+   hypre_ParVectorCopy(b, r);
+   hypre_ParCSRMatrixMatvec(-1.0, A, x, 1.0, r);
+
+   /* p = C*r */
+   hypre_ParVectorSetConstantValues(p, 0.0);
+   hypre_ParCSRPCGApplyPrecondMulti(pcg_data, A, r, p, r_col, s_col);
+
+   /* gamma = <r,p> */
+   hypre_ParMultiVectorInnerProd(r, p, gamma);
+
+   for (j = 0; j < num_vectors; j++)
+   {
+      i_prod[j] = 0.0;
+   }
+
+   i = 0;
+   while (num_active > 0 && i < max_iter)
+   {
+      i++;
+
+      /* s = A*p */
+      hypre_ParCSRMatrixMatvec(1.0, A, p, 0.0, s);
+
+      /* alpha = gamma / <s,p> */
+      hypre_ParMultiVectorInnerProd(s, p, sdotp);
+      for (j = 0; j < num_vectors; j++)
+      {
+         alpha[j] = (active[j] && sdotp[j] != 0.0) ? gamma[j] / sdotp[j] : 0.0;
+      }
+
+      /* x = x + alpha*p, r = r - alpha*s */
+      hypre_ParMultiVectorAxpy(alpha, p, x);
+      for (j = 0; j < num_vectors; j++)
+      {
+         alpha[j] = -alpha[j];
+      }
+      hypre_ParMultiVectorAxpy(alpha, s, r);
+
+      /* s = C*r */
+      hypre_ParVectorSetConstantValues(s, 0.0);
+      hypre_ParCSRPCGApplyPrecondMulti(pcg_data, A, r, s, r_col, s_col);
+
+      /* gamma = <r,s> */
+      for (j = 0; j < num_vectors; j++)
+      {
+         gamma_old[j] = gamma[j];
+      }
+      hypre_ParMultiVectorInnerProd(r, s, gamma);
+
+      /* residual norms */
+      if (two_norm)
+      {
+         hypre_ParMultiVectorInnerProd(r, r, i_prod);
+      }
+      else
+      {
+         for (j = 0; j < num_vectors; j++)
+         {
+            i_prod[j] = gamma[j];
+         }
+      }
+
+      /* check for convergence and compute beta */
+      for (j = 0; j < num_vectors; j++)
+      {
+         beta[j] = 0.0;
+         if (!active[j])
+         {
+            continue;
+         }
+         if (i_prod[j] / bi_prod[j] < eps[j] || gamma_old[j] == 0.0)
+         {
+            active[j] = 0;
+            num_active--;
+         }
+         else
+         {
+            beta[j] = gamma[j] / gamma_old[j];
+         }
+      }
+
+      if (print_level > 1 && my_id == 0)
+      {
+         max_rel_norm = 0.0;
+         for (j = 0; j < num_vectors; j++)
+         {
+            if (bi_prod[j] > 0.0)
+            {
+               rel_norm = sqrt(i_prod[j] / bi_prod[j]);
+               max_rel_norm = hypre_max(max_rel_norm, rel_norm);
+            }
+         }
+         hypre_printf("% 5d    %e    %d\n", i, max_rel_norm, num_active);
+      }
+
+      /* p = s + beta p */
+      hypre_ParMultiVectorScale(beta, p);
+      hypre_ParMultiVectorAxpy(ones, s, p);
+   }
+
+   max_rel_norm = 0.0;
+   for (j = 0; j < num_vectors; j++)
+   {
+      if (bi_prod[j] > 0.0)
+      {
+         max_rel_norm = hypre_max(max_rel_norm, sqrt(i_prod[j] / bi_prod[j]));
+      }
+   }
+   (pcg_data -> num_iterations)    = i;
+   (pcg_data -> rel_residual_norm) = max_rel_norm;
+   (pcg_data -> converged)         = (num_active == 0);
+
+   if (num_active > 0)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   hypre_ParVectorDestroy(r);
+   hypre_ParVectorDestroy(p);
+   hypre_ParVectorDestroy(s);
+   hypre_ParVectorDestroy(r_col);
+   hypre_ParVectorDestroy(s_col);
+   hypre_TFree(bi_prod, HYPRE_MEMORY_HOST);
+   hypre_TFree(i_prod, HYPRE_MEMORY_HOST);
+   hypre_TFree(eps, HYPRE_MEMORY_HOST);
+   hypre_TFree(gamma, HYPRE_MEMORY_HOST);
+   hypre_TFree(gamma_old, HYPRE_MEMORY_HOST);
+   hypre_TFree(sdotp, HYPRE_MEMORY_HOST);
+   hypre_TFree(alpha, HYPRE_MEMORY_HOST);
+   hypre_TFree(beta, HYPRE_MEMORY_HOST);
+   hypre_TFree(ones, HYPRE_MEMORY_HOST);
+   hypre_TFree(active, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
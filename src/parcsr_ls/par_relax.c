@@ -104,6 +104,20 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    hypre_MPI_Comm_size(comm,&num_procs);  
    hypre_MPI_Comm_rank(comm,&my_id);  
    num_threads = hypre_NumThreads();
+
+   /* flops and memory traffic of the sweep; the symmetric sweeps pass
+      over A twice, the other types count their own kernels */
+   if ((relax_type >= 0 && relax_type <= 6) || relax_type == 8 ||
+       relax_type == 13 || relax_type == 14)
+   {
+      HYPRE_Real nnz = (HYPRE_Real) A_diag_i[n] + (HYPRE_Real) A_offd_i[n];
+      HYPRE_Real passes = (relax_type == 6 || relax_type == 8) ? 2.0 : 1.0;
+
+      HYPRE_PROFILE_COUNT(passes * 2.0 * nnz,
+                          passes * (nnz * (sizeof(HYPRE_Real) + sizeof(HYPRE_Int)) +
+                                    n * (2 * sizeof(HYPRE_Int) + 3 * sizeof(HYPRE_Real))), 0.0);
+   }
+
    /*-----------------------------------------------------------------------
     * Switch statement to direct control based on relax_type:
     *     relax_type = 0 -> Jacobi or CF-Jacobi
@@ -4335,6 +4349,169 @@ HYPRE_Int hypre_GaussElimSolve (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
    return hypre_error_flag;
 }
 
+/*-------------------------------------------------------------------------
+ *
+ *              Gaussian Elimination for block matrices
+ *
+ * The coarsest block matrix is gathered into a dense matrix directly from
+ * its blocks and LU-factored once in the setup, so the solve only gathers
+ * the right-hand side and does the triangular solves.  A_mat holds the
+ * factors of the transposed (row-major) matrix, hence the "T" solve.
+ *
+ *------------------------------------------------------------------------ */
+
+HYPRE_Int hypre_BlockGaussElimSetup (hypre_ParAMGData *amg_data, HYPRE_Int level)
+{
+   /* Par Data Structure variables */
+   hypre_ParCSRBlockMatrix *A = hypre_ParAMGDataABlockArray(amg_data)[level];
+   hypre_CSRBlockMatrix *A_diag = hypre_ParCSRBlockMatrixDiag(A);
+   HYPRE_Int block_size = hypre_CSRBlockMatrixBlockSize(A_diag);
+   HYPRE_Int num_rows = hypre_CSRBlockMatrixNumRows(A_diag);
+   HYPRE_Int global_num_rows = hypre_ParCSRBlockMatrixGlobalNumRows(A)*block_size;
+   MPI_Comm           comm = hypre_ParCSRBlockMatrixComm(A);
+   MPI_Comm           new_comm;
+   HYPRE_Int          my_info = 0, info_max;
+
+   /* Generate sub communicator */
+   hypre_GenerateSubComm(comm, num_rows, &new_comm);
+
+   if (num_rows)
+   {
+      hypre_CSRBlockMatrix *A_offd = hypre_ParCSRBlockMatrixOffd(A);
+      HYPRE_Int *col_map_offd = hypre_ParCSRBlockMatrixColMapOffd(A);
+      HYPRE_Int *A_diag_i = hypre_CSRBlockMatrixI(A_diag);
+      HYPRE_Int *A_offd_i = hypre_CSRBlockMatrixI(A_offd);
+      HYPRE_Int *A_diag_j = hypre_CSRBlockMatrixJ(A_diag);
+      HYPRE_Int *A_offd_j = hypre_CSRBlockMatrixJ(A_offd);
+      HYPRE_Real *A_diag_data = hypre_CSRBlockMatrixData(A_diag);
+      HYPRE_Real *A_offd_data = hypre_CSRBlockMatrixData(A_offd);
+      HYPRE_Real *A_mat, *A_mat_local;
+      HYPRE_Int *comm_info, *info, *displs;
+      HYPRE_Int *mat_info, *mat_displs;
+      HYPRE_Int new_num_procs, A_mat_local_size, i, jj, column;
+      HYPRE_Int b1, b2, bnnz = block_size*block_size;
+      HYPRE_Int num_local = num_rows*block_size;
+      HYPRE_Int first_row_index = hypre_ParCSRBlockMatrixFirstRowIndex(A);
+
+      hypre_MPI_Comm_size(new_comm, &new_num_procs);
+      comm_info = hypre_CTAlloc(HYPRE_Int,  2*new_num_procs+1, HYPRE_MEMORY_HOST);
+      mat_info = hypre_CTAlloc(HYPRE_Int,  new_num_procs, HYPRE_MEMORY_HOST);
+      mat_displs = hypre_CTAlloc(HYPRE_Int,  new_num_procs+1, HYPRE_MEMORY_HOST);
+      info = &comm_info[0];
+      displs = &comm_info[new_num_procs];
+      hypre_MPI_Allgather(&num_local, 1, HYPRE_MPI_INT, info, 1, HYPRE_MPI_INT, new_comm);
+      displs[0] = 0;
+      mat_displs[0] = 0;
+      for (i=0; i < new_num_procs; i++)
+      {
+         displs[i+1] = displs[i]+info[i];
+         mat_displs[i+1] = global_num_rows*displs[i+1];
+         mat_info[i] = global_num_rows*info[i];
+      }
+      hypre_ParAMGDataBVec(amg_data) = hypre_CTAlloc(HYPRE_Real,  global_num_rows, HYPRE_MEMORY_HOST);
+      A_mat_local_size =  global_num_rows*num_local;
+      A_mat_local = hypre_CTAlloc(HYPRE_Real,  A_mat_local_size, HYPRE_MEMORY_HOST);
+      A_mat = hypre_CTAlloc(HYPRE_Real,  global_num_rows*global_num_rows, HYPRE_MEMORY_HOST);
+      /* load local block rows into A_mat_local (row major) */
+      for (i = 0; i < num_rows; i++)
+      {
+         for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+         {
+            column = (A_diag_j[jj]+first_row_index)*block_size;
+            for (b1 = 0; b1 < block_size; b1++)
+               for (b2 = 0; b2 < block_size; b2++)
+                  A_mat_local[(i*block_size+b1)*global_num_rows + column+b2] =
+                     A_diag_data[jj*bnnz+b1*block_size+b2];
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            column = col_map_offd[A_offd_j[jj]]*block_size;
+            for (b1 = 0; b1 < block_size; b1++)
+               for (b2 = 0; b2 < block_size; b2++)
+                  A_mat_local[(i*block_size+b1)*global_num_rows + column+b2] =
+                     A_offd_data[jj*bnnz+b1*block_size+b2];
+         }
+      }
+      hypre_MPI_Allgatherv( A_mat_local, A_mat_local_size, HYPRE_MPI_REAL, A_mat, 
+		mat_info, mat_displs, HYPRE_MPI_REAL, new_comm);
+
+      /* write over A_mat with LU */
+      hypre_ParAMGDataAPiv(amg_data) = hypre_CTAlloc(HYPRE_Int,  global_num_rows, HYPRE_MEMORY_HOST);
+      hypre_dgetrf(&global_num_rows, &global_num_rows, A_mat, &global_num_rows,
+                   hypre_ParAMGDataAPiv(amg_data), &my_info);
+
+      hypre_ParAMGDataAMat(amg_data) = A_mat;
+      hypre_ParAMGDataCommInfo(amg_data) = comm_info;
+      hypre_ParAMGDataNewComm(amg_data) = new_comm;
+      hypre_TFree(mat_info, HYPRE_MEMORY_HOST);
+      hypre_TFree(mat_displs, HYPRE_MEMORY_HOST);
+      hypre_TFree(A_mat_local, HYPRE_MEMORY_HOST);
+   }
+
+   /* all processors have to agree on whether the coarse matrix is singular;
+      if it is, the coarsest level is smoothed with the down cycle smoother
+      until the next setup */
+   hypre_MPI_Allreduce(&my_info, &info_max, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   hypre_ParAMGDataASingular(amg_data) = (info_max != 0);
+   if (info_max)
+   {
+      hypre_TFree(hypre_ParAMGDataAMat(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataAMat(amg_data) = NULL;
+      hypre_TFree(hypre_ParAMGDataAPiv(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataAPiv(amg_data) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int hypre_BlockGaussElimSolve (hypre_ParAMGData *amg_data, HYPRE_Int level)
+{
+   hypre_ParCSRBlockMatrix *A = hypre_ParAMGDataABlockArray(amg_data)[level];
+   HYPRE_Int  block_size = hypre_ParCSRBlockMatrixBlockSize(A);
+   HYPRE_Int  n = hypre_CSRBlockMatrixNumRows(hypre_ParCSRBlockMatrixDiag(A))*block_size;
+
+   if (n && hypre_ParAMGDataAMat(amg_data) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Block GE coarse solve was not set up\n");
+      return hypre_error_flag;
+   }
+
+   if (n)
+   {
+      MPI_Comm new_comm = hypre_ParAMGDataNewComm(amg_data);
+      hypre_ParVector *f = hypre_ParAMGDataFArray(amg_data)[level]; 
+      hypre_ParVector *u = hypre_ParAMGDataUArray(amg_data)[level]; 
+      HYPRE_Real *A_mat = hypre_ParAMGDataAMat(amg_data);
+      HYPRE_Real *b_vec = hypre_ParAMGDataBVec(amg_data);
+      HYPRE_Int  *A_piv = hypre_ParAMGDataAPiv(amg_data);
+      HYPRE_Real *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f)); 
+      HYPRE_Real *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u)); 
+      HYPRE_Int *comm_info = hypre_ParAMGDataCommInfo(amg_data);
+      HYPRE_Int *displs, *info;
+      HYPRE_Int  n_global = hypre_ParCSRBlockMatrixGlobalNumRows(A)*block_size;
+      HYPRE_Int new_num_procs, i, my_info;
+      HYPRE_Int first_index = hypre_ParCSRBlockMatrixFirstRowIndex(A)*block_size;
+      HYPRE_Int one_i = 1;
+
+      hypre_MPI_Comm_size(new_comm, &new_num_procs);
+      info = &comm_info[0];
+      displs = &comm_info[new_num_procs];
+      hypre_MPI_Allgatherv ( f_data, n, HYPRE_MPI_REAL,
+                          b_vec, info, displs,
+                          HYPRE_MPI_REAL, new_comm );
+
+      /* now b_vec = inv(A)*b_vec */
+      hypre_dgetrs("T", &n_global, &one_i, A_mat, &n_global, A_piv, b_vec, &n_global, &my_info);
+
+      for (i = 0; i < n; i++)
+      {
+         u_data[i] = b_vec[first_index+i];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 #if 0
 HYPRE_Int gselim(HYPRE_Real *A,
                  HYPRE_Real *x,
@@ -1046,6 +1046,14 @@ HYPRE_Int  hypre_ParCSRRelax_L1_Jacobi( hypre_ParCSRMatrix *A,
     hypre_MPI_Comm_size(comm,&num_procs);  
     hypre_MPI_Comm_rank(comm,&my_id);  
 
+    {
+       HYPRE_Real nnz = (HYPRE_Real) A_diag_i[n] + (HYPRE_Real) A_offd_i[n];
+
+       HYPRE_PROFILE_COUNT(2.0 * nnz,
+                           nnz * (sizeof(HYPRE_Real) + sizeof(HYPRE_Int)) +
+                           n * (2 * sizeof(HYPRE_Int) + 4 * sizeof(HYPRE_Real)), 0.0);
+    }
+
     if (num_procs > 1)
     {
        num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
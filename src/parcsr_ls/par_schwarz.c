@@ -65,6 +65,7 @@ hypre_SchwarzCreate()
    hypre_SchwarzDataScale(schwarz_data) = NULL;
    hypre_SchwarzDataVtemp(schwarz_data) = NULL;
    hypre_SchwarzDataDofFunc(schwarz_data) = NULL;
+   hypre_SchwarzDataDomainColors(schwarz_data) = NULL;
 
    return (void *) schwarz_data;
 }
@@ -83,6 +84,8 @@ hypre_SchwarzDestroy( void *data )
    if (hypre_SchwarzDataDofFunc(schwarz_data))
       hypre_TFree(hypre_SchwarzDataDofFunc(schwarz_data), HYPRE_MEMORY_HOST);
    hypre_CSRMatrixDestroy(hypre_SchwarzDataDomainStructure(schwarz_data));
+   if (hypre_SchwarzDataDomainColors(schwarz_data))
+      hypre_CSRMatrixDestroy(hypre_SchwarzDataDomainColors(schwarz_data));
    if (hypre_SchwarzDataVariant(schwarz_data) == 3)
       hypre_CSRMatrixDestroy(hypre_SchwarzDataABoundary(schwarz_data));
    hypre_ParVectorDestroy(hypre_SchwarzDataVtemp(schwarz_data));
@@ -107,6 +110,7 @@ hypre_SchwarzSetup(void               *schwarz_vdata,
    HYPRE_Int *dof_func;
    HYPRE_Real *scale;
    hypre_CSRMatrix *domain_structure;
+   hypre_CSRMatrix *domain_colors = NULL;
    hypre_CSRMatrix *A_boundary;
    hypre_ParVector *Vtemp;
 
@@ -173,7 +177,23 @@ hypre_SchwarzSetup(void               *schwarz_vdata,
       }
    }
 
+   /* with several threads, color the subdomains so that decoupled
+      subdomains can be updated concurrently; variant 3 stays sequential */
+   if (domain_structure && hypre_NumThreads() > 1 && variant != 3)
+   {
+      hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+      HYPRE_Int num_dofs = hypre_CSRMatrixNumRows(A_diag);
+
+      if (variant == 2)
+      {
+         num_dofs += hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+      }
+      hypre_SchwarzColorDomains((variant == 1 || variant == 2) ? NULL : A_diag,
+                                domain_structure, num_dofs, &domain_colors);
+   }
+
    hypre_SchwarzDataDomainStructure(schwarz_data) = domain_structure;
+   hypre_SchwarzDataDomainColors(schwarz_data) = domain_colors;
    hypre_SchwarzDataPivots(schwarz_data) = pivots;
 
    return hypre_error_flag;
@@ -194,6 +214,7 @@ hypre_SchwarzSolve(void               *schwarz_vdata,
 
    hypre_CSRMatrix *domain_structure = 
 		hypre_SchwarzDataDomainStructure(schwarz_data);
+   hypre_CSRMatrix *domain_colors = hypre_SchwarzDataDomainColors(schwarz_data);
    hypre_CSRMatrix *A_boundary = hypre_SchwarzDataABoundary(schwarz_data);
    HYPRE_Real *scale = hypre_SchwarzDataScale(schwarz_data);
    hypre_ParVector *Vtemp = hypre_SchwarzDataVtemp(schwarz_data);
@@ -207,7 +228,7 @@ hypre_SchwarzSolve(void               *schwarz_vdata,
    {
     if (variant == 2)
     {
-      hypre_ParAdSchwarzSolve(A, f, domain_structure, scale, u, Vtemp, pivots, use_nonsymm);
+      hypre_ParAdSchwarzSolve(A, f, domain_structure, domain_colors, scale, u, Vtemp, pivots, use_nonsymm);
     }
     else if (variant == 3)
     {
@@ -216,18 +237,19 @@ hypre_SchwarzSolve(void               *schwarz_vdata,
     }
     else if (variant == 1)
     {
-      hypre_AdSchwarzSolve(A, f, domain_structure, scale, u, Vtemp, pivots, use_nonsymm);
+      hypre_AdSchwarzSolve(A, f, domain_structure, domain_colors, scale, u,
+                           Vtemp, pivots, use_nonsymm);
     }
     else if (variant == 4)
     {
       hypre_MPSchwarzFWSolve(A, hypre_ParVectorLocalVector(f), 
-				domain_structure, u, relax_wt, 
+				domain_structure, domain_colors, u, relax_wt, 
                              hypre_ParVectorLocalVector(Vtemp), pivots, use_nonsymm);
     }
     else 
     {
       hypre_MPSchwarzSolve(A, hypre_ParVectorLocalVector(f), 
-                                  domain_structure, u, relax_wt, 
+                                  domain_structure, domain_colors, u, relax_wt, 
                                   hypre_ParVectorLocalVector(Vtemp), pivots, use_nonsymm);
     }
    }
@@ -361,6 +383,13 @@ hypre_SchwarzSetDomainStructure( void *data, hypre_CSRMatrix *domain_structure )
  
    hypre_SchwarzDataDomainStructure(schwarz_data) = domain_structure;
 
+   /* a coloring of the previous subdomains does not apply */
+   if (hypre_SchwarzDataDomainColors(schwarz_data))
+   {
+      hypre_CSRMatrixDestroy(hypre_SchwarzDataDomainColors(schwarz_data));
+      hypre_SchwarzDataDomainColors(schwarz_data) = NULL;
+   }
+
    return hypre_error_flag;
 }
 
@@ -402,3 +431,64 @@ hypre_SchwarzSetDofFunc( void *data, HYPRE_Int *dof_func)
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SchwarzGetDomainStats
+ *
+ * Local subdomain statistics: the number of subdomains, the number of dofs
+ * summed over all subdomains, the size of the largest subdomain, the number
+ * of colors used for threaded sweeps (0 if the sweeps are sequential) and
+ * the number of bytes held by the subdomain factors and pivots.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SchwarzGetDomainStats( void       *data,
+                             HYPRE_Int  *num_domains,
+                             HYPRE_Int  *num_domain_dofs,
+                             HYPRE_Int  *max_domain_size,
+                             HYPRE_Int  *num_colors,
+                             HYPRE_Real *factor_bytes )
+{
+   hypre_SchwarzData  *schwarz_data = (hypre_SchwarzData*) data;
+   hypre_CSRMatrix    *domain_structure;
+   hypre_CSRMatrix    *domain_colors;
+   HYPRE_Int          *i_domain_dof;
+   HYPRE_Int           i, size;
+
+   if (!schwarz_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   domain_structure = hypre_SchwarzDataDomainStructure(schwarz_data);
+   domain_colors = hypre_SchwarzDataDomainColors(schwarz_data);
+
+   *num_domains = 0;
+   *num_domain_dofs = 0;
+   *max_domain_size = 0;
+   *num_colors = 0;
+   *factor_bytes = 0.0;
+
+   if (domain_structure)
+   {
+      i_domain_dof = hypre_CSRMatrixI(domain_structure);
+      *num_domains = hypre_CSRMatrixNumRows(domain_structure);
+      *num_domain_dofs = i_domain_dof[*num_domains];
+      for (i = 0; i < *num_domains; i++)
+      {
+         size = i_domain_dof[i+1] - i_domain_dof[i];
+         *max_domain_size = hypre_max(*max_domain_size, size);
+         *factor_bytes += (HYPRE_Real) size * size * sizeof(HYPRE_Real);
+      }
+      if (hypre_SchwarzDataPivots(schwarz_data))
+      {
+         *factor_bytes += (HYPRE_Real) (*num_domain_dofs) * sizeof(HYPRE_Int);
+      }
+   }
+   if (domain_colors)
+   {
+      *num_colors = hypre_CSRMatrixNumRows(domain_colors);
+   }
+
+   return hypre_error_flag;
+}
@@ -131,6 +131,13 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
    HYPRE_Real   grid_cmplxty = 0;
    HYPRE_Real   memory_cmplxty = 0;
 
+   /* Schwarz smoother subdomains */
+   HYPRE_Solver *smoother;
+   HYPRE_Int     num_domains, num_domain_dofs, max_domain_size, num_colors;
+   HYPRE_Real    factor_bytes;
+   HYPRE_Real    domain_sum[3], global_domain_sum[3];
+   HYPRE_Real    domain_max[2], global_domain_max[2];
+
    /* amg solve params */
    HYPRE_Int      max_iter;
    HYPRE_Int      cycle_type;    
@@ -926,6 +933,59 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
       hypre_printf("                memory = %f\n",memory_cmplxty);
    }
 
+   /* memory held by the subdomain factors of the Schwarz smoothers */
+   smoother = hypre_ParAMGDataSmoother(amg_data);
+   if ((smooth_type == 6 || smooth_type == 16) && smoother)
+   {
+      if (my_id == 0)
+      {
+         hypre_printf("\n\nSchwarz Smoother Information:\n\n");
+         hypre_printf("              avg     max            factor     bytes per\n");
+         hypre_printf("lev domains   size    size  colors      (KB)        domain\n");
+         hypre_printf("========================================================\n");
+      }
+      for (level = 0; level < hypre_min(smooth_num_levels, num_levels); level++)
+      {
+         if (!smoother[level])
+         {
+            continue;
+         }
+         hypre_SchwarzGetDomainStats((void *) smoother[level], &num_domains,
+                                     &num_domain_dofs, &max_domain_size,
+                                     &num_colors, &factor_bytes);
+         domain_sum[0] = (HYPRE_Real) num_domains;
+         domain_sum[1] = (HYPRE_Real) num_domain_dofs;
+         domain_sum[2] = factor_bytes;
+         domain_max[0] = (HYPRE_Real) max_domain_size;
+         domain_max[1] = (HYPRE_Real) num_colors;
+         hypre_MPI_Reduce(domain_sum, global_domain_sum, 3, HYPRE_MPI_REAL,
+                          hypre_MPI_SUM, 0, comm);
+         hypre_MPI_Reduce(domain_max, global_domain_max, 2, HYPRE_MPI_REAL,
+                          hypre_MPI_MAX, 0, comm);
+         if (my_id == 0)
+         {
+            if (global_domain_sum[0] > 0)
+            {
+               hypre_printf("%2d %8.0f %7.1f %7.0f %7.0f %9.1f %13.1f\n",
+                            level, global_domain_sum[0],
+                            global_domain_sum[1]/global_domain_sum[0],
+                            global_domain_max[0], global_domain_max[1],
+                            global_domain_sum[2]/1024.0,
+                            global_domain_sum[2]/global_domain_sum[0]);
+            }
+            else
+            {
+               hypre_printf("%2d %8d\n", level, 0);
+            }
+         }
+      }
+   }
+
+   if (hypre_ParAMGDataCommStats(amg_data))
+   {
+      hypre_BoomerAMGCommStats(amg_data);
+   }
+
    if (my_id == 0) hypre_printf("\n\n");
 
    if (my_id == 0)
@@ -1169,6 +1229,172 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
 
 
 
+/*---------------------------------------------------------------
+ * hypre_BoomerAMGCommStats
+ *
+ * Prints, per level, the communication of the operator A, the
+ * interpolation P and, if it is not P^T, the restriction R: number of
+ * neighbor processes, exchanges, messages, bytes sent and time spent
+ * waiting, as minimum, average and maximum over the processes.  The
+ * counters are those accumulated since the last call, which resets them.
+ *---------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGCommStats( void *amg_vdata )
+{
+   hypre_ParAMGData         *amg_data      = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int                 num_levels    = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int                 block_mode    = hypre_ParAMGDataBlockMode(amg_data);
+   HYPRE_Int                 restri_type   = hypre_ParAMGDataRestriction(amg_data);
+   hypre_ParCSRMatrix      **A_array       = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix      **P_array       = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix      **R_array       = hypre_ParAMGDataRArray(amg_data);
+   hypre_ParCSRBlockMatrix **A_block_array = hypre_ParAMGDataABlockArray(amg_data);
+   hypre_ParCSRBlockMatrix **P_block_array = hypre_ParAMGDataPBlockArray(amg_data);
+
+   const char      op_names[3] = {'A', 'P', 'R'};
+   MPI_Comm        comm;
+   hypre_ParCSRCommPkg **comm_pkgs;
+   HYPRE_Int      *present;
+   HYPRE_Real     *local, *gmin, *gmax, *gsum;
+   HYPRE_Int      *procs;
+   HYPRE_Int       num_rows, num_sends, num_recvs, num_nbrs;
+   HYPRE_Int       level, op, row, i, k;
+   HYPRE_Int       num_procs, my_id;
+
+   if (num_levels < 1)
+   {
+      return hypre_error_flag;
+   }
+   comm = block_mode ? hypre_ParCSRBlockMatrixComm(A_block_array[0]) :
+                       hypre_ParCSRMatrixComm(A_array[0]);
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   /* rows are (level, operator); the same on all processes */
+   num_rows  = 3*num_levels;
+   comm_pkgs = hypre_CTAlloc(hypre_ParCSRCommPkg *, num_rows, HYPRE_MEMORY_HOST);
+   present   = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   local     = hypre_CTAlloc(HYPRE_Real, 5*num_rows, HYPRE_MEMORY_HOST);
+   gmin      = hypre_CTAlloc(HYPRE_Real, 5*num_rows, HYPRE_MEMORY_HOST);
+   gmax      = hypre_CTAlloc(HYPRE_Real, 5*num_rows, HYPRE_MEMORY_HOST);
+   gsum      = hypre_CTAlloc(HYPRE_Real, 5*num_rows, HYPRE_MEMORY_HOST);
+
+   for (level = 0; level < num_levels; level++)
+   {
+      present[3*level] = 1;
+      if (block_mode)
+      {
+         comm_pkgs[3*level] = hypre_ParCSRBlockMatrixCommPkg(A_block_array[level]);
+         if (level < num_levels-1)
+         {
+            present[3*level+1] = 1;
+            comm_pkgs[3*level+1] = hypre_ParCSRBlockMatrixCommPkg(P_block_array[level]);
+         }
+      }
+      else
+      {
+         comm_pkgs[3*level] = hypre_ParCSRMatrixCommPkg(A_array[level]);
+         if (level < num_levels-1)
+         {
+            present[3*level+1] = 1;
+            comm_pkgs[3*level+1] = hypre_ParCSRMatrixCommPkg(P_array[level]);
+            if (restri_type && R_array[level] && R_array[level] != P_array[level])
+            {
+               present[3*level+2] = 1;
+               comm_pkgs[3*level+2] = hypre_ParCSRMatrixCommPkg(R_array[level]);
+            }
+         }
+      }
+   }
+
+   for (row = 0; row < num_rows; row++)
+   {
+      hypre_ParCSRCommPkg *comm_pkg = comm_pkgs[row];
+
+      if (!comm_pkg)
+      {
+         continue;
+      }
+
+      /* distinct processes this one sends to or receives from */
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+      procs = hypre_TAlloc(HYPRE_Int, num_sends+num_recvs, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_sends; i++)
+      {
+         procs[i] = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+      }
+      for (i = 0; i < num_recvs; i++)
+      {
+         procs[num_sends+i] = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+      }
+      hypre_qsort0(procs, 0, num_sends+num_recvs-1);
+      num_nbrs = 0;
+      for (i = 0; i < num_sends+num_recvs; i++)
+      {
+         if (i == 0 || procs[i] != procs[i-1])
+         {
+            num_nbrs++;
+         }
+      }
+      hypre_TFree(procs, HYPRE_MEMORY_HOST);
+
+      local[5*row]   = (HYPRE_Real) num_nbrs;
+      local[5*row+1] = (HYPRE_Real) hypre_ParCSRCommPkgNumExchanges(comm_pkg);
+      local[5*row+2] = (HYPRE_Real) hypre_ParCSRCommPkgNumMessages(comm_pkg);
+      local[5*row+3] = hypre_ParCSRCommPkgNumBytes(comm_pkg) / 1.0e6;
+      local[5*row+4] = hypre_ParCSRCommPkgWaitTime(comm_pkg);
+
+      hypre_ParCSRCommPkgNumExchanges(comm_pkg) = 0;
+      hypre_ParCSRCommPkgNumMessages(comm_pkg)  = 0;
+      hypre_ParCSRCommPkgNumBytes(comm_pkg)     = 0.0;
+      hypre_ParCSRCommPkgWaitTime(comm_pkg)     = 0.0;
+   }
+
+   hypre_MPI_Reduce(local, gmin, 5*num_rows, HYPRE_MPI_REAL, hypre_MPI_MIN, 0, comm);
+   hypre_MPI_Reduce(local, gmax, 5*num_rows, HYPRE_MPI_REAL, hypre_MPI_MAX, 0, comm);
+   hypre_MPI_Reduce(local, gsum, 5*num_rows, HYPRE_MPI_REAL, hypre_MPI_SUM, 0, comm);
+
+   if (my_id == 0)
+   {
+      hypre_printf("\n\nCommunication Information (min/avg/max over processes):\n\n");
+      hypre_printf("             neighbors        exch   messages");
+      hypre_printf("         MB sent                wait time (s)\n");
+      hypre_printf("lev  op   min    avg   max    max        avg");
+      hypre_printf("      min    avg    max        min      avg      max\n");
+      hypre_printf("================================================");
+      hypre_printf("================================================\n");
+      for (level = 0; level < num_levels; level++)
+      {
+         for (op = 0; op < 3; op++)
+         {
+            row = 3*level + op;
+            k   = 5*row;
+            if (!present[row])
+            {
+               continue;
+            }
+            hypre_printf("%3d %3c %5.0f %6.1f %5.0f %6.0f %10.1f   %6.3f %6.3f %6.3f   %8.2e %8.2e %8.2e\n",
+                         level, op_names[op],
+                         gmin[k], gsum[k]/num_procs, gmax[k], gmax[k+1],
+                         gsum[k+2]/num_procs,
+                         gmin[k+3], gsum[k+3]/num_procs, gmax[k+3],
+                         gmin[k+4], gsum[k+4]/num_procs, gmax[k+4]);
+         }
+      }
+   }
+
+   hypre_TFree(comm_pkgs, HYPRE_MEMORY_HOST);
+   hypre_TFree(present, HYPRE_MEMORY_HOST);
+   hypre_TFree(local, HYPRE_MEMORY_HOST);
+   hypre_TFree(gmin, HYPRE_MEMORY_HOST);
+   hypre_TFree(gmax, HYPRE_MEMORY_HOST);
+   hypre_TFree(gsum, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*---------------------------------------------------------------
  * hypre_BoomerAMGWriteSolverParams
  *---------------------------------------------------------------*/
@@ -25,6 +25,529 @@
    B can be used to define strength matrix;
    ----------------------------------------------------------------------- */
 
+/* -------------------------------------------------------------------------
+   the factors of all subdomain matrices are stored column-wise, one after
+   the other, in the data array of domain_structure; the pivots of domain i
+   (use_nonsymm) start at pivots[i_domain_dof[i]].
+
+   The f2c translated LAPACK/BLAS routines keep their local variables in
+   static storage and can not be called from several threads at once.  The
+   routines below are reentrant versions of the unblocked dpotf2/dgetf2
+   factorizations and of dpotrs/dgetrs for one right-hand side; they perform
+   the operations in the same order as the LAPACK routines.
+   ----------------------------------------------------------------------- */
+
+static HYPRE_Int
+hypre_SchwarzDenseFactor( HYPRE_Int   n,
+                          HYPRE_Real *a,
+                          HYPRE_Int  *ipiv,
+                          HYPRE_Int   use_nonsymm )
+{
+   HYPRE_Int  i, j, k, jp;
+   HYPRE_Int  info = 0;
+   HYPRE_Real ajj, temp;
+
+   if (use_nonsymm)
+   {
+      /* LU factorization with partial pivoting (dgetf2) */
+      for (j = 0; j < n; j++)
+      {
+         jp = j;
+         temp = fabs(a[j+j*n]);
+         for (i = j+1; i < n; i++)
+         {
+            if (fabs(a[i+j*n]) > temp)
+            {
+               temp = fabs(a[i+j*n]);
+               jp = i;
+            }
+         }
+         ipiv[j] = jp+1;
+
+         if (a[jp+j*n] != 0.0)
+         {
+            if (jp != j)
+            {
+               for (k = 0; k < n; k++)
+               {
+                  temp = a[j+k*n];
+                  a[j+k*n] = a[jp+k*n];
+                  a[jp+k*n] = temp;
+               }
+            }
+            temp = 1.0 / a[j+j*n];
+            for (i = j+1; i < n; i++)
+            {
+               a[i+j*n] *= temp;
+            }
+         }
+         else if (info == 0)
+         {
+            info = j+1;
+         }
+
+         for (k = j+1; k < n; k++)
+         {
+            if (a[j+k*n] != 0.0)
+            {
+               temp = -a[j+k*n];
+               for (i = j+1; i < n; i++)
+               {
+                  a[i+k*n] += a[i+j*n] * temp;
+               }
+            }
+         }
+      }
+   }
+   else
+   {
+      /* Cholesky factorization A = L*L' (dpotf2) */
+      for (j = 0; j < n; j++)
+      {
+         temp = 0.0;
+         for (k = 0; k < j; k++)
+         {
+            temp += a[j+k*n] * a[j+k*n];
+         }
+         ajj = a[j+j*n] - temp;
+         if (ajj <= 0.0)
+         {
+            a[j+j*n] = ajj;
+            return j+1;
+         }
+         ajj = sqrt(ajj);
+         a[j+j*n] = ajj;
+
+         for (k = 0; k < j; k++)
+         {
+            if (a[j+k*n] != 0.0)
+            {
+               temp = -a[j+k*n];
+               for (i = j+1; i < n; i++)
+               {
+                  a[i+j*n] += temp * a[i+k*n];
+               }
+            }
+         }
+         temp = 1.0 / ajj;
+         for (i = j+1; i < n; i++)
+         {
+            a[i+j*n] *= temp;
+         }
+      }
+   }
+
+   return info;
+}
+
+static void
+hypre_SchwarzDenseSolve( HYPRE_Int   n,
+                         HYPRE_Real *a,
+                         HYPRE_Int  *ipiv,
+                         HYPRE_Int   use_nonsymm,
+                         HYPRE_Real *b )
+{
+   HYPRE_Int  i, k;
+   HYPRE_Real temp;
+
+   if (use_nonsymm)
+   {
+      /* dgetrs: apply the row interchanges, then solve L*U*x = b */
+      for (i = 0; i < n; i++)
+      {
+         k = ipiv[i]-1;
+         if (k != i)
+         {
+            temp = b[i];
+            b[i] = b[k];
+            b[k] = temp;
+         }
+      }
+      for (k = 0; k < n; k++)
+      {
+         if (b[k] != 0.0)
+         {
+            for (i = k+1; i < n; i++)
+            {
+               b[i] -= b[k] * a[i+k*n];
+            }
+         }
+      }
+      for (k = n-1; k >= 0; k--)
+      {
+         if (b[k] != 0.0)
+         {
+            b[k] /= a[k+k*n];
+            for (i = 0; i < k; i++)
+            {
+               b[i] -= b[k] * a[i+k*n];
+            }
+         }
+      }
+   }
+   else
+   {
+      /* dpotrs: solve L*L'*x = b */
+      for (k = 0; k < n; k++)
+      {
+         if (b[k] != 0.0)
+         {
+            b[k] /= a[k+k*n];
+            for (i = k+1; i < n; i++)
+            {
+               b[i] -= b[k] * a[i+k*n];
+            }
+         }
+      }
+      for (i = n-1; i >= 0; i--)
+      {
+         temp = b[i];
+         for (k = i+1; k < n; k++)
+         {
+            temp -= a[k+i*n] * b[k];
+         }
+         b[i] = temp / a[i+i*n];
+      }
+   }
+}
+
+/* -------------------------------------------------------------------------
+   hypre_SchwarzFactorOffsets: start of the factor of each subdomain in the
+   factor array (num_domains+1 entries).
+   ----------------------------------------------------------------------- */
+
+static HYPRE_Int *
+hypre_SchwarzFactorOffsets( HYPRE_Int  num_domains,
+                            HYPRE_Int *i_domain_dof )
+{
+   HYPRE_Int *offsets;
+   HYPRE_Int  i, size;
+
+   offsets = hypre_TAlloc(HYPRE_Int, num_domains+1, HYPRE_MEMORY_HOST);
+   offsets[0] = 0;
+   for (i = 0; i < num_domains; i++)
+   {
+      size = i_domain_dof[i+1] - i_domain_dof[i];
+      offsets[i+1] = offsets[i] + size*size;
+   }
+
+   return offsets;
+}
+
+/* -------------------------------------------------------------------------
+   hypre_SchwarzColorDomains: greedy coloring of the subdomains such that
+   subdomains of the same color share no dof and, if A is given, are not
+   coupled through an entry of A or of its transpose (A need not be
+   symmetric, e.g., with use_nonsymm).  Subdomains of one color can then be
+   updated concurrently in a multiplicative (A given) or additive (A NULL)
+   sweep.  The coloring is returned as a num_colors x num_domains CSR
+   pattern (no data) listing the subdomains of each color in increasing
+   order.  num_dofs is the number of dofs the subdomains are built from.
+   ----------------------------------------------------------------------- */
+
+HYPRE_Int
+hypre_SchwarzColorDomains( hypre_CSRMatrix  *A,
+                           hypre_CSRMatrix  *domain_structure,
+                           HYPRE_Int         num_dofs,
+                           hypre_CSRMatrix **domain_colors_pointer )
+{
+   HYPRE_Int  num_domains = hypre_CSRMatrixNumRows(domain_structure);
+   HYPRE_Int *i_domain_dof = hypre_CSRMatrixI(domain_structure);
+   HYPRE_Int *j_domain_dof = hypre_CSRMatrixJ(domain_structure);
+   HYPRE_Int  num_rows = 0;
+   HYPRE_Int *A_i = NULL;
+   HYPRE_Int *A_j = NULL;
+   HYPRE_Int  num_rows_AT = 0;
+   HYPRE_Int *AT_i = NULL;
+   HYPRE_Int *AT_j = NULL;
+
+   hypre_CSRMatrix *AT = NULL;
+   hypre_CSRMatrix *domain_colors;
+   HYPRE_Int *i_dof_domain, *j_dof_domain;
+   HYPRE_Int *i_color_domain, *j_color_domain;
+   HYPRE_Int *color, *mark;
+   HYPRE_Int  num_colors = 0;
+   HYPRE_Int  i, j, k, kk, l, dof, c;
+
+   if (A)
+   {
+      num_rows = hypre_CSRMatrixNumRows(A);
+      A_i = hypre_CSRMatrixI(A);
+      A_j = hypre_CSRMatrixJ(A);
+
+      /* the rows of A^T give the domains whose rows reference a dof */
+      hypre_CSRMatrixTranspose(A, &AT, 0);
+      num_rows_AT = hypre_CSRMatrixNumRows(AT);
+      AT_i = hypre_CSRMatrixI(AT);
+      AT_j = hypre_CSRMatrixJ(AT);
+   }
+
+   /* dof -> domain incidence */
+   i_dof_domain = hypre_CTAlloc(HYPRE_Int, num_dofs+1, HYPRE_MEMORY_HOST);
+   j_dof_domain = hypre_CTAlloc(HYPRE_Int, i_domain_dof[num_domains],
+                                HYPRE_MEMORY_HOST);
+   for (j = 0; j < i_domain_dof[num_domains]; j++)
+   {
+      i_dof_domain[j_domain_dof[j]+1]++;
+   }
+   for (i = 0; i < num_dofs; i++)
+   {
+      i_dof_domain[i+1] += i_dof_domain[i];
+   }
+   for (i = 0; i < num_domains; i++)
+   {
+      for (j = i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
+      {
+         j_dof_domain[i_dof_domain[j_domain_dof[j]]++] = i;
+      }
+   }
+   for (i = num_dofs; i > 0; i--)
+   {
+      i_dof_domain[i] = i_dof_domain[i-1];
+   }
+   i_dof_domain[0] = 0;
+
+   /* greedy coloring; mark[c] == i if color c is taken by a neighbor of i */
+   color = hypre_TAlloc(HYPRE_Int, num_domains, HYPRE_MEMORY_HOST);
+   mark = hypre_TAlloc(HYPRE_Int, num_domains+1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_domains; i++)
+   {
+      color[i] = -1;
+      mark[i] = -1;
+   }
+   mark[num_domains] = -1;
+
+   for (i = 0; i < num_domains; i++)
+   {
+      for (j = i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
+      {
+         dof = j_domain_dof[j];
+         for (k = i_dof_domain[dof]; k < i_dof_domain[dof+1]; k++)
+         {
+            if (color[j_dof_domain[k]] > -1)
+            {
+               mark[color[j_dof_domain[k]]] = i;
+            }
+         }
+         if (dof < num_rows)
+         {
+            for (kk = A_i[dof]; kk < A_i[dof+1]; kk++)
+            {
+               l = A_j[kk];
+               for (k = i_dof_domain[l]; k < i_dof_domain[l+1]; k++)
+               {
+                  if (color[j_dof_domain[k]] > -1)
+                  {
+                     mark[color[j_dof_domain[k]]] = i;
+                  }
+               }
+            }
+         }
+         if (dof < num_rows_AT)
+         {
+            for (kk = AT_i[dof]; kk < AT_i[dof+1]; kk++)
+            {
+               l = AT_j[kk];
+               for (k = i_dof_domain[l]; k < i_dof_domain[l+1]; k++)
+               {
+                  if (color[j_dof_domain[k]] > -1)
+                  {
+                     mark[color[j_dof_domain[k]]] = i;
+                  }
+               }
+            }
+         }
+      }
+      c = 0;
+      while (mark[c] == i)
+      {
+         c++;
+      }
+      color[i] = c;
+      if (c >= num_colors)
+      {
+         num_colors = c+1;
+      }
+   }
+
+   i_color_domain = hypre_CTAlloc(HYPRE_Int, num_colors+1, HYPRE_MEMORY_HOST);
+   j_color_domain = hypre_CTAlloc(HYPRE_Int, num_domains, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_domains; i++)
+   {
+      i_color_domain[color[i]+1]++;
+   }
+   for (c = 0; c < num_colors; c++)
+   {
+      i_color_domain[c+1] += i_color_domain[c];
+   }
+   for (i = 0; i < num_domains; i++)
+   {
+      j_color_domain[i_color_domain[color[i]]++] = i;
+   }
+   for (c = num_colors; c > 0; c--)
+   {
+      i_color_domain[c] = i_color_domain[c-1];
+   }
+   i_color_domain[0] = 0;
+
+   domain_colors = hypre_CSRMatrixCreate(num_colors, num_domains, num_domains);
+   hypre_CSRMatrixI(domain_colors) = i_color_domain;
+   hypre_CSRMatrixJ(domain_colors) = j_color_domain;
+
+   hypre_TFree(i_dof_domain, HYPRE_MEMORY_HOST);
+   hypre_TFree(j_dof_domain, HYPRE_MEMORY_HOST);
+   hypre_TFree(color, HYPRE_MEMORY_HOST);
+   hypre_TFree(mark, HYPRE_MEMORY_HOST);
+   if (AT)
+   {
+      hypre_CSRMatrixDestroy(AT);
+   }
+
+   *domain_colors_pointer = domain_colors;
+
+   return hypre_error_flag;
+}
+
+/* -------------------------------------------------------------------------
+   hypre_MPSchwarzDomainUpdate: multiplicative update of subdomain i,
+   x_i += relax_wt * A_ii^{-1} (rhs - A x)_i, with aux as workspace.
+   ----------------------------------------------------------------------- */
+
+static void
+hypre_MPSchwarzDomainUpdate( HYPRE_Int   i,
+                             HYPRE_Int  *i_domain_dof,
+                             HYPRE_Int  *j_domain_dof,
+                             HYPRE_Real *factor,
+                             HYPRE_Int  *pivots,
+                             HYPRE_Int   use_nonsymm,
+                             HYPRE_Int  *i_dof_dof,
+                             HYPRE_Int  *j_dof_dof,
+                             HYPRE_Real *a_dof_dof,
+                             HYPRE_Real *rhs,
+                             HYPRE_Real *x,
+                             HYPRE_Real  relax_wt,
+                             HYPRE_Real *aux )
+{
+   HYPRE_Int matrix_size = i_domain_dof[i+1] - i_domain_dof[i];
+   HYPRE_Int jj, j, k;
+
+   /* compute residual: ---------------------------------------- */
+   jj = 0;
+   for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
+   {
+      aux[jj] = rhs[j_domain_dof[j]];
+      for (k=i_dof_dof[j_domain_dof[j]];
+           k<i_dof_dof[j_domain_dof[j]+1]; k++)
+         aux[jj] -= a_dof_dof[k] * x[j_dof_dof[k]];
+      jj++;
+   }
+
+   /* solve for correction: ------------------------------------- */
+   hypre_SchwarzDenseSolve(matrix_size, factor,
+                           use_nonsymm ? &pivots[i_domain_dof[i]] : NULL,
+                           use_nonsymm, aux);
+
+   jj = 0;
+   for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
+   {
+      x[j_domain_dof[j]]+=  relax_wt * aux[jj++];
+   }
+}
+
+/* -------------------------------------------------------------------------
+   hypre_AdSchwarzDomainUpdate: additive update of subdomain i with the
+   residual r, x_i += scale_i * A_ii^{-1} r_i, with tmp as workspace.
+   ----------------------------------------------------------------------- */
+
+static void
+hypre_AdSchwarzDomainUpdate( HYPRE_Int   i,
+                             HYPRE_Int  *i_domain_dof,
+                             HYPRE_Int  *j_domain_dof,
+                             HYPRE_Real *factor,
+                             HYPRE_Int  *pivots,
+                             HYPRE_Int   use_nonsymm,
+                             HYPRE_Real *r,
+                             HYPRE_Real *scale,
+                             HYPRE_Real *x,
+                             HYPRE_Real *tmp )
+{
+   HYPRE_Int matrix_size = i_domain_dof[i+1] - i_domain_dof[i];
+   HYPRE_Int jj, j;
+
+   jj = 0;
+   for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
+   {
+      tmp[jj] = r[j_domain_dof[j]];
+      jj++;
+   }
+
+   hypre_SchwarzDenseSolve(matrix_size, factor,
+                           use_nonsymm ? &pivots[i_domain_dof[i]] : NULL,
+                           use_nonsymm, tmp);
+
+   jj = 0;
+   for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
+   {
+      x[j_domain_dof[j]]+=  scale[j_domain_dof[j]]*tmp[jj++];
+   }
+}
+
+/* -------------------------------------------------------------------------
+   hypre_ParAdSchwarzDomainUpdate: as hypre_AdSchwarzDomainUpdate for
+   subdomains that include off-processor dofs (index >= num_variables),
+   whose residual and correction live in r_ext and x_ext.
+   ----------------------------------------------------------------------- */
+
+static void
+hypre_ParAdSchwarzDomainUpdate( HYPRE_Int   i,
+                                HYPRE_Int  *i_domain_dof,
+                                HYPRE_Int  *j_domain_dof,
+                                HYPRE_Real *factor,
+                                HYPRE_Int  *pivots,
+                                HYPRE_Int   use_nonsymm,
+                                HYPRE_Int   num_variables,
+                                HYPRE_Real *r,
+                                HYPRE_Real *r_ext,
+                                HYPRE_Real *scale,
+                                HYPRE_Real *scale_ext,
+                                HYPRE_Real *x,
+                                HYPRE_Real *x_ext,
+                                HYPRE_Real *aux )
+{
+   HYPRE_Int matrix_size = i_domain_dof[i+1] - i_domain_dof[i];
+   HYPRE_Int jj, j, j_loc;
+
+   /* copy data contiguously into aux  --------------------------- */
+   jj = 0;
+   for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
+   {
+      j_loc = j_domain_dof[j];
+      if (j_loc < num_variables)
+         aux[jj] = r[j_loc];
+      else
+         aux[jj] = r_ext[j_loc-num_variables];
+      jj++;
+   }
+
+   /* solve for correction: ------------------------------------- */
+   hypre_SchwarzDenseSolve(matrix_size, factor,
+                           use_nonsymm ? &pivots[i_domain_dof[i]] : NULL,
+                           use_nonsymm, aux);
+
+   jj = 0;
+   for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
+   {
+      j_loc = j_domain_dof[j];
+      if (j_loc < num_variables)
+         x[j_loc]+= scale[j_loc] * aux[jj++];
+      else
+      {
+         j_loc -= num_variables;
+         x_ext[j_loc] += scale_ext[j_loc] * aux[jj++];
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AMGNodalSchwarzSmoother: (Not used currently)
  *--------------------------------------------------------------------------*/
@@ -704,12 +1227,12 @@ HYPRE_Int hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix *par_A,
 HYPRE_Int hypre_MPSchwarzSolve(hypre_ParCSRMatrix *par_A,
                                hypre_Vector *rhs_vector,
                                hypre_CSRMatrix *domain_structure,
+                               hypre_CSRMatrix *domain_colors,
                                hypre_ParVector *par_x,
                                HYPRE_Real relax_wt,
                                hypre_Vector *aux_vector, HYPRE_Int *pivots,
                                HYPRE_Int use_nonsymm)
 {
-   HYPRE_Int ierr = 0;
    /* HYPRE_Int num_dofs; */
    HYPRE_Int *i_dof_dof;
    HYPRE_Int *j_dof_dof;
@@ -721,15 +1244,18 @@ HYPRE_Int hypre_MPSchwarzSolve(hypre_ParCSRMatrix *par_A,
    hypre_Vector *x_vector;
    MPI_Comm comm = hypre_ParCSRMatrixComm(par_A);
    HYPRE_Int num_domains = hypre_CSRMatrixNumRows(domain_structure);
+   HYPRE_Int max_domain_size = hypre_CSRMatrixNumCols(domain_structure);
    HYPRE_Int *i_domain_dof = hypre_CSRMatrixI(domain_structure);
    HYPRE_Int *j_domain_dof = hypre_CSRMatrixJ(domain_structure);
    HYPRE_Real *domain_matrixinverse = hypre_CSRMatrixData(domain_structure);
 
-   HYPRE_Int piv_counter = 0;
-   HYPRE_Int one = 1;
-   char uplo = 'L';
+   HYPRE_Int *factor_offsets;
+   HYPRE_Int num_colors;
+   HYPRE_Int *i_color_domain;
+   HYPRE_Int *j_color_domain;
+   HYPRE_Real *aux_threads;
 
-   HYPRE_Int jj,i,j,k; /*, j_loc, k_loc;*/
+   HYPRE_Int i, ii, c; /*, j_loc, k_loc;*/
 
 
    HYPRE_Int matrix_size, matrix_size_counter = 0;
@@ -750,15 +1276,47 @@ HYPRE_Int hypre_MPSchwarzSolve(hypre_ParCSRMatrix *par_A,
    /* for (i=0; i < num_dofs; i++)
       x[i] = 0.e0; */
 
-   if (use_nonsymm)
-      uplo = 'N';
-
-
    if (num_procs > 1)
       hypre_parCorrRes(par_A,par_x,rhs_vector,&rhs);
    else
       rhs = hypre_VectorData(rhs_vector);
 
+   if (domain_colors)
+   {
+      /* colored ordering: subdomains of one color are decoupled and are
+         updated concurrently, colors are visited forward and backward */
+      num_colors = hypre_CSRMatrixNumRows(domain_colors);
+      i_color_domain = hypre_CSRMatrixI(domain_colors);
+      j_color_domain = hypre_CSRMatrixJ(domain_colors);
+      factor_offsets = hypre_SchwarzFactorOffsets(num_domains, i_domain_dof);
+      aux_threads = hypre_CTAlloc(HYPRE_Real, max_domain_size*hypre_NumThreads(),
+                                  HYPRE_MEMORY_HOST);
+
+      for (c = 0; c < 2*num_colors; c++)
+      {
+         HYPRE_Int color = (c < num_colors) ? c : 2*num_colors-1-c;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ii,i) HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = i_color_domain[color]; ii < i_color_domain[color+1]; ii++)
+         {
+            i = j_color_domain[ii];
+            hypre_MPSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                        &domain_matrixinverse[factor_offsets[i]],
+                                        pivots, use_nonsymm,
+                                        i_dof_dof, j_dof_dof, a_dof_dof,
+                                        rhs, x, relax_wt,
+                                        &aux_threads[max_domain_size*hypre_GetThreadNum()]);
+         }
+      }
+
+      hypre_TFree(factor_offsets, HYPRE_MEMORY_HOST);
+      hypre_TFree(aux_threads, HYPRE_MEMORY_HOST);
+      if (num_procs > 1) hypre_TFree(rhs, HYPRE_MEMORY_SHARED);
+
+      return hypre_error_flag;
+   }
+
    /* forward solve: ----------------------------------------------- */
 
    matrix_size_counter = 0;
@@ -766,93 +1324,34 @@ HYPRE_Int hypre_MPSchwarzSolve(hypre_ParCSRMatrix *par_A,
    {
       matrix_size = i_domain_dof[i+1] - i_domain_dof[i];
 
-      /* compute residual: ---------------------------------------- */
+      hypre_MPSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                  &domain_matrixinverse[matrix_size_counter],
+                                  pivots, use_nonsymm,
+                                  i_dof_dof, j_dof_dof, a_dof_dof,
+                                  rhs, x, relax_wt, aux);
 
-      jj = 0;
-      for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
-      {
-         aux[jj] = rhs[j_domain_dof[j]];
-         for (k=i_dof_dof[j_domain_dof[j]];
-              k<i_dof_dof[j_domain_dof[j]+1]; k++)
-            aux[jj] -= a_dof_dof[k] * x[j_dof_dof[k]];
-         jj++;
-      }
-      /* solve for correction: ------------------------------------- */
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], aux,
-                      &matrix_size, &ierr);
-      }
-      else
-      {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, aux,
-                      &matrix_size, &ierr);
-      }
-
-      if (ierr) hypre_error(HYPRE_ERROR_GENERIC);
-      jj = 0;
-      for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
-      {
-         x[j_domain_dof[j]]+=  relax_wt * aux[jj++];
-      }
       matrix_size_counter += matrix_size * matrix_size;
-      piv_counter += matrix_size;
    }
 
 /*  if (num_procs > 1)
     {
-    hypre_TFree(rhs, HYPRE_MEMORY_HOST);
-    hypre_parCorrRes(par_A,par_x,rhs_vector,&rhs);
-    }
-    else
-    rhs = hypre_VectorData(rhs_vector);
-*/
-   /* backward solve: ------------------------------------------------ */
-   for (i=num_domains-1; i > -1; i--)
-   {
-      matrix_size = i_domain_dof[i+1] - i_domain_dof[i];
-      matrix_size_counter -= matrix_size * matrix_size;
-      piv_counter -= matrix_size;
-
-      /* compute residual: ---------------------------------------- */
-
-      jj = 0;
-      for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
-      {
-         aux[jj] = rhs[j_domain_dof[j]];
-         for (k=i_dof_dof[j_domain_dof[j]];
-              k<i_dof_dof[j_domain_dof[j]+1]; k++)
-            aux[jj] -= a_dof_dof[k] * x[j_dof_dof[k]];
-         jj++;
-      }
-
-      /* solve for correction: ------------------------------------- */
-
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], aux,
-                      &matrix_size, &ierr);
-      }
-      else
-      {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, aux,
-                      &matrix_size, &ierr);
-      }
+    hypre_TFree(rhs, HYPRE_MEMORY_HOST);
+    hypre_parCorrRes(par_A,par_x,rhs_vector,&rhs);
+    }
+    else
+    rhs = hypre_VectorData(rhs_vector);
+*/
+   /* backward solve: ------------------------------------------------ */
+   for (i=num_domains-1; i > -1; i--)
+   {
+      matrix_size = i_domain_dof[i+1] - i_domain_dof[i];
+      matrix_size_counter -= matrix_size * matrix_size;
 
-      if (ierr)  hypre_error(HYPRE_ERROR_GENERIC);
-      jj = 0;
-      for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
-      {
-         x[j_domain_dof[j]]+=  relax_wt*aux[jj++];
-      }
+      hypre_MPSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                  &domain_matrixinverse[matrix_size_counter],
+                                  pivots, use_nonsymm,
+                                  i_dof_dof, j_dof_dof, a_dof_dof,
+                                  rhs, x, relax_wt, aux);
    }
 
    if (num_procs > 1) hypre_TFree(rhs, HYPRE_MEMORY_SHARED);
@@ -1031,12 +1530,12 @@ HYPRE_Int hypre_MPSchwarzCFSolve(hypre_ParCSRMatrix *par_A,
 HYPRE_Int hypre_MPSchwarzFWSolve(hypre_ParCSRMatrix *par_A,
                                  hypre_Vector *rhs_vector,
                                  hypre_CSRMatrix *domain_structure,
+                                 hypre_CSRMatrix *domain_colors,
                                  hypre_ParVector *par_x,
                                  HYPRE_Real relax_wt,
                                  hypre_Vector *aux_vector, HYPRE_Int *pivots,
                                  HYPRE_Int use_nonsymm)
 {
-   HYPRE_Int ierr = 0;
    /* HYPRE_Int num_dofs; */
    HYPRE_Int *i_dof_dof;
    HYPRE_Int *j_dof_dof;
@@ -1048,15 +1547,18 @@ HYPRE_Int hypre_MPSchwarzFWSolve(hypre_ParCSRMatrix *par_A,
    hypre_Vector *x_vector;
    MPI_Comm comm = hypre_ParCSRMatrixComm(par_A);
    HYPRE_Int num_domains = hypre_CSRMatrixNumRows(domain_structure);
+   HYPRE_Int max_domain_size = hypre_CSRMatrixNumCols(domain_structure);
    HYPRE_Int *i_domain_dof = hypre_CSRMatrixI(domain_structure);
    HYPRE_Int *j_domain_dof = hypre_CSRMatrixJ(domain_structure);
    HYPRE_Real *domain_matrixinverse = hypre_CSRMatrixData(domain_structure);
 
+   HYPRE_Int *factor_offsets;
+   HYPRE_Int num_colors;
+   HYPRE_Int *i_color_domain;
+   HYPRE_Int *j_color_domain;
+   HYPRE_Real *aux_threads;
 
-   HYPRE_Int piv_counter = 0;
-   HYPRE_Int one = 1;
-   char uplo = 'L';
-   HYPRE_Int jj,i,j,k; /*, j_loc, k_loc;*/
+   HYPRE_Int i, ii, c; /*, j_loc, k_loc;*/
 
 
    HYPRE_Int matrix_size, matrix_size_counter = 0;
@@ -1082,6 +1584,40 @@ HYPRE_Int hypre_MPSchwarzFWSolve(hypre_ParCSRMatrix *par_A,
    else
       rhs = hypre_VectorData(rhs_vector);
 
+   if (domain_colors)
+   {
+      /* colored ordering: subdomains of one color are updated concurrently */
+      num_colors = hypre_CSRMatrixNumRows(domain_colors);
+      i_color_domain = hypre_CSRMatrixI(domain_colors);
+      j_color_domain = hypre_CSRMatrixJ(domain_colors);
+      factor_offsets = hypre_SchwarzFactorOffsets(num_domains, i_domain_dof);
+      aux_threads = hypre_CTAlloc(HYPRE_Real, max_domain_size*hypre_NumThreads(),
+                                  HYPRE_MEMORY_HOST);
+
+      for (c = 0; c < num_colors; c++)
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ii,i) HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = i_color_domain[c]; ii < i_color_domain[c+1]; ii++)
+         {
+            i = j_color_domain[ii];
+            hypre_MPSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                        &domain_matrixinverse[factor_offsets[i]],
+                                        pivots, use_nonsymm,
+                                        i_dof_dof, j_dof_dof, a_dof_dof,
+                                        rhs, x, relax_wt,
+                                        &aux_threads[max_domain_size*hypre_GetThreadNum()]);
+         }
+      }
+
+      hypre_TFree(factor_offsets, HYPRE_MEMORY_HOST);
+      hypre_TFree(aux_threads, HYPRE_MEMORY_HOST);
+      if (num_procs > 1) hypre_TFree(rhs, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+
    /* forward solve: ----------------------------------------------- */
 
    matrix_size_counter = 0;
@@ -1089,42 +1625,13 @@ HYPRE_Int hypre_MPSchwarzFWSolve(hypre_ParCSRMatrix *par_A,
    {
       matrix_size = i_domain_dof[i+1] - i_domain_dof[i];
 
-      /* compute residual: ---------------------------------------- */
-
-      jj = 0;
-      for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
-      {
-         aux[jj] = rhs[j_domain_dof[j]];
-         for (k=i_dof_dof[j_domain_dof[j]];
-              k<i_dof_dof[j_domain_dof[j]+1]; k++)
-            aux[jj] -= a_dof_dof[k] * x[j_dof_dof[k]];
-         jj++;
-      }
-      /* solve for correction: ------------------------------------- */
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], aux,
-                      &matrix_size, &ierr);
-      }
-      else
-      {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, aux,
-                      &matrix_size, &ierr);
-      }
+      hypre_MPSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                  &domain_matrixinverse[matrix_size_counter],
+                                  pivots, use_nonsymm,
+                                  i_dof_dof, j_dof_dof, a_dof_dof,
+                                  rhs, x, relax_wt, aux);
 
-
-      if (ierr)   hypre_error(HYPRE_ERROR_GENERIC);
-      jj = 0;
-      for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
-      {
-         x[j_domain_dof[j]]+=  relax_wt * aux[jj++];
-      }
       matrix_size_counter += matrix_size * matrix_size;
-      piv_counter += matrix_size;
    }
 
    if (num_procs > 1) hypre_TFree(rhs, HYPRE_MEMORY_HOST);
@@ -1473,7 +1980,6 @@ hypre_AMGCreateDomainDof(hypre_CSRMatrix     *A,
 
    HYPRE_Int *i_dof_index;
 
-   HYPRE_Int ierr = 0;
    HYPRE_Int i,j,k,  l_loc, i_loc, j_loc;
    HYPRE_Int i_dof;
    HYPRE_Int *i_local_to_global;
@@ -1485,11 +1991,11 @@ hypre_AMGCreateDomainDof(hypre_CSRMatrix     *A,
    HYPRE_Int nf;
 
    HYPRE_Real *AE;
+   HYPRE_Int *factor_offsets;
 
    HYPRE_Int piv_counter = 0;
    HYPRE_Int *ipiv;
    HYPRE_Int *piv = NULL;
-   char uplo = 'L';
    HYPRE_Int cnt;
 
    /* --------------------------------------------------------------------- */
@@ -1724,68 +2230,67 @@ hypre_AMGCreateDomainDof(hypre_CSRMatrix     *A,
    if (use_nonsymm)
       piv = hypre_CTAlloc(HYPRE_Int,  piv_counter, HYPRE_MEMORY_HOST);
 
-   i_local_to_global = hypre_CTAlloc(HYPRE_Int,  max_local_dof_counter, HYPRE_MEMORY_HOST);
+   factor_offsets = hypre_SchwarzFactorOffsets(num_domains, i_domain_dof);
 
-   i_global_to_local = hypre_CTAlloc(HYPRE_Int, num_dofs, HYPRE_MEMORY_HOST);
+   /* assemble and factor the subdomain matrices; the subdomains are
+      independent and are distributed over the threads */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,j,i_loc,j_loc,l_loc,i_dof,local_dof_counter,cnt,AE,ipiv,i_local_to_global,i_global_to_local)
+#endif
+   {
+      HYPRE_Int ns, ne;
 
-   for (i=0; i < num_dofs; i++)
-      i_global_to_local[i] = -1;
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_domains);
 
-   piv_counter = 0;
-   domain_matrixinverse_counter = 0;
-   for (i=0; i < num_domains; i++)
-   {
-      local_dof_counter = 0;
-      for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
-      {
-         i_global_to_local[j_domain_dof[j]] = local_dof_counter;
-         i_local_to_global[local_dof_counter] = j_domain_dof[j];
-         local_dof_counter++;
-      }
+      i_local_to_global = hypre_CTAlloc(HYPRE_Int,  max_local_dof_counter, HYPRE_MEMORY_HOST);
 
-      /* get local matrix in AE: ======================================== */
-      cnt = 0;
+      i_global_to_local = hypre_CTAlloc(HYPRE_Int, num_dofs, HYPRE_MEMORY_HOST);
 
-      AE = &domain_matrixinverse[domain_matrixinverse_counter];
-      ipiv = &piv[piv_counter];
-      for (i_loc=0; i_loc < local_dof_counter; i_loc++)
-         for (j_loc=0; j_loc < local_dof_counter; j_loc++)
-            AE[cnt++] = 0.e0;
+      for (i=0; i < num_dofs; i++)
+         i_global_to_local[i] = -1;
 
-      for (i_loc=0; i_loc < local_dof_counter; i_loc++)
+      for (i=ns; i < ne; i++)
       {
-         i_dof = i_local_to_global[i_loc];
-         for (j=i_dof_dof[i_dof]; j < i_dof_dof[i_dof+1]; j++)
+         local_dof_counter = 0;
+         for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
          {
-            j_loc = i_global_to_local[j_dof_dof[j]];
-            if (j_loc >=0)
-               AE[i_loc + j_loc * local_dof_counter] = a_dof_dof[j];
+            i_global_to_local[j_domain_dof[j]] = local_dof_counter;
+            i_local_to_global[local_dof_counter] = j_domain_dof[j];
+            local_dof_counter++;
          }
-      }
 
-      if (use_nonsymm)
-      {
-         hypre_dgetrf(&local_dof_counter,
-                      &local_dof_counter, AE,
-                      &local_dof_counter, ipiv, &ierr);
-         piv_counter +=local_dof_counter;
-      }
+         /* get local matrix in AE: ======================================== */
+         cnt = 0;
 
-      else
-      {
-         hypre_dpotrf(&uplo,&local_dof_counter, AE,
-                      &local_dof_counter, &ierr);
-      }
+         AE = &domain_matrixinverse[factor_offsets[i]];
+         ipiv = use_nonsymm ? &piv[i_domain_dof[i]] : NULL;
+         for (i_loc=0; i_loc < local_dof_counter; i_loc++)
+            for (j_loc=0; j_loc < local_dof_counter; j_loc++)
+               AE[cnt++] = 0.e0;
+
+         for (i_loc=0; i_loc < local_dof_counter; i_loc++)
+         {
+            i_dof = i_local_to_global[i_loc];
+            for (j=i_dof_dof[i_dof]; j < i_dof_dof[i_dof+1]; j++)
+            {
+               j_loc = i_global_to_local[j_dof_dof[j]];
+               if (j_loc >=0)
+                  AE[i_loc + j_loc * local_dof_counter] = a_dof_dof[j];
+            }
+         }
 
-      domain_matrixinverse_counter+=local_dof_counter*local_dof_counter;
+         hypre_SchwarzDenseFactor(local_dof_counter, AE, ipiv, use_nonsymm);
 
-      for (l_loc=0; l_loc < local_dof_counter; l_loc++)
-         i_global_to_local[i_local_to_global[l_loc]] = -1;
+         for (l_loc=0; l_loc < local_dof_counter; l_loc++)
+            i_global_to_local[i_local_to_global[l_loc]] = -1;
+
+      }
 
+      hypre_TFree(i_local_to_global, HYPRE_MEMORY_HOST);
+      hypre_TFree(i_global_to_local, HYPRE_MEMORY_HOST);
    }
 
-   hypre_TFree(i_local_to_global, HYPRE_MEMORY_HOST);
-   hypre_TFree(i_global_to_local, HYPRE_MEMORY_HOST);
+   hypre_TFree(factor_offsets, HYPRE_MEMORY_HOST);
 
    domain_structure = hypre_CSRMatrixCreate(num_domains, max_local_dof_counter,
                                             i_domain_dof[num_domains]);
@@ -2542,12 +3047,12 @@ hypre_parCorrRes( hypre_ParCSRMatrix *A,
 HYPRE_Int hypre_AdSchwarzSolve(hypre_ParCSRMatrix *par_A,
                                hypre_ParVector *par_rhs,
                                hypre_CSRMatrix *domain_structure,
+                               hypre_CSRMatrix *domain_colors,
                                HYPRE_Real *scale,
                                hypre_ParVector *par_x,
                                hypre_ParVector *par_aux, HYPRE_Int *pivots,
                                HYPRE_Int use_nonsymm)
 {
-   HYPRE_Int ierr = 0;
    HYPRE_Real *x;
    HYPRE_Real *aux;
    HYPRE_Real *tmp;
@@ -2560,11 +3065,12 @@ HYPRE_Int hypre_AdSchwarzSolve(hypre_ParCSRMatrix *par_A,
    HYPRE_Int *j_domain_dof;
    HYPRE_Real *domain_matrixinverse;
 
-   HYPRE_Int piv_counter = 0;
-   HYPRE_Int one = 1;
-   char uplo = 'L';
+   HYPRE_Int *factor_offsets;
+   HYPRE_Int num_colors;
+   HYPRE_Int *i_color_domain;
+   HYPRE_Int *j_color_domain;
 
-   HYPRE_Int jj,i,j; /*, j_loc, k_loc;*/
+   HYPRE_Int i,ii,c; /*, j_loc, k_loc;*/
 
 
    HYPRE_Int matrix_size, matrix_size_counter = 0;
@@ -2584,11 +3090,40 @@ HYPRE_Int hypre_AdSchwarzSolve(hypre_ParCSRMatrix *par_A,
    j_domain_dof = hypre_CSRMatrixJ(domain_structure);
    domain_matrixinverse = hypre_CSRMatrixData(domain_structure);
 
-   if (use_nonsymm)
-      uplo = 'N';
-
    hypre_ParVectorCopy(par_rhs,par_aux);
    hypre_ParCSRMatrixMatvec(-1.0,par_A,par_x,1.0,par_aux);
+
+   if (domain_colors)
+   {
+      /* subdomains of one color share no dofs and are solved concurrently */
+      num_colors = hypre_CSRMatrixNumRows(domain_colors);
+      i_color_domain = hypre_CSRMatrixI(domain_colors);
+      j_color_domain = hypre_CSRMatrixJ(domain_colors);
+      factor_offsets = hypre_SchwarzFactorOffsets(num_domains, i_domain_dof);
+      tmp = hypre_CTAlloc(HYPRE_Real, max_domain_size*hypre_NumThreads(),
+                          HYPRE_MEMORY_HOST);
+
+      for (c = 0; c < num_colors; c++)
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ii,i) HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = i_color_domain[c]; ii < i_color_domain[c+1]; ii++)
+         {
+            i = j_color_domain[ii];
+            hypre_AdSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                        &domain_matrixinverse[factor_offsets[i]],
+                                        pivots, use_nonsymm, aux, scale, x,
+                                        &tmp[max_domain_size*hypre_GetThreadNum()]);
+         }
+      }
+
+      hypre_TFree(factor_offsets, HYPRE_MEMORY_HOST);
+      hypre_TFree(tmp, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+
    tmp = hypre_CTAlloc(HYPRE_Real, max_domain_size, HYPRE_MEMORY_HOST);
 
    /* forward solve: ----------------------------------------------- */
@@ -2598,39 +3133,11 @@ HYPRE_Int hypre_AdSchwarzSolve(hypre_ParCSRMatrix *par_A,
    {
       matrix_size = i_domain_dof[i+1] - i_domain_dof[i];
 
-      /* compute residual: ---------------------------------------- */
-
-      jj = 0;
-      for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
-      {
-         tmp[jj] = aux[j_domain_dof[j]];
-         jj++;
-      }
-      /* solve for correction: ------------------------------------- */
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], tmp,
-                      &matrix_size, &ierr);
-      }
-      else
-      {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, tmp,
-                      &matrix_size, &ierr);
-      }
+      hypre_AdSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                  &domain_matrixinverse[matrix_size_counter],
+                                  pivots, use_nonsymm, aux, scale, x, tmp);
 
-      if (ierr)  hypre_error(HYPRE_ERROR_GENERIC);
-      jj = 0;
-      for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
-      {
-         x[j_domain_dof[j]]+=  scale[j_domain_dof[j]]*tmp[jj++];
-      }
       matrix_size_counter += matrix_size * matrix_size;
-      piv_counter += matrix_size;
-
    }
 
    hypre_TFree(tmp, HYPRE_MEMORY_HOST);
@@ -2770,6 +3277,7 @@ hypre_GenerateScale(hypre_CSRMatrix *domain_structure,
 HYPRE_Int hypre_ParAdSchwarzSolve(hypre_ParCSRMatrix *A,
                                   hypre_ParVector *F,
                                   hypre_CSRMatrix *domain_structure,
+                                  hypre_CSRMatrix *domain_colors,
                                   HYPRE_Real *scale,
                                   hypre_ParVector *X,
                                   hypre_ParVector *Vtemp,
@@ -2783,12 +3291,12 @@ HYPRE_Int hypre_ParAdSchwarzSolve(hypre_ParCSRMatrix *A,
 
    hypre_ParCSRCommHandle *comm_handle;
 
-   HYPRE_Int ierr = 0;
    HYPRE_Real *x_data;
-   HYPRE_Real *x_ext_data;
+   HYPRE_Real *x_ext_data = NULL;
    HYPRE_Real *aux;
+   HYPRE_Real *aux_threads;
    HYPRE_Real *vtemp_data;
-   HYPRE_Real *vtemp_ext_data;
+   HYPRE_Real *vtemp_ext_data = NULL;
    HYPRE_Int num_domains, max_domain_size;
    HYPRE_Int *i_domain_dof;
    HYPRE_Int *j_domain_dof;
@@ -2796,15 +3304,16 @@ HYPRE_Int hypre_ParAdSchwarzSolve(hypre_ParCSRMatrix *A,
    hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
    HYPRE_Int num_variables;
    HYPRE_Int num_cols_offd;
-   HYPRE_Real *scale_ext;
+   HYPRE_Real *scale_ext = NULL;
    HYPRE_Real *buf_data;
    HYPRE_Int index;
 
-   HYPRE_Int piv_counter = 0;
-   HYPRE_Int one = 1;
+   HYPRE_Int *factor_offsets;
+   HYPRE_Int num_colors;
+   HYPRE_Int *i_color_domain;
+   HYPRE_Int *j_color_domain;
 
-   char uplo = 'L';
-   HYPRE_Int jj,i,j, j_loc; /*, j_loc, k_loc;*/
+   HYPRE_Int i,ii,j,c; /*, j_loc, k_loc;*/
 
    HYPRE_Int matrix_size, matrix_size_counter = 0;
 
@@ -2814,9 +3323,6 @@ HYPRE_Int hypre_ParAdSchwarzSolve(hypre_ParCSRMatrix *A,
    x_data = hypre_VectorData(hypre_ParVectorLocalVector(X));
    vtemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
 
-   if (use_nonsymm)
-      uplo = 'N';
-
    hypre_ParVectorCopy(F,Vtemp);
    hypre_ParCSRMatrixMatvec(-1.0,A,X,1.0,Vtemp);
 
@@ -2867,54 +3373,51 @@ HYPRE_Int hypre_ParAdSchwarzSolve(hypre_ParCSRMatrix *A,
    for (i=0; i < num_cols_offd; i++)
       x_ext_data[i] = 0.0;
 
-   matrix_size_counter = 0;
-   for (i=0; i < num_domains; i++)
+   if (domain_colors)
    {
-      matrix_size = i_domain_dof[i+1] - i_domain_dof[i];
-
-      /* copy data contiguously into aux  --------------------------- */
-
-      jj = 0;
-      for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
-      {
-         j_loc = j_domain_dof[j];
-         if (j_loc < num_variables)
-            aux[jj] = vtemp_data[j_loc];
-         else
-            aux[jj] = vtemp_ext_data[j_loc-num_variables];
-         jj++;
-      }
-      /* solve for correction: ------------------------------------- */
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], aux,
-                      &matrix_size, &ierr);
-      }
-      else
+      /* subdomains of one color share no dofs and are solved concurrently */
+      num_colors = hypre_CSRMatrixNumRows(domain_colors);
+      i_color_domain = hypre_CSRMatrixI(domain_colors);
+      j_color_domain = hypre_CSRMatrixJ(domain_colors);
+      factor_offsets = hypre_SchwarzFactorOffsets(num_domains, i_domain_dof);
+      aux_threads = hypre_CTAlloc(HYPRE_Real, max_domain_size*hypre_NumThreads(),
+                                  HYPRE_MEMORY_HOST);
+
+      for (c = 0; c < num_colors; c++)
       {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, aux,
-                      &matrix_size, &ierr);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ii,i) HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = i_color_domain[c]; ii < i_color_domain[c+1]; ii++)
+         {
+            i = j_color_domain[ii];
+            hypre_ParAdSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                           &domain_matrixinverse[factor_offsets[i]],
+                                           pivots, use_nonsymm, num_variables,
+                                           vtemp_data, vtemp_ext_data,
+                                           scale, scale_ext, x_data, x_ext_data,
+                                           &aux_threads[max_domain_size*hypre_GetThreadNum()]);
+         }
       }
 
-      if (ierr)  hypre_error(HYPRE_ERROR_GENERIC);
-      jj = 0;
-      for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
+      hypre_TFree(factor_offsets, HYPRE_MEMORY_HOST);
+      hypre_TFree(aux_threads, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      matrix_size_counter = 0;
+      for (i=0; i < num_domains; i++)
       {
-         j_loc = j_domain_dof[j];
-         if (j_loc < num_variables)
-            x_data[j_loc]+= scale[j_loc] * aux[jj++];
-         else
-         {
-            j_loc -= num_variables;
-            x_ext_data[j_loc] += scale_ext[j_loc] * aux[jj++];
-         }
+         matrix_size = i_domain_dof[i+1] - i_domain_dof[i];
+
+         hypre_ParAdSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                        &domain_matrixinverse[matrix_size_counter],
+                                        pivots, use_nonsymm, num_variables,
+                                        vtemp_data, vtemp_ext_data,
+                                        scale, scale_ext, x_data, x_ext_data, aux);
+
+         matrix_size_counter += matrix_size * matrix_size;
       }
-      matrix_size_counter += matrix_size * matrix_size;
-      piv_counter += matrix_size;
    }
 
    if (comm_pkg)
@@ -3000,7 +3503,6 @@ hypre_ParAMGCreateDomainDof(hypre_ParCSRMatrix   *A,
    HYPRE_Int num_recvs = 0;
    HYPRE_Int *recv_vec_starts = NULL;
 
-   HYPRE_Int ierr = 0;
    HYPRE_Int i,j,k, jj,  l_loc, i_loc, j_loc;
    HYPRE_Int i_dof;
    HYPRE_Int nf;
@@ -3014,8 +3516,8 @@ hypre_ParAMGCreateDomainDof(hypre_ParCSRMatrix   *A,
    HYPRE_Real *AE;
 
 
+   HYPRE_Int *factor_offsets;
    HYPRE_Int *ipiv;
-   char uplo = 'L';
    HYPRE_Int piv_counter;
    HYPRE_Int *piv = NULL;
 
@@ -3351,103 +3853,100 @@ hypre_ParAMGCreateDomainDof(hypre_ParCSRMatrix   *A,
    else
       A_ext = NULL;
 
-   i_local_to_global = hypre_CTAlloc(HYPRE_Int,  max_local_dof_counter, HYPRE_MEMORY_HOST);
-
-   i_global_to_local = hypre_CTAlloc(HYPRE_Int,  num_variables+num_cols_offd, HYPRE_MEMORY_HOST);
-
-   for (i=0; i < num_variables+num_cols_offd; i++)
-      i_global_to_local[i] = -1;
+   factor_offsets = hypre_SchwarzFactorOffsets(num_domains, i_domain_dof);
 
-   piv_counter = 0;
-   domain_matrixinverse_counter = 0;
-   for (i=0; i < num_domains; i++)
+   /* assemble and factor the subdomain matrices; the subdomains are
+      independent and are distributed over the threads */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,j,jj,i_loc,j_loc,l_loc,i_dof,local_dof_counter,cnt,AE,ipiv,i_local_to_global,i_global_to_local)
+#endif
    {
-      local_dof_counter = 0;
-      for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
-      {
-         i_global_to_local[j_domain_dof[j]] = local_dof_counter;
-         i_local_to_global[local_dof_counter] = j_domain_dof[j];
-         local_dof_counter++;
-      }
+      HYPRE_Int ns, ne;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_domains);
 
-      /* get local matrix in AE: ======================================== */
+      i_local_to_global = hypre_CTAlloc(HYPRE_Int,  max_local_dof_counter, HYPRE_MEMORY_HOST);
 
-      AE = &domain_matrixinverse[domain_matrixinverse_counter];
-      ipiv = &piv[piv_counter];
+      i_global_to_local = hypre_CTAlloc(HYPRE_Int,  num_variables+num_cols_offd, HYPRE_MEMORY_HOST);
 
-      cnt = 0;
-      for (i_loc=0; i_loc < local_dof_counter; i_loc++)
-         for (j_loc=0; j_loc < local_dof_counter; j_loc++)
-            AE[cnt++] = 0.e0;
+      for (i=0; i < num_variables+num_cols_offd; i++)
+         i_global_to_local[i] = -1;
 
-      for (i_loc=0; i_loc < local_dof_counter; i_loc++)
+      for (i=ns; i < ne; i++)
       {
-         i_dof = i_local_to_global[i_loc];
-         if (i_dof < num_variables)
+         local_dof_counter = 0;
+         for (j=i_domain_dof[i]; j < i_domain_dof[i+1]; j++)
          {
-            for (j=a_diag_i[i_dof]; j < a_diag_i[i_dof+1]; j++)
-            {
-               j_loc = i_global_to_local[a_diag_j[j]];
-               if (j_loc >=0)
-                  AE[i_loc + j_loc * local_dof_counter] = a_diag_data[j];
-            }
-            for (j=a_offd_i[i_dof]; j < a_offd_i[i_dof+1]; j++)
-            {
-               j_loc = i_global_to_local[a_offd_j[j]+num_variables];
-               if (j_loc >=0)
-                  AE[i_loc + j_loc * local_dof_counter] = a_offd_data[j];
-            }
+            i_global_to_local[j_domain_dof[j]] = local_dof_counter;
+            i_local_to_global[local_dof_counter] = j_domain_dof[j];
+            local_dof_counter++;
          }
-         else
+
+         /* get local matrix in AE: ======================================== */
+
+         AE = &domain_matrixinverse[factor_offsets[i]];
+         ipiv = use_nonsymm ? &piv[i_domain_dof[i]] : NULL;
+
+         cnt = 0;
+         for (i_loc=0; i_loc < local_dof_counter; i_loc++)
+            for (j_loc=0; j_loc < local_dof_counter; j_loc++)
+               AE[cnt++] = 0.e0;
+
+         for (i_loc=0; i_loc < local_dof_counter; i_loc++)
          {
-            i_dof -= num_variables;
-            for (j=a_ext_i[i_dof]; j < a_ext_i[i_dof+1]; j++)
+            i_dof = i_local_to_global[i_loc];
+            if (i_dof < num_variables)
             {
-               jj = a_ext_j[j];
-               if (jj > col_0 && jj < col_n)
+               for (j=a_diag_i[i_dof]; j < a_diag_i[i_dof+1]; j++)
                {
-                  jj = jj - first_col_diag;
+                  j_loc = i_global_to_local[a_diag_j[j]];
+                  if (j_loc >=0)
+                     AE[i_loc + j_loc * local_dof_counter] = a_diag_data[j];
                }
-               else
+               for (j=a_offd_i[i_dof]; j < a_offd_i[i_dof+1]; j++)
                {
-                  jj = hypre_BinarySearch(col_map_offd,jj,num_cols_offd);
-                  if (jj > -1) jj += num_variables;
+                  j_loc = i_global_to_local[a_offd_j[j]+num_variables];
+                  if (j_loc >=0)
+                     AE[i_loc + j_loc * local_dof_counter] = a_offd_data[j];
                }
-               if (jj > -1)
+            }
+            else
+            {
+               i_dof -= num_variables;
+               for (j=a_ext_i[i_dof]; j < a_ext_i[i_dof+1]; j++)
                {
-                  j_loc = i_global_to_local[jj];
-                  if (j_loc >=0)
-                     AE[i_loc + j_loc * local_dof_counter] = a_ext_data[j];
+                  jj = a_ext_j[j];
+                  if (jj > col_0 && jj < col_n)
+                  {
+                     jj = jj - first_col_diag;
+                  }
+                  else
+                  {
+                     jj = hypre_BinarySearch(col_map_offd,jj,num_cols_offd);
+                     if (jj > -1) jj += num_variables;
+                  }
+                  if (jj > -1)
+                  {
+                     j_loc = i_global_to_local[jj];
+                     if (j_loc >=0)
+                        AE[i_loc + j_loc * local_dof_counter] = a_ext_data[j];
+                  }
                }
             }
          }
-      }
-
-      if (use_nonsymm)
-      {
-         hypre_dgetrf(&local_dof_counter,
-                      &local_dof_counter, AE,
-                      &local_dof_counter, ipiv, &ierr);
-         piv_counter +=local_dof_counter;
-      }
-
-      else
-      {
-         hypre_dpotrf(&uplo,&local_dof_counter, AE,
-                      &local_dof_counter, &ierr);
-      }
-
-      domain_matrixinverse_counter+=local_dof_counter*local_dof_counter;
 
+         hypre_SchwarzDenseFactor(local_dof_counter, AE, ipiv, use_nonsymm);
 
+         for (l_loc=0; l_loc < local_dof_counter; l_loc++)
+            i_global_to_local[i_local_to_global[l_loc]] = -1;
 
-      for (l_loc=0; l_loc < local_dof_counter; l_loc++)
-         i_global_to_local[i_local_to_global[l_loc]] = -1;
+      }
 
+      hypre_TFree(i_local_to_global, HYPRE_MEMORY_HOST);
+      hypre_TFree(i_global_to_local, HYPRE_MEMORY_HOST);
    }
 
-   hypre_TFree(i_local_to_global, HYPRE_MEMORY_HOST);
-   hypre_TFree(i_global_to_local, HYPRE_MEMORY_HOST);
+   hypre_TFree(factor_offsets, HYPRE_MEMORY_HOST);
    hypre_CSRMatrixDestroy(A_ext);
 
    domain_structure = hypre_CSRMatrixCreate(num_domains, max_local_dof_counter,
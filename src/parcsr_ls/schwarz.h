@@ -36,6 +36,7 @@ typedef struct
    HYPRE_Real  *scale;
    HYPRE_Int     *dof_func;
    HYPRE_Int     *pivots;
+   hypre_CSRMatrix *domain_colors; /* subdomain coloring for threaded sweeps */
    
    
 
@@ -61,6 +62,8 @@ typedef struct
 #define hypre_SchwarzDataScale(schwarz_data) ((schwarz_data)->scale)
 #define hypre_SchwarzDataDofFunc(schwarz_data) ((schwarz_data)->dof_func)
 #define hypre_SchwarzDataPivots(schwarz_data) ((schwarz_data)->pivots)
+#define hypre_SchwarzDataDomainColors(schwarz_data) \
+((schwarz_data)->domain_colors)
 
 #endif
 
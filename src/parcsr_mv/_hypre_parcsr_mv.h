@@ -57,10 +57,14 @@ typedef struct
 
    HYPRE_Int own_send_data, own_recv_data;
 
+   /* job and package the requests were set up for (for the statistics) */
+   HYPRE_Int                     job;
+   struct hypre_ParCSRCommPkg_struct *comm_pkg;
+
 } hypre_ParCSRPersistentCommHandle;
 #endif
 
-typedef struct
+typedef struct hypre_ParCSRCommPkg_struct
 {
    MPI_Comm               comm;
 
@@ -80,6 +84,12 @@ typedef struct
 #ifdef HYPRE_USING_PERSISTENT_COMM
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
 #endif
+
+   /* statistics, accumulated while hypre_comm_stats_active is set */
+   HYPRE_Int                    num_exchanges;
+   HYPRE_Int                    num_messages;
+   HYPRE_Real                   num_bytes;
+   HYPRE_Real                   wait_time;
 } hypre_ParCSRCommPkg;
 
 /*--------------------------------------------------------------------------
@@ -123,6 +133,11 @@ typedef struct
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)  (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i) (comm_pkg -> recv_mpi_types[i])
 
+#define hypre_ParCSRCommPkgNumExchanges(comm_pkg)  (comm_pkg -> num_exchanges)
+#define hypre_ParCSRCommPkgNumMessages(comm_pkg)   (comm_pkg -> num_messages)
+#define hypre_ParCSRCommPkgNumBytes(comm_pkg)      (comm_pkg -> num_bytes)
+#define hypre_ParCSRCommPkgWaitTime(comm_pkg)      (comm_pkg -> wait_time)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_ParCSRCommHandle
  *--------------------------------------------------------------------------*/
@@ -876,6 +891,11 @@ hypre_ParVector *hypre_ParVectorCloneShallow ( hypre_ParVector *x );
 HYPRE_Int hypre_ParVectorScale ( HYPRE_Complex alpha , hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha , hypre_ParVector *x , hypre_ParVector *y );
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x , hypre_ParVector *y );
+HYPRE_Int hypre_ParMultiVectorInnerProd ( hypre_ParVector *x , hypre_ParVector *y , HYPRE_Real *result );
+HYPRE_Int hypre_ParMultiVectorAxpy ( HYPRE_Complex *alpha , hypre_ParVector *x , hypre_ParVector *y );
+HYPRE_Int hypre_ParMultiVectorScale ( HYPRE_Complex *alpha , hypre_ParVector *y );
+HYPRE_Int hypre_ParMultiVectorGetColumn ( hypre_ParVector *x , HYPRE_Int j , hypre_ParVector *y );
+HYPRE_Int hypre_ParMultiVectorSetColumn ( hypre_ParVector *x , HYPRE_Int j , hypre_ParVector *y );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm , hypre_Vector *v , HYPRE_Int *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
 HYPRE_Int hypre_ParVectorPrintIJ ( hypre_ParVector *vector , HYPRE_Int base_j , const char *filename );
@@ -14,6 +14,85 @@
 
 /*==========================================================================*/
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgCountExchange
+ *
+ * Charges one exchange of the given job to the statistics of comm_pkg and
+ * its message volume to the innermost profiler region.  Jobs exchanging
+ * MPI datatypes are counted without bytes.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRCommPkgCountExchange( HYPRE_Int            job,
+                                  hypre_ParCSRCommPkg *comm_pkg )
+{
+   HYPRE_Int  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int  num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int  num_msgs  = num_sends;
+   HYPRE_Real bytes     = 0.0;
+
+   switch (job)
+   {
+      case  1:
+         bytes = (HYPRE_Real) hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) *
+            sizeof(HYPRE_Complex);
+         break;
+      case  2:
+         num_msgs = num_recvs;
+         bytes = (HYPRE_Real) hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) *
+            sizeof(HYPRE_Complex);
+         break;
+      case 11:
+         bytes = (HYPRE_Real) hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) *
+            sizeof(HYPRE_Int);
+         break;
+      case 12:
+         num_msgs = num_recvs;
+         bytes = (HYPRE_Real) hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) *
+            sizeof(HYPRE_Int);
+         break;
+   }
+
+   if (hypre_comm_stats_active)
+   {
+      hypre_ParCSRCommPkgNumExchanges(comm_pkg) ++;
+      hypre_ParCSRCommPkgNumMessages(comm_pkg) += num_msgs;
+      hypre_ParCSRCommPkgNumBytes(comm_pkg)    += bytes;
+   }
+   HYPRE_PROFILE_COUNT(0.0, 0.0, bytes);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgWaitall
+ *
+ * MPI_Waitall that charges the time blocked to the statistics of comm_pkg
+ * (if it is not NULL) and to a "comm.wait" profiler region.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRCommPkgWaitall( hypre_ParCSRCommPkg *comm_pkg,
+                            HYPRE_Int            num_requests,
+                            hypre_MPI_Request   *requests,
+                            hypre_MPI_Status    *status )
+{
+   HYPRE_Real  wait_start = 0.0;
+   HYPRE_Int   ret;
+
+   if (hypre_comm_stats_active)
+   {
+      wait_start = hypre_MPI_Wtime();
+   }
+   HYPRE_PROFILE_BEGIN("comm.wait", -1);
+   ret = hypre_MPI_Waitall(num_requests, requests, status);
+   HYPRE_PROFILE_END("comm.wait");
+   if (hypre_comm_stats_active && comm_pkg)
+   {
+      hypre_ParCSRCommPkgWaitTime(comm_pkg) += hypre_MPI_Wtime() - wait_start;
+   }
+
+   return ret;
+}
+
 #ifdef HYPRE_USING_PERSISTENT_COMM
 static CommPkgJobType getJobTypeOf(HYPRE_Int job)
 {
@@ -65,6 +144,8 @@ hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job,
 
    hypre_ParCSRCommHandleNumRequests(comm_handle) = num_requests;
    hypre_ParCSRCommHandleRequests(comm_handle)    = requests;
+   comm_handle->job      = job;
+   comm_handle->comm_pkg = comm_pkg;
 
    switch (job_type)
    {
@@ -232,6 +313,7 @@ void hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *co
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,"MPI error\n");
          /*hypre_printf("MPI error %d in %s (%s, line %u)\n", ret, __FUNCTION__, __FILE__, __LINE__);*/
       }
+      hypre_ParCSRCommPkgCountExchange(comm_handle->job, comm_handle->comm_pkg);
    }
 }
 
@@ -239,9 +321,10 @@ void hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *com
 {
    if (hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
    {
-      HYPRE_Int ret = hypre_MPI_Waitall(hypre_ParCSRCommHandleNumRequests(comm_handle),
-                                        hypre_ParCSRCommHandleRequests(comm_handle),
-                                        hypre_MPI_STATUSES_IGNORE);
+      HYPRE_Int ret = hypre_ParCSRCommPkgWaitall(comm_handle->comm_pkg,
+                                                 hypre_ParCSRCommHandleNumRequests(comm_handle),
+                                                 hypre_ParCSRCommHandleRequests(comm_handle),
+                                                 hypre_MPI_STATUSES_IGNORE);
       if (hypre_MPI_SUCCESS != ret)
       {
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,"MPI error\n");
@@ -392,6 +475,12 @@ hypre_ParCSRCommHandleCreate ( HYPRE_Int            job,
          break;
       }
    }
+
+   if (hypre_comm_stats_active || hypre_profile_active)
+   {
+      hypre_ParCSRCommPkgCountExchange(job, comm_pkg);
+   }
+
    /*--------------------------------------------------------------------
     * set up comm_handle and return
     *--------------------------------------------------------------------*/
@@ -417,8 +506,9 @@ hypre_ParCSRCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
    {
       status0 = hypre_CTAlloc(hypre_MPI_Status, 
                               hypre_ParCSRCommHandleNumRequests(comm_handle), HYPRE_MEMORY_HOST);
-      hypre_MPI_Waitall(hypre_ParCSRCommHandleNumRequests(comm_handle),
-                        hypre_ParCSRCommHandleRequests(comm_handle), status0);
+      hypre_ParCSRCommPkgWaitall(hypre_ParCSRCommHandleCommPkg(comm_handle),
+                                 hypre_ParCSRCommHandleNumRequests(comm_handle),
+                                 hypre_ParCSRCommHandleRequests(comm_handle), status0);
       hypre_TFree(status0, HYPRE_MEMORY_HOST);
    }
 
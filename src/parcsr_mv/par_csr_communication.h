@@ -42,10 +42,14 @@ typedef struct
 
    HYPRE_Int own_send_data, own_recv_data;
 
+   /* job and package the requests were set up for (for the statistics) */
+   HYPRE_Int                     job;
+   struct hypre_ParCSRCommPkg_struct *comm_pkg;
+
 } hypre_ParCSRPersistentCommHandle;
 #endif
 
-typedef struct
+typedef struct hypre_ParCSRCommPkg_struct
 {
    MPI_Comm               comm;
 
@@ -65,6 +69,12 @@ typedef struct
 #ifdef HYPRE_USING_PERSISTENT_COMM
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
 #endif
+
+   /* statistics, accumulated while hypre_comm_stats_active is set */
+   HYPRE_Int                    num_exchanges;
+   HYPRE_Int                    num_messages;
+   HYPRE_Real                   num_bytes;
+   HYPRE_Real                   wait_time;
 } hypre_ParCSRCommPkg;
 
 /*--------------------------------------------------------------------------
@@ -108,6 +118,11 @@ typedef struct
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)  (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i) (comm_pkg -> recv_mpi_types[i])
 
+#define hypre_ParCSRCommPkgNumExchanges(comm_pkg)  (comm_pkg -> num_exchanges)
+#define hypre_ParCSRCommPkgNumMessages(comm_pkg)   (comm_pkg -> num_messages)
+#define hypre_ParCSRCommPkgNumBytes(comm_pkg)      (comm_pkg -> num_bytes)
+#define hypre_ParCSRCommPkgWaitTime(comm_pkg)      (comm_pkg -> wait_time)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_ParCSRCommHandle
  *--------------------------------------------------------------------------*/
@@ -1497,6 +1497,13 @@ void hypre_ParCSRMatrixExtractBExt_Arrays_Overlap(
       row_map_comm_handle = NULL;
    }
 
+   /* the handles outlive tmp_comm_pkg */
+   hypre_ParCSRCommHandleCommPkg((*comm_handle_idx)) = NULL;
+   if (data)
+   {
+      hypre_ParCSRCommHandleCommPkg((*comm_handle_data)) = NULL;
+   }
+
    hypre_TFree(jdata_send_map_starts, HYPRE_MEMORY_HOST);
    hypre_TFree(jdata_recv_vec_starts, HYPRE_MEMORY_HOST);
    hypre_TFree(tmp_comm_pkg, HYPRE_MEMORY_HOST);
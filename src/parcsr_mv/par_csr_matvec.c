@@ -25,6 +25,32 @@
 //}
 //#endif
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecProfileCount
+ *
+ * Charge the flops and the memory traffic of a product with A to the
+ * current profiling region, if profiling is active.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatrixMatvecProfileCount( hypre_ParCSRMatrix *A,
+                                      HYPRE_Int           num_vectors )
+{
+   hypre_CSRMatrix *diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real       nnz, vec_size;
+
+   nnz = (HYPRE_Real) hypre_CSRMatrixNumNonzeros(diag) +
+         (HYPRE_Real) hypre_CSRMatrixNumNonzeros(offd);
+   vec_size = 2.0 * hypre_CSRMatrixNumRows(diag) + hypre_CSRMatrixNumCols(diag) +
+              hypre_CSRMatrixNumCols(offd);
+
+   HYPRE_PROFILE_COUNT(2.0 * num_vectors * nnz,
+                       nnz * (sizeof(HYPRE_Complex) + sizeof(HYPRE_Int)) +
+                       2.0 * hypre_CSRMatrixNumRows(diag) * sizeof(HYPRE_Int) +
+                       num_vectors * vec_size * sizeof(HYPRE_Complex), 0.0);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -87,6 +113,8 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    hypre_assert( hypre_VectorNumVectors(b_local)==num_vectors );
    hypre_assert( hypre_VectorNumVectors(y_local)==num_vectors );
 
+   hypre_ParCSRMatrixMatvecProfileCount(A, num_vectors);
+
    if ( num_vectors==1 )
       x_tmp = hypre_SeqVectorCreate( num_cols_offd );
    else
@@ -409,6 +437,8 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    /*-----------------------------------------------------------------------
     *-----------------------------------------------------------------------*/
 
+   hypre_ParCSRMatrixMatvecProfileCount(A, num_vectors);
+
    if ( num_vectors==1 )
    {
       y_tmp = hypre_SeqVectorCreate(num_cols_offd);
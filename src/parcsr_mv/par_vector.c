@@ -433,6 +433,92 @@ hypre_ParVectorInnerProd( hypre_ParVector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParMultiVectorInnerProd
+ *
+ * Computes result[j] = <x_j, y_j> for all columns of the multivectors x and
+ * y using a single global reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMultiVectorInnerProd( hypre_ParVector *x,
+                               hypre_ParVector *y,
+                               HYPRE_Real      *result )
+{
+   MPI_Comm      comm        = hypre_ParVectorComm(x);
+   hypre_Vector *x_local     = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local     = hypre_ParVectorLocalVector(y);
+   HYPRE_Int     num_vectors = hypre_VectorNumVectors(x_local);
+
+   HYPRE_Real   *local_result;
+
+   local_result = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   hypre_SeqMultiVectorInnerProd(x_local, y_local, local_result);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, num_vectors, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMultiVectorAxpy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMultiVectorAxpy( HYPRE_Complex   *alpha,
+                          hypre_ParVector *x,
+                          hypre_ParVector *y )
+{
+   return hypre_SeqMultiVectorAxpy(alpha, hypre_ParVectorLocalVector(x),
+                                   hypre_ParVectorLocalVector(y));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMultiVectorScale
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMultiVectorScale( HYPRE_Complex   *alpha,
+                           hypre_ParVector *y )
+{
+   return hypre_SeqMultiVectorScale(alpha, hypre_ParVectorLocalVector(y));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMultiVectorGetColumn
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMultiVectorGetColumn( hypre_ParVector *x,
+                               HYPRE_Int        j,
+                               hypre_ParVector *y )
+{
+   return hypre_SeqMultiVectorGetColumn(hypre_ParVectorLocalVector(x), j,
+                                        hypre_ParVectorLocalVector(y));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMultiVectorSetColumn
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMultiVectorSetColumn( hypre_ParVector *x,
+                               HYPRE_Int        j,
+                               hypre_ParVector *y )
+{
+   return hypre_SeqMultiVectorSetColumn(hypre_ParVectorLocalVector(x), j,
+                                        hypre_ParVectorLocalVector(y));
+}
+
 /*--------------------------------------------------------------------------
  * hypre_VectorToParVector:
  * generates a ParVector from a Vector on proc 0 and distributes the pieces
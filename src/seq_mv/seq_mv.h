@@ -380,6 +380,11 @@ HYPRE_Int hypre_SeqVectorScale ( HYPRE_Complex alpha , hypre_Vector *y );
 HYPRE_Int hypre_SeqVectorAxpy ( HYPRE_Complex alpha , hypre_Vector *x , hypre_Vector *y );
 HYPRE_Real hypre_SeqVectorInnerProd ( hypre_Vector *x , hypre_Vector *y );
 HYPRE_Complex hypre_VectorSumElts ( hypre_Vector *vector );
+HYPRE_Int hypre_SeqMultiVectorInnerProd ( hypre_Vector *x , hypre_Vector *y , HYPRE_Real *result );
+HYPRE_Int hypre_SeqMultiVectorAxpy ( HYPRE_Complex *alpha , hypre_Vector *x , hypre_Vector *y );
+HYPRE_Int hypre_SeqMultiVectorScale ( HYPRE_Complex *alpha , hypre_Vector *y );
+HYPRE_Int hypre_SeqMultiVectorGetColumn ( hypre_Vector *x , HYPRE_Int j , hypre_Vector *y );
+HYPRE_Int hypre_SeqMultiVectorSetColumn ( hypre_Vector *x , HYPRE_Int j , hypre_Vector *y );
 #ifdef HYPRE_USE_MANAGED
 HYPRE_Complex hypre_VectorSumAbsElts ( hypre_Vector *vector );
 HYPRE_Int hypre_SeqVectorCopyDevice ( hypre_Vector *x , hypre_Vector *y );
@@ -619,6 +619,204 @@ HYPRE_Complex hypre_VectorSumElts( hypre_Vector *vector )
    return sum;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SeqMultiVectorInnerProd:
+ * Computes the inner products of corresponding columns of the multivectors
+ * x and y, result[j] = <x_j, y_j>, one column at a time.  The local results
+ * of all columns are then reduced together by hypre_ParMultiVectorInnerProd.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqMultiVectorInnerProd( hypre_Vector *x,
+                               hypre_Vector *y,
+                               HYPRE_Real   *result )
+{
+   HYPRE_Complex *x_data      = hypre_VectorData(x);
+   HYPRE_Complex *y_data      = hypre_VectorData(y);
+   HYPRE_Int      size        = hypre_VectorSize(x);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int      x_vecstride = hypre_VectorVectorStride(x);
+   HYPRE_Int      x_idxstride = hypre_VectorIndexStride(x);
+   HYPRE_Int      y_vecstride = hypre_VectorVectorStride(y);
+   HYPRE_Int      y_idxstride = hypre_VectorIndexStride(y);
+
+   HYPRE_Int      i, j;
+   HYPRE_Real     res;
+
+   hypre_assert( hypre_VectorNumVectors(y) == num_vectors );
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+   for (j = 0; j < num_vectors; j++)
+   {
+      res = 0.0;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) reduction(+:res) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         res += hypre_conj(y_data[j*y_vecstride + i*y_idxstride]) *
+                x_data[j*x_vecstride + i*x_idxstride];
+      }
+      result[j] = res;
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqMultiVectorAxpy:
+ * y_j = alpha[j] * x_j + y_j for each column j.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqMultiVectorAxpy( HYPRE_Complex *alpha,
+                          hypre_Vector  *x,
+                          hypre_Vector  *y )
+{
+   HYPRE_Complex *x_data      = hypre_VectorData(x);
+   HYPRE_Complex *y_data      = hypre_VectorData(y);
+   HYPRE_Int      size        = hypre_VectorSize(x);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int      x_vecstride = hypre_VectorVectorStride(x);
+   HYPRE_Int      x_idxstride = hypre_VectorIndexStride(x);
+   HYPRE_Int      y_vecstride = hypre_VectorVectorStride(y);
+   HYPRE_Int      y_idxstride = hypre_VectorIndexStride(y);
+
+   HYPRE_Int      i, j;
+
+   hypre_assert( hypre_VectorNumVectors(y) == num_vectors );
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      for (j = 0; j < num_vectors; j++)
+      {
+         y_data[j*y_vecstride + i*y_idxstride] +=
+            alpha[j] * x_data[j*x_vecstride + i*x_idxstride];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqMultiVectorScale:
+ * y_j = alpha[j] * y_j for each column j.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqMultiVectorScale( HYPRE_Complex *alpha,
+                           hypre_Vector  *y )
+{
+   HYPRE_Complex *y_data      = hypre_VectorData(y);
+   HYPRE_Int      size        = hypre_VectorSize(y);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(y);
+   HYPRE_Int      y_vecstride = hypre_VectorVectorStride(y);
+   HYPRE_Int      y_idxstride = hypre_VectorIndexStride(y);
+
+   HYPRE_Int      i, j;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      for (j = 0; j < num_vectors; j++)
+      {
+         y_data[j*y_vecstride + i*y_idxstride] *= alpha[j];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqMultiVectorGetColumn:
+ * Copies column j of the multivector x into the single vector y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqMultiVectorGetColumn( hypre_Vector *x,
+                               HYPRE_Int     j,
+                               hypre_Vector *y )
+{
+   HYPRE_Complex *x_data      = hypre_VectorData(x);
+   HYPRE_Complex *y_data      = hypre_VectorData(y);
+   HYPRE_Int      size        = hypre_VectorSize(x);
+   HYPRE_Int      x_vecstride = hypre_VectorVectorStride(x);
+   HYPRE_Int      x_idxstride = hypre_VectorIndexStride(x);
+
+   HYPRE_Int      i;
+
+   hypre_assert( hypre_VectorSize(y) == size );
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      y_data[i] = x_data[j*x_vecstride + i*x_idxstride];
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqMultiVectorSetColumn:
+ * Copies the single vector y into column j of the multivector x.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqMultiVectorSetColumn( hypre_Vector *x,
+                               HYPRE_Int     j,
+                               hypre_Vector *y )
+{
+   HYPRE_Complex *x_data      = hypre_VectorData(x);
+   HYPRE_Complex *y_data      = hypre_VectorData(y);
+   HYPRE_Int      size        = hypre_VectorSize(x);
+   HYPRE_Int      x_vecstride = hypre_VectorVectorStride(x);
+   HYPRE_Int      x_idxstride = hypre_VectorIndexStride(x);
+
+   HYPRE_Int      i;
+
+   hypre_assert( hypre_VectorSize(y) == size );
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      x_data[j*x_vecstride + i*x_idxstride] = y_data[i];
+   }
+
+   return hypre_error_flag;
+}
+
 #ifdef HYPRE_USE_MANAGED
 /* Sums of the absolute value of the elements for comparison to cublas device side routine */
 HYPRE_Complex hypre_VectorSumAbsElts( hypre_Vector *vector )
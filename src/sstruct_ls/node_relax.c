@@ -16,7 +16,7 @@
 #include "gselim.h"
 
 /* TODO consider adding it to semistruct header files */
-#define HYPRE_MAXVARS 4
+#define HYPRE_MAXVARS 8
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
@@ -58,8 +58,15 @@ typedef struct
    HYPRE_Real            *x_loc;
    */
 
+   /* inverses of the diagonal blocks, computed in setup.  Entry (vi,vj) of
+    * the inverse on grid box i is stored contiguously at
+    * Ainv[Ainv_offsets[i] + (vi*nvars+vj)*volume(box i)] */
+   HYPRE_Real           *Ainv;
+   HYPRE_Int            *Ainv_offsets;
+
    /* pointers for vector and matrix data */    
    HYPRE_Real          **Ap;
+   HYPRE_Real          **Ainvp;
    HYPRE_Real          **bp;
    HYPRE_Real          **xp;
    HYPRE_Real          **tp;
@@ -105,7 +112,10 @@ hypre_NodeRelaxCreate( MPI_Comm  comm )
    (relax_data -> A_loc)            = NULL;
    (relax_data -> x_loc)            = NULL;
    */
+   (relax_data -> Ainv)             = NULL;
+   (relax_data -> Ainv_offsets)     = NULL;
    (relax_data -> Ap)               = NULL;
+   (relax_data -> Ainvp)            = NULL;
    (relax_data -> bp)               = NULL;
    (relax_data -> xp)               = NULL;
    (relax_data -> tp)               = NULL;
@@ -163,6 +173,9 @@ hypre_NodeRelaxDestroy( void *relax_vdata )
       hypre_TFree(relax_data -> xp, HYPRE_MEMORY_SHARED);
       hypre_TFree(relax_data -> tp, HYPRE_MEMORY_SHARED);
       hypre_TFree(relax_data -> Ap, HYPRE_MEMORY_SHARED);
+      hypre_TFree(relax_data -> Ainvp, HYPRE_MEMORY_SHARED);
+      hypre_TFree(relax_data -> Ainv, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(relax_data -> Ainv_offsets, HYPRE_MEMORY_HOST);
       for (vi = 0; vi < nvars; vi++)
       {
          hypre_TFree((relax_data -> diag_rank)[vi], HYPRE_MEMORY_HOST);
@@ -201,9 +214,12 @@ hypre_NodeRelaxSetup(  void                 *relax_vdata,
    HYPRE_Real            *x_loc;
    */
    HYPRE_Real           **Ap;
+   HYPRE_Real           **Ainvp;
    HYPRE_Real           **bp;
    HYPRE_Real           **xp;
    HYPRE_Real           **tp;
+   HYPRE_Real            *Ainv;
+   HYPRE_Int             *Ainv_offsets;
 
    hypre_ComputeInfo     *compute_info;
    hypre_ComputePkg     **compute_pkgs;
@@ -213,8 +229,13 @@ hypre_NodeRelaxSetup(  void                 *relax_vdata,
    hypre_Index            diag_index;
    hypre_IndexRef         stride;
    hypre_IndexRef         index;
+   hypre_IndexRef         start;
+   hypre_Index            unit_stride;
+   hypre_Index            loop_size;
                        
    hypre_StructGrid      *sgrid;
+   hypre_BoxArray        *grid_boxes;
+   hypre_Box             *A_data_box;
 
    hypre_StructStencil   *sstencil;
    hypre_Index           *sstencil_shape;
@@ -297,13 +318,94 @@ hypre_NodeRelaxSetup(  void                 *relax_vdata,
    xp = hypre_TAlloc(HYPRE_Real *, nvars,       HYPRE_MEMORY_SHARED);
    tp = hypre_TAlloc(HYPRE_Real *, nvars,       HYPRE_MEMORY_SHARED);
    Ap = hypre_TAlloc(HYPRE_Real *, nvars*nvars, HYPRE_MEMORY_SHARED);
+   Ainvp = hypre_TAlloc(HYPRE_Real *, nvars*nvars, HYPRE_MEMORY_SHARED);
+
+   sgrid = hypre_StructMatrixGrid(hypre_SStructPMatrixSMatrix(A, 0, 0));
+   dim = hypre_StructStencilNDim(hypre_SStructPMatrixSStencil(A, 0, 0));
 
    /*----------------------------------------------------------
-    * Set up the compute packages for each nodeset
+    * Compute the inverses of the diagonal blocks.  Column vj of
+    * the inverse is the result of applying gselim to the unit
+    * vector e_vj, so the relaxation sweeps below reproduce the
+    * gselim solves (including the handling of zero pivots) with
+    * a single small matrix-vector product per node.
     *----------------------------------------------------------*/
 
-   sgrid = hypre_StructMatrixGrid(hypre_SStructPMatrixSMatrix(A, 0, 0));
-   dim = hypre_StructStencilNDim(hypre_SStructPMatrixSStencil(A, 0, 0));
+   grid_boxes = hypre_StructGridBoxes(sgrid);
+   Ainv_offsets = hypre_CTAlloc(HYPRE_Int, hypre_BoxArraySize(grid_boxes) + 1,
+                                HYPRE_MEMORY_HOST);
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      box = hypre_BoxArrayBox(grid_boxes, i);
+      Ainv_offsets[i+1] = Ainv_offsets[i] + nvars*nvars*hypre_BoxVolume(box);
+   }
+   Ainv = hypre_TAlloc(HYPRE_Real, Ainv_offsets[hypre_BoxArraySize(grid_boxes)],
+                       HYPRE_MEMORY_DEVICE);
+
+   hypre_SetIndex3(unit_stride, 1, 1, 1);
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      box = hypre_BoxArrayBox(grid_boxes, i);
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(
+                                     hypre_SStructPMatrixSMatrix(A,0,0)), i);
+      for (vi = 0; vi < nvars; vi++)
+      {
+         for (vj = 0; vj < nvars; vj++)
+         {
+            if (diag_rank[vi][vj] > -1)
+            {
+               Ap[vi*nvars+vj] = hypre_StructMatrixBoxData( hypre_SStructPMatrixSMatrix(A,vi,vj),
+                                                            i, diag_rank[vi][vj] );
+            }
+            else
+            {
+               Ap[vi*nvars+vj] = NULL;
+            }
+            Ainvp[vi*nvars+vj] = Ainv + Ainv_offsets[i] +
+                                 (vi*nvars+vj)*hypre_BoxVolume(box);
+         }
+      }
+
+      start = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+
+#undef DEVICE_VAR
+#define DEVICE_VAR is_device_ptr(Ap,Ainvp)
+      hypre_BoxLoop2Begin(ndim, loop_size,
+                          A_data_box, start, unit_stride, Ai,
+                          box,        start, unit_stride, Ii);
+      {
+         HYPRE_Int vi, vj, vk, err;
+         HYPRE_Real A_loc[HYPRE_MAXVARS * HYPRE_MAXVARS];
+         HYPRE_Real x_loc[HYPRE_MAXVARS];
+
+         for (vk = 0; vk < nvars; vk++)
+         {
+            for (vi = 0; vi < nvars; vi++)
+            {
+               x_loc[vi] = (vi == vk) ? 1.0 : 0.0;
+               for (vj = 0; vj < nvars; vj++)
+               {
+                  HYPRE_Real *Apij = Ap[vi*nvars+vj];
+                  A_loc[vi*nvars+vj] = Apij ? Apij[Ai] : 0.0;
+               }
+            }
+            hypre_gselim(A_loc, x_loc, nvars, err);
+            for (vi = 0; vi < nvars; vi++)
+            {
+               HYPRE_Real *Ainvpik = Ainvp[vi*nvars+vk];
+               Ainvpik[Ii] = x_loc[vi];
+            }
+         }
+      }
+      hypre_BoxLoop2End(Ai, Ii);
+#undef DEVICE_VAR
+#define DEVICE_VAR 
+   }
+
+   /*----------------------------------------------------------
+    * Set up the compute packages for each nodeset
+    *----------------------------------------------------------*/
 
    compute_pkgs = hypre_CTAlloc(hypre_ComputePkg *, num_nodesets, 
                                 HYPRE_MEMORY_HOST);
@@ -506,7 +608,10 @@ hypre_NodeRelaxSetup(  void                 *relax_vdata,
    (relax_data -> A_loc)     = A_loc;
    (relax_data -> x_loc)     = x_loc;
    */
+   (relax_data -> Ainv)  = Ainv;
+   (relax_data -> Ainv_offsets) = Ainv_offsets;
    (relax_data -> Ap)    = Ap;
+   (relax_data -> Ainvp) = Ainvp;
    (relax_data -> bp)    = bp;
    (relax_data -> tp)    = tp;
    (relax_data -> xp)    = xp;
@@ -527,8 +632,8 @@ hypre_NodeRelaxSetup(  void                 *relax_vdata,
       frac  *= hypre_IndexZ(stride);
       scale += (nodeset_sizes[p] / frac);
    }
-   /* REALLY Rough Estimate = num_nodes * nvar^3 */
-   (relax_data -> flops) = scale * nvars * nvars * nvars *
+   /* REALLY Rough Estimate = num_nodes * nvar^2 */
+   (relax_data -> flops) = scale * nvars * nvars *
                            hypre_StructVectorGlobalSize(
                                  hypre_SStructPVectorSVector(x,0) );
 
@@ -570,19 +675,25 @@ hypre_NodeRelax(  void                 *relax_vdata,
    hypre_Box             *b_data_box;
    hypre_Box             *x_data_box;
    hypre_Box             *t_data_box;
+   hypre_Box             *I_data_box;
 
    /*
    HYPRE_Real            *tA_loc = (relax_data -> A_loc);
    HYPRE_Real            *tx_loc = (relax_data -> x_loc);
    */
 
+   HYPRE_Real            *Ainv = (relax_data -> Ainv);
+   HYPRE_Int             *Ainv_offsets = (relax_data -> Ainv_offsets);
+
    HYPRE_Real           **Ap = (relax_data -> Ap);
+   HYPRE_Real           **Ainvp = (relax_data -> Ainvp);
    HYPRE_Real           **bp = (relax_data -> bp);
    HYPRE_Real           **xp = (relax_data -> xp);
    HYPRE_Real           **tp = (relax_data -> tp);
 
    hypre_StructMatrix    *A_block;
    hypre_StructVector    *x_block;
+   hypre_BoxArray        *grid_boxes;
 
    hypre_IndexRef         stride;
    hypre_IndexRef         start;
@@ -635,6 +746,8 @@ hypre_NodeRelax(  void                 *relax_vdata,
 
    nvars = hypre_SStructPMatrixNVars(relax_data -> A);
    ndim = hypre_SStructPMatrixNDim(relax_data -> A);
+   grid_boxes = hypre_StructGridBoxes(
+      hypre_StructMatrixGrid(hypre_SStructPMatrixSMatrix(A,0,0)));
 
    if (zero_guess)
    {
@@ -667,8 +780,7 @@ hypre_NodeRelax(  void                 *relax_vdata,
          {
             compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
 
-            A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(
-                                           hypre_SStructPMatrixSMatrix(A,0,0)), i);
+            I_data_box = hypre_BoxArrayBox(grid_boxes, i);
             b_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(
                                            hypre_SStructPVectorSVector(b,0)), i);
             x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(
@@ -678,15 +790,8 @@ hypre_NodeRelax(  void                 *relax_vdata,
             {
                for (vj = 0; vj < nvars; vj++)
                {
-                  if (hypre_SStructPMatrixSMatrix(A,vi,vj) != NULL)
-                  {
-                     Ap[vi*nvars+vj] = hypre_StructMatrixBoxData( hypre_SStructPMatrixSMatrix(A,vi,vj),
-                                                                  i, diag_rank[vi][vj] );
-                  }
-                  else
-                  {
-                     Ap[vi*nvars+vj] = NULL;
-                  }
+                  Ainvp[vi*nvars+vj] = Ainv + Ainv_offsets[i] +
+                                       (vi*nvars+vj)*hypre_BoxVolume(I_data_box);
                }
                bp[vi] = hypre_StructVectorBoxData( hypre_SStructPVectorSVector(b,vi), i );
                xp[vi] = hypre_StructVectorBoxData( hypre_SStructPVectorSVector(x,vi), i );
@@ -700,46 +805,40 @@ hypre_NodeRelax(  void                 *relax_vdata,
                hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
 #undef DEVICE_VAR
-#define DEVICE_VAR is_device_ptr(bp,Ap,xp)
+#define DEVICE_VAR is_device_ptr(bp,Ainvp,xp)
                hypre_BoxLoop3Begin(ndim, loop_size,
-                                   A_data_box, start, stride, Ai,
+                                   I_data_box, start, stride, Ii,
                                    b_data_box, start, stride, bi,
                                    x_data_box, start, stride, xi);
                {
-                  HYPRE_Int vi, vj, err;
-                  //HYPRE_Real *A_loc = tA_loc + hypre_BoxLoopBlock() * nvars * nvars;
-                  //HYPRE_Real *x_loc = tx_loc + hypre_BoxLoopBlock() * nvars;
-                  HYPRE_Real A_loc[HYPRE_MAXVARS * HYPRE_MAXVARS];
+                  HYPRE_Int vi, vj;
                   HYPRE_Real x_loc[HYPRE_MAXVARS];
+
                   /*------------------------------------------------
-                   * Copy rhs and matrix for diagonal coupling
-                   * (intra-nodal) into local storage.
+                   * Copy rhs into local storage.
                    *----------------------------------------------*/
                   for (vi = 0; vi < nvars; vi++)
                   {
                      HYPRE_Real *bpi = bp[vi];
                      x_loc[vi] = bpi[bi];
-                     for (vj = 0; vj < nvars; vj++)
-                     {
-                        HYPRE_Real *Apij = Ap[vi*nvars+vj];
-                        A_loc[vi*nvars+vj] = Apij ? Apij[Ai] : 0.0;
-                     }
                   }
 
                   /*------------------------------------------------
-                   * Invert intra-nodal coupling 
-                   *----------------------------------------------*/
-		  hypre_gselim(A_loc, x_loc, nvars, err);
-                  /*------------------------------------------------
-                   * Copy solution from local storage.
+                   * Apply the inverse of the intra-nodal coupling 
                    *----------------------------------------------*/
                   for (vi = 0; vi < nvars; vi++)
                   {
                      HYPRE_Real *xpi = xp[vi];
-                     xpi[xi] = x_loc[vi];
+                     HYPRE_Real  sum = 0.0;
+                     for (vj = 0; vj < nvars; vj++)
+                     {
+                        HYPRE_Real *Ainvpij = Ainvp[vi*nvars+vj];
+                        sum += Ainvpij[Ii] * x_loc[vj];
+                     }
+                     xpi[xi] = sum;
                   }
                }
-               hypre_BoxLoop3End(Ai, bi, xi);
+               hypre_BoxLoop3End(Ii, bi, xi);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
             }
@@ -808,6 +907,7 @@ hypre_NodeRelax(  void                 *relax_vdata,
                                             hypre_SStructPVectorSVector(x,0)), i );
             t_data_box = hypre_BoxArrayBox( hypre_StructVectorDataSpace(
                                             hypre_SStructPVectorSVector(t,0)), i );
+            I_data_box = hypre_BoxArrayBox(grid_boxes, i);
 
             for (vi = 0; vi < nvars; vi++)
             {
@@ -885,62 +985,45 @@ hypre_NodeRelax(  void                 *relax_vdata,
                {
                   for (vj = 0; vj < nvars; vj++)
                   {
-                     if (hypre_SStructPMatrixSMatrix(A,vi,vj) != NULL)
-                     {
-                        Ap[vi*nvars+vj] = hypre_StructMatrixBoxData( hypre_SStructPMatrixSMatrix(A,vi,vj),
-                                                                     i, diag_rank[vi][vj]);
-                     }
-                     else
-                     {
-                        Ap[vi*nvars+vj] = NULL;
-                     }
+                     Ainvp[vi*nvars+vj] = Ainv + Ainv_offsets[i] +
+                                          (vi*nvars+vj)*hypre_BoxVolume(I_data_box);
                   }
                }
 
 #undef DEVICE_VAR
-#define DEVICE_VAR is_device_ptr(tp,Ap)
+#define DEVICE_VAR is_device_ptr(tp,Ainvp)
                hypre_BoxLoop2Begin(ndim, loop_size,
-                                   A_data_box, start, stride, Ai,
+                                   I_data_box, start, stride, Ii,
                                    t_data_box, start, stride, ti);
                {
-                  HYPRE_Int vi, vj, err;
-                  /*
-                  HYPRE_Real *A_loc = tA_loc + hypre_BoxLoopBlock() * nvars * nvars;
-                  HYPRE_Real *x_loc = tx_loc + hypre_BoxLoopBlock() * nvars;
-                  */
-                  HYPRE_Real A_loc[HYPRE_MAXVARS * HYPRE_MAXVARS];
+                  HYPRE_Int vi, vj;
                   HYPRE_Real x_loc[HYPRE_MAXVARS];
                   
                   /*------------------------------------------------
-                   * Copy rhs and matrix for diagonal coupling
-                   * (intra-nodal) into local storage.
+                   * Copy rhs into local storage.
                    *----------------------------------------------*/
                   for (vi = 0; vi < nvars; vi++)
                   {
                      HYPRE_Real *tpi = tp[vi];
                      x_loc[vi] = tpi[ti];
-                     for (vj = 0; vj < nvars; vj++)
-                     {
-                        HYPRE_Real *Apij = Ap[vi*nvars+vj];
-                        A_loc[vi*nvars+vj] = Apij ? Apij[Ai] : 0.0;
-                     }
                   }
 
                   /*------------------------------------------------
-                   * Invert intra-nodal coupling
-                   *----------------------------------------------*/
-		  hypre_gselim(A_loc, x_loc, nvars, err);
-                  /*------------------------------------------------
-                   * Copy solution from local storage.
+                   * Apply the inverse of the intra-nodal coupling
                    *----------------------------------------------*/
                   for (vi = 0; vi < nvars; vi++)
                   {
                      HYPRE_Real *tpi = tp[vi];
-                     tpi[ti] = x_loc[vi];
+                     HYPRE_Real  sum = 0.0;
+                     for (vj = 0; vj < nvars; vj++)
+                     {
+                        HYPRE_Real *Ainvpij = Ainvp[vi*nvars+vj];
+                        sum += Ainvpij[Ii] * x_loc[vj];
+                     }
+                     tpi[ti] = sum;
                   }
-
                }
-               hypre_BoxLoop2End(Ai, ti);
+               hypre_BoxLoop2End(Ii, ti);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
             }
@@ -1440,10 +1440,8 @@ hypre_SStructGridFindBoxManEntry( hypre_SStructGrid  *grid,
 {
    HYPRE_Int nentries;
 
-   hypre_BoxManEntry **entries;
-   
-   hypre_BoxManIntersect (  hypre_SStructGridBoxManager(grid, part, var),
-                            index, index, &entries, &nentries);
+   hypre_BoxManFindEntry(hypre_SStructGridBoxManager(grid, part, var),
+                         index, entry_ptr, &nentries);
 
    /* we should only get a single entry returned */
    if (nentries > 1)
@@ -1451,17 +1449,6 @@ hypre_SStructGridFindBoxManEntry( hypre_SStructGrid  *grid,
       hypre_error(HYPRE_ERROR_GENERIC);
       *entry_ptr = NULL;
    }
-   else if (nentries == 0)
-   {
-      *entry_ptr = NULL;
-   }
-   else
-   {
-      *entry_ptr = entries[0];
-   }
-
-   /* remove the entries array (NULL or allocated in the intersect routine) */
-   hypre_TFree(entries, HYPRE_MEMORY_HOST); 
    
    return hypre_error_flag;
 }
@@ -1478,28 +1465,15 @@ hypre_SStructGridFindNborBoxManEntry( hypre_SStructGrid  *grid,
 {
    HYPRE_Int nentries;
 
-   hypre_BoxManEntry **entries;
-
-   hypre_BoxManIntersect (  hypre_SStructGridNborBoxManager(grid, part, var),
-                            index, index, &entries, &nentries);
+   hypre_BoxManFindEntry(hypre_SStructGridNborBoxManager(grid, part, var),
+                         index, entry_ptr, &nentries);
 
    /* we should only get a single entry returned */
-   if (nentries >  1)
+   if (nentries > 1)
    {
       hypre_error(HYPRE_ERROR_GENERIC);
       *entry_ptr = NULL;
    }
-   else if (nentries == 0)
-   {
-      *entry_ptr = NULL;
-   }
-   else
-   {
-      *entry_ptr = entries[0];
-   }
-
-   /* remove the entries array (NULL or allocated in the intersect routine) */
-   hypre_TFree(entries, HYPRE_MEMORY_HOST); 
    
    return hypre_error_flag;
 }
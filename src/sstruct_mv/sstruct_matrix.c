@@ -683,6 +683,9 @@ hypre_SStructUMatrixInitialize( hypre_SStructMatrix *matrix )
    hypre_IndexRef          start;
    hypre_Index             loop_size, stride;
 
+   HYPRE_Int              *diag_sizes, *offd_sizes;
+   HYPRE_Int               collower, colupper, col, i;
+
    HYPRE_IJMatrixSetObjectType(ijmatrix, HYPRE_PARCSR);
 
    if (matrix_type == HYPRE_SSTRUCT || matrix_type == HYPRE_STRUCT)
@@ -773,8 +776,48 @@ hypre_SStructUMatrixInitialize( hypre_SStructMatrix *matrix )
       }
    }
 
-   /* ZTODO: Update row_sizes based on neighbor off-part couplings */
-   HYPRE_IJMatrixSetRowSizes (ijmatrix, (const HYPRE_Int *) row_sizes);
+   if (matrix_type == HYPRE_PARCSR)
+   {
+      /* Set diag/offd row sizes so that the values are written directly into
+       * the ParCSR matrix instead of the auxiliary matrix */
+      diag_sizes = hypre_CTAlloc(HYPRE_Int,  nrows, HYPRE_MEMORY_HOST);
+      offd_sizes = hypre_CTAlloc(HYPRE_Int,  nrows, HYPRE_MEMORY_HOST);
+      hypre_SStructUMatrixStencilSizes(matrix, diag_sizes, offd_sizes);
+
+      collower = hypre_SStructGridStartRank(hypre_SStructGraphDomainGrid(graph));
+      colupper = collower + hypre_SStructGridLocalSize(hypre_SStructGraphDomainGrid(graph));
+      for (entry = 0; entry < nUventries; entry++)
+      {
+         mi = iUventries[entry];
+         m = hypre_SStructUVEntryRank(Uventries[mi]) - rowstart;
+         if ((m > -1) && (m < nrows))
+         {
+            for (i = 0; i < hypre_SStructUVEntryNUEntries(Uventries[mi]); i++)
+            {
+               col = hypre_SStructUVEntryToRank(Uventries[mi], i);
+               if ((col >= collower) && (col < colupper))
+               {
+                  diag_sizes[m]++;
+               }
+               else
+               {
+                  offd_sizes[m]++;
+               }
+            }
+         }
+      }
+
+      HYPRE_IJMatrixSetDiagOffdSizes(ijmatrix, (const HYPRE_Int *) diag_sizes,
+                                     (const HYPRE_Int *) offd_sizes);
+
+      hypre_TFree(diag_sizes, HYPRE_MEMORY_HOST);
+      hypre_TFree(offd_sizes, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      /* ZTODO: Update row_sizes based on neighbor off-part couplings */
+      HYPRE_IJMatrixSetRowSizes (ijmatrix, (const HYPRE_Int *) row_sizes);
+   }
 
    hypre_TFree(row_sizes, HYPRE_MEMORY_HOST);
    hypre_SStructMatrixTmpColCoords(matrix) =
@@ -787,6 +830,123 @@ hypre_SStructUMatrixInitialize( hypre_SStructMatrix *matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Count the U-matrix stencil couplings of each local row (HYPRE_PARCSR
+ * numbering) whose columns are owned by this process (diag_sizes) or by
+ * other processes (offd_sizes).  The counts are computed box-wise with the
+ * same intersections used in hypre_SStructUMatrixSetBoxValues.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructUMatrixStencilSizes( hypre_SStructMatrix *matrix,
+                                  HYPRE_Int           *diag_sizes,
+                                  HYPRE_Int           *offd_sizes )
+{
+   HYPRE_Int               ndim        = hypre_SStructMatrixNDim(matrix);
+   hypre_SStructGraph     *graph       = hypre_SStructMatrixGraph(matrix);
+   hypre_SStructGrid      *dom_grid    = hypre_SStructGraphDomainGrid(graph);
+   HYPRE_Int               nparts      = hypre_SStructGraphNParts(graph);
+   hypre_SStructPGrid    **pgrids      = hypre_SStructGraphPGrids(graph);
+   hypre_SStructStencil ***stencils    = hypre_SStructGraphStencils(graph);
+   hypre_StructGrid       *sgrid;
+   hypre_SStructStencil   *stencil;
+   HYPRE_Int              *split;
+   HYPRE_Int              *vars;
+   hypre_Index            *shape;
+   HYPRE_Int               nvars, part, var, entry, b, jj, m;
+   HYPRE_Int               myid;
+   HYPRE_Int              *sizes;
+
+   hypre_BoxManEntry     **boxman_to_entries;
+   HYPRE_Int               nboxman_to_entries;
+   hypre_BoxArray         *boxes;
+   hypre_Box              *box, *to_box, *map_box, *int_box;
+   hypre_IndexRef          offset, start;
+   hypre_Index             loop_size, stride;
+
+   hypre_MPI_Comm_rank(hypre_SStructMatrixComm(matrix), &myid);
+
+   to_box  = hypre_BoxCreate(ndim);
+   map_box = hypre_BoxCreate(ndim);
+   int_box = hypre_BoxCreate(ndim);
+   hypre_SetIndex(stride, 1);
+
+   m = 0;
+   for (part = 0; part < nparts; part++)
+   {
+      nvars = hypre_SStructPGridNVars(pgrids[part]);
+      for (var = 0; var < nvars; var++)
+      {
+         sgrid   = hypre_SStructPGridSGrid(pgrids[part], var);
+         stencil = stencils[part][var];
+         split   = hypre_SStructMatrixSplit(matrix, part, var);
+         vars    = hypre_SStructStencilVars(stencil);
+         shape   = hypre_SStructStencilShape(stencil);
+
+         boxes = hypre_StructGridBoxes(sgrid);
+         hypre_ForBoxI(b, boxes)
+         {
+            box = hypre_BoxArrayBox(boxes, b);
+
+            for (entry = 0; entry < hypre_SStructStencilSize(stencil); entry++)
+            {
+               if (split[entry] > -1)
+               {
+                  continue;
+               }
+
+               offset = shape[entry];
+               hypre_CopyBox(box, to_box);
+               hypre_BoxShiftPos(to_box, offset);
+
+               hypre_SStructGridIntersect(dom_grid, part, vars[entry], to_box, -1,
+                                          &boxman_to_entries, &nboxman_to_entries);
+
+               for (jj = 0; jj < nboxman_to_entries; jj++)
+               {
+                  hypre_BoxManEntryGetExtents(boxman_to_entries[jj],
+                                              hypre_BoxIMin(map_box),
+                                              hypre_BoxIMax(map_box));
+                  hypre_IntersectBoxes(to_box, map_box, int_box);
+                  hypre_BoxShiftNeg(int_box, offset);
+
+                  if (hypre_BoxManEntryProc(boxman_to_entries[jj]) == myid)
+                  {
+                     sizes = diag_sizes + m;
+                  }
+                  else
+                  {
+                     sizes = offd_sizes + m;
+                  }
+
+                  start = hypre_BoxIMin(int_box);
+                  hypre_BoxGetSize(int_box, loop_size);
+                  zypre_BoxLoop1Begin(ndim, loop_size, box, start, stride, mi);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(HYPRE_BOX_PRIVATE) HYPRE_SMP_SCHEDULE
+#endif
+                  zypre_BoxLoop1For(mi)
+                  {
+                     sizes[mi]++;
+                  }
+                  zypre_BoxLoop1End(mi);
+               }
+
+               hypre_TFree(boxman_to_entries, HYPRE_MEMORY_HOST);
+            }
+
+            m += hypre_BoxVolume(box);
+         }
+      }
+   }
+
+   hypre_BoxDestroy(to_box);
+   hypre_BoxDestroy(map_box);
+   hypre_BoxDestroy(int_box);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * (action > 0): add-to values
  * (action = 0): set values
@@ -955,6 +1115,8 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
    HYPRE_Int            *ncols;
    HYPRE_Int            *rows;
    HYPRE_Int            *cols;
+   HYPRE_Int            *vindex;
+   HYPRE_Int             nvalues;
    HYPRE_Complex        *ijvalues;
    hypre_Box            *box, *vbox;
    hypre_Box            *to_box;
@@ -982,18 +1144,15 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
       map_box = hypre_BoxCreate(ndim);
       int_box = hypre_BoxCreate(ndim);
 
-      nrows    = hypre_BoxVolume(vbox)*nentries;
-      ncols    =  hypre_CTAlloc(HYPRE_Int,  nrows, HYPRE_MEMORY_SHARED);
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
-#endif
-      for (i = 0; i < nrows; i++)
-      {
-         ncols[i] = 1;
-      }
-      rows     =  hypre_CTAlloc(HYPRE_Int,  nrows, HYPRE_MEMORY_SHARED);
-      cols     =  hypre_CTAlloc(HYPRE_Int,  nrows, HYPRE_MEMORY_SHARED);
-      ijvalues =  hypre_CTAlloc(HYPRE_Complex,  nrows, HYPRE_MEMORY_SHARED);
+      /* The values are grouped by row, with room for nentries columns in each
+       * row, so that each row is passed to the IJ interface only once.  The
+       * array 'vindex' maps each IJ value to its position in 'values'. */
+      nrows    = hypre_BoxVolume(vbox);
+      ncols    = hypre_CTAlloc(HYPRE_Int,  nrows, HYPRE_MEMORY_SHARED);
+      rows     = hypre_CTAlloc(HYPRE_Int,  nrows, HYPRE_MEMORY_SHARED);
+      cols     = hypre_CTAlloc(HYPRE_Int,  nrows*nentries, HYPRE_MEMORY_SHARED);
+      vindex   = hypre_CTAlloc(HYPRE_Int,  nrows*nentries, HYPRE_MEMORY_HOST);
+      ijvalues = hypre_CTAlloc(HYPRE_Complex,  nrows*nentries, HYPRE_MEMORY_SHARED);
 
       hypre_SetIndex(stride, 1);
 
@@ -1010,8 +1169,38 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
                                      hypre_BoxIMax(map_box));
          hypre_IntersectBoxes(box, map_box, int_box);
          hypre_CopyBox(int_box, box);
-            
-         nrows = 0;
+
+         nrows = hypre_BoxVolume(box);
+         if (nrows == 0)
+         {
+            continue;
+         }
+
+         /* row ranks */
+         hypre_CopyIndex(hypre_BoxIMin(box), index);
+         hypre_SStructBoxManEntryGetGlobalRank(boxman_entries[ii],
+                                               index, &row_base, matrix_type);
+         start = hypre_BoxIMin(box);
+         hypre_BoxGetSize(box, loop_size);
+         zypre_BoxLoop1Begin(ndim, loop_size, box, start, stride, mi);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(HYPRE_BOX_PRIVATE) HYPRE_SMP_SCHEDULE
+#endif
+         zypre_BoxLoop1For(mi)
+         {
+            hypre_Index index;
+            HYPRE_Int   d;
+
+            hypre_BoxLoopGetIndex(index);
+            rows[mi] = row_base;
+            for (d = 0; d < ndim; d++)
+            {
+               rows[mi] += index[d]*rs[d];
+            }
+            ncols[mi] = 0;
+         }
+         zypre_BoxLoop1End(mi);
+
          for (ei = 0; ei < nentries; ei++)
          {
             entry = entries[ei];
@@ -1040,48 +1229,73 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
                   
                hypre_BoxShiftNeg(int_box, offset);
 
-               hypre_CopyIndex(hypre_BoxIMin(int_box), index);
-               hypre_SStructBoxManEntryGetGlobalRank(boxman_entries[ii],
-                                                     index, &row_base, matrix_type);
-                     
                start = hypre_BoxIMin(int_box);
                hypre_BoxGetSize(int_box, loop_size);
                /*FIXME: It has to be the old boxloop */
                zypre_BoxLoop2Begin(ndim, loop_size,
-                                   int_box, start, stride, mi,
-                                   vbox,    start, stride, vi);
+                                   box,  start, stride, mi,
+                                   vbox, start, stride, vi);
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(HYPRE_BOX_PRIVATE) HYPRE_SMP_SCHEDULE
 #endif
                zypre_BoxLoop2For(mi, vi)
                {
                   hypre_Index index;
-                  HYPRE_Int   d;
+                  HYPRE_Int   d, ci;
                   
                   hypre_BoxLoopGetIndex(index);
-                  rows[nrows + mi] = row_base;
-                  cols[nrows + mi] = col_base;
+                  ci = mi*nentries + ncols[mi];
+                  cols[ci] = col_base;
                   for (d = 0; d < ndim; d++)
                   {
-                     rows[nrows + mi] += index[d]*rs[d];
-                     cols[nrows + mi] += index[d]*cs[d];
+                     cols[ci] += index[d]*cs[d];
                   }
-                  ijvalues[nrows + mi] = values[ei + vi*nentries];
+                  vindex[ci] = ei + vi*nentries;
+                  ncols[mi]++;
                }
                zypre_BoxLoop2End(mi, vi);
 
-               nrows += hypre_BoxVolume(int_box);
-
             } /* end loop through boxman to entries */
 
             hypre_TFree(boxman_to_entries, HYPRE_MEMORY_HOST);
 
          } /* end of ei nentries loop */
 
+         /* squeeze out the unused column slots and empty rows */
+         nvalues = 0;
+         jj = 0;
+         for (i = 0; i < nrows; i++)
+         {
+            if (ncols[i] > 0)
+            {
+               for (ei = i*nentries; ei < i*nentries + ncols[i]; ei++)
+               {
+                  cols[nvalues]   = cols[ei];
+                  vindex[nvalues] = vindex[ei];
+                  nvalues++;
+               }
+               rows[jj]  = rows[i];
+               ncols[jj] = ncols[i];
+               jj++;
+            }
+         }
+         nrows = jj;
+
          /*------------------------------------------
-          * set IJ values one stencil entry at a time
+          * set IJ values one row at a time
           *------------------------------------------*/
             
+         if (action > -1)
+         {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+            for (i = 0; i < nvalues; i++)
+            {
+               ijvalues[i] = values[vindex[i]];
+            }
+         }
+
          if (action > 0)
          {
             HYPRE_IJMatrixAddToValues(ijmatrix, nrows, ncols,
@@ -1098,16 +1312,24 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
          }
          else
          {
-            HYPRE_IJMatrixGetValues(ijmatrix, nrows, ncols, rows, cols, values);
+            HYPRE_IJMatrixGetValues(ijmatrix, nrows, ncols, rows, cols, ijvalues);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+            for (i = 0; i < nvalues; i++)
+            {
+               values[vindex[i]] = ijvalues[i];
+            }
          }
       } /* end loop through boxman entries */
 
       hypre_TFree(boxman_entries, HYPRE_MEMORY_HOST);
       
-       hypre_TFree(ncols, HYPRE_MEMORY_SHARED);
-       hypre_TFree(rows, HYPRE_MEMORY_SHARED);
-       hypre_TFree(cols, HYPRE_MEMORY_SHARED);
-       hypre_TFree(ijvalues, HYPRE_MEMORY_SHARED);
+      hypre_TFree(ncols, HYPRE_MEMORY_SHARED);
+      hypre_TFree(rows, HYPRE_MEMORY_SHARED);
+      hypre_TFree(cols, HYPRE_MEMORY_SHARED);
+      hypre_TFree(vindex, HYPRE_MEMORY_HOST);
+      hypre_TFree(ijvalues, HYPRE_MEMORY_SHARED);
 
       hypre_BoxDestroy(to_box);
       hypre_BoxDestroy(map_box);
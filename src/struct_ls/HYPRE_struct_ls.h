@@ -242,7 +242,19 @@ HYPRE_Int HYPRE_StructPFMGSetNonZeroGuess(HYPRE_StructSolver solver);
  * 1 & Weighted Jacobi (default) \\
  * 2 & Red/Black Gauss-Seidel (symmetric: RB pre-relaxation, BR post-relaxation) \\
  * 3 & Red/Black Gauss-Seidel (nonsymmetric: RB pre- and post-relaxation) \\
+ * 4 & Weighted Jacobi, temporally blocked (wavefront) \\
  * \end{tabular}
+ *
+ * Type 4 does several sweeps per pass through memory and computes the
+ * residual for the restriction in the same pass as the last pre-relaxation
+ * sweep.  On coarse levels, the matrix ghost layer is made deep enough for all
+ * sweeps to fit in one pass.  On the finest level, the sweeps per pass are
+ * limited by the ghost layer of the user's matrix (two sweeps with the default
+ * of one); for n sweeps of a 7-point stencil, call
+ * HYPRE_StructMatrixSetNumGhost with n ghost points (n+1 with symmetric
+ * storage) before initializing the matrix.  It gives the same iterates as
+ * type 1, which it falls back to for constant-coefficient matrices and for
+ * levels with small grids.
  **/
 HYPRE_Int HYPRE_StructPFMGSetRelaxType(HYPRE_StructSolver solver,
                                  HYPRE_Int          relax_type);
@@ -323,6 +335,24 @@ HYPRE_Int HYPRE_StructPFMGGetNumIterations(HYPRE_StructSolver  solver,
 HYPRE_Int HYPRE_StructPFMGGetFinalRelativeResidualNorm(HYPRE_StructSolver  solver,
                                                  HYPRE_Real         *norm);
 
+/**
+ * (Optional) If set to 1, the communication packages of the smoothers,
+ * residual, restriction and interpolation count their exchanges, messages,
+ * bytes sent and the time spent waiting for messages, starting with the
+ * setup.  Setting it back to 0 or destroying the solver stops the counting,
+ * unless another solver still collects statistics.  The default is 0.
+ **/
+HYPRE_Int HYPRE_StructPFMGSetCommStats(HYPRE_StructSolver solver,
+                                       HYPRE_Int          comm_stats);
+
+/**
+ * Prints, per level and operation, the number of neighbors and the
+ * communication statistics accumulated since the setup or the previous print
+ * (see HYPRE\_StructPFMGSetCommStats), as minimum, average and maximum over
+ * the processes, and resets them.
+ **/
+HYPRE_Int HYPRE_StructPFMGPrintCommStats(HYPRE_StructSolver solver);
+
 #if defined(HYPRE_USE_CUDA)
 HYPRE_Int
 HYPRE_StructPFMGSetDeviceLevel( HYPRE_StructSolver  solver,
@@ -319,6 +319,27 @@ HYPRE_StructPFMGGetFinalRelativeResidualNorm( HYPRE_StructSolver  solver,
    return( hypre_PFMGGetFinalRelativeResidualNorm( (void *) solver, norm ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetCommStats( HYPRE_StructSolver solver,
+                              HYPRE_Int          comm_stats )
+{
+   return( hypre_PFMGSetCommStats( (void *) solver, comm_stats) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGPrintCommStats( HYPRE_StructSolver solver )
+{
+   if (!solver)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   return( hypre_PFMGCommStats( (void *) solver ) );
+}
+
 #if defined(HYPRE_USE_CUDA)
 HYPRE_Int
 HYPRE_StructPFMGSetDeviceLevel( HYPRE_StructSolver  solver,
@@ -233,6 +233,8 @@ HYPRE_Int HYPRE_StructPFMGSetPrintLevel ( HYPRE_StructSolver solver , HYPRE_Int
 HYPRE_Int HYPRE_StructPFMGGetPrintLevel ( HYPRE_StructSolver solver , HYPRE_Int *print_level );
 HYPRE_Int HYPRE_StructPFMGGetNumIterations ( HYPRE_StructSolver solver , HYPRE_Int *num_iterations );
 HYPRE_Int HYPRE_StructPFMGGetFinalRelativeResidualNorm ( HYPRE_StructSolver solver , HYPRE_Real *norm );
+HYPRE_Int HYPRE_StructPFMGSetCommStats ( HYPRE_StructSolver solver , HYPRE_Int comm_stats );
+HYPRE_Int HYPRE_StructPFMGPrintCommStats ( HYPRE_StructSolver solver );
 HYPRE_Int hypre_PFMGSetDeviceLevel( void *pfmg_vdata, HYPRE_Int   device_level  );
 
 /* HYPRE_struct_smg.c */
@@ -377,15 +379,20 @@ HYPRE_Int hypre_PFMGSetLogging ( void *pfmg_vdata , HYPRE_Int logging );
 HYPRE_Int hypre_PFMGGetLogging ( void *pfmg_vdata , HYPRE_Int *logging );
 HYPRE_Int hypre_PFMGSetPrintLevel ( void *pfmg_vdata , HYPRE_Int print_level );
 HYPRE_Int hypre_PFMGGetPrintLevel ( void *pfmg_vdata , HYPRE_Int *print_level );
+HYPRE_Int hypre_PFMGSetCommStats ( void *pfmg_vdata , HYPRE_Int comm_stats );
 HYPRE_Int hypre_PFMGGetNumIterations ( void *pfmg_vdata , HYPRE_Int *num_iterations );
 HYPRE_Int hypre_PFMGPrintLogging ( void *pfmg_vdata , HYPRE_Int myid );
+HYPRE_Int hypre_PFMGCommStats ( void *pfmg_vdata );
 HYPRE_Int hypre_PFMGGetFinalRelativeResidualNorm ( void *pfmg_vdata , HYPRE_Real *relative_residual_norm );
 
 /* pfmg_relax.c */
 void *hypre_PFMGRelaxCreate ( MPI_Comm comm );
 HYPRE_Int hypre_PFMGRelaxDestroy ( void *pfmg_relax_vdata );
+HYPRE_Int hypre_PFMGRelaxCommStats ( void *pfmg_relax_vdata , HYPRE_Real *stats );
 HYPRE_Int hypre_PFMGRelax ( void *pfmg_relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_PFMGRelaxResidual ( void *pfmg_relax_vdata , void *matvec_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x , hypre_StructVector *r );
 HYPRE_Int hypre_PFMGRelaxSetup ( void *pfmg_relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_PFMGRelaxSetMatrixNumGhost ( hypre_StructMatrix *A , HYPRE_Int num_sweeps );
 HYPRE_Int hypre_PFMGRelaxSetType ( void *pfmg_relax_vdata , HYPRE_Int relax_type );
 HYPRE_Int hypre_PFMGRelaxSetJacobiWeight ( void *pfmg_relax_vdata , HYPRE_Real weight );
 HYPRE_Int hypre_PFMGRelaxSetPreRelax ( void *pfmg_relax_vdata );
@@ -442,6 +449,7 @@ HYPRE_Int hypre_PFMGSolve ( void *pfmg_vdata , hypre_StructMatrix *A , hypre_Str
 /* point_relax.c */
 void *hypre_PointRelaxCreate ( MPI_Comm comm );
 HYPRE_Int hypre_PointRelaxDestroy ( void *relax_vdata );
+HYPRE_Int hypre_PointRelaxCommStats ( void *relax_vdata , HYPRE_Real *stats );
 HYPRE_Int hypre_PointRelaxSetup ( void *relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
 HYPRE_Int hypre_PointRelax ( void *relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
 HYPRE_Int hypre_PointRelax_core0 ( void *relax_vdata , hypre_StructMatrix *A , HYPRE_Int constant_coefficient , hypre_Box *compute_box , HYPRE_Real *bp , HYPRE_Real *xp , HYPRE_Real *tp , HYPRE_Int boxarray_id , hypre_Box *A_data_box , hypre_Box *b_data_box , hypre_Box *x_data_box , hypre_Box *t_data_box , hypre_IndexRef stride );
@@ -468,6 +476,7 @@ HYPRE_Int hypre_RedBlackConstantCoefGS ( void *relax_vdata , hypre_StructMatrix
 /* red_black_gs.c */
 void *hypre_RedBlackGSCreate ( MPI_Comm comm );
 HYPRE_Int hypre_RedBlackGSDestroy ( void *relax_vdata );
+HYPRE_Int hypre_RedBlackGSCommStats ( void *relax_vdata , HYPRE_Real *stats );
 HYPRE_Int hypre_RedBlackGSSetup ( void *relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
 HYPRE_Int hypre_RedBlackGS ( void *relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
 HYPRE_Int hypre_RedBlackGSSetTol ( void *relax_vdata , HYPRE_Real tol );
@@ -484,12 +493,14 @@ void *hypre_SemiInterpCreate ( void );
 HYPRE_Int hypre_SemiInterpSetup ( void *interp_vdata , hypre_StructMatrix *P , HYPRE_Int P_stored_as_transpose , hypre_StructVector *xc , hypre_StructVector *e , hypre_Index cindex , hypre_Index findex , hypre_Index stride );
 HYPRE_Int hypre_SemiInterp ( void *interp_vdata , hypre_StructMatrix *P , hypre_StructVector *xc , hypre_StructVector *e );
 HYPRE_Int hypre_SemiInterpDestroy ( void *interp_vdata );
+HYPRE_Int hypre_SemiInterpCommStats ( void *interp_vdata , HYPRE_Real *stats );
 
 /* semi_restrict.c */
 void *hypre_SemiRestrictCreate ( void );
 HYPRE_Int hypre_SemiRestrictSetup ( void *restrict_vdata , hypre_StructMatrix *R , HYPRE_Int R_stored_as_transpose , hypre_StructVector *r , hypre_StructVector *rc , hypre_Index cindex , hypre_Index findex , hypre_Index stride );
 HYPRE_Int hypre_SemiRestrict ( void *restrict_vdata , hypre_StructMatrix *R , hypre_StructVector *r , hypre_StructVector *rc );
 HYPRE_Int hypre_SemiRestrictDestroy ( void *restrict_vdata );
+HYPRE_Int hypre_SemiRestrictCommStats ( void *restrict_vdata , HYPRE_Real *stats );
 
 /* semi_setup_rap.c */
 hypre_StructMatrix *hypre_SemiCreateRAPOp ( hypre_StructMatrix *R , hypre_StructMatrix *A , hypre_StructMatrix *P , hypre_StructGrid *coarse_grid , HYPRE_Int cdir , HYPRE_Int P_stored_as_transpose );
@@ -656,6 +667,19 @@ HYPRE_Int hypre_SparseMSGSetupRAPOp ( hypre_StructMatrix *R , hypre_StructMatrix
 /* sparse_msg_solve.c */
 HYPRE_Int hypre_SparseMSGSolve ( void *smsg_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
 
+/* wavefront_relax.c */
+void *hypre_WavefrontRelaxCreate ( MPI_Comm comm );
+HYPRE_Int hypre_WavefrontRelaxDestroy ( void *relax_vdata );
+HYPRE_Int hypre_WavefrontRelaxCommStats ( void *relax_vdata , HYPRE_Real *stats );
+HYPRE_Int hypre_WavefrontRelaxSetMatrixNumGhost ( hypre_StructMatrix *A , HYPRE_Int num_sweeps );
+HYPRE_Int hypre_WavefrontRelaxSetup ( void *relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_WavefrontRelaxFillWork ( void *relax_vdata , hypre_StructVector *v , HYPRE_Real *w_data , hypre_CommPkg *comm_pkg );
+HYPRE_Int hypre_WavefrontRelaxBox ( void *relax_vdata , HYPRE_Int i , HYPRE_Int num_stages , HYPRE_Int residual , HYPRE_Int zero , hypre_StructVector *r , HYPRE_Real **Ap , HYPRE_Int *offsets );
+HYPRE_Int hypre_WavefrontRelax ( void *relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x , hypre_StructVector *r );
+HYPRE_Int hypre_WavefrontRelaxSetMaxIter ( void *relax_vdata , HYPRE_Int max_iter );
+HYPRE_Int hypre_WavefrontRelaxSetZeroGuess ( void *relax_vdata , HYPRE_Int zero_guess );
+HYPRE_Int hypre_WavefrontRelaxSetWeight ( void *relax_vdata , HYPRE_Real weight );
+
 #ifdef __cplusplus
 }
 #endif
@@ -44,6 +44,8 @@ hypre_PFMGCreate( MPI_Comm  comm )
    (pfmg_data -> skip_relax)       = 1;
    (pfmg_data -> logging)          = 0;
    (pfmg_data -> print_level)      = 0;
+   (pfmg_data -> comm_stats)       = 0;
+   (pfmg_data -> comm_stats_on)    = 0;
 
    /* initialize */
    (pfmg_data -> num_levels)  = -1;
@@ -67,6 +69,11 @@ hypre_PFMGDestroy( void *pfmg_vdata )
 
    if (pfmg_data)
    {
+      if (pfmg_data -> comm_stats_on)
+      {
+         hypre_comm_stats_active--;
+      }
+
       if ((pfmg_data -> logging) > 0)
       {
          hypre_TFree(pfmg_data -> norms, HYPRE_MEMORY_HOST);
@@ -475,6 +482,26 @@ hypre_PFMGGetPrintLevel( void *pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetCommStats( void *pfmg_vdata,
+                        HYPRE_Int   comm_stats)
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+ 
+   (pfmg_data -> comm_stats) = comm_stats;
+   /* stop counting, unless other solvers still do */
+   if (!comm_stats && (pfmg_data -> comm_stats_on))
+   {
+      hypre_comm_stats_active--;
+      (pfmg_data -> comm_stats_on) = 0;
+   }
+ 
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -522,6 +549,110 @@ hypre_PFMGPrintLogging( void *pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PFMGCommStats
+ *
+ * Prints, per level, the communication of the smoother, the residual, the
+ * restriction and the interpolation: number of neighbor processes,
+ * exchanges, messages, bytes sent and time spent waiting, as minimum,
+ * average and maximum over the processes.  The counters are those
+ * accumulated since the last call, which resets them.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGCommStats( void *pfmg_vdata )
+{
+   hypre_PFMGData  *pfmg_data       = (hypre_PFMGData *)pfmg_vdata;
+   MPI_Comm         comm            = (pfmg_data -> comm);
+   HYPRE_Int        num_levels      = (pfmg_data -> num_levels);
+   HYPRE_Int       *active_l        = (pfmg_data -> active_l);
+   void           **relax_data_l    = (pfmg_data -> relax_data_l);
+   void           **matvec_data_l   = (pfmg_data -> matvec_data_l);
+   void           **restrict_data_l = (pfmg_data -> restrict_data_l);
+   void           **interp_data_l   = (pfmg_data -> interp_data_l);
+
+   const char      *op_names[4] = {"relax", "resid", "restr", "interp"};
+   HYPRE_Int       *present;
+   HYPRE_Real      *local, *gmin, *gmax, *gsum;
+   HYPRE_Int        num_rows, level, op, row, k;
+   HYPRE_Int        num_procs, my_id;
+
+   if (num_levels < 1)
+   {
+      return hypre_error_flag;
+   }
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   /* rows are (level, operation); the same on all processes */
+   num_rows = 4*num_levels;
+   present  = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   local    = hypre_CTAlloc(HYPRE_Real, 5*num_rows, HYPRE_MEMORY_HOST);
+   gmin     = hypre_CTAlloc(HYPRE_Real, 5*num_rows, HYPRE_MEMORY_HOST);
+   gmax     = hypre_CTAlloc(HYPRE_Real, 5*num_rows, HYPRE_MEMORY_HOST);
+   gsum     = hypre_CTAlloc(HYPRE_Real, 5*num_rows, HYPRE_MEMORY_HOST);
+
+   for (level = 0; level < num_levels; level++)
+   {
+      row = 4*level;
+      if (active_l[level])
+      {
+         present[row] = 1;
+         hypre_PFMGRelaxCommStats(relax_data_l[level], &local[5*row]);
+      }
+      if (level < num_levels-1)
+      {
+         present[row+1] = 1;
+         hypre_StructMatvecCommStats(matvec_data_l[level], &local[5*(row+1)]);
+         present[row+2] = 1;
+         hypre_SemiRestrictCommStats(restrict_data_l[level], &local[5*(row+2)]);
+         present[row+3] = 1;
+         hypre_SemiInterpCommStats(interp_data_l[level], &local[5*(row+3)]);
+      }
+   }
+
+   hypre_MPI_Reduce(local, gmin, 5*num_rows, HYPRE_MPI_REAL, hypre_MPI_MIN, 0, comm);
+   hypre_MPI_Reduce(local, gmax, 5*num_rows, HYPRE_MPI_REAL, hypre_MPI_MAX, 0, comm);
+   hypre_MPI_Reduce(local, gsum, 5*num_rows, HYPRE_MPI_REAL, hypre_MPI_SUM, 0, comm);
+
+   if (my_id == 0)
+   {
+      hypre_printf("\n\nPFMG Communication Information (min/avg/max over processes):\n\n");
+      hypre_printf("                neighbors        exch   messages");
+      hypre_printf("         MB sent                wait time (s)\n");
+      hypre_printf("lev  op      min    avg   max    max        avg");
+      hypre_printf("      min    avg    max        min      avg      max\n");
+      hypre_printf("===================================================");
+      hypre_printf("================================================\n");
+      for (level = 0; level < num_levels; level++)
+      {
+         for (op = 0; op < 4; op++)
+         {
+            row = 4*level + op;
+            k   = 5*row;
+            if (!present[row])
+            {
+               continue;
+            }
+            hypre_printf("%3d %-6s %5.0f %6.1f %5.0f %6.0f %10.1f   %6.3f %6.3f %6.3f   %8.2e %8.2e %8.2e\n",
+                         level, op_names[op],
+                         gmin[k], gsum[k]/num_procs, gmax[k], gmax[k+1],
+                         gsum[k+2]/num_procs,
+                         gmin[k+3], gsum[k+3]/num_procs, gmax[k+3],
+                         gmin[k+4], gsum[k+4]/num_procs, gmax[k+4]);
+         }
+      }
+   }
+
+   hypre_TFree(present, HYPRE_MEMORY_HOST);
+   hypre_TFree(local, HYPRE_MEMORY_HOST);
+   hypre_TFree(gmin, HYPRE_MEMORY_HOST);
+   hypre_TFree(gmax, HYPRE_MEMORY_HOST);
+   hypre_TFree(gsum, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
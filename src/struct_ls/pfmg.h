@@ -84,6 +84,8 @@ typedef struct
    HYPRE_Int             time_index;
 
    HYPRE_Int             print_level;
+   HYPRE_Int             comm_stats;     /* collect communication statistics */
+   HYPRE_Int             comm_stats_on;  /* hypre_comm_stats_active is held */
    /* additional log info (logged when `logging' > 0) */
    HYPRE_Int             logging;
    HYPRE_Real           *norms;
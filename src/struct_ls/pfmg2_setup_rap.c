@@ -469,11 +469,11 @@ hypre_PFMG2BuildRAPSym_onebox_FSS5_CC0(
    {
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_csw,rb,a_cw,pa,rap_cs,a_cc,a_cs,rap_cse,a_ce,rap_cw,pb,ra,rap_cc,a_cn)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAm1 = iA - yOffsetA;
          HYPRE_Int iAp1 = iA + yOffsetA;
@@ -501,7 +501,7 @@ hypre_PFMG2BuildRAPSym_onebox_FSS5_CC0(
             +                   a_cs[iA]   * pb[iP-pbOffset]
             +                   a_cn[iA]   * pa[iP];
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -522,11 +522,11 @@ hypre_PFMG2BuildRAPSym_onebox_FSS5_CC0(
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_csw,rb,pa,rap_cs,a_cc,rap_cse,rap_cw,pb,ra,rap_cc)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAm1 = iA - yOffsetA_diag;
          HYPRE_Int iAp1 = iA + yOffsetA_diag;
@@ -555,7 +555,7 @@ hypre_PFMG2BuildRAPSym_onebox_FSS5_CC0(
             +                   a_cs_offd  * pb[iP-pbOffset]
             +                   a_cn_offd  * pa[iP];
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -990,11 +990,11 @@ hypre_PFMG2BuildRAPSym_onebox_FSS9_CC0(
    {
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_csw,rb,a_cw,pa,a_csw,rap_cs,a_cc,a_cs,rap_cse,a_ce,a_cse,rap_cw,pb,ra,a_cnw,rap_cc,a_cn)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAm1 = iA - yOffsetA;
          HYPRE_Int iAp1 = iA + yOffsetA;
@@ -1032,7 +1032,7 @@ hypre_PFMG2BuildRAPSym_onebox_FSS9_CC0(
             +                   a_cn[iA]   * pa[iP];
 
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -1060,11 +1060,11 @@ hypre_PFMG2BuildRAPSym_onebox_FSS9_CC0(
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_csw,rb,pa,rap_cs,a_cc,rap_cse,rap_cw,pb,ra,rap_cc)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAm1 = iA - yOffsetA_diag;
          HYPRE_Int iAp1 = iA + yOffsetA_diag;
@@ -1102,7 +1102,7 @@ hypre_PFMG2BuildRAPSym_onebox_FSS9_CC0(
             +                   a_cn_offd   * pa[iP];
 
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -1664,11 +1664,11 @@ hypre_PFMG2BuildRAPNoSym_onebox_FSS5_CC0(
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_cne,ra,a_ce,pb,rap_cn,a_cc,a_cn,rap_cnw,a_cw,rap_ce,rb,pa)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAm1 = iA - yOffsetA;
          HYPRE_Int iAp1 = iA + yOffsetA;
@@ -1689,7 +1689,7 @@ hypre_PFMG2BuildRAPNoSym_onebox_FSS5_CC0(
             +          rb[iR-rbOffset] * a_ce[iAm1] * pb[iP1-pbOffset]
             +          ra[iR] * a_ce[iAp1] * pa[iP1];
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -1710,11 +1710,11 @@ hypre_PFMG2BuildRAPNoSym_onebox_FSS5_CC0(
  
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_cne,ra,pb,rap_cn,a_cc,rap_cnw,rap_ce,rb,pa)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAp1 = iA + yOffsetA_diag;
 
@@ -1734,7 +1734,7 @@ hypre_PFMG2BuildRAPNoSym_onebox_FSS5_CC0(
             +          rb[iR-rbOffset] * a_ce_offdm1 * pb[iP1-pbOffset]
             +          ra[iR] * a_ce_offdp1 * pa[iP1];
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -2160,11 +2160,11 @@ hypre_PFMG2BuildRAPNoSym_onebox_FSS9_CC0(
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_cne,ra,a_ce,pb,a_cne,rap_cn,a_cc,a_cn,rap_cnw,a_cw,a_cnw,rap_ce,rb,pa,a_cse)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAm1 = iA - yOffsetA;
          HYPRE_Int iAp1 = iA + yOffsetA;
@@ -2194,7 +2194,7 @@ hypre_PFMG2BuildRAPNoSym_onebox_FSS9_CC0(
             +                   a_cne[iA]  * pa[iP1];
 
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -2221,11 +2221,11 @@ hypre_PFMG2BuildRAPNoSym_onebox_FSS9_CC0(
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_cne,ra,pb,rap_cn,a_cc,rap_cnw,rap_ce,rb,pa)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAp1 = iA + yOffsetA_diag;
 
@@ -2254,7 +2254,7 @@ hypre_PFMG2BuildRAPNoSym_onebox_FSS9_CC0(
             +                   a_cne_offd  * pa[iP1];
 
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -560,11 +560,11 @@ hypre_PFMG3BuildRAPSym_onebox_FSS07_CC0(
    {
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_bs,rb,a_cs,pa,rap_bw,a_cw,rap_bc,a_bc,a_cc,rap_be,a_ce,rap_bn,a_cn,rap_cs,pb,ra,rap_cw,rap_csw,rap_cse,rap_cc,a_ac)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc)
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc)
       {
          HYPRE_Int iAm1 = iA - zOffsetA;
          HYPRE_Int iAp1 = iA + zOffsetA;
@@ -609,7 +609,7 @@ hypre_PFMG3BuildRAPSym_onebox_FSS07_CC0(
             +                   a_ac[iA]   * pa[iP];
 
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -634,11 +634,11 @@ hypre_PFMG3BuildRAPSym_onebox_FSS07_CC0(
        
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_bs,rb,pa,rap_bw,rap_bc,a_cc,rap_be,rap_bn,rap_cs,pb,ra,rap_cw,rap_csw,rap_cse,rap_cc)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAm1 = iA - zOffsetA_diag;
          HYPRE_Int iAp1 = iA + zOffsetA_diag;
@@ -683,7 +683,7 @@ hypre_PFMG3BuildRAPSym_onebox_FSS07_CC0(
             +                   a_ac_offd   * pa[iP];
 
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -1299,11 +1299,11 @@ hypre_PFMG3BuildRAPSym_onebox_FSS19_CC0(
    {
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_bsw,rb,a_csw,pa,rap_bs,a_cs,a_bs,rap_bse,a_cse,rap_bw,a_cw,a_bw,rap_bc,a_bc,a_cc,rap_be,a_ce,a_be,rap_bnw,a_cnw,rap_bn,a_cn,a_bn,rap_bne,a_cne,rap_csw,pb,ra,rap_cs,a_as,rap_cse,rap_cw,a_aw,rap_cc,a_ac)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAm1 = iA - zOffsetA;
          HYPRE_Int iAp1 = iA + zOffsetA;
@@ -1382,7 +1382,7 @@ hypre_PFMG3BuildRAPSym_onebox_FSS19_CC0(
             +                   a_ac[iA]   * pa[iP];
 
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -1429,11 +1429,11 @@ hypre_PFMG3BuildRAPSym_onebox_FSS19_CC0(
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_bsw,rb,pa,rap_bs,rap_bse,rap_bw,rap_bc,a_cc,rap_be,rap_bnw,rap_bn,rap_bne,rap_csw,pb,ra,rap_cs,rap_cse,rap_cw,rap_cc)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAm1 = iA - zOffsetA_diag;
          HYPRE_Int iAp1 = iA + zOffsetA_diag;
@@ -1512,7 +1512,7 @@ hypre_PFMG3BuildRAPSym_onebox_FSS19_CC0(
             +                   a_ac_offd   * pa[iP];
 
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -2296,11 +2296,11 @@ hypre_PFMG3BuildRAPSym_onebox_FSS27_CC0(
    {
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_bsw,rb,a_csw,pa,a_bsw,rap_bs,a_cs,a_bs,rap_bse,a_cse,a_bse,rap_bw,a_cw,a_bw,rap_bc,a_bc,a_cc,rap_be,a_ce,a_be,rap_bnw,a_cnw,a_bnw,rap_bn,a_cn,a_bn,rap_bne,a_cne,a_bne,rap_csw,pb,ra,a_asw,rap_cs,a_as,rap_cse,a_ase,rap_cw,a_aw,rap_cc,a_ac)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAm1 = iA - zOffsetA;
          HYPRE_Int iAp1 = iA + zOffsetA;
@@ -2394,7 +2394,7 @@ hypre_PFMG3BuildRAPSym_onebox_FSS27_CC0(
             +                   a_bc[iA]   * pb[iP-pbOffset]
             +                   a_ac[iA]   * pa[iP];
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -2455,11 +2455,11 @@ hypre_PFMG3BuildRAPSym_onebox_FSS27_CC0(
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_bsw,rb,pa,rap_bs,rap_bse,rap_bw,rap_bc,a_cc,rap_be,rap_bnw,rap_bn,rap_bne,rap_csw,pb,ra,rap_cs,rap_cse,rap_cw,rap_cc)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAm1 = iA - zOffsetA_diag;
          HYPRE_Int iAp1 = iA + zOffsetA_diag;
@@ -2553,7 +2553,7 @@ hypre_PFMG3BuildRAPSym_onebox_FSS27_CC0(
             +                   a_bc_offd   * pb[iP-pbOffset]
             +                   a_ac_offd   * pa[iP];
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -3376,11 +3376,11 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS07_CC0(
    {
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_an,ra,a_cn,pb,rap_ae,a_ce,rap_ac,a_ac,a_cc,rap_aw,a_cw,rap_as,a_cs,rap_cn,rb,pa,rap_ce,rap_cnw,rap_cne)      
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAm1 = iA - zOffsetA;
          HYPRE_Int iAp1 = iA + zOffsetA;
@@ -3416,7 +3416,7 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS07_CC0(
            
          rap_cne[iAc] = 0.0;
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -3438,11 +3438,11 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS07_CC0(
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_an,ra,pb,rap_ae,rap_ac,a_cc,rap_aw,rap_as,rap_cn,rb,pa,rap_ce,rap_cnw,rap_cne)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          //HYPRE_Int iAm1 = iA - zOffsetA_diag;
          HYPRE_Int iAp1 = iA + zOffsetA_diag;
@@ -3478,7 +3478,7 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS07_CC0(
  
          rap_cne[iAc] = 0.0;
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -4067,11 +4067,11 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS19_CC0(
    {
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_ane,ra,a_cne,pb,rap_an,a_cn,a_an,rap_anw,a_cnw,rap_ae,a_ce,a_ae,rap_ac,a_ac,a_cc,rap_aw,a_cw,a_aw,rap_ase,a_cse,rap_as,a_cs,a_as,rap_asw,a_csw,rap_cne,rb,pa,rap_cn,a_bn,rap_cnw,rap_ce,a_be)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAm1 = iA - zOffsetA;
          HYPRE_Int iAp1 = iA + zOffsetA;
@@ -4142,7 +4142,7 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS19_CC0(
             +          ra[iR] * a_be[iAp1];
 
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -4186,11 +4186,11 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS19_CC0(
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_ane,ra,pb,rap_an,rap_anw,rap_ae,rap_ac,a_cc,rap_aw,rap_ase,rap_as,rap_asw,rap_cne,rb,pa,rap_cn,rap_cnw,rap_ce)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAp1 = iA + zOffsetA_diag;
 
@@ -4260,7 +4260,7 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS19_CC0(
             +          ra[iR] * a_be_offdp1;
 
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -5018,11 +5018,11 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC0(
    {
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_ane,ra,a_cne,pb,a_ane,rap_an,a_cn,a_an,rap_anw,a_cnw,a_anw,rap_ae,a_ce,a_ae,rap_ac,a_ac,a_cc,rap_aw,a_cw,a_aw,rap_ase,a_cse,a_ase,rap_as,a_cs,a_as,rap_asw,a_csw,a_asw,rap_cne,rb,pa,a_bne,rap_cn,a_bn,rap_cnw,a_bnw,rap_ce,a_be)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAm1 = iA - zOffsetA;
          HYPRE_Int iAp1 = iA + zOffsetA;
@@ -5110,7 +5110,7 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC0(
             +          ra[iR] * a_be[iAp1];
 
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
@@ -5168,11 +5168,11 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC0(
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_ane,ra,pb,rap_an,rap_anw,rap_ae,rap_ac,a_cc,rap_aw,rap_ase,rap_as,rap_asw,rap_cne,rb,pa,rap_cn,rap_cnw,rap_ce)
-      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                          P_dbox, cstart, stridec, iP,
-                          R_dbox, cstart, stridec, iR,
-                          A_dbox, fstart, stridef, iA,
-                          RAP_dbox, cstart, stridec, iAc);
+      hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                              P_dbox, cstart, stridec, iP,
+                              R_dbox, cstart, stridec, iR,
+                              A_dbox, fstart, stridef, iA,
+                              RAP_dbox, cstart, stridec, iAc);
       {
          HYPRE_Int iAp1 = iA + zOffsetA_diag;
 
@@ -5258,7 +5258,7 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC0(
             +          ra[iR] * a_be_offdp1;
 
       }
-      hypre_BoxLoop4End(iP, iR, iA, iAc);
+      hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
    }
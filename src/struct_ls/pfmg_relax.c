@@ -12,6 +12,9 @@
 
 #include "_hypre_struct_ls.h"
 
+/* minimum average number of grid points per process for relax_type 4 */
+#define HYPRE_PFMG_WAVEFRONT_MIN_SIZE 262144
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -19,7 +22,9 @@ typedef struct
 {
    void                   *relax_data;
    void                   *rb_relax_data;
+   void                   *wf_relax_data;
    HYPRE_Int               relax_type;
+   HYPRE_Int               wavefront;    /* relax_type 4 uses wf_relax_data */
    HYPRE_Real              jacobi_weight;
 
 } hypre_PFMGRelaxData;
@@ -35,7 +40,9 @@ hypre_PFMGRelaxCreate( MPI_Comm  comm )
    pfmg_relax_data = hypre_CTAlloc(hypre_PFMGRelaxData,  1, HYPRE_MEMORY_HOST);
    (pfmg_relax_data -> relax_data) = hypre_PointRelaxCreate(comm);
    (pfmg_relax_data -> rb_relax_data) = hypre_RedBlackGSCreate(comm);
+   (pfmg_relax_data -> wf_relax_data) = hypre_WavefrontRelaxCreate(comm);
    (pfmg_relax_data -> relax_type) = 0;        /* Weighted Jacobi */
+   (pfmg_relax_data -> wavefront) = 0;
    (pfmg_relax_data -> jacobi_weight) = 0.0;
 
    return (void *) pfmg_relax_data;
@@ -53,12 +60,47 @@ hypre_PFMGRelaxDestroy( void *pfmg_relax_vdata )
    {
       hypre_PointRelaxDestroy(pfmg_relax_data -> relax_data);
       hypre_RedBlackGSDestroy(pfmg_relax_data -> rb_relax_data);
+      hypre_WavefrontRelaxDestroy(pfmg_relax_data -> wf_relax_data);
       hypre_TFree(pfmg_relax_data, HYPRE_MEMORY_HOST);
    }
 
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Adds the communication statistics of the smoother in use to stats and
+ * resets them (see hypre_CommPkgGetStats).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxCommStats( void       *pfmg_relax_vdata,
+                          HYPRE_Real *stats )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   switch(pfmg_relax_data -> relax_type)
+   {
+      case 0:
+      case 1:
+         hypre_PointRelaxCommStats((pfmg_relax_data -> relax_data), stats);
+         break;
+      case 2:
+      case 3:
+         hypre_RedBlackGSCommStats((pfmg_relax_data -> rb_relax_data), stats);
+         break;
+      case 4:
+         /* single sweeps fall back to the point smoother */
+         if (pfmg_relax_data -> wavefront)
+         {
+            hypre_WavefrontRelaxCommStats((pfmg_relax_data -> wf_relax_data), stats);
+         }
+         hypre_PointRelaxCommStats((pfmg_relax_data -> relax_data), stats);
+         break;
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -70,7 +112,9 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
 {
    hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
    HYPRE_Int    relax_type = (pfmg_relax_data -> relax_type);
+   HYPRE_Int    wavefront  = (pfmg_relax_data -> wavefront);
    HYPRE_Int    constant_coefficient= hypre_StructMatrixConstantCoefficient(A);
+   HYPRE_Int    max_iter;
 
    switch(relax_type)
    {
@@ -90,12 +134,63 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
             hypre_RedBlackGS((pfmg_relax_data -> rb_relax_data), A, b, x);
          }
           
+         break;
+      case 4:
+         /* a single sweep gains nothing from temporal blocking */
+         hypre_PointRelaxGetMaxIter((pfmg_relax_data -> relax_data), &max_iter);
+         if (wavefront && (max_iter > 1))
+         {
+            hypre_WavefrontRelax((pfmg_relax_data -> wf_relax_data), A, b, x, NULL);
+         }
+         else
+         {
+            hypre_PointRelax((pfmg_relax_data -> relax_data), A, b, x);
+         }
          break;
    }
 
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Relax and then compute the residual r = b - Ax.  When more than one sweep
+ * is done, the wavefront smoother computes the residual in the same pass as
+ * its last sweep.  Otherwise, the residual is computed separately with
+ * matvec_vdata.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxResidual( void               *pfmg_relax_vdata,
+                         void               *matvec_vdata,
+                         hypre_StructMatrix *A,
+                         hypre_StructVector *b,
+                         hypre_StructVector *x,
+                         hypre_StructVector *r                )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+   HYPRE_Int    relax_type = (pfmg_relax_data -> relax_type);
+   HYPRE_Int    wavefront  = (pfmg_relax_data -> wavefront);
+   HYPRE_Int    max_iter = 0;
+
+   /* use the wavefront smoother under the same conditions as PFMGRelax */
+   if ((relax_type == 4) && wavefront)
+   {
+      hypre_PointRelaxGetMaxIter((pfmg_relax_data -> relax_data), &max_iter);
+   }
+   if ((relax_type == 4) && wavefront && (max_iter > 1))
+   {
+      hypre_WavefrontRelax((pfmg_relax_data -> wf_relax_data), A, b, x, r);
+   }
+   else
+   {
+      hypre_PFMGRelax(pfmg_relax_vdata, A, b, x);
+      hypre_StructCopy(b, r);
+      hypre_StructMatvecCompute(matvec_vdata, -1.0, A, x, 1.0, r);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -108,6 +203,7 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
    hypre_PFMGRelaxData *pfmg_relax_data  = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
    HYPRE_Int            relax_type       = (pfmg_relax_data -> relax_type);
    HYPRE_Real           jacobi_weight    = (pfmg_relax_data -> jacobi_weight); 
+   HYPRE_Int            wavefront, num_procs;
 
    switch(relax_type)
    {
@@ -119,6 +215,27 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
       case 3:
          hypre_RedBlackGSSetup((pfmg_relax_data -> rb_relax_data), A, b, x);
          break;
+      case 4:
+         /* the wavefront smoother only pays off on large boxes; the decision
+          * is made from global sizes so that all processes agree on it */
+         hypre_MPI_Comm_size(hypre_StructVectorComm(x), &num_procs);
+         wavefront = (!hypre_StructMatrixConstantCoefficient(A) &&
+                      (hypre_StructVectorGlobalSize(x) / num_procs >=
+                       HYPRE_PFMG_WAVEFRONT_MIN_SIZE));
+#if defined(HYPRE_USE_RAJA) || defined(HYPRE_USE_KOKKOS) || defined(HYPRE_USE_CUDA) || defined(HYPRE_USE_OMP45)
+         wavefront = 0;
+#endif
+         /* otherwise weighted Jacobi (type 1) is used for this setup */
+         (pfmg_relax_data -> wavefront) = wavefront;
+         if (wavefront)
+         {
+            hypre_WavefrontRelaxSetWeight((pfmg_relax_data -> wf_relax_data),
+                                          jacobi_weight);
+            hypre_WavefrontRelaxSetup((pfmg_relax_data -> wf_relax_data), A, b, x);
+         }
+         hypre_PointRelaxSetup((pfmg_relax_data -> relax_data), A, b, x);
+         hypre_PointRelaxSetWeight((pfmg_relax_data -> relax_data), jacobi_weight);
+         break;
    }
 
    if (relax_type==1)
@@ -129,6 +246,30 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * For relax_type 4, request the matrix ghost layer needed to do num_sweeps
+ * sweeps in one pass, on levels large enough to use the wavefront smoother.
+ * Must be called before A is initialized.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetMatrixNumGhost( hypre_StructMatrix *A,
+                                  HYPRE_Int           num_sweeps )
+{
+   hypre_StructGrid  *grid = hypre_StructMatrixGrid(A);
+   HYPRE_Int          num_procs;
+
+   hypre_MPI_Comm_size(hypre_StructGridComm(grid), &num_procs);
+   if (!hypre_StructMatrixConstantCoefficient(A) &&
+       (hypre_StructGridGlobalSize(grid) / num_procs >=
+        HYPRE_PFMG_WAVEFRONT_MIN_SIZE))
+   {
+      hypre_WavefrontRelaxSetMatrixNumGhost(A, num_sweeps);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -159,6 +300,7 @@ hypre_PFMGRelaxSetType( void  *pfmg_relax_vdata,
 
       case 2: /* Red-Black Gauss-Seidel */
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
+      case 4: /* Weighted Jacobi (wavefront) */
          break;
    }
 
@@ -192,6 +334,7 @@ hypre_PFMGRelaxSetPreRelax( void  *pfmg_relax_vdata )
    {
       case 1: /* Weighted Jacobi */
       case 0: /* Jacobi */
+      case 4: /* Weighted Jacobi (wavefront) */
          break;
 
       case 2: /* Red-Black Gauss-Seidel */
@@ -219,6 +362,7 @@ hypre_PFMGRelaxSetPostRelax( void  *pfmg_relax_vdata )
    {
       case 1: /* Weighted Jacobi */
       case 0: /* Jacobi */
+      case 4: /* Weighted Jacobi (wavefront) */
          break;
 
       case 2: /* Red-Black Gauss-Seidel */
@@ -259,6 +403,7 @@ hypre_PFMGRelaxSetMaxIter( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetMaxIter((pfmg_relax_data -> relax_data), max_iter);
    hypre_RedBlackGSSetMaxIter((pfmg_relax_data -> rb_relax_data), max_iter);
+   hypre_WavefrontRelaxSetMaxIter((pfmg_relax_data -> wf_relax_data), max_iter);
 
    return hypre_error_flag;
 }
@@ -274,6 +419,7 @@ hypre_PFMGRelaxSetZeroGuess( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetZeroGuess((pfmg_relax_data -> relax_data), zero_guess);
    hypre_RedBlackGSSetZeroGuess((pfmg_relax_data -> rb_relax_data), zero_guess);
+   hypre_WavefrontRelaxSetZeroGuess((pfmg_relax_data -> wf_relax_data), zero_guess);
 
    return hypre_error_flag;
 }
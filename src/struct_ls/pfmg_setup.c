@@ -147,6 +147,13 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 
    HYPRE_ANNOTATION_BEGIN("PFMG.setup");
 
+   /* count the communication of the cycle from here on */
+   if ((pfmg_data -> comm_stats) && !(pfmg_data -> comm_stats_on))
+   {
+      hypre_comm_stats_active++;
+      (pfmg_data -> comm_stats_on) = 1;
+   }
+
    /*-----------------------------------------------------
     * Set up coarse grids
     *-----------------------------------------------------*/
@@ -435,6 +442,12 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 
       A_l[l+1] = hypre_PFMGCreateRAPOp(RT_l[l], A_l[l], P_l[l],
                                        grid_l[l+1], cdir, rap_type);
+      if (relax_type == 4)
+      {
+         hypre_PFMGRelaxSetMatrixNumGhost(A_l[l+1],
+                                          hypre_max((pfmg_data -> num_pre_relax),
+                                                    (pfmg_data -> num_post_relax)));
+      }
       hypre_StructMatrixInitializeShell(A_l[l+1]);
       data_size += hypre_StructMatrixDataSize(A_l[l+1]);
       data_size_const += hypre_StructMatrixDataConstSize(A_l[l+1]);
@@ -342,10 +342,10 @@ hypre_PFMGBuildCoarseOp5( hypre_StructMatrix *A,
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_cb,a_cb,pa,rap_ca,a_ca,pb,a_cw,a_ce,rap_cw,rap_ce,rap_cc,a_cc)
-         hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                             P_dbox, cstart, stridec, iP,
-                             A_dbox, fstart, stridef, iA,
-                             RAP_dbox, cstart, stridec, iAc);
+         hypre_BoxLoop3SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                                 P_dbox, cstart, stridec, iP,
+                                 A_dbox, fstart, stridef, iA,
+                                 RAP_dbox, cstart, stridec, iAc);
          {
             HYPRE_Int iAm1,iAp1,iPm1,iPp1;
             HYPRE_Real  west, east;
@@ -375,7 +375,7 @@ hypre_PFMGBuildCoarseOp5( hypre_StructMatrix *A,
                + a_cb[iA] * pb[iP-pbOffset] + a_ca[iA] * pa[iP]
                - west - east;
          }
-         hypre_BoxLoop3End(iP, iA, iAc);
+         hypre_BoxLoop3SimdEnd(iP, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
       }
@@ -151,13 +151,11 @@ hypre_PFMGSolve( void               *pfmg_vdata,
       hypre_PFMGRelaxSetPreRelax(relax_data_l[0]);
       hypre_PFMGRelaxSetMaxIter(relax_data_l[0], num_pre_relax);
       hypre_PFMGRelaxSetZeroGuess(relax_data_l[0], zero_guess);
-      hypre_PFMGRelax(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
-      zero_guess = 0;
 
-      /* compute fine grid residual (b - Ax) */
-      hypre_StructCopy(b_l[0], r_l[0]);
-      hypre_StructMatvecCompute(matvec_data_l[0],
-                                -1.0, A_l[0], x_l[0], 1.0, r_l[0]);
+      /* relax and compute fine grid residual (b - Ax) */
+      hypre_PFMGRelaxResidual(relax_data_l[0], matvec_data_l[0],
+                              A_l[0], b_l[0], x_l[0], r_l[0]);
+      zero_guess = 0;
 
       /* convergence check */
       if (tol > 0.0)
@@ -217,12 +215,10 @@ hypre_PFMGSolve( void               *pfmg_vdata,
                hypre_PFMGRelaxSetPreRelax(relax_data_l[l]);
                hypre_PFMGRelaxSetMaxIter(relax_data_l[l], num_pre_relax);
                hypre_PFMGRelaxSetZeroGuess(relax_data_l[l], 1);
-               hypre_PFMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
 
-               /* compute residual (b - Ax) */
-               hypre_StructCopy(b_l[l], r_l[l]);
-               hypre_StructMatvecCompute(matvec_data_l[l],
-                                         -1.0, A_l[l], x_l[l], 1.0, r_l[l]);
+               /* relax and compute residual (b - Ax) */
+               hypre_PFMGRelaxResidual(relax_data_l[l], matvec_data_l[l],
+                                       A_l[l], b_l[l], x_l[l], r_l[l]);
             }
             else
             {
@@ -135,6 +135,33 @@ hypre_PointRelaxDestroy( void *relax_vdata )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Adds the communication statistics of the pointset sweeps to stats and
+ * resets them (see hypre_CommPkgGetStats).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxCommStats( void       *relax_vdata,
+                           HYPRE_Real *stats )
+{
+   hypre_PointRelaxData *relax_data = (hypre_PointRelaxData *)relax_vdata;
+   HYPRE_Int             i;
+
+   if (relax_data && (relax_data -> compute_pkgs))
+   {
+      for (i = 0; i < (relax_data -> num_pointsets); i++)
+      {
+         if (relax_data -> compute_pkgs[i])
+         {
+            hypre_CommPkgGetStats(
+               hypre_ComputePkgCommPkg(relax_data -> compute_pkgs[i]), stats);
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
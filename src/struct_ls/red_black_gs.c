@@ -69,6 +69,26 @@ hypre_RedBlackGSDestroy( void *relax_vdata )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Adds the communication statistics of the red and black sweeps to stats
+ * and resets them (see hypre_CommPkgGetStats).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSCommStats( void       *relax_vdata,
+                           HYPRE_Real *stats )
+{
+   hypre_RedBlackGSData *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+
+   if (relax_data && (relax_data -> compute_pkg))
+   {
+      hypre_CommPkgGetStats(hypre_ComputePkgCommPkg(relax_data -> compute_pkg),
+                            stats);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
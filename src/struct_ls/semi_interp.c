@@ -368,3 +368,23 @@ hypre_SemiInterpDestroy( void *interp_vdata )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Adds the communication statistics of the interpolation to stats and
+ * resets them (see hypre_CommPkgGetStats).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiInterpCommStats( void       *interp_vdata,
+                           HYPRE_Real *stats )
+{
+   hypre_SemiInterpData *interp_data = (hypre_SemiInterpData *)interp_vdata;
+
+   if (interp_data && (interp_data -> compute_pkg))
+   {
+      hypre_CommPkgGetStats(hypre_ComputePkgCommPkg(interp_data -> compute_pkg),
+                            stats);
+   }
+
+   return hypre_error_flag;
+}
+
@@ -336,3 +336,23 @@ hypre_SemiRestrictDestroy( void *restrict_vdata )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Adds the communication statistics of the restriction to stats and resets
+ * them (see hypre_CommPkgGetStats).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiRestrictCommStats( void       *restrict_vdata,
+                             HYPRE_Real *stats )
+{
+   hypre_SemiRestrictData *restrict_data = (hypre_SemiRestrictData *)restrict_vdata;
+
+   if (restrict_data && (restrict_data -> compute_pkg))
+   {
+      hypre_CommPkgGetStats(hypre_ComputePkgCommPkg(restrict_data -> compute_pkg),
+                            stats);
+   }
+
+   return hypre_error_flag;
+}
+
@@ -349,11 +349,11 @@ hypre_SMG2BuildRAPSym( hypre_StructMatrix *A,
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_csw,rb,a_cw,pa,rap_cs,a_cc,a_cs,rap_cse,a_ce,rap_cw,pb,ra,rap_cc,a_cn)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
+            hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                                    PT_dbox,  cstart, stridec, iP,
+                                    R_dbox,   cstart, stridec, iR,
+                                    A_dbox,   fstart, stridef, iA,
+                                    RAP_dbox, cstart, stridec, iAc);
             {
                HYPRE_Int iAm1 = iA - yOffsetA;
                HYPRE_Int iAp1 = iA + yOffsetA;
@@ -381,7 +381,7 @@ hypre_SMG2BuildRAPSym( hypre_StructMatrix *A,
                   +                   a_cs[iA]   * pb[iP]
                   +                   a_cn[iA]   * pa[iP];
             }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+            hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
             
@@ -400,11 +400,11 @@ hypre_SMG2BuildRAPSym( hypre_StructMatrix *A,
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_csw,rb,a_cw,pa,a_csw,rap_cs,a_cc,a_cs,rap_cse,a_ce,a_cse,rap_cw,pb,ra,a_cnw,rap_cc,a_cn)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
+            hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                                    PT_dbox,  cstart, stridec, iP,
+                                    R_dbox,   cstart, stridec, iR,
+                                    A_dbox,   fstart, stridef, iA,
+                                    RAP_dbox, cstart, stridec, iAc);
             {
                HYPRE_Int iAm1 = iA - yOffsetA;
                HYPRE_Int iAp1 = iA + yOffsetA;
@@ -442,7 +442,7 @@ hypre_SMG2BuildRAPSym( hypre_StructMatrix *A,
                   +                   a_cn[iA]   * pa[iP];
 
             }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+            hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
 
@@ -658,11 +658,11 @@ hypre_SMG2BuildRAPNoSym( hypre_StructMatrix *A,
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_cne,ra,a_ce,pb,rap_cn,a_cc,a_cn,rap_cnw,a_cw,rap_ce,rb,pa)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
+            hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                                    PT_dbox,  cstart, stridec, iP,
+                                    R_dbox,   cstart, stridec, iR,
+                                    A_dbox,   fstart, stridef, iA,
+                                    RAP_dbox, cstart, stridec, iAc);
             {
                HYPRE_Int iAm1 = iA - yOffsetA;
                HYPRE_Int iAp1 = iA + yOffsetA;
@@ -684,7 +684,7 @@ hypre_SMG2BuildRAPNoSym( hypre_StructMatrix *A,
                   +          ra[iR] * a_ce[iAp1] * pa[iP1];
 
             }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+            hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
 
@@ -701,11 +701,11 @@ hypre_SMG2BuildRAPNoSym( hypre_StructMatrix *A,
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_cne,ra,a_ce,pb,a_cne,rap_cn,a_cc,a_cn,rap_cnw,a_cw,a_cnw,rap_ce,rb,pa,a_cse)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
+            hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                                    PT_dbox,  cstart, stridec, iP,
+                                    R_dbox,   cstart, stridec, iR,
+                                    A_dbox,   fstart, stridef, iA,
+                                    RAP_dbox, cstart, stridec, iAc);
             {
                HYPRE_Int iAm1 = iA - yOffsetA;
                HYPRE_Int iAp1 = iA + yOffsetA;
@@ -735,7 +735,7 @@ hypre_SMG2BuildRAPNoSym( hypre_StructMatrix *A,
                   +                   a_cne[iA]  * pa[iP1];
 
             }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+            hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
 
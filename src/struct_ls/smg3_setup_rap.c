@@ -566,11 +566,11 @@ hypre_SMG3BuildRAPSym( hypre_StructMatrix *A,
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_bs,rb,a_cs,pa,rap_bw,a_cw,rap_bc,a_bc,a_cc,rap_be,a_ce,rap_bn,a_cn,rap_cs,pb,ra,rap_cw,rap_cc,a_ac)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
+            hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                                    PT_dbox,  cstart, stridec, iP,
+                                    R_dbox,   cstart, stridec, iR,
+                                    A_dbox,   fstart, stridef, iA,
+                                    RAP_dbox, cstart, stridec, iAc);
             {                   
                HYPRE_Int iAm1 = iA - zOffsetA;
                HYPRE_Int iAp1 = iA + zOffsetA;
@@ -611,7 +611,7 @@ hypre_SMG3BuildRAPSym( hypre_StructMatrix *A,
                   +                   a_ac[iA]   * pa[iP];
 
             }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+            hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
 
@@ -631,11 +631,11 @@ hypre_SMG3BuildRAPSym( hypre_StructMatrix *A,
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_bs,rb,a_cs,pa,a_bs,rap_bw,a_cw,a_bw,rap_bc,a_bc,a_cc,rap_be,a_ce,a_be,rap_bn,a_cn,a_bn,rap_cs,pb,ra,a_as,rap_cw,a_aw,rap_cc,a_ac)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
+            hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                                    PT_dbox,  cstart, stridec, iP,
+                                    R_dbox,   cstart, stridec, iR,
+                                    A_dbox,   fstart, stridef, iA,
+                                    RAP_dbox, cstart, stridec, iAc);
             {
                HYPRE_Int iAm1 = iA - zOffsetA;
                HYPRE_Int iAp1 = iA + zOffsetA;
@@ -692,7 +692,7 @@ hypre_SMG3BuildRAPSym( hypre_StructMatrix *A,
                   +                   a_ac[iA]   * pa[iP];
 
             }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+            hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
 
@@ -713,11 +713,11 @@ hypre_SMG3BuildRAPSym( hypre_StructMatrix *A,
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_bsw,rb,a_csw,pa,rap_bs,a_cs,a_bs,rap_bse,a_cse,rap_bw,a_cw,a_bw,rap_bc,a_bc,a_cc,rap_be,a_ce,a_be,rap_bnw,a_cnw,rap_bn,a_cn,a_bn,rap_bne,a_cne,rap_csw,pb,ra,rap_cs,a_as,rap_cse,rap_cw,a_aw,rap_cc,a_ac)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
+            hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                                    PT_dbox,  cstart, stridec, iP,
+                                    R_dbox,   cstart, stridec, iR,
+                                    A_dbox,   fstart, stridef, iA,
+                                    RAP_dbox, cstart, stridec, iAc);
             {
                HYPRE_Int iAm1 = iA - zOffsetA;
                HYPRE_Int iAp1 = iA + zOffsetA;
@@ -796,7 +796,7 @@ hypre_SMG3BuildRAPSym( hypre_StructMatrix *A,
                   +                   a_ac[iA]   * pa[iP];
 
             }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+            hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
 
@@ -817,11 +817,11 @@ hypre_SMG3BuildRAPSym( hypre_StructMatrix *A,
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_bsw,rb,a_csw,pa,a_bsw,rap_bs,a_cs,a_bs,rap_bse,a_cse,a_bse,rap_bw,a_cw,a_bw,rap_bc,a_bc,a_cc,rap_be,a_ce,a_be,rap_bnw,a_cnw,a_bnw,rap_bn,a_cn,a_bn,rap_bne,a_cne,a_bne,rap_csw,pb,ra,a_asw,rap_cs,a_as,rap_cse,a_ase,rap_cw,a_aw,rap_cc,a_ac)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
+            hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                                    PT_dbox,  cstart, stridec, iP,
+                                    R_dbox,   cstart, stridec, iR,
+                                    A_dbox,   fstart, stridef, iA,
+                                    RAP_dbox, cstart, stridec, iAc);
             {
                HYPRE_Int iAm1 = iA - zOffsetA;
                HYPRE_Int iAp1 = iA + zOffsetA;
@@ -916,7 +916,7 @@ hypre_SMG3BuildRAPSym( hypre_StructMatrix *A,
                   +                   a_ac[iA]   * pa[iP];
 
             }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+            hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
 
@@ -1273,11 +1273,11 @@ hypre_SMG3BuildRAPNoSym( hypre_StructMatrix *A,
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_an,ra,a_cn,pb,rap_ae,a_ce,rap_ac,a_ac,a_cc,rap_aw,a_cw,rap_as,a_cs,rap_cn,rb,pa,rap_ce)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
+            hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                                    PT_dbox,  cstart, stridec, iP,
+                                    R_dbox,   cstart, stridec, iR,
+                                    A_dbox,   fstart, stridef, iA,
+                                    RAP_dbox, cstart, stridec, iAc);
             {
                HYPRE_Int iAm1 = iA - zOffsetA;
                HYPRE_Int iAp1 = iA + zOffsetA;
@@ -1310,7 +1310,7 @@ hypre_SMG3BuildRAPNoSym( hypre_StructMatrix *A,
                   +          ra[iR] * a_ce[iAp1] * pa[iP1];
  
             }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+            hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
 
@@ -1329,11 +1329,11 @@ hypre_SMG3BuildRAPNoSym( hypre_StructMatrix *A,
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_an,ra,a_cn,pb,a_an,rap_ae,a_ce,a_ae,rap_ac,a_ac,a_cc,rap_aw,a_cw,a_aw,rap_as,a_cs,a_as,rap_cn,rb,pa,a_bn,rap_ce,a_be)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
+            hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                                    PT_dbox,  cstart, stridec, iP,
+                                    R_dbox,   cstart, stridec, iR,
+                                    A_dbox,   fstart, stridef, iA,
+                                    RAP_dbox, cstart, stridec, iAc);
             {
                HYPRE_Int iAm1 = iA - zOffsetA;
                HYPRE_Int iAp1 = iA + zOffsetA;
@@ -1382,7 +1382,7 @@ hypre_SMG3BuildRAPNoSym( hypre_StructMatrix *A,
                   +          ra[iR] * a_be[iAp1];
  
             }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+            hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
 
@@ -1404,11 +1404,11 @@ hypre_SMG3BuildRAPNoSym( hypre_StructMatrix *A,
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_ane,ra,a_cne,pb,rap_an,a_cn,a_an,rap_anw,a_cnw,rap_ae,a_ce,a_ae,rap_ac,a_ac,a_cc,rap_aw,a_cw,a_aw,rap_ase,a_cse,rap_as,a_cs,a_as,rap_asw,a_csw,rap_cne,rb,pa,rap_cn,a_bn,rap_cnw,rap_ce,a_be)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
+            hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                                    PT_dbox,  cstart, stridec, iP,
+                                    R_dbox,   cstart, stridec, iR,
+                                    A_dbox,   fstart, stridef, iA,
+                                    RAP_dbox, cstart, stridec, iAc);
             {
                HYPRE_Int iAm1 = iA - zOffsetA;
                HYPRE_Int iAp1 = iA + zOffsetA;
@@ -1479,7 +1479,7 @@ hypre_SMG3BuildRAPNoSym( hypre_StructMatrix *A,
                   +          ra[iR] * a_be[iAp1];
  
             }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+            hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
 
@@ -1500,11 +1500,11 @@ hypre_SMG3BuildRAPNoSym( hypre_StructMatrix *A,
 
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(rap_ane,ra,a_cne,pb,a_ane,rap_an,a_cn,a_an,rap_anw,a_cnw,a_anw,rap_ae,a_ce,a_ae,rap_ac,a_ac,a_cc,rap_aw,a_cw,a_aw,rap_ase,a_cse,a_ase,rap_as,a_cs,a_as,rap_asw,a_csw,a_asw,rap_cne,rb,pa,a_bne,rap_cn,a_bn,rap_cnw,a_bnw,rap_ce,a_be)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
+            hypre_BoxLoop4SimdBegin(hypre_StructMatrixNDim(A), loop_size,
+                                    PT_dbox,  cstart, stridec, iP,
+                                    R_dbox,   cstart, stridec, iR,
+                                    A_dbox,   fstart, stridef, iA,
+                                    RAP_dbox, cstart, stridec, iAc);
             {
                HYPRE_Int iAm1 = iA - zOffsetA;
                HYPRE_Int iAp1 = iA + zOffsetA;
@@ -1592,7 +1592,7 @@ hypre_SMG3BuildRAPNoSym( hypre_StructMatrix *A,
                   +          ra[iR] * a_be[iAp1];
  
             }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+            hypre_BoxLoop4SimdEnd(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 #define DEVICE_VAR 
 
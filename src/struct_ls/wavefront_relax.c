@@ -0,0 +1,953 @@
+/*BHEADER**********************************************************************
+ * Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+ * Produced at the Lawrence Livermore National Laboratory.
+ * This file is part of HYPRE.  See file COPYRIGHT for details.
+ *
+ * HYPRE is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License (as published by the Free
+ * Software Foundation) version 2.1 dated February 1999.
+ *
+ * $Revision$
+ ***********************************************************************EHEADER*/
+
+/******************************************************************************
+ *
+ * Temporally blocked weighted Jacobi relaxation.
+ *
+ * Several Jacobi sweeps (and optionally the residual r = b - Ax) are done in
+ * one pass over each box.  The solution and right-hand side are copied into
+ * work arrays with a ghost layer deep enough for all sweeps of the pass, so
+ * only one ghost exchange is needed per pass.  Intermediate sweeps are then
+ * computed redundantly on a shrinking halo around the box, one plane at a time
+ * along the last dimension (a wavefront).  Each intermediate sweep only keeps a
+ * ring of (2r+1) planes, where r is the stencil radius, so the intermediate
+ * iterates stay in cache and each pass streams A, b and x from memory once.
+ *
+ * The halo sweeps need matrix coefficients in the ghost layer, so the number
+ * of sweeps per pass is limited by the matrix ghost layer (two sweeps for the
+ * default ghost layer of one).  hypre_WavefrontRelaxSetMatrixNumGhost requests
+ * the depth needed for a given number of sweeps; it must be called before the
+ * matrix is initialized, which PFMG does for its coarse operators.  The fine
+ * matrix belongs to the user and is already assembled at setup, so its depth
+ * is whatever was set with HYPRE_StructMatrixSetNumGhost.  Copying A into a
+ * deeper work array instead would double the matrix storage and add a pass
+ * over A, which costs more than the sweeps save.  Only constant_coefficient = 0
+ * is supported.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+
+/* chunk size for the row loops */
+#define HYPRE_WAVEFRONT_CHUNK 256
+
+/* target number of points per plane of a tile, times the stages per pass */
+#define HYPRE_WAVEFRONT_TILE 16384
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm                comm;
+
+   HYPRE_Int               max_iter;
+   HYPRE_Int               zero_guess;
+   HYPRE_Real              weight;
+
+   hypre_StructMatrix     *A;
+   hypre_StructVector     *b;
+   hypre_StructVector     *x;
+
+   HYPRE_Int               diag_rank;
+   HYPRE_Int               radius;       /* stencil radius */
+   HYPRE_Int               max_stages;   /* sweeps (+ residual) per pass */
+
+   hypre_BoxArray         *w_data_space; /* boxes grown by radius*max_stages */
+   HYPRE_Int              *w_data_indices;
+   HYPRE_Real             *xw_data;      /* copy of x with deep ghost layer */
+   HYPRE_Real             *bw_data;      /* copy of b with deep ghost layer */
+   hypre_CommPkg          *x_comm_pkg;
+   hypre_CommPkg          *b_comm_pkg;
+
+   HYPRE_Int               tile_rows;    /* tile size along dimension 1 */
+   HYPRE_Int               plane_size;   /* max size of a ring buffer plane */
+   HYPRE_Int               ring_size;    /* size of the ring buffers of a thread */
+   HYPRE_Real             *ring_data;    /* ring buffers for interior sweeps */
+
+   /* log info (always logged) */
+   HYPRE_Int               num_iterations;
+   HYPRE_Int               time_index;
+   HYPRE_Int               flops;
+
+} hypre_WavefrontRelaxData;
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_WavefrontRelaxCreate( MPI_Comm  comm )
+{
+   hypre_WavefrontRelaxData *relax_data;
+
+   relax_data = hypre_CTAlloc(hypre_WavefrontRelaxData, 1, HYPRE_MEMORY_HOST);
+
+   (relax_data -> comm)       = comm;
+   (relax_data -> time_index) = hypre_InitializeTiming("WavefrontRelax");
+
+   /* set defaults */
+   (relax_data -> max_iter)       = 1000;
+   (relax_data -> zero_guess)     = 0;
+   (relax_data -> weight)         = 1.0;
+   (relax_data -> A)              = NULL;
+   (relax_data -> b)              = NULL;
+   (relax_data -> x)              = NULL;
+   (relax_data -> w_data_space)   = NULL;
+   (relax_data -> w_data_indices) = NULL;
+   (relax_data -> xw_data)        = NULL;
+   (relax_data -> bw_data)        = NULL;
+   (relax_data -> x_comm_pkg)     = NULL;
+   (relax_data -> b_comm_pkg)     = NULL;
+   (relax_data -> ring_data)      = NULL;
+
+   return (void *) relax_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_WavefrontRelaxDestroy( void *relax_vdata )
+{
+   hypre_WavefrontRelaxData *relax_data = (hypre_WavefrontRelaxData *)relax_vdata;
+
+   if (relax_data)
+   {
+      hypre_StructMatrixDestroy(relax_data -> A);
+      hypre_StructVectorDestroy(relax_data -> b);
+      hypre_StructVectorDestroy(relax_data -> x);
+      hypre_BoxArrayDestroy(relax_data -> w_data_space);
+      hypre_TFree(relax_data -> w_data_indices, HYPRE_MEMORY_HOST);
+      hypre_TFree(relax_data -> xw_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(relax_data -> bw_data, HYPRE_MEMORY_HOST);
+      hypre_CommPkgDestroy(relax_data -> x_comm_pkg);
+      hypre_CommPkgDestroy(relax_data -> b_comm_pkg);
+      hypre_TFree(relax_data -> ring_data, HYPRE_MEMORY_HOST);
+
+      hypre_FinalizeTiming(relax_data -> time_index);
+      hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Adds the communication statistics of the deep ghost exchanges of x and b
+ * to stats and resets them (see hypre_CommPkgGetStats).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_WavefrontRelaxCommStats( void       *relax_vdata,
+                               HYPRE_Real *stats )
+{
+   hypre_WavefrontRelaxData *relax_data = (hypre_WavefrontRelaxData *)relax_vdata;
+
+   if (relax_data)
+   {
+      hypre_CommPkgGetStats(relax_data -> x_comm_pkg, stats);
+      hypre_CommPkgGetStats(relax_data -> b_comm_pkg, stats);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Return the stencil radius of A (at least one).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_WavefrontRelaxRadius( hypre_StructMatrix *A )
+{
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+   hypre_StructStencil   *stencil = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size = hypre_StructStencilSize(stencil);
+   HYPRE_Int              radius, si, d;
+
+   radius = 1;
+   for (si = 0; si < stencil_size; si++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         radius = hypre_max(radius, hypre_abs(hypre_IndexD(stencil_shape[si], d)));
+      }
+   }
+
+   return radius;
+}
+
+/*--------------------------------------------------------------------------
+ * Increase the ghost layer of A so that num_sweeps sweeps and the residual
+ * can be done in one pass.  Must be called before A is initialized.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_WavefrontRelaxSetMatrixNumGhost( hypre_StructMatrix *A,
+                                       HYPRE_Int           num_sweeps )
+{
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+   HYPRE_Int             *A_num_ghost = hypre_StructMatrixNumGhost(A);
+   HYPRE_Int              num_ghost[2*HYPRE_MAXDIM];
+   HYPRE_Int              radius, depth, d;
+
+   radius = hypre_WavefrontRelaxRadius(A);
+   depth = radius*num_sweeps;
+   if (hypre_StructMatrixSymmetric(A))
+   {
+      depth += radius;
+   }
+   for (d = 0; d < 2*HYPRE_MAXDIM; d++)
+   {
+      num_ghost[d] = A_num_ghost[d];
+      if (d < 2*ndim)
+      {
+         num_ghost[d] = hypre_max(num_ghost[d], depth);
+      }
+   }
+   hypre_StructMatrixSetNumGhost(A, num_ghost);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * The matrix must have constant_coefficient = 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_WavefrontRelaxSetup( void               *relax_vdata,
+                           hypre_StructMatrix *A,
+                           hypre_StructVector *b,
+                           hypre_StructVector *x           )
+{
+   hypre_WavefrontRelaxData *relax_data = (hypre_WavefrontRelaxData *)relax_vdata;
+
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+   hypre_StructGrid      *grid = hypre_StructMatrixGrid(A);
+   hypre_StructStencil   *stencil = hypre_StructMatrixStencil(A);
+   HYPRE_Int             *A_num_ghost = hypre_StructMatrixNumGhost(A);
+   hypre_BoxArray        *boxes = hypre_StructGridBoxes(grid);
+
+   hypre_BoxArray        *w_data_space;
+   HYPRE_Int             *w_data_indices;
+   hypre_Box             *w_box;
+   hypre_CommInfo        *comm_info;
+   hypre_CommPkg         *comm_pkg;
+   hypre_Index            diag_index;
+   HYPRE_Int              num_ghost[2*HYPRE_MAXDIM];
+   HYPRE_Int              radius, A_depth, max_stages;
+   HYPRE_Int              w_data_size, row_size, tile_rows;
+   HYPRE_Int              plane_size, ring_size;
+   HYPRE_Int              i, d;
+
+   if (hypre_StructMatrixConstantCoefficient(A))
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   /*----------------------------------------------------------
+    * Free up the data of a previous setup
+    *----------------------------------------------------------*/
+
+   hypre_StructMatrixDestroy(relax_data -> A);
+   hypre_StructVectorDestroy(relax_data -> b);
+   hypre_StructVectorDestroy(relax_data -> x);
+   hypre_BoxArrayDestroy(relax_data -> w_data_space);
+   hypre_TFree(relax_data -> w_data_indices, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> xw_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> bw_data, HYPRE_MEMORY_HOST);
+   hypre_CommPkgDestroy(relax_data -> x_comm_pkg);
+   hypre_CommPkgDestroy(relax_data -> b_comm_pkg);
+   hypre_TFree(relax_data -> ring_data, HYPRE_MEMORY_HOST);
+
+   /*----------------------------------------------------------
+    * Find the matrix diagonal and the stencil radius
+    *----------------------------------------------------------*/
+
+   hypre_SetIndex3(diag_index, 0, 0, 0);
+   (relax_data -> diag_rank) = hypre_StructStencilElementRank(stencil, diag_index);
+
+   radius = hypre_WavefrontRelaxRadius(A);
+
+   /*----------------------------------------------------------
+    * The number of stages per pass is limited by the depth of the ghost
+    * layer in which all matrix coefficients are available.  With symmetric
+    * storage, the extra ghost layer only holds the stored half.
+    *----------------------------------------------------------*/
+
+   A_depth = A_num_ghost[0];
+   for (d = 0; d < 2*ndim; d++)
+   {
+      A_depth = hypre_min(A_depth, A_num_ghost[d]);
+   }
+   if (hypre_StructMatrixSymmetric(A))
+   {
+      A_depth -= radius;
+   }
+   max_stages = hypre_max(A_depth, 0) / radius + 1;
+
+   /*----------------------------------------------------------
+    * Set up the work arrays and their communication packages
+    *----------------------------------------------------------*/
+
+   for (d = 0; d < 2*HYPRE_MAXDIM; d++)
+   {
+      num_ghost[d] = (d < 2*ndim) ? radius*max_stages : 0;
+   }
+
+   w_data_space = hypre_BoxArrayCreate(hypre_BoxArraySize(boxes), ndim);
+   w_data_indices = hypre_CTAlloc(HYPRE_Int, hypre_BoxArraySize(boxes), HYPRE_MEMORY_HOST);
+   w_data_size = 0;
+   row_size = 1;
+   hypre_ForBoxI(i, boxes)
+   {
+      w_box = hypre_BoxArrayBox(w_data_space, i);
+      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), w_box);
+      hypre_BoxGrowByArray(w_box, num_ghost);
+      w_data_indices[i] = w_data_size;
+      w_data_size += hypre_BoxVolume(w_box);
+      if (ndim > 1)
+      {
+         row_size = hypre_max(row_size, hypre_BoxSizeD(w_box, 0));
+      }
+   }
+
+   /*----------------------------------------------------------
+    * In 3D, boxes are split along dimension 1 into tiles small enough for
+    * the matrix coefficients of the planes in flight to stay in cache.  The
+    * ring buffer planes cover a tile grown by the deepest sweep halo.
+    *----------------------------------------------------------*/
+
+   tile_rows = 1;
+   plane_size = 1;
+   if (ndim > 1)
+   {
+      plane_size = row_size;
+   }
+   if (ndim > 2)
+   {
+      tile_rows = hypre_max(HYPRE_WAVEFRONT_TILE / (row_size * max_stages), 1);
+      plane_size = row_size * (tile_rows + 2*radius*(max_stages - 1));
+   }
+   ring_size = (max_stages - 1)*(2*radius + 1)*plane_size;
+
+   hypre_CreateCommInfoFromNumGhost(grid, num_ghost, &comm_info);
+   hypre_CommPkgCreate(comm_info, hypre_StructVectorDataSpace(x), w_data_space,
+                       1, NULL, 0, hypre_StructVectorComm(x), &comm_pkg);
+   (relax_data -> x_comm_pkg) = comm_pkg;
+   hypre_CommPkgCreate(comm_info, hypre_StructVectorDataSpace(b), w_data_space,
+                       1, NULL, 0, hypre_StructVectorComm(b), &comm_pkg);
+   (relax_data -> b_comm_pkg) = comm_pkg;
+   hypre_CommInfoDestroy(comm_info);
+
+   /* ghost values outside of the grid are never received and stay zero */
+   (relax_data -> xw_data) = hypre_CTAlloc(HYPRE_Real, w_data_size, HYPRE_MEMORY_HOST);
+   (relax_data -> bw_data) = hypre_CTAlloc(HYPRE_Real, w_data_size, HYPRE_MEMORY_HOST);
+   (relax_data -> ring_data) =
+      hypre_CTAlloc(HYPRE_Real, hypre_NumThreads()*ring_size, HYPRE_MEMORY_HOST);
+
+   (relax_data -> w_data_space)   = w_data_space;
+   (relax_data -> w_data_indices) = w_data_indices;
+   (relax_data -> plane_size)     = plane_size;
+   (relax_data -> ring_size)      = ring_size;
+   (relax_data -> tile_rows)      = tile_rows;
+   (relax_data -> radius)         = radius;
+   (relax_data -> max_stages)     = max_stages;
+
+   /*----------------------------------------------------------
+    * Set up the relax data structure
+    *----------------------------------------------------------*/
+
+   (relax_data -> A) = hypre_StructMatrixRef(A);
+   (relax_data -> x) = hypre_StructVectorRef(x);
+   (relax_data -> b) = hypre_StructVectorRef(b);
+
+   (relax_data -> flops) = (hypre_StructMatrixGlobalSize(A) +
+                            hypre_StructVectorGlobalSize(x));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Copy the values of vector v on the grid boxes into the work array w_data and
+ * fill its ghost layer from the neighboring boxes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_WavefrontRelaxFillWork( void               *relax_vdata,
+                              hypre_StructVector *v,
+                              HYPRE_Real         *w_data,
+                              hypre_CommPkg      *comm_pkg    )
+{
+   hypre_WavefrontRelaxData *relax_data = (hypre_WavefrontRelaxData *)relax_vdata;
+
+   HYPRE_Int              ndim = hypre_StructVectorNDim(v);
+   hypre_BoxArray        *boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(v));
+   hypre_BoxArray        *w_data_space = (relax_data -> w_data_space);
+   HYPRE_Int             *w_data_indices = (relax_data -> w_data_indices);
+
+   hypre_CommHandle      *comm_handle;
+   hypre_Box             *box;
+   hypre_Box             *v_data_box;
+   hypre_Box             *w_data_box;
+   HYPRE_Real            *vp;
+   HYPRE_Real            *wp;
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+   hypre_Index            unit_stride;
+   HYPRE_Int              i;
+
+   hypre_SetIndex(unit_stride, 1);
+
+   hypre_InitializeCommunication(comm_pkg, hypre_StructVectorData(v), w_data,
+                                 0, 0, &comm_handle);
+
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+      v_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(v), i);
+      w_data_box = hypre_BoxArrayBox(w_data_space, i);
+      vp = hypre_StructVectorBoxData(v, i);
+      wp = w_data + w_data_indices[i];
+
+      hypre_BoxGetSize(box, loop_size);
+
+      hypre_BoxLoop2Begin(ndim, loop_size,
+                          v_data_box, start, unit_stride, vi,
+                          w_data_box, start, unit_stride, wi);
+      {
+         wp[wi] = vp[vi];
+      }
+      hypre_BoxLoop2End(vi, wi);
+   }
+
+   hypre_FinalizeCommunication(comm_handle);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Do one pass of num_stages stages on box i.  Each stage is a weighted Jacobi
+ * sweep, except the last one when 'residual' is set, which computes
+ * r = b - Ax.  If 'zero' is set, the first sweep assumes x = 0.
+ *
+ * Stage j is computed on the box grown by radius*(num_stages - j), plane by
+ * plane along the last dimension.  Plane z of stage j is computed at step
+ * z + (j-1)*radius, after the planes of stage j-1 it depends on.
+ *
+ * Ap (stencil_size pointers) and offsets (3*stencil_size integers) are
+ * scratch space provided by the caller.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_WavefrontRelaxBox( void               *relax_vdata,
+                         HYPRE_Int           i,
+                         HYPRE_Int           num_stages,
+                         HYPRE_Int           residual,
+                         HYPRE_Int           zero,
+                         hypre_StructVector *r,
+                         HYPRE_Real        **Ap,
+                         HYPRE_Int          *offsets     )
+{
+   hypre_WavefrontRelaxData *relax_data = (hypre_WavefrontRelaxData *)relax_vdata;
+
+   hypre_StructMatrix    *A = (relax_data -> A);
+   hypre_StructVector    *x = (relax_data -> x);
+   HYPRE_Real             weight = (relax_data -> weight);
+   HYPRE_Int              diag_rank = (relax_data -> diag_rank);
+   HYPRE_Int              radius = (relax_data -> radius);
+   HYPRE_Int              plane_size = (relax_data -> plane_size);
+   HYPRE_Int              num_planes = 2*radius + 1;
+
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+   hypre_StructStencil   *stencil = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size = hypre_StructStencilSize(stencil);
+   hypre_Box             *box = hypre_BoxArrayBox(hypre_StructGridBoxes(hypre_StructMatrixGrid(A)), i);
+   hypre_Box             *A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+   hypre_Box             *x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+   hypre_Box             *w_data_box = hypre_BoxArrayBox((relax_data -> w_data_space), i);
+   hypre_Box             *r_data_box = NULL;
+   HYPRE_Real            *xwp = (relax_data -> xw_data) + (relax_data -> w_data_indices)[i];
+   HYPRE_Real            *bwp = (relax_data -> bw_data) + (relax_data -> w_data_indices)[i];
+   HYPRE_Real            *xp = hypre_StructVectorBoxData(x, i);
+   HYPRE_Real            *rp = NULL;
+   HYPRE_Int              ring_size = (relax_data -> ring_size);
+   HYPRE_Int              tile_rows = (relax_data -> tile_rows);
+
+   /* dimension 0 is contiguous and the wavefront moves along dimension wd */
+   HYPRE_Int              wd = ndim - 1;
+   HYPRE_Int              d1 = (ndim > 2) ? 1 : HYPRE_MAXDIM;
+   HYPRE_Int              A_stride[HYPRE_MAXDIM+1];
+   HYPRE_Int              x_stride[HYPRE_MAXDIM+1];
+   HYPRE_Int              w_stride[HYPRE_MAXDIM+1];
+   HYPRE_Int              r_stride[HYPRE_MAXDIM+1];
+   HYPRE_Int              e_size0;
+
+   HYPRE_Int              A_off;
+   HYPRE_Int             *w_off      = offsets;
+   HYPRE_Int             *ring_off   = offsets + stencil_size;
+   HYPRE_Int             *ring_plane = offsets + 2*stencil_size;
+   HYPRE_Int              g1, num_tiles, t, si, d;
+
+   if (residual)
+   {
+      r_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(r), i);
+      rp = hypre_StructVectorBoxData(r, i);
+   }
+
+   /* set up strides, with a trailing zero stride for unused dimensions */
+   for (d = 0; d <= HYPRE_MAXDIM; d++)
+   {
+      A_stride[d] = 0;
+      x_stride[d] = 0;
+      w_stride[d] = 0;
+      r_stride[d] = 0;
+   }
+   A_stride[0] = x_stride[0] = w_stride[0] = r_stride[0] = 1;
+   for (d = 1; d < ndim; d++)
+   {
+      A_stride[d] = A_stride[d-1] * hypre_BoxSizeD(A_data_box, d-1);
+      x_stride[d] = x_stride[d-1] * hypre_BoxSizeD(x_data_box, d-1);
+      w_stride[d] = w_stride[d-1] * hypre_BoxSizeD(w_data_box, d-1);
+      if (residual)
+      {
+         r_stride[d] = r_stride[d-1] * hypre_BoxSizeD(r_data_box, d-1);
+      }
+   }
+
+   /* the ring buffer planes cover the stage 1 extents */
+   g1 = radius*(num_stages - 1);
+   e_size0 = hypre_BoxSizeD(box, 0) + 2*g1;
+   if (ndim == 1)
+   {
+      e_size0 = 1;
+   }
+
+   A_off = hypre_BoxIndexRank(A_data_box, hypre_BoxIMin(box));
+   for (si = 0; si < stencil_size; si++)
+   {
+      Ap[si] = hypre_StructMatrixBoxData(A, i, si);
+      w_off[si] = 0;
+      ring_off[si] = 0;
+      for (d = 0; d < ndim; d++)
+      {
+         w_off[si] += hypre_IndexD(stencil_shape[si], d) * w_stride[d];
+      }
+      if (ndim > 1)
+      {
+         ring_off[si] = hypre_IndexD(stencil_shape[si], 0);
+      }
+      if (ndim > 2)
+      {
+         ring_off[si] += hypre_IndexD(stencil_shape[si], 1) * e_size0;
+      }
+      ring_plane[si] = hypre_IndexD(stencil_shape[si], wd);
+   }
+
+   /* tiles of tile_rows rows along dimension 1 are done independently */
+   num_tiles = 1;
+   if (ndim > 2)
+   {
+      num_tiles = (hypre_BoxSizeD(box, 1) + tile_rows - 1) / tile_rows;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(t) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_tiles; t++)
+   {
+      HYPRE_Real  tmp[HYPRE_WAVEFRONT_CHUNK];
+      HYPRE_Real  xc[HYPRE_WAVEFRONT_CHUNK];
+      HYPRE_Real *Aq[4];
+      HYPRE_Real *Xq[4];
+      HYPRE_Real *xs;
+      HYPRE_Real *src;
+      HYPRE_Real *dst;
+      HYPRE_Real *Ad;
+      HYPRE_Real *bp;
+      HYPRE_Real *ring;
+      HYPRE_Int   lo[HYPRE_MAXDIM+1];
+      HYPRE_Int   hi[HYPRE_MAXDIM+1];
+      HYPRE_Int   e_lo[HYPRE_MAXDIM+1];
+      HYPRE_Int   t_lo[HYPRE_MAXDIM+1];
+      HYPRE_Int   t_hi[HYPRE_MAXDIM+1];
+      HYPRE_Int   index[HYPRE_MAXDIM+1];
+      HYPRE_Int   Ai, wi, ei, xi, ri, ii, i0, len, k, nq, in_tile;
+      HYPRE_Int   g, j, z, step, last_step, row, nrows, n0, si, sweep, is_last;
+
+      ring = (relax_data -> ring_data) + hypre_GetThreadNum()*ring_size;
+
+      /* the tile, and the stage 1 extents covered by the ring buffer planes */
+      for (k = 0; k <= HYPRE_MAXDIM; k++)
+      {
+         t_lo[k] = 0;
+         t_hi[k] = 0;
+         e_lo[k] = 0;
+         lo[k] = 0;
+         hi[k] = 0;
+      }
+      for (k = 0; k < ndim; k++)
+      {
+         t_lo[k] = hypre_BoxIMinD(box, k);
+         t_hi[k] = hypre_BoxIMaxD(box, k);
+      }
+      if (ndim > 2)
+      {
+         t_lo[1] += t*tile_rows;
+         t_hi[1] = hypre_min(t_lo[1] + tile_rows - 1, t_hi[1]);
+      }
+      for (k = 0; k < ndim; k++)
+      {
+         e_lo[k] = t_lo[k] - g1;
+      }
+
+      last_step = t_hi[wd] + g1 + (num_stages - 1)*radius;
+      for (step = t_lo[wd] - g1; step <= last_step; step++)
+      {
+         for (j = 1; j <= num_stages; j++)
+         {
+            z = step - (j-1)*radius;
+            g = radius*(num_stages - j);
+            if ((z < t_lo[wd] - g) || (z > t_hi[wd] + g))
+            {
+               continue;
+            }
+
+            is_last = (j == num_stages);
+            sweep = !(is_last && residual);
+
+            /* extents of this stage in the plane dimensions */
+            for (k = 0; k < wd; k++)
+            {
+               lo[k] = t_lo[k] - g;
+               hi[k] = t_hi[k] + g;
+            }
+            lo[wd] = hi[wd] = z;
+            n0 = (ndim > 1) ? (hi[0] - lo[0] + 1) : 1;
+            nrows = (ndim > 2) ? (hi[1] - lo[1] + 1) : 1;
+
+            for (row = 0; row < nrows; row++)
+            {
+               for (k = 0; k <= HYPRE_MAXDIM; k++)
+               {
+                  index[k] = lo[k];
+               }
+               index[d1] = lo[d1] + row;
+
+               /* offsets of the first point of the row */
+               Ai = 0;
+               wi = 0;
+               xi = 0;
+               ri = 0;
+               for (k = 0; k < ndim; k++)
+               {
+                  Ai += (index[k] - hypre_BoxIMinD(box, k)) * A_stride[k];
+                  wi += (index[k] - hypre_BoxIMinD(w_data_box, k)) * w_stride[k];
+                  xi += (index[k] - hypre_BoxIMinD(x_data_box, k)) * x_stride[k];
+                  if (residual)
+                  {
+                     ri += (index[k] - hypre_BoxIMinD(r_data_box, k)) * r_stride[k];
+                  }
+               }
+               ei = 0;
+               if (ndim > 1)
+               {
+                  ei = index[0] - e_lo[0];
+               }
+               if (ndim > 2)
+               {
+                  ei += (index[1] - e_lo[1]) * e_size0;
+               }
+
+               /* is the row inside the tile (only the dimension 0 range is not) */
+               in_tile = 1;
+               for (k = 1; k < ndim; k++)
+               {
+                  if ((index[k] < t_lo[k]) || (index[k] > t_hi[k]))
+                  {
+                     in_tile = 0;
+                  }
+               }
+
+               for (i0 = 0; i0 < n0; i0 += HYPRE_WAVEFRONT_CHUNK)
+               {
+                  len = hypre_min(HYPRE_WAVEFRONT_CHUNK, n0 - i0);
+
+                  /* off-diagonal part of A times the previous iterate */
+                  for (ii = 0; ii < len; ii++)
+                  {
+                     tmp[ii] = 0.0;
+                  }
+                  xs = xc;
+                  if (!(zero && j == 1))
+                  {
+                     /* accumulate in groups of up to four entries */
+                     nq = 0;
+                     for (si = 0; si <= stencil_size; si++)
+                     {
+                        if (si < stencil_size)
+                        {
+                           if (j == 1)
+                           {
+                              src = xwp + wi + i0 + w_off[si];
+                           }
+                           else
+                           {
+                              k = (z + ring_plane[si] - e_lo[wd]) % num_planes;
+                              src = ring + ((j-2)*num_planes + k)*plane_size +
+                                 ei + i0 + ring_off[si];
+                           }
+                           if (si == diag_rank)
+                           {
+                              xs = src;
+                              continue;
+                           }
+                           Aq[nq] = Ap[si] + A_off + Ai + i0;
+                           Xq[nq] = src;
+                           nq++;
+                           if (nq < 4)
+                           {
+                              continue;
+                           }
+                        }
+                        switch (nq)
+                        {
+                           case 4:
+                              for (ii = 0; ii < len; ii++)
+                              {
+                                 tmp[ii] += Aq[0][ii] * Xq[0][ii] + Aq[1][ii] * Xq[1][ii] +
+                                    Aq[2][ii] * Xq[2][ii] + Aq[3][ii] * Xq[3][ii];
+                              }
+                              break;
+                           case 3:
+                              for (ii = 0; ii < len; ii++)
+                              {
+                                 tmp[ii] += Aq[0][ii] * Xq[0][ii] + Aq[1][ii] * Xq[1][ii] +
+                                    Aq[2][ii] * Xq[2][ii];
+                              }
+                              break;
+                           case 2:
+                              for (ii = 0; ii < len; ii++)
+                              {
+                                 tmp[ii] += Aq[0][ii] * Xq[0][ii] + Aq[1][ii] * Xq[1][ii];
+                              }
+                              break;
+                           case 1:
+                              for (ii = 0; ii < len; ii++)
+                              {
+                                 tmp[ii] += Aq[0][ii] * Xq[0][ii];
+                              }
+                              break;
+                        }
+                        nq = 0;
+                     }
+                  }
+                  else
+                  {
+                     for (ii = 0; ii < len; ii++)
+                     {
+                        xc[ii] = 0.0;
+                     }
+                  }
+
+                  Ad = Ap[diag_rank] + A_off + Ai + i0;
+                  bp = bwp + wi + i0;
+                  if (!sweep)
+                  {
+                     dst = rp + ri + i0;
+                     for (ii = 0; ii < len; ii++)
+                     {
+                        dst[ii] = bp[ii] - tmp[ii] - Ad[ii] * xs[ii];
+                     }
+                     continue;
+                  }
+
+                  if (is_last)
+                  {
+                     dst = xp + xi + i0;
+                  }
+                  else
+                  {
+                     k = (z - e_lo[wd]) % num_planes;
+                     dst = ring + ((j-1)*num_planes + k)*plane_size + ei + i0;
+                  }
+                  for (ii = 0; ii < len; ii++)
+                  {
+                     dst[ii] = (1.0 - weight) * xs[ii] +
+                        weight * (bp[ii] - tmp[ii]) / Ad[ii];
+                  }
+
+                  /* the last sweep before a residual also updates x */
+                  if ((j == num_stages - 1) && residual && in_tile)
+                  {
+                     for (ii = 0; ii < len; ii++)
+                     {
+                        k = index[0] + i0 + ii;
+                        if ((k >= hypre_BoxIMinD(box, 0)) && (k <= hypre_BoxIMaxD(box, 0)))
+                        {
+                           xp[xi + i0 + ii] = dst[ii];
+                        }
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Do max_iter weighted Jacobi sweeps.  If r is not NULL, also compute the
+ * residual r = b - Ax in the same pass as the last sweep.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_WavefrontRelax( void               *relax_vdata,
+                      hypre_StructMatrix *A,
+                      hypre_StructVector *b,
+                      hypre_StructVector *x,
+                      hypre_StructVector *r           )
+{
+   hypre_WavefrontRelaxData *relax_data = (hypre_WavefrontRelaxData *)relax_vdata;
+
+   HYPRE_Int              max_iter   = (relax_data -> max_iter);
+   HYPRE_Int              zero_guess = (relax_data -> zero_guess);
+   HYPRE_Int              max_stages = (relax_data -> max_stages);
+   hypre_BoxArray        *boxes;
+   HYPRE_Real           **Ap;
+   HYPRE_Int             *offsets;
+   HYPRE_Int              stencil_size;
+   HYPRE_Int              num_stages, stages_left, residual, zero;
+   HYPRE_Int              i;
+
+   /*----------------------------------------------------------
+    * Initialize some things and deal with special cases
+    *----------------------------------------------------------*/
+
+   hypre_BeginTiming(relax_data -> time_index);
+
+   hypre_StructMatrixDestroy(relax_data -> A);
+   hypre_StructVectorDestroy(relax_data -> b);
+   hypre_StructVectorDestroy(relax_data -> x);
+   (relax_data -> A) = hypre_StructMatrixRef(A);
+   (relax_data -> x) = hypre_StructVectorRef(x);
+   (relax_data -> b) = hypre_StructVectorRef(b);
+
+   (relax_data -> num_iterations) = 0;
+
+   if ((max_iter == 0) && zero_guess)
+   {
+      hypre_StructVectorSetConstantValues(x, 0.0);
+      zero_guess = 0;
+   }
+   if ((max_iter == 0) && (r == NULL))
+   {
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
+   /*----------------------------------------------------------
+    * Do the sweeps in passes of at most max_stages stages
+    *----------------------------------------------------------*/
+
+   boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+   stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+   Ap      = hypre_TAlloc(HYPRE_Real *, stencil_size, HYPRE_MEMORY_HOST);
+   offsets = hypre_TAlloc(HYPRE_Int, 3*stencil_size, HYPRE_MEMORY_HOST);
+
+   hypre_WavefrontRelaxFillWork(relax_vdata, b, (relax_data -> bw_data),
+                                (relax_data -> b_comm_pkg));
+
+   stages_left = max_iter + (r != NULL);
+   zero = zero_guess;
+   while (stages_left > 0)
+   {
+      num_stages = hypre_min(max_stages, stages_left);
+      residual = (r != NULL) && (num_stages == stages_left);
+
+      if (!zero)
+      {
+         hypre_WavefrontRelaxFillWork(relax_vdata, x, (relax_data -> xw_data),
+                                      (relax_data -> x_comm_pkg));
+      }
+
+      hypre_ForBoxI(i, boxes)
+      {
+         hypre_WavefrontRelaxBox(relax_vdata, i, num_stages, residual, zero, r,
+                                 Ap, offsets);
+      }
+
+      stages_left -= num_stages;
+      zero = 0;
+   }
+
+   hypre_TFree(Ap, HYPRE_MEMORY_HOST);
+   hypre_TFree(offsets, HYPRE_MEMORY_HOST);
+
+   (relax_data -> num_iterations) = max_iter;
+
+   /*-----------------------------------------------------------------------
+    * Return
+    *-----------------------------------------------------------------------*/
+
+   hypre_IncFLOPCount((relax_data -> flops) * (max_iter + (r != NULL)));
+   hypre_EndTiming(relax_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_WavefrontRelaxSetMaxIter( void      *relax_vdata,
+                                HYPRE_Int  max_iter    )
+{
+   hypre_WavefrontRelaxData *relax_data = (hypre_WavefrontRelaxData *)relax_vdata;
+
+   (relax_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_WavefrontRelaxSetZeroGuess( void      *relax_vdata,
+                                  HYPRE_Int  zero_guess  )
+{
+   hypre_WavefrontRelaxData *relax_data = (hypre_WavefrontRelaxData *)relax_vdata;
+
+   (relax_data -> zero_guess) = zero_guess;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_WavefrontRelaxSetWeight( void       *relax_vdata,
+                               HYPRE_Real  weight      )
+{
+   hypre_WavefrontRelaxData *relax_data = (hypre_WavefrontRelaxData *)relax_vdata;
+
+   (relax_data -> weight) = weight;
+
+   return hypre_error_flag;
+}
@@ -110,6 +110,16 @@ HYPRE_StructGridSetNumGhost( HYPRE_StructGrid grid, HYPRE_Int *num_ghost )
    return ( hypre_StructGridSetNumGhost(grid, num_ghost) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_StructGridSetPrevGrid
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructGridSetPrevGrid( HYPRE_StructGrid grid, HYPRE_StructGrid prev_grid )
+{
+   return ( hypre_StructGridSetPrevGrid(grid, prev_grid) );
+}
+
 #if defined(HYPRE_USE_CUDA)
 HYPRE_Int
 HYPRE_StructGridSetDataLocation( HYPRE_StructGrid grid, HYPRE_Int data_location )
@@ -104,6 +104,17 @@ HYPRE_Int HYPRE_StructGridSetPeriodic(HYPRE_StructGrid  grid,
 HYPRE_Int HYPRE_StructGridSetNumGhost(HYPRE_StructGrid  grid,
                                       HYPRE_Int        *num_ghost);
 
+/**
+ * (Optional) Declare that the grid replaces the assembled grid {\tt
+ * prev\_grid}, e.g., after a regrid that changed the boxes of a few
+ * processes.  The assemble then reuses data of {\tt prev\_grid} and only
+ * exchanges the boxes of the processes whose boxes changed.  This must be
+ * called on all processes (or on none) before HYPRE\_StructGridAssemble, and
+ * {\tt prev\_grid} must not be destroyed before the grid is assembled.
+ **/
+HYPRE_Int HYPRE_StructGridSetPrevGrid(HYPRE_StructGrid  grid,
+                                      HYPRE_StructGrid  prev_grid);
+
 /*@}*/
 
 /*--------------------------------------------------------------------------
@@ -317,6 +317,10 @@ hypre_CheckErrorDevice(cudaDeviceSynchronize());
 #define hypre_BoxLoop4Begin      zypre_newBoxLoop4Begin
 #define hypre_BoxLoop4For        zypre_newBoxLoop4For
 #define hypre_BoxLoop4End        zypre_newBoxLoop4End
+#define hypre_BoxLoop3SimdBegin  hypre_BoxLoop3Begin
+#define hypre_BoxLoop3SimdEnd    hypre_BoxLoop3End
+#define hypre_BoxLoop4SimdBegin  hypre_BoxLoop4Begin
+#define hypre_BoxLoop4SimdEnd    hypre_BoxLoop4End
 
 #define hypre_BasicBoxLoop2Begin zypre_newBasicBoxLoop2Begin
 #endif
@@ -696,6 +700,10 @@ struct ColumnSums
 #define hypre_BoxLoop4Begin      hypre_newBoxLoop4Begin
 #define hypre_BoxLoop4For        hypre_newBoxLoop4For
 #define hypre_BoxLoop4End        hypre_newBoxLoop4End
+#define hypre_BoxLoop3SimdBegin  hypre_BoxLoop3Begin
+#define hypre_BoxLoop3SimdEnd    hypre_BoxLoop3End
+#define hypre_BoxLoop4SimdBegin  hypre_BoxLoop4Begin
+#define hypre_BoxLoop4SimdEnd    hypre_BoxLoop4End
 
 #define hypre_BasicBoxLoop2Begin hypre_newBasicBoxLoop2Begin
 #endif
@@ -1268,6 +1276,10 @@ private:
 #define hypre_BoxLoop4Begin      hypre_newBoxLoop4Begin
 #define hypre_BoxLoop4For        hypre_newBoxLoop4For
 #define hypre_BoxLoop4End        hypre_newBoxLoop4End
+#define hypre_BoxLoop3SimdBegin  hypre_BoxLoop3Begin
+#define hypre_BoxLoop3SimdEnd    hypre_BoxLoop3End
+#define hypre_BoxLoop4SimdBegin  hypre_BoxLoop4Begin
+#define hypre_BoxLoop4SimdEnd    hypre_BoxLoop4End
 
 #define hypre_BasicBoxLoop1Begin zypre_newBasicBoxLoop1Begin 
 #define hypre_BasicBoxLoop2Begin zypre_newBasicBoxLoop2Begin 
@@ -1357,6 +1369,10 @@ private:
 #define hypre_BoxLoop3End    zypre_omp4_dist_BoxLoopEnd
 #define hypre_BoxLoop4Begin  zypre_omp4_dist_BoxLoop4Begin
 #define hypre_BoxLoop4End    zypre_omp4_dist_BoxLoopEnd
+#define hypre_BoxLoop3SimdBegin hypre_BoxLoop3Begin
+#define hypre_BoxLoop3SimdEnd   hypre_BoxLoop3End
+#define hypre_BoxLoop4SimdBegin hypre_BoxLoop4Begin
+#define hypre_BoxLoop4SimdEnd   hypre_BoxLoop4End
 #define hypre_LoopBegin      zypre_LoopBegin
 #define hypre_LoopEnd        zypre_omp4_dist_BoxLoopEnd
 
@@ -2058,6 +2074,122 @@ typedef struct hypre_Boxloop_struct
    }\
 }
 
+/*--------------------------------------------------------------------------
+ * BoxLoops for bodies whose iterations are independent of each other, i.e.,
+ * each iteration only writes data indexed by its own (last) loop index.  The
+ * innermost loop computes the indices from the loop counter instead of
+ * carrying them from one iteration to the next, and it is marked so that the
+ * compiler may vectorize it without proving that the data pointers in the
+ * body do not alias.
+ *--------------------------------------------------------------------------*/
+
+#if defined(__INTEL_COMPILER)
+#define zypre_BoxLoopIvdep _Pragma("ivdep")
+#elif defined(__clang__)
+#define zypre_BoxLoopIvdep _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define zypre_BoxLoopIvdep _Pragma("GCC ivdep")
+#else
+#define zypre_BoxLoopIvdep
+#endif
+
+#define zypre_newBoxLoop3SimdBegin(ndim, loop_size,\
+                                   dbox1, start1, stride1, i1,\
+                                   dbox2, start2, stride2, i2,\
+                                   dbox3, start3, stride3, i3)\
+{\
+   HYPRE_Int i1, i2, i3;\
+   zypre_BoxLoopDeclare();\
+   zypre_BoxLoopDeclareK(1);\
+   zypre_BoxLoopDeclareK(2);\
+   zypre_BoxLoopDeclareK(3);\
+   zypre_BoxLoopInit(ndim, loop_size);\
+   zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);\
+   zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);\
+   zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);\
+   OMP1\
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)\
+   {\
+      HYPRE_Int hypre__j1, hypre__j2, hypre__j3;\
+      zypre_BoxLoopSet();\
+      zypre_BoxLoopSetK(1, hypre__j1);\
+      zypre_BoxLoopSetK(2, hypre__j2);\
+      zypre_BoxLoopSetK(3, hypre__j3);\
+      for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)\
+      {\
+         zypre_BoxLoopIvdep\
+         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)\
+         {\
+            HYPRE_Int i1 = hypre__j1 + hypre__I*hypre__i0inc1;\
+            HYPRE_Int i2 = hypre__j2 + hypre__I*hypre__i0inc2;\
+            HYPRE_Int i3 = hypre__j3 + hypre__I*hypre__i0inc3;
+
+#define zypre_newBoxLoop3SimdEnd(i1, i2, i3)\
+         }\
+         hypre__j1 += hypre__IN*hypre__i0inc1;\
+         hypre__j2 += hypre__IN*hypre__i0inc2;\
+         hypre__j3 += hypre__IN*hypre__i0inc3;\
+         zypre_BoxLoopInc1();\
+         hypre__j1 += hypre__ikinc1[hypre__d];\
+         hypre__j2 += hypre__ikinc2[hypre__d];\
+         hypre__j3 += hypre__ikinc3[hypre__d];\
+         zypre_BoxLoopInc2();\
+      }\
+   }\
+}
+
+#define zypre_newBoxLoop4SimdBegin(ndim, loop_size,\
+                                   dbox1, start1, stride1, i1,\
+                                   dbox2, start2, stride2, i2,\
+                                   dbox3, start3, stride3, i3,\
+                                   dbox4, start4, stride4, i4)\
+{\
+   HYPRE_Int i1, i2, i3, i4;\
+   zypre_BoxLoopDeclare();\
+   zypre_BoxLoopDeclareK(1);\
+   zypre_BoxLoopDeclareK(2);\
+   zypre_BoxLoopDeclareK(3);\
+   zypre_BoxLoopDeclareK(4);\
+   zypre_BoxLoopInit(ndim, loop_size);\
+   zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);\
+   zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);\
+   zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);\
+   zypre_BoxLoopInitK(4, dbox4, start4, stride4, i4);\
+   OMP1\
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)\
+   {\
+      HYPRE_Int hypre__j1, hypre__j2, hypre__j3, hypre__j4;\
+      zypre_BoxLoopSet();\
+      zypre_BoxLoopSetK(1, hypre__j1);\
+      zypre_BoxLoopSetK(2, hypre__j2);\
+      zypre_BoxLoopSetK(3, hypre__j3);\
+      zypre_BoxLoopSetK(4, hypre__j4);\
+      for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)\
+      {\
+         zypre_BoxLoopIvdep\
+         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)\
+         {\
+            HYPRE_Int i1 = hypre__j1 + hypre__I*hypre__i0inc1;\
+            HYPRE_Int i2 = hypre__j2 + hypre__I*hypre__i0inc2;\
+            HYPRE_Int i3 = hypre__j3 + hypre__I*hypre__i0inc3;\
+            HYPRE_Int i4 = hypre__j4 + hypre__I*hypre__i0inc4;
+
+#define zypre_newBoxLoop4SimdEnd(i1, i2, i3, i4)\
+         }\
+         hypre__j1 += hypre__IN*hypre__i0inc1;\
+         hypre__j2 += hypre__IN*hypre__i0inc2;\
+         hypre__j3 += hypre__IN*hypre__i0inc3;\
+         hypre__j4 += hypre__IN*hypre__i0inc4;\
+         zypre_BoxLoopInc1();\
+         hypre__j1 += hypre__ikinc1[hypre__d];\
+         hypre__j2 += hypre__ikinc2[hypre__d];\
+         hypre__j3 += hypre__ikinc3[hypre__d];\
+         hypre__j4 += hypre__ikinc4[hypre__d];\
+         zypre_BoxLoopInc2();\
+      }\
+   }\
+}
+
 #define zypre_newBasicBoxLoop2Begin(ndim, loop_size,\
 				    stride1, i1,		\
 				    stride2, i2)		\
@@ -2105,6 +2237,10 @@ typedef struct hypre_Boxloop_struct
 #define hypre_BoxLoop3End        zypre_newBoxLoop3End
 #define hypre_BoxLoop4Begin      zypre_newBoxLoop4Begin
 #define hypre_BoxLoop4End        zypre_newBoxLoop4End
+#define hypre_BoxLoop3SimdBegin  zypre_newBoxLoop3SimdBegin
+#define hypre_BoxLoop3SimdEnd    zypre_newBoxLoop3SimdEnd
+#define hypre_BoxLoop4SimdBegin  zypre_newBoxLoop4SimdBegin
+#define hypre_BoxLoop4SimdEnd    zypre_newBoxLoop4SimdEnd
 #define hypre_BasicBoxLoop2Begin zypre_newBasicBoxLoop2Begin
 
 #endif
@@ -2890,6 +3026,10 @@ typedef struct
    HYPRE_Int           my_partition_ids_size;   
    HYPRE_Int           my_partition_ids_alloc;
    HYPRE_Int           my_partition_num_distinct_procs;
+   HYPRE_Int           my_partition_num_updated_procs; /* procs whose boxes
+                                                         were replaced by the
+                                                         last update */
+   HYPRE_Int          *my_partition_updated_procs; /* (sorted) */
     
 } hypre_StructAssumedPart;
 
@@ -2910,6 +3050,8 @@ typedef struct
 #define hypre_StructAssumedPartMyPartitionIdsAlloc(apart) ((apart)->my_partition_ids_alloc)
 #define hypre_StructAssumedPartMyPartitionNumDistinctProcs(apart) ((apart)->my_partition_num_distinct_procs)
 #define hypre_StructAssumedPartMyPartitionBoxnums(apart) ((apart)->my_partition_boxnums)
+#define hypre_StructAssumedPartMyPartitionNumUpdatedProcs(apart) ((apart)->my_partition_num_updated_procs)
+#define hypre_StructAssumedPartMyPartitionUpdatedProcs(apart) ((apart)->my_partition_updated_procs)
 
 #define hypre_StructAssumedPartMyPartitionProcId(apart, i) ((apart)->my_partition_proc_ids[i])
 #define hypre_StructAssumedPartMyPartitionBoxnum(apart, i) ((apart)->my_partition_boxnums[i])
@@ -2960,6 +3102,7 @@ typedef struct hypre_BoxManEntry_struct
 typedef struct
 {
    MPI_Comm            comm;
+   HYPRE_Int           myid; /* Rank of this processor in comm */
 
    HYPRE_Int           max_nentries; /* storage allocated for entries */
     
@@ -3022,6 +3165,11 @@ typedef struct
    HYPRE_Int           last_index[HYPRE_MAXDIM]; /* Last index used in the
                                                     indexes map */
 
+   HYPRE_Int           num_point_caches; /* Number of per-thread point caches */
+   HYPRE_Int          *point_cache; /* Index table cell (HYPRE_MAXDIM indexes
+                                       per thread) found by the last point
+                                       lookup of each thread, or -1 */
+
    HYPRE_Int           num_my_entries; /* Num entries with proc_id = myid */
    HYPRE_Int          *my_ids; /* Array of ids corresponding to my entries */ 
    hypre_BoxManEntry **my_entries; /* Points into entries that are mine and
@@ -3035,6 +3183,10 @@ typedef struct
                                                   For now this is only used
                                                   during the assemble (where it
                                                   is created). */
+   void               *prev_manager; /* A previously assembled manager for
+                                        the same (changed) grid whose entries
+                                        and assumed partition are reused in
+                                        the next assemble (incremental mode) */
    HYPRE_Int           ndim; /* Problem dimension (known in the grid) */
 
    hypre_Box          *bounding_box; /* Bounding box from associated grid */
@@ -3052,6 +3204,7 @@ typedef struct
  *--------------------------------------------------------------------------*/
 
 #define hypre_BoxManComm(manager)               ((manager) -> comm)
+#define hypre_BoxManMyId(manager)               ((manager) -> myid)
 
 #define hypre_BoxManMaxNEntries(manager)        ((manager) -> max_nentries)
 
@@ -3077,11 +3230,14 @@ typedef struct
 #define hypre_BoxManIndexes(manager)            ((manager) -> indexes)
 #define hypre_BoxManSize(manager)               ((manager) -> size)
 #define hypre_BoxManLastIndex(manager)          ((manager) -> last_index)
+#define hypre_BoxManNumPointCaches(manager)     ((manager) -> num_point_caches)
+#define hypre_BoxManPointCache(manager)         ((manager) -> point_cache)
 
 #define hypre_BoxManNumMyEntries(manager)       ((manager) -> num_my_entries)
 #define hypre_BoxManMyIds(manager)              ((manager) -> my_ids)
 #define hypre_BoxManMyEntries(manager)          ((manager) -> my_entries)
 #define hypre_BoxManAssumedPartition(manager)   ((manager) -> assumed_partition)
+#define hypre_BoxManPrevManager(manager)        ((manager) -> prev_manager)
 #define hypre_BoxManNDim(manager)               ((manager) -> ndim)
 #define hypre_BoxManBoundingBox(manager)        ((manager) -> bounding_box)
 
@@ -3092,6 +3248,8 @@ typedef struct
 #define hypre_BoxManIndexesD(manager, d)    hypre_BoxManIndexes(manager)[d]
 #define hypre_BoxManSizeD(manager, d)       hypre_BoxManSize(manager)[d]
 #define hypre_BoxManLastIndexD(manager, d)  hypre_BoxManLastIndex(manager)[d]
+#define hypre_BoxManPointCacheT(manager, t) \
+(hypre_BoxManPointCache(manager) + (t)*HYPRE_MAXDIM)
 
 #define hypre_BoxManInfoObject(manager, i) \
 (void *) ((char *)hypre_BoxManInfoObjects(manager) + i* hypre_BoxManEntryInfoSize(manager))
@@ -3166,6 +3324,8 @@ typedef struct hypre_StructGrid_struct
    HYPRE_Int            num_ghost[2*HYPRE_MAXDIM]; /* ghost layer size */  
 
    hypre_BoxManager    *boxman;
+   hypre_BoxManager    *prev_boxman;  /* box manager of a previous version of
+                                         the grid, reused in the assemble */
 #if defined(HYPRE_USE_CUDA) 
    HYPRE_Int            data_location;
 #endif
@@ -3191,6 +3351,7 @@ typedef struct hypre_StructGrid_struct
 #define hypre_StructGridGhlocalSize(grid)   ((grid) -> ghlocal_size)
 #define hypre_StructGridNumGhost(grid)      ((grid) -> num_ghost)
 #define hypre_StructGridBoxMan(grid)        ((grid) -> boxman) 
+#define hypre_StructGridPrevBoxMan(grid)    ((grid) -> prev_boxman)
 
 #define hypre_StructGridBox(grid, i) \
 (hypre_BoxArrayBox(hypre_StructGridBoxes(grid), i))
@@ -3344,6 +3505,17 @@ typedef struct hypre_CommType_struct
 
 } hypre_CommType;
 
+/*--------------------------------------------------------------------------
+ * Persistent exchanges reuse the MPI requests and message buffers of a
+ * CommPkg after its first communication.  They are only used with host
+ * communication buffers.
+ *--------------------------------------------------------------------------*/
+
+#if (defined(HYPRE_USING_PERSISTENT_COMM) || defined(HYPRE_USING_NEIGHBOR_COLL)) \
+   && !defined(HYPRE_MEMORY_GPU) && !defined(HYPRE_USE_OMP45)
+#define HYPRE_USING_PERSISTENT_COMM_PKG
+#endif
+
 /*--------------------------------------------------------------------------
  * hypre_CommPkg:
  *   Structure containing information for doing communications
@@ -3385,6 +3557,31 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+   /* statistics, accumulated while hypre_comm_stats_active is set */
+   HYPRE_Int         num_exchanges;
+   HYPRE_Int         num_messages;
+   HYPRE_Real        num_bytes;
+   HYPRE_Real        wait_time;
+
+#ifdef HYPRE_USING_PERSISTENT_COMM_PKG
+   /* persistent exchange (set up after the first communication) */
+   HYPRE_Int           persistent;  /* 0 = none, 1 = ready, 2 = in use */
+   HYPRE_Int           persistent_tag;
+   HYPRE_Int           num_persistent_requests;
+   hypre_MPI_Request  *persistent_requests;
+   hypre_MPI_Status   *persistent_status;
+   HYPRE_Complex     **persistent_send_buffers;
+   HYPRE_Complex     **persistent_recv_buffers;
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+   /* distributed graph communicator and message layout (in bytes) */
+   hypre_MPI_Comm      neighbor_comm;
+   hypre_int          *neighbor_send_counts;
+   hypre_int          *neighbor_send_displs;
+   hypre_int          *neighbor_recv_counts;
+   hypre_int          *neighbor_recv_displs;
+#endif
+#endif
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -3410,6 +3607,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int       action;
 
+   /* requests and buffers belong to the CommPkg persistent exchange */
+   HYPRE_Int       persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -3501,6 +3701,25 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)     (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)   (comm_pkg -> identity_order)
 
+#define hypre_CommPkgNumExchanges(comm_pkg)    (comm_pkg -> num_exchanges)
+#define hypre_CommPkgNumMessages(comm_pkg)     (comm_pkg -> num_messages)
+#define hypre_CommPkgNumBytes(comm_pkg)        (comm_pkg -> num_bytes)
+#define hypre_CommPkgWaitTime(comm_pkg)        (comm_pkg -> wait_time)
+
+#define hypre_CommPkgPersistent(comm_pkg)             (comm_pkg -> persistent)
+#define hypre_CommPkgPersistentTag(comm_pkg)          (comm_pkg -> persistent_tag)
+#define hypre_CommPkgNumPersistentRequests(comm_pkg)  (comm_pkg -> num_persistent_requests)
+#define hypre_CommPkgPersistentRequests(comm_pkg)     (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)       (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffers(comm_pkg)  (comm_pkg -> persistent_send_buffers)
+#define hypre_CommPkgPersistentRecvBuffers(comm_pkg)  (comm_pkg -> persistent_recv_buffers)
+
+#define hypre_CommPkgNeighborComm(comm_pkg)           (comm_pkg -> neighbor_comm)
+#define hypre_CommPkgNeighborSendCounts(comm_pkg)     (comm_pkg -> neighbor_send_counts)
+#define hypre_CommPkgNeighborSendDispls(comm_pkg)     (comm_pkg -> neighbor_send_displs)
+#define hypre_CommPkgNeighborRecvCounts(comm_pkg)     (comm_pkg -> neighbor_recv_counts)
+#define hypre_CommPkgNeighborRecvDispls(comm_pkg)     (comm_pkg -> neighbor_recv_displs)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -3514,6 +3733,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleSendBuffers(comm_handle) (comm_handle -> send_buffers)
 #define hypre_CommHandleRecvBuffers(comm_handle) (comm_handle -> recv_buffers)
 #define hypre_CommHandleAction(comm_handle)      (comm_handle -> action)
+#define hypre_CommHandlePersistent(comm_handle)  (comm_handle -> persistent)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_data)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_data)
 
@@ -3812,6 +4032,9 @@ HYPRE_Int hypre_APRefineRegionsByVol ( hypre_BoxArray *region_array , HYPRE_Real
 HYPRE_Int hypre_StructAssumedPartitionCreate ( HYPRE_Int dim , hypre_Box *bounding_box , HYPRE_Real global_boxes_size , HYPRE_Int global_num_boxes , hypre_BoxArray *local_boxes , HYPRE_Int *local_boxnums , HYPRE_Int max_regions , HYPRE_Int max_refinements , HYPRE_Real gamma , MPI_Comm comm , hypre_StructAssumedPart **p_assumed_partition );
 HYPRE_Int hypre_StructAssumedPartitionDestroy ( hypre_StructAssumedPart *assumed_part );
 HYPRE_Int hypre_APFillResponseStructAssumedPart ( void *p_recv_contact_buf , HYPRE_Int contact_size , HYPRE_Int contact_proc , void *ro , MPI_Comm comm , void **p_send_response_buf , HYPRE_Int *response_message_size );
+HYPRE_Int hypre_StructAssumedPartitionCoversBoxes ( hypre_StructAssumedPart *assumed_part , hypre_BoxArray *boxes , HYPRE_Int *covers_ptr );
+HYPRE_Int hypre_StructAssumedPartitionUpdate ( hypre_StructAssumedPart *assumed_part , hypre_BoxArray *old_boxes , hypre_BoxArray *new_boxes , HYPRE_Int *new_boxnums , HYPRE_Int changed , MPI_Comm comm );
+HYPRE_Int hypre_APFillResponseStructAssumedPartUpdate ( void *p_recv_contact_buf , HYPRE_Int contact_size , HYPRE_Int contact_proc , void *ro , MPI_Comm comm , void **p_send_response_buf , HYPRE_Int *response_message_size );
 HYPRE_Int hypre_StructAssumedPartitionGetRegionsFromProc ( hypre_StructAssumedPart *assumed_part , HYPRE_Int proc_id , hypre_BoxArray *assumed_regions );
 HYPRE_Int hypre_StructAssumedPartitionGetProcsFromBox ( hypre_StructAssumedPart *assumed_part , hypre_Box *box , HYPRE_Int *num_proc_array , HYPRE_Int *size_alloc_proc_array , HYPRE_Int **p_proc_array );
 
@@ -3881,6 +4104,7 @@ HYPRE_Int hypre_BoxManGetIsEntriesSort ( hypre_BoxManager *manager , HYPRE_Int *
 HYPRE_Int hypre_BoxManGetGlobalIsGatherCalled ( hypre_BoxManager *manager , MPI_Comm comm , HYPRE_Int *is_gather );
 HYPRE_Int hypre_BoxManGetAssumedPartition ( hypre_BoxManager *manager , hypre_StructAssumedPart **assumed_partition );
 HYPRE_Int hypre_BoxManSetAssumedPartition ( hypre_BoxManager *manager , hypre_StructAssumedPart *assumed_partition );
+HYPRE_Int hypre_BoxManSetPrevManager ( hypre_BoxManager *manager , hypre_BoxManager *prev_manager );
 HYPRE_Int hypre_BoxManSetBoundingBox ( hypre_BoxManager *manager , hypre_Box *bounding_box );
 HYPRE_Int hypre_BoxManSetNumGhost ( hypre_BoxManager *manager , HYPRE_Int *num_ghost );
 HYPRE_Int hypre_BoxManDeleteMultipleEntriesAndInfo ( hypre_BoxManager *manager , HYPRE_Int *indices , HYPRE_Int num );
@@ -3889,6 +4113,7 @@ HYPRE_Int hypre_BoxManIncSize ( hypre_BoxManager *manager , HYPRE_Int inc_size )
 HYPRE_Int hypre_BoxManDestroy ( hypre_BoxManager *manager );
 HYPRE_Int hypre_BoxManAddEntry ( hypre_BoxManager *manager , hypre_Index imin , hypre_Index imax , HYPRE_Int proc_id , HYPRE_Int box_id , void *info );
 HYPRE_Int hypre_BoxManGetEntry ( hypre_BoxManager *manager , HYPRE_Int proc , HYPRE_Int id , hypre_BoxManEntry **entry_ptr );
+HYPRE_Int hypre_BoxManGetProcEntries ( hypre_BoxManager *manager , HYPRE_Int proc , HYPRE_Int *start_ptr , HYPRE_Int *finish_ptr );
 HYPRE_Int hypre_BoxManGetAllEntries ( hypre_BoxManager *manager , HYPRE_Int *num_entries , hypre_BoxManEntry **entries );
 HYPRE_Int hypre_BoxManGetAllEntriesBoxes ( hypre_BoxManager *manager , hypre_BoxArray *boxes );
 HYPRE_Int hypre_BoxManGetLocalEntriesBoxes ( hypre_BoxManager *manager , hypre_BoxArray *boxes );
@@ -3896,6 +4121,7 @@ HYPRE_Int hypre_BoxManGetAllEntriesBoxesProc ( hypre_BoxManager *manager , hypre
 HYPRE_Int hypre_BoxManGatherEntries ( hypre_BoxManager *manager , hypre_Index imin , hypre_Index imax );
 HYPRE_Int hypre_BoxManAssemble ( hypre_BoxManager *manager );
 HYPRE_Int hypre_BoxManIntersect ( hypre_BoxManager *manager , hypre_Index ilower , hypre_Index iupper , hypre_BoxManEntry ***entries_ptr , HYPRE_Int *nentries_ptr );
+HYPRE_Int hypre_BoxManFindEntry ( hypre_BoxManager *manager , hypre_Index index , hypre_BoxManEntry **entry_ptr , HYPRE_Int *nentries_ptr );
 HYPRE_Int hypre_FillResponseBoxManAssemble1 ( void *p_recv_contact_buf , HYPRE_Int contact_size , HYPRE_Int contact_proc , void *ro , MPI_Comm comm , void **p_send_response_buf , HYPRE_Int *response_message_size );
 HYPRE_Int hypre_FillResponseBoxManAssemble2 ( void *p_recv_contact_buf , HYPRE_Int contact_size , HYPRE_Int contact_proc , void *ro , MPI_Comm comm , void **p_send_response_buf , HYPRE_Int *response_message_size );
 
@@ -3929,6 +4155,7 @@ HYPRE_Int HYPRE_StructGridSetExtents ( HYPRE_StructGrid grid , HYPRE_Int *ilower
 HYPRE_Int HYPRE_StructGridSetPeriodic ( HYPRE_StructGrid grid , HYPRE_Int *periodic );
 HYPRE_Int HYPRE_StructGridAssemble ( HYPRE_StructGrid grid );
 HYPRE_Int HYPRE_StructGridSetNumGhost ( HYPRE_StructGrid grid , HYPRE_Int *num_ghost );
+HYPRE_Int HYPRE_StructGridSetPrevGrid ( HYPRE_StructGrid grid , HYPRE_StructGrid prev_grid );
 
 /* HYPRE_struct_matrix.c */
 HYPRE_Int HYPRE_StructMatrixCreate ( MPI_Comm comm , HYPRE_StructGrid grid , HYPRE_StructStencil stencil , HYPRE_StructMatrix *matrix );
@@ -3988,10 +4215,13 @@ HYPRE_Int hypre_StructAxpy ( HYPRE_Complex alpha , hypre_StructVector *x , hypre
 HYPRE_Int hypre_CommPkgCreate ( hypre_CommInfo *comm_info , hypre_BoxArray *send_data_space , hypre_BoxArray *recv_data_space , HYPRE_Int num_values , HYPRE_Int **orders , HYPRE_Int reverse , MPI_Comm comm , hypre_CommPkg **comm_pkg_ptr );
 HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type , HYPRE_Int *boxnums , hypre_Box *boxes , hypre_Index stride , hypre_Index coord , hypre_Index dir , HYPRE_Int *order , hypre_BoxArray *data_space , HYPRE_Int *data_offsets );
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box , hypre_Index stride , hypre_Index coord , hypre_Index dir , HYPRE_Int *order , hypre_Box *data_box , HYPRE_Int data_box_offset , hypre_CommEntryType *comm_entry );
+HYPRE_Int hypre_CommPkgCreatePersistent ( hypre_CommPkg *comm_pkg , HYPRE_Int tag );
+HYPRE_Int hypre_CommPkgDestroyPersistent ( hypre_CommPkg *comm_pkg );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int action , HYPRE_Int tag , hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
 HYPRE_Int hypre_ExchangeLocalData ( hypre_CommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int action );
 HYPRE_Int hypre_CommPkgDestroy ( hypre_CommPkg *comm_pkg );
+HYPRE_Int hypre_CommPkgGetStats ( hypre_CommPkg *comm_pkg , HYPRE_Real *stats );
 
 /* struct_copy.c */
 HYPRE_Int hypre_StructCopy ( hypre_StructVector *x , hypre_StructVector *y );
@@ -4002,6 +4232,7 @@ HYPRE_Int hypre_StructGridCreate ( MPI_Comm comm , HYPRE_Int dim , hypre_StructG
 HYPRE_Int hypre_StructGridRef ( hypre_StructGrid *grid , hypre_StructGrid **grid_ref );
 HYPRE_Int hypre_StructGridDestroy ( hypre_StructGrid *grid );
 HYPRE_Int hypre_StructGridSetPeriodic ( hypre_StructGrid *grid , hypre_Index periodic );
+HYPRE_Int hypre_StructGridSetPrevGrid ( hypre_StructGrid *grid , hypre_StructGrid *prev_grid );
 HYPRE_Int hypre_StructGridSetExtents ( hypre_StructGrid *grid , hypre_Index ilower , hypre_Index iupper );
 HYPRE_Int hypre_StructGridSetBoxes ( hypre_StructGrid *grid , hypre_BoxArray *boxes );
 HYPRE_Int hypre_StructGridSetBoundingBox ( hypre_StructGrid *grid , hypre_Box *new_bb );
@@ -4061,7 +4292,9 @@ HYPRE_Int hypre_StructMatvecCompute ( void *matvec_vdata , HYPRE_Complex alpha ,
 HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecFused ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , HYPRE_Int stencil_size );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
+HYPRE_Int hypre_StructMatvecCommStats ( void *matvec_vdata , HYPRE_Real *stats );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , HYPRE_Complex beta , hypre_StructVector *y );
 
 /* struct_scale.c */
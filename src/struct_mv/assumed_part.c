@@ -802,6 +802,8 @@ hypre_StructAssumedPartitionCreate(
       hypre_StructAssumedPartMyPartitionIdsAlloc(assumed_part) = 0;
       hypre_StructAssumedPartMyPartitionIdsSize(assumed_part) = 0;
       hypre_StructAssumedPartMyPartitionNumDistinctProcs(assumed_part) = 0;
+      hypre_StructAssumedPartMyPartitionNumUpdatedProcs(assumed_part) = 0;
+      hypre_StructAssumedPartMyPartitionUpdatedProcs(assumed_part) = NULL;
       hypre_StructAssumedPartMyPartitionBoxnums(assumed_part) = NULL;
       hypre_StructAssumedPartMyPartitionProcIds(assumed_part) = NULL;
       *p_assumed_partition = assumed_part;
@@ -1361,6 +1363,8 @@ hypre_StructAssumedPartitionCreate(
    hypre_StructAssumedPartMyPartitionBoxnums(assumed_part) 
       = hypre_CTAlloc(HYPRE_Int,  box_count, HYPRE_MEMORY_HOST);
    hypre_StructAssumedPartMyPartitionNumDistinctProcs(assumed_part) = 0;
+   hypre_StructAssumedPartMyPartitionNumUpdatedProcs(assumed_part) = 0;
+   hypre_StructAssumedPartMyPartitionUpdatedProcs(assumed_part) = NULL;
 
    /* Set up for exchanging data */  
    /* The response we expect is just a confirmation */
@@ -1408,6 +1412,7 @@ hypre_StructAssumedPartitionDestroy( hypre_StructAssumedPart *assumed_part )
       hypre_BoxArrayDestroy( hypre_StructAssumedPartMyPartitionBoxes(assumed_part));
       hypre_TFree(hypre_StructAssumedPartMyPartitionProcIds(assumed_part), HYPRE_MEMORY_HOST);
       hypre_TFree( hypre_StructAssumedPartMyPartitionBoxnums(assumed_part), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_StructAssumedPartMyPartitionUpdatedProcs(assumed_part), HYPRE_MEMORY_HOST);
       
       /* This goes last! */
       hypre_TFree(assumed_part, HYPRE_MEMORY_HOST);
@@ -1497,6 +1502,292 @@ hypre_APFillResponseStructAssumedPart(
    return hypre_error_flag;
 }
 
+/******************************************************************************
+ * Check whether the boxes lie entirely within the regions of the assumed
+ * partition.  Only then can the boxes be added to the assumed partition with
+ * hypre_StructAssumedPartitionUpdate() (regions are disjoint).
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_StructAssumedPartitionCoversBoxes( hypre_StructAssumedPart *assumed_part,
+                                         hypre_BoxArray          *boxes,
+                                         HYPRE_Int               *covers_ptr )
+{
+   HYPRE_Int        ndim = hypre_StructAssumedPartNDim(assumed_part);
+   HYPRE_Int        i, j, covers;
+   HYPRE_Real       volume;
+   hypre_BoxArray  *regions = hypre_StructAssumedPartRegions(assumed_part);
+   hypre_Box       *box, *int_box;
+
+   int_box = hypre_BoxCreate(ndim);
+
+   covers = 1;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      volume = hypre_doubleBoxVolume(box);
+      hypre_ForBoxI(j, regions)
+      {
+         hypre_IntersectBoxes(box, hypre_BoxArrayBox(regions, j), int_box);
+         volume -= hypre_doubleBoxVolume(int_box);
+      }
+      if (volume > 0.5)
+      {
+         covers = 0;
+         break;
+      }
+   }
+
+   hypre_BoxDestroy(int_box);
+
+   *covers_ptr = covers;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ * Replace the boxes of the processors that changed since the assumed
+ * partition was created (or last updated), without rebuilding it.
+ *
+ * This is collective, but only processors with changed = 1 send anything.
+ * They contact the owners of the assumed partition regions intersected by
+ * their old or their new boxes, and send to each the new boxes in its regions
+ * (possibly none).  The owner removes all boxes of the contacting processor
+ * and appends the new ones (see hypre_APFillResponseStructAssumedPartUpdate).
+ * The regions themselves are not changed, so the new boxes must be covered by
+ * them (see hypre_StructAssumedPartitionCoversBoxes).
+ *
+ * On return, each processor's assumed partition contains the sorted list of
+ * processors that updated boxes in its regions (MyPartitionUpdatedProcs).
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_StructAssumedPartitionUpdate( hypre_StructAssumedPart *assumed_part,
+                                    hypre_BoxArray          *old_boxes,
+                                    hypre_BoxArray          *new_boxes,
+                                    HYPRE_Int               *new_boxnums,
+                                    HYPRE_Int                changed,
+                                    MPI_Comm                 comm )
+{
+   HYPRE_Int   ndim = hypre_StructAssumedPartNDim(assumed_part);
+   HYPRE_Int   i, j, d, index;
+   HYPRE_Int   count, size, proc_count, proc_alloc, box_count;
+   HYPRE_Int   num_contacts;
+   HYPRE_Int  *proc_array, *tmp_proc_ids, *tmp_box_inds;
+   HYPRE_Int  *contact_procs, *contact_starts, *contact_boxinfo;
+   HYPRE_Int  *response_buf = NULL, *response_buf_starts = NULL;
+
+   hypre_Box  *box;
+
+   hypre_DataExchangeResponse  response_obj;
+
+   hypre_StructAssumedPartMyPartitionNumUpdatedProcs(assumed_part) = 0;
+
+   proc_alloc = hypre_pow2(ndim);
+   proc_array = hypre_CTAlloc(HYPRE_Int,  proc_alloc, HYPRE_MEMORY_HOST);
+
+   /* Collect (proc, box) pairs for the new boxes, and (proc, -1) for the
+      owners of the old boxes, so that they are contacted even if no new box
+      lies in their regions */
+   count = 0;
+   size  = 0;
+   tmp_proc_ids = NULL;
+   tmp_box_inds = NULL;
+   if (changed)
+   {
+      for (j = 0; j < 2; j++)
+      {
+         hypre_BoxArray *boxes = j ? old_boxes : new_boxes;
+
+         hypre_ForBoxI(i, boxes)
+         {
+            box = hypre_BoxArrayBox(boxes, i);
+            hypre_StructAssumedPartitionGetProcsFromBox(
+               assumed_part, box, &proc_count, &proc_alloc, &proc_array);
+            if ((count + proc_count) > size)
+            {
+               size = 2*(count + proc_count);
+               tmp_proc_ids = hypre_TReAlloc(tmp_proc_ids,  HYPRE_Int,  size, HYPRE_MEMORY_HOST);
+               tmp_box_inds = hypre_TReAlloc(tmp_box_inds,  HYPRE_Int,  size, HYPRE_MEMORY_HOST);
+            }
+            for (d = 0; d < proc_count; d++)
+            {
+               tmp_proc_ids[count] = proc_array[d];
+               tmp_box_inds[count] = j ? -1 : i;
+               count++;
+            }
+         }
+      }
+   }
+   hypre_TFree(proc_array, HYPRE_MEMORY_HOST);
+
+   hypre_qsort2i(tmp_proc_ids, tmp_box_inds, 0, count-1);
+
+   /* Build the contact lists (see hypre_StructAssumedPartitionCreate) */
+   contact_procs   = hypre_CTAlloc(HYPRE_Int,  count, HYPRE_MEMORY_HOST);
+   contact_starts  = hypre_CTAlloc(HYPRE_Int,  count+1, HYPRE_MEMORY_HOST);
+   contact_boxinfo = hypre_CTAlloc(HYPRE_Int,  count*(1+2*ndim), HYPRE_MEMORY_HOST);
+   num_contacts = 0;
+   box_count = 0;
+   index = 0;
+   for (i = 0; i < count; i++)
+   {
+      if ((num_contacts == 0) || (tmp_proc_ids[i] != contact_procs[num_contacts-1]))
+      {
+         contact_procs[num_contacts] = tmp_proc_ids[i];
+         contact_starts[num_contacts] = box_count;
+         num_contacts++;
+      }
+      if (tmp_box_inds[i] >= 0)
+      {
+         box = hypre_BoxArrayBox(new_boxes, tmp_box_inds[i]);
+         contact_boxinfo[index++] = new_boxnums[tmp_box_inds[i]];
+         for (d = 0; d < ndim; d++)
+         {
+            contact_boxinfo[index++] = hypre_BoxIMinD(box, d);
+            contact_boxinfo[index++] = hypre_BoxIMaxD(box, d);
+         }
+         box_count++;
+      }
+   }
+   contact_starts[num_contacts] = box_count;
+
+   hypre_TFree(tmp_proc_ids, HYPRE_MEMORY_HOST);
+   hypre_TFree(tmp_box_inds, HYPRE_MEMORY_HOST);
+
+   response_obj.fill_response = hypre_APFillResponseStructAssumedPartUpdate;
+   response_obj.data1 = assumed_part;
+   response_obj.data2 = NULL;
+
+   hypre_DataExchangeList(num_contacts, contact_procs,
+                          contact_boxinfo, contact_starts,
+                          (1+2*ndim)*sizeof(HYPRE_Int),
+                          sizeof(HYPRE_Int), &response_obj, 0, 5,
+                          comm, (void**) &response_buf, &response_buf_starts);
+
+   hypre_TFree(contact_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_boxinfo, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ * Response for hypre_StructAssumedPartitionUpdate: replace the boxes of the
+ * contacting processor in my partition with the received ones.
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_APFillResponseStructAssumedPartUpdate(
+   void      *p_recv_contact_buf,
+   HYPRE_Int  contact_size,
+   HYPRE_Int  contact_proc,
+   void      *ro,
+   MPI_Comm   comm,
+   void     **p_send_response_buf, 
+   HYPRE_Int *response_message_size )
+{
+   HYPRE_Int    ndim, size, alloc_size, i, j, d, index, found;
+   HYPRE_Int   *ids, *boxnums, *updated;
+   HYPRE_Int   *recv_contact_buf;
+
+   hypre_Box   *box;
+     
+   hypre_BoxArray              *part_boxes;
+   hypre_DataExchangeResponse  *response_obj = (hypre_DataExchangeResponse  *)ro;  
+   hypre_StructAssumedPart     *assumed_part = (hypre_StructAssumedPart     *)response_obj->data1;  
+
+   ndim = hypre_StructAssumedPartNDim(assumed_part);
+   part_boxes = hypre_StructAssumedPartMyPartitionBoxes(assumed_part);
+   ids = hypre_StructAssumedPartMyPartitionProcIds(assumed_part);
+   boxnums = hypre_StructAssumedPartMyPartitionBoxnums(assumed_part);
+
+   size = hypre_StructAssumedPartMyPartitionIdsSize(assumed_part);
+   alloc_size = hypre_StructAssumedPartMyPartitionIdsAlloc(assumed_part);
+   
+   recv_contact_buf = (HYPRE_Int * ) p_recv_contact_buf;
+
+   /* Remove the old boxes of contact_proc (they are adjacent) */
+   found = 0;
+   j = 0;
+   for (i = 0; i < size; i++)
+   {
+      if (ids[i] == contact_proc)
+      {
+         found = 1;
+      }
+      else
+      {
+         if (j < i)
+         {
+            ids[j] = ids[i];
+            boxnums[j] = boxnums[i];
+            hypre_CopyBox(hypre_BoxArrayBox(part_boxes, i),
+                          hypre_BoxArrayBox(part_boxes, j));
+         }
+         j++;
+      }
+   }
+   size = j;
+   hypre_BoxArraySetSize(part_boxes, size);
+   if (found)
+   {
+      hypre_StructAssumedPartMyPartitionNumDistinctProcs(assumed_part)--;
+   }
+
+   /* Append the new ones */
+   if (contact_size > 0)
+   {
+      hypre_StructAssumedPartMyPartitionNumDistinctProcs(assumed_part)++;
+   }
+   if ((size + contact_size) > alloc_size)
+   {
+      alloc_size = size + contact_size;
+      ids = hypre_TReAlloc(ids,  HYPRE_Int,  alloc_size, HYPRE_MEMORY_HOST);
+      boxnums = hypre_TReAlloc(boxnums,  HYPRE_Int,  alloc_size, HYPRE_MEMORY_HOST);
+      hypre_StructAssumedPartMyPartitionIdsAlloc(assumed_part) = alloc_size;
+   }
+   
+   box = hypre_BoxCreate(ndim);
+   index = 0;
+   for (i = 0; i < contact_size; i++)
+   {
+      ids[size+i] = contact_proc;
+      boxnums[size+i] = recv_contact_buf[index++];
+      for (d = 0; d < ndim; d++)
+      {
+         hypre_BoxIMinD(box, d) = recv_contact_buf[index++];
+         hypre_BoxIMaxD(box, d) = recv_contact_buf[index++];
+      }
+      hypre_AppendBox(box, part_boxes);
+   }
+   hypre_BoxDestroy(box);
+
+   hypre_StructAssumedPartMyPartitionIdsSize(assumed_part) = size + contact_size;
+   hypre_StructAssumedPartMyPartitionBoxes(assumed_part) = part_boxes;
+   hypre_StructAssumedPartMyPartitionProcIds(assumed_part) = ids;
+   hypre_StructAssumedPartMyPartitionBoxnums(assumed_part) = boxnums;
+
+   /* Record the update (each processor contacts us at most once), keeping
+      the list sorted */
+   size = hypre_StructAssumedPartMyPartitionNumUpdatedProcs(assumed_part);
+   updated = hypre_TReAlloc(hypre_StructAssumedPartMyPartitionUpdatedProcs(assumed_part),
+                            HYPRE_Int, size+1, HYPRE_MEMORY_HOST);
+   for (i = size; (i > 0) && (updated[i-1] > contact_proc); i--)
+   {
+      updated[i] = updated[i-1];
+   }
+   updated[i] = contact_proc;
+   hypre_StructAssumedPartMyPartitionUpdatedProcs(assumed_part) = updated;
+   hypre_StructAssumedPartMyPartitionNumUpdatedProcs(assumed_part) = size+1;
+
+   *response_message_size = 0; 
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
  * Given a processor id, get that processor's assumed region(s).
  *
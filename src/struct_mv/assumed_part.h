@@ -37,6 +37,10 @@ typedef struct
    HYPRE_Int           my_partition_ids_size;   
    HYPRE_Int           my_partition_ids_alloc;
    HYPRE_Int           my_partition_num_distinct_procs;
+   HYPRE_Int           my_partition_num_updated_procs; /* procs whose boxes
+                                                         were replaced by the
+                                                         last update */
+   HYPRE_Int          *my_partition_updated_procs; /* (sorted) */
     
 } hypre_StructAssumedPart;
 
@@ -57,6 +61,8 @@ typedef struct
 #define hypre_StructAssumedPartMyPartitionIdsAlloc(apart) ((apart)->my_partition_ids_alloc)
 #define hypre_StructAssumedPartMyPartitionNumDistinctProcs(apart) ((apart)->my_partition_num_distinct_procs)
 #define hypre_StructAssumedPartMyPartitionBoxnums(apart) ((apart)->my_partition_boxnums)
+#define hypre_StructAssumedPartMyPartitionNumUpdatedProcs(apart) ((apart)->my_partition_num_updated_procs)
+#define hypre_StructAssumedPartMyPartitionUpdatedProcs(apart) ((apart)->my_partition_updated_procs)
 
 #define hypre_StructAssumedPartMyPartitionProcId(apart, i) ((apart)->my_partition_proc_ids[i])
 #define hypre_StructAssumedPartMyPartitionBoxnum(apart, i) ((apart)->my_partition_boxnums[i])
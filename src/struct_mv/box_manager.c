@@ -112,6 +112,74 @@ hypre_entryqsort2( HYPRE_Int *v,
    hypre_entryqsort2(v, ent, last+1, right);
 }
 
+/* merge the runs [run_starts[r], run_starts[r+1]) of (proc, id, order)
+   triples, each sorted on proc and then id, into the front of the arrays and
+   drop repeated (proc, id) pairs.  Returns the number of triples kept. */
+
+HYPRE_Int
+hypre_BoxManMergeRuns( HYPRE_Int  num_runs,
+                       HYPRE_Int *run_starts,
+                       HYPRE_Int *procs,
+                       HYPRE_Int *ids,
+                       HYPRE_Int *order )
+{
+   HYPRE_Int  size = run_starts[num_runs];
+   HYPRE_Int *heads, *m_procs, *m_ids, *m_order;
+   HYPRE_Int  i, r, best, count;
+
+   heads   = hypre_TAlloc(HYPRE_Int, num_runs, HYPRE_MEMORY_HOST);
+   m_procs = hypre_TAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+   m_ids   = hypre_TAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+   m_order = hypre_TAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+   for (r = 0; r < num_runs; r++)
+   {
+      heads[r] = run_starts[r];
+   }
+
+   count = 0;
+   for (i = 0; i < size; i++)
+   {
+      best = -1;
+      for (r = 0; r < num_runs; r++)
+      {
+         if (heads[r] < run_starts[r+1])
+         {
+            if ( (best < 0) ||
+                 (procs[heads[r]] < procs[heads[best]]) ||
+                 ((procs[heads[r]] == procs[heads[best]]) &&
+                  (ids[heads[r]] < ids[heads[best]])) )
+            {
+               best = r;
+            }
+         }
+      }
+      if ( (count == 0) ||
+           (procs[heads[best]] != m_procs[count-1]) ||
+           (ids[heads[best]] != m_ids[count-1]) )
+      {
+         m_procs[count] = procs[heads[best]];
+         m_ids[count]   = ids[heads[best]];
+         m_order[count] = order[heads[best]];
+         count++;
+      }
+      heads[best]++;
+   }
+
+   for (i = 0; i < count; i++)
+   {
+      procs[i] = m_procs[i];
+      ids[i]   = m_ids[i];
+      order[i] = m_order[i];
+   }
+
+   hypre_TFree(heads, HYPRE_MEMORY_HOST);
+   hypre_TFree(m_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(m_ids, HYPRE_MEMORY_HOST);
+   hypre_TFree(m_order, HYPRE_MEMORY_HOST);
+
+   return count;
+}
+
 /*--------------------------------------------------------------------------
  * This is not used
  *--------------------------------------------------------------------------*/
@@ -318,6 +386,34 @@ hypre_BoxManSetAssumedPartition( hypre_BoxManager *manager,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Set a previously assembled manager for the same grid, before the entries
+ * of a changed grid are gathered in hypre_BoxManAssemble.  The assemble then
+ * reuses the assumed partition of prev_manager (updating it only with the
+ * boxes of the processors whose local entries changed), and copies the
+ * entries of unchanged processors from prev_manager instead of requesting
+ * them again.
+ *
+ * Notes:
+ *
+ * (1) This must be called on all processors (or on none).
+ *
+ * (2) The assumed partition is moved from prev_manager to manager, but
+ * prev_manager can still be used for lookups until it is destroyed.
+ *
+ * (3) If the regions of the old assumed partition do not cover the new boxes,
+ * a new assumed partition is created as usual.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxManSetPrevManager( hypre_BoxManager *manager,
+                            hypre_BoxManager *prev_manager )
+{
+   hypre_BoxManPrevManager(manager) = prev_manager;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -445,6 +541,7 @@ hypre_BoxManCreate( HYPRE_Int max_nentries,
 
    /* initialize */
    hypre_BoxManComm(manager) = comm;
+   hypre_MPI_Comm_rank(comm, &hypre_BoxManMyId(manager));
    hypre_BoxManMaxNEntries(manager) = max_nentries;
    hypre_BoxManEntryInfoSize(manager) = info_size;
    hypre_BoxManNDim(manager) = ndim;
@@ -462,6 +559,8 @@ hypre_BoxManCreate( HYPRE_Int max_nentries,
    hypre_BoxManInfoObjects(manager) = hypre_TAlloc(char, max_nentries*info_size, HYPRE_MEMORY_HOST);
 
    hypre_BoxManIndexTable(manager) = NULL;
+   hypre_BoxManNumPointCaches(manager) = 0;
+   hypre_BoxManPointCache(manager) = NULL;
    
    hypre_BoxManNumProcsSort(manager)     = 0;
    hypre_BoxManIdsSort(manager)          = hypre_CTAlloc(HYPRE_Int,  max_nentries, HYPRE_MEMORY_HOST);
@@ -482,6 +581,7 @@ hypre_BoxManCreate( HYPRE_Int max_nentries,
    hypre_BoxManMyEntries(manager)    = NULL;
                             
    hypre_BoxManAssumedPartition(manager) = NULL;
+   hypre_BoxManPrevManager(manager) = NULL;
 
    hypre_BoxManMyIds(manager) = hypre_CTAlloc(HYPRE_Int,  max_nentries, HYPRE_MEMORY_HOST);
    hypre_BoxManMyEntries(manager) =
@@ -523,10 +623,12 @@ hypre_BoxManIncSize ( hypre_BoxManager *manager,
    HYPRE_Int  *ids          = hypre_BoxManIdsSort(manager);
    HYPRE_Int  *procs        = hypre_BoxManProcsSort(manager);
    HYPRE_Int   info_size    = hypre_BoxManEntryInfoSize(manager);
+   HYPRE_Int   i;
    
    void *info         = hypre_BoxManInfoObjects(manager);
 
    hypre_BoxManEntry  *entries = hypre_BoxManEntries(manager);
+   hypre_BoxManEntry  *old_entries = entries;
 
    /* increase size */
    max_nentries += inc_size;
@@ -551,6 +653,12 @@ hypre_BoxManIncSize ( hypre_BoxManager *manager,
       my_ids = hypre_TReAlloc(my_ids,  HYPRE_Int,  max_nentries, HYPRE_MEMORY_HOST);
 
       my_entries = hypre_TReAlloc(my_entries,  hypre_BoxManEntry *,  max_nentries, HYPRE_MEMORY_HOST);
+
+      /* my_entries points into entries, which may have moved */
+      for (i = 0; i < hypre_BoxManNumMyEntries(manager); i++)
+      {
+         my_entries[i] = entries + (my_entries[i] - old_entries);
+      }
    
       hypre_BoxManMyIds(manager) = my_ids;
       hypre_BoxManMyEntries(manager) = my_entries;
@@ -581,6 +689,7 @@ hypre_BoxManDestroy( hypre_BoxManager *manager )
       hypre_Free((char *)hypre_BoxManInfoObjects(manager), HYPRE_MEMORY_HOST);
       
       hypre_TFree(hypre_BoxManIndexTable(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManPointCache(manager), HYPRE_MEMORY_HOST);
       
       hypre_TFree(hypre_BoxManIdsSort(manager), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_BoxManProcsSort(manager), HYPRE_MEMORY_HOST);
@@ -788,15 +897,12 @@ hypre_BoxManGetEntry( hypre_BoxManager *manager,
   
    hypre_BoxManEntry *entry;
 
-   HYPRE_Int  myid;
-   HYPRE_Int  i, offset;
+   HYPRE_Int  myid         = hypre_BoxManMyId(manager);
    HYPRE_Int  start, finish;
    HYPRE_Int  location;
    HYPRE_Int  first_local  = hypre_BoxManFirstLocal(manager);
-   HYPRE_Int *procs_sort   = hypre_BoxManProcsSort(manager);
    HYPRE_Int *ids_sort     = hypre_BoxManIdsSort(manager);
    HYPRE_Int  nentries     = hypre_BoxManNEntries(manager);
-   HYPRE_Int  num_proc     = hypre_BoxManNumProcsSort(manager);
    HYPRE_Int *proc_offsets =  hypre_BoxManProcsSortOffsets(manager);
 
    /* can only use after assembling */
@@ -806,8 +912,6 @@ hypre_BoxManGetEntry( hypre_BoxManager *manager,
       return hypre_error_flag;
    }
 
-   hypre_MPI_Comm_rank(hypre_BoxManComm(manager), &myid );
-
    if (nentries) 
    {
       /* check to see if it is the local id first - this will be the case most
@@ -821,23 +925,9 @@ hypre_BoxManGetEntry( hypre_BoxManager *manager,
          }
       }
       
-      else /* otherwise find proc (TO DO: just have procs_sort not contain
-              duplicates - then we could do a regular binary search (though this
-              list is probably short)- this has to be changed in assemble, then
-              also memory management in addentry - but currently this is not
-              necessary because proc = myid for all current hypre calls) */
+      else /* otherwise find proc */
       {
-         start = -1;
-         for (i = 0; i< num_proc; i++)
-         {
-            offset = proc_offsets[i];
-            if (proc == procs_sort[offset])
-            {
-               start = offset;
-               finish = proc_offsets[i+1];
-               break;
-            }
-         }
+         hypre_BoxManGetProcEntries(manager, proc, &start, &finish);
       }
       if (start >= 0 )
       {
@@ -870,6 +960,58 @@ hypre_BoxManGetEntry( hypre_BoxManager *manager,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Return the range [start, finish) of the entries of processor proc in the
+ * (sorted) entries array, or start = -1 if there are none.  Can only be used
+ * after assembling.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxManGetProcEntries( hypre_BoxManager *manager,
+                            HYPRE_Int proc,
+                            HYPRE_Int *start_ptr,
+                            HYPRE_Int *finish_ptr )
+{
+   HYPRE_Int *procs_sort   = hypre_BoxManProcsSort(manager);
+   HYPRE_Int *proc_offsets = hypre_BoxManProcsSortOffsets(manager);
+   HYPRE_Int  lo, hi, mid, offset;
+
+   *start_ptr  = -1;
+   *finish_ptr = -1;
+
+   if (!hypre_BoxManIsAssembled(manager))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   /* the first entry of each proc group in procs_sort (given by proc_offsets)
+      is sorted, so do a binary search over the groups */
+   lo = 0;
+   hi = hypre_BoxManNumProcsSort(manager) - 1;
+   while (lo <= hi)
+   {
+      mid = lo + (hi - lo)/2;
+      offset = proc_offsets[mid];
+      if (proc < procs_sort[offset])
+      {
+         hi = mid - 1;
+      }
+      else if (proc > procs_sort[offset])
+      {
+         lo = mid + 1;
+      }
+      else
+      {
+         *start_ptr  = offset;
+         *finish_ptr = proc_offsets[mid+1];
+         break;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Return a list of all of the entries in the box manager (and the number of
  * entries). These are sorted by (proc, id) pairs.
@@ -1141,6 +1283,11 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
 
    HYPRE_Int need_to_sort = 1; /* default it to sort */
    //HYPRE_Int short_sort = 0; /*do abreviated sort */
+
+   /* incremental assemble: entries are added in runs sorted on (proc, id),
+      except the first (entries added before the assemble) */
+   HYPRE_Int  num_merge_runs = 0;
+   HYPRE_Int  merge_starts[4];
    
    HYPRE_Int  non_ap_gather = 1; /* default to gather w/out ap*/
 
@@ -1284,7 +1431,107 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
          hypre_Index imin, imax;
 
          hypre_IndexRef  min_ref, max_ref;
-         
+
+         hypre_BoxManager *prev_manager = hypre_BoxManPrevManager(manager);
+         HYPRE_Int  incremental = 0;
+         HYPRE_Int  num_changed = 0, num_copy = 0;
+         HYPRE_Int *changed_procs = NULL, *copy_proc_ids = NULL;
+
+         /* 0.  Incremental assemble: try to reuse the assumed partition of the
+            previous manager (see hypre_BoxManSetPrevManager) */
+
+         if (prev_manager && hypre_BoxManAssumedPartition(manager) == NULL)
+         {
+            hypre_BoxArray          *old_boxes;
+            hypre_StructAssumedPart *prev_ap;
+            HYPRE_Int                changed, covers, not_ok;
+            HYPRE_Int                start, finish, info_size;
+
+            info_size = hypre_BoxManEntryInfoSize(manager);
+            prev_ap = hypre_BoxManAssumedPartition(prev_manager);
+            not_ok = ( !hypre_BoxManIsAssembled(prev_manager) || (prev_ap == NULL) ||
+                       (hypre_BoxManNDim(prev_manager) != ndim) ||
+                       (hypre_BoxManEntryInfoSize(prev_manager) != info_size) ||
+                       !hypre_IndexesEqual(hypre_BoxIMin(hypre_BoxManBoundingBox(prev_manager)),
+                                           hypre_BoxIMin(hypre_BoxManBoundingBox(manager)), ndim) ||
+                       !hypre_IndexesEqual(hypre_BoxIMax(hypre_BoxManBoundingBox(prev_manager)),
+                                           hypre_BoxIMax(hypre_BoxManBoundingBox(manager)), ndim) );
+
+            local_boxes = hypre_BoxArrayCreate(num_my_entries, ndim);
+            local_boxnums = hypre_CTAlloc(HYPRE_Int,  num_my_entries, HYPRE_MEMORY_HOST);
+            old_boxes = hypre_BoxArrayCreate(0, ndim);
+            changed = 0;
+            if (!not_ok)
+            {
+               /* my entries are sorted by id (above), as are those of the
+                  previous manager */
+               hypre_BoxManGetProcEntries(prev_manager, myid, &start, &finish);
+               if (start >= 0)
+               {
+                  hypre_BoxArraySetSize(old_boxes, finish - start);
+                  for (i = start; i < finish; i++)
+                  {
+                     entry_ptr = &hypre_BoxManEntries(prev_manager)[i];
+                     hypre_BoxSetExtents(hypre_BoxArrayBox(old_boxes, i - start),
+                                         hypre_BoxManEntryIMin(entry_ptr),
+                                         hypre_BoxManEntryIMax(entry_ptr));
+                  }
+               }
+               changed = (hypre_BoxArraySize(old_boxes) != num_my_entries);
+            }
+            for (i = 0; i < num_my_entries; i++)
+            {
+               entry_ptr = my_entries[i];
+               box = hypre_BoxArrayBox(local_boxes, i);
+               hypre_BoxSetExtents(box, hypre_BoxManEntryIMin(entry_ptr),
+                                   hypre_BoxManEntryIMax(entry_ptr));
+               local_boxnums[i] = hypre_BoxManEntryId(entry_ptr);
+
+               if (!not_ok && !changed)
+               {
+                  hypre_BoxManEntry *prev_entry =
+                     &hypre_BoxManEntries(prev_manager)[start + i];
+                  changed = ( (hypre_BoxManEntryId(prev_entry) != local_boxnums[i]) ||
+                              !hypre_IndexesEqual(hypre_BoxManEntryIMin(entry_ptr),
+                                                  hypre_BoxManEntryIMin(prev_entry), ndim) ||
+                              !hypre_IndexesEqual(hypre_BoxManEntryIMax(entry_ptr),
+                                                  hypre_BoxManEntryIMax(prev_entry), ndim) ||
+                              memcmp(hypre_BoxManInfoObject(manager,
+                                        hypre_BoxManEntryPosition(entry_ptr)),
+                                     hypre_BoxManInfoObject(prev_manager,
+                                        hypre_BoxManEntryPosition(prev_entry)),
+                                     info_size) );
+               }
+            }
+            if (!not_ok && changed)
+            {
+               hypre_StructAssumedPartitionCoversBoxes(prev_ap, local_boxes, &covers);
+               not_ok = !covers;
+            }
+
+            sendbuf2[0] = (HYPRE_Real) num_my_entries;
+            sendbuf2[1] = (HYPRE_Real) not_ok;
+            hypre_MPI_Allreduce(&sendbuf2, &recvbuf2, 2, HYPRE_MPI_REAL,
+                                hypre_MPI_SUM, comm);
+
+            if (recvbuf2[1] == 0.0)
+            {
+               global_num_boxes = (HYPRE_Int) recvbuf2[0];
+
+               /* move the assumed partition to this manager and update it */
+               hypre_BoxManAssumedPartition(manager) = prev_ap;
+               hypre_BoxManAssumedPartition(prev_manager) = NULL;
+
+               hypre_StructAssumedPartitionUpdate(prev_ap, old_boxes, local_boxes,
+                                                  local_boxnums, changed, comm);
+               incremental = 1;
+            }
+
+            hypre_BoxArrayDestroy(local_boxes);
+            hypre_BoxArrayDestroy(old_boxes);
+            hypre_TFree(local_boxnums, HYPRE_MEMORY_HOST);
+         }
+
          /* 1.  Create an assumed partition? (may have been added in the coarsen
             routine) */   
 
@@ -1490,7 +1737,7 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
                /* build response object*/
                response_obj.fill_response = hypre_FillResponseBoxManAssemble1;
                response_obj.data1 = ap; /* needed to fill responses*/ 
-               response_obj.data2 = NULL;           
+               response_obj.data2 = incremental ? ap : NULL; /* flag updated procs */
                
                send_buf = NULL;
                send_buf_starts = hypre_CTAlloc(HYPRE_Int,  proc_count + 1, HYPRE_MEMORY_HOST);
@@ -1528,6 +1775,21 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
                hypre_TFree(ap_proc_ids, HYPRE_MEMORY_HOST);
                hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
                
+               /* incremental: updated procs were returned as -(proc+1) */
+               if (incremental)
+               {
+                  changed_procs = hypre_CTAlloc(HYPRE_Int,  size, HYPRE_MEMORY_HOST);
+                  for (i = 0; i < size; i++)
+                  {
+                     if (neighbor_proc_ids[i] < 0)
+                     {
+                        neighbor_proc_ids[i] = -neighbor_proc_ids[i] - 1;
+                        changed_procs[num_changed++] = neighbor_proc_ids[i];
+                     }
+                  }
+                  hypre_qsort0(changed_procs, 0, num_changed-1);
+               }
+
                /* create a contact list of these processors (eliminate duplicate
                 * procs and also my id ) */
                
@@ -1553,6 +1815,31 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
                   }
                }
                       
+               /* incremental: the entries of procs that did not change are
+                  copied from the previous manager instead (below) */
+               if (incremental)
+               {
+                  HYPRE_Int new_count = 0;
+                  HYPRE_Int start, finish;
+
+                  copy_proc_ids = hypre_CTAlloc(HYPRE_Int,  proc_count, HYPRE_MEMORY_HOST);
+                  for (i = 0; i < proc_count; i++)
+                  {
+                     proc = contact_proc_ids[i];
+                     hypre_BoxManGetProcEntries(prev_manager, proc, &start, &finish);
+                     if ( (start >= 0) &&
+                          (hypre_BinarySearch(changed_procs, proc, num_changed) < 0) )
+                     {
+                        copy_proc_ids[num_copy++] = proc;
+                     }
+                     else
+                     {
+                        contact_proc_ids[new_count++] = proc;
+                     }
+                  }
+                  proc_count = new_count;
+               }
+
                /* check to see if we have any entries from a processor before
                   contacting(if we have one entry from a processor, then we have
                   all of the entries)
@@ -1681,6 +1968,10 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
                   ids_sort = hypre_BoxManIdsSort(manager);
                }
                
+               /* responses come in increasing proc order, each sorted by id */
+               merge_starts[0] = 0;
+               merge_starts[1] = hypre_BoxManNEntries(manager);
+
                index_ptr = entry_response_buf; /* point into response buf */
                for (i = 0; i < response_size; i++)
                {
@@ -1720,7 +2011,56 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
                      ((char *) index_ptr + hypre_BoxManEntryInfoSize(manager));
                }
                
+               merge_starts[2] = hypre_BoxManNEntries(manager);
+
+               /* incremental: copy the entries of the unchanged procs (these
+                  are in increasing proc order, and sorted by id) */
+               response_size = 0;
+               for (j = 0; j < num_copy; j++)
+               {
+                  HYPRE_Int start, finish;
+
+                  hypre_BoxManGetProcEntries(prev_manager, copy_proc_ids[j],
+                                             &start, &finish);
+                  response_size += finish - start;
+               }
+               if (hypre_BoxManNEntries(manager) + response_size >
+                   hypre_BoxManMaxNEntries(manager))
+               {
+                  hypre_BoxManIncSize(manager, hypre_BoxManNEntries(manager) + response_size
+                                      - hypre_BoxManMaxNEntries(manager));
+
+                  entries =  hypre_BoxManEntries(manager);
+                  procs_sort = hypre_BoxManProcsSort(manager);
+                  ids_sort = hypre_BoxManIdsSort(manager);
+               }
+               for (j = 0; j < num_copy; j++)
+               {
+                  HYPRE_Int start, finish;
+
+                  hypre_BoxManGetProcEntries(prev_manager, copy_proc_ids[j],
+                                             &start, &finish);
+                  for (i = start; i < finish; i++)
+                  {
+                     entry_ptr = &hypre_BoxManEntries(prev_manager)[i];
+                     hypre_BoxManAddEntry(
+                        manager, hypre_BoxManEntryIMin(entry_ptr),
+                        hypre_BoxManEntryIMax(entry_ptr),
+                        hypre_BoxManEntryProc(entry_ptr),
+                        hypre_BoxManEntryId(entry_ptr),
+                        hypre_BoxManInfoObject(prev_manager,
+                                               hypre_BoxManEntryPosition(entry_ptr)));
+                  }
+               }
+               merge_starts[3] = hypre_BoxManNEntries(manager);
+               if (incremental)
+               {
+                  num_merge_runs = 3;
+               }
+               
                /* clean up from this section of code*/
+               hypre_TFree(changed_procs, HYPRE_MEMORY_HOST);
+               hypre_TFree(copy_proc_ids, HYPRE_MEMORY_HOST);
                hypre_TFree(entry_response_buf, HYPRE_MEMORY_HOST);
                hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
                hypre_TFree(send_buf_starts, HYPRE_MEMORY_HOST);
@@ -2009,75 +2349,106 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
          {
             order_index[i] = i;
          }
-         /* sort by proc_id */ 
-         hypre_qsort3i(procs_sort, ids_sort, order_index, 0, nentries-1);
-         num_procs_sort = 0;
-         /* get first id */
-         if (nentries)
+         if (num_merge_runs)
          {
-            tmp_id = procs_sort[0];
-            num_procs_sort++;
+            /* incremental assemble: only the entries added before the
+               assemble need sorting; the gathered runs are merged in */
+            hypre_qsort3i(procs_sort, ids_sort, order_index, 0, merge_starts[1]-1);
+            start = 0;
+            for (i = 1; i <= merge_starts[1]; i++)
+            {
+               if ((i == merge_starts[1]) || (procs_sort[i] != procs_sort[start]))
+               {
+                  hypre_qsort2i(ids_sort, order_index, start, i-1);
+                  start = i;
+               }
+            }
+            size = hypre_BoxManMergeRuns(num_merge_runs, merge_starts,
+                                         procs_sort, ids_sort, order_index);
+            /* now index = the number of deleted duplicates */
+            index = nentries - size;
+
+            num_procs_sort = 0;
+            for (i = 0; i < size; i++)
+            {
+               if ((i == 0) || (procs_sort[i] != procs_sort[i-1]))
+               {
+                  num_procs_sort++;
+               }
+            }
          }
-         
-         /* now sort on ids within each processor number*/
-         start = 0;
-         for (i=1; i< nentries; i++)
+         else
          {
-            if (procs_sort[i] != tmp_id) 
+            /* sort by proc_id */ 
+            hypre_qsort3i(procs_sort, ids_sort, order_index, 0, nentries-1);
+            num_procs_sort = 0;
+            /* get first id */
+            if (nentries)
             {
-               hypre_qsort2i(ids_sort, order_index, start, i-1);
-               /*now find duplicate ids */ 
-               for (j=start+1; j< i; j++)
+               tmp_id = procs_sort[0];
+               num_procs_sort++;
+            }
+         
+            /* now sort on ids within each processor number*/
+            start = 0;
+            for (i=1; i< nentries; i++)
+            {
+               if (procs_sort[i] != tmp_id) 
                {
-                  if (ids_sort[j] == ids_sort[j-1])
+                  hypre_qsort2i(ids_sort, order_index, start, i-1);
+                  /*now find duplicate ids */ 
+                  for (j=start+1; j< i; j++)
                   {
-                     delete_array[index++] = j;
+                     if (ids_sort[j] == ids_sort[j-1])
+                     {
+                        delete_array[index++] = j;
+                     }
                   }
+                  /* update start and tmp_id */  
+                  start = i;
+                  tmp_id = procs_sort[i];
+                  num_procs_sort++; 
                }
-               /* update start and tmp_id */  
-               start = i;
-               tmp_id = procs_sort[i];
-               num_procs_sort++; 
             }
-         }
-         /* final sort and purge (the last group doesn't get caught in the above
-            loop) */
-         if (nentries)
-         {
-            hypre_qsort2i(ids_sort, order_index, start, nentries-1);
-            /*now find duplicate boxnums */ 
-            for (j=start+1; j<nentries; j++)
+            /* final sort and purge (the last group doesn't get caught in the above
+               loop) */
+            if (nentries)
             {
-               if (ids_sort[j] == ids_sort[j-1])
+               hypre_qsort2i(ids_sort, order_index, start, nentries-1);
+               /*now find duplicate boxnums */ 
+               for (j=start+1; j<nentries; j++)
                {
-                  delete_array[index++] = j;
+                  if (ids_sort[j] == ids_sort[j-1])
+                  {
+                     delete_array[index++] = j;
+                  }
                }
             }
-         }
-         /* now index = the number to delete (in delete_array) */     
+            /* now index = the number to delete (in delete_array) */     
          
-         if (index)
-         {
-            /* now delete from sort procs and sort ids -use delete_array because
-               these have already been sorted.  also delete from order_index */
-            start = delete_array[0];
-            j = 0;
-            for (i = start; (i + j) < nentries; i++)
+            if (index)
             {
-               if (j < index)
+               /* now delete from sort procs and sort ids -use delete_array because
+                  these have already been sorted.  also delete from order_index */
+               start = delete_array[0];
+               j = 0;
+               for (i = start; (i + j) < nentries; i++)
                {
-                  while ((i+j) == delete_array[j]) /* see if deleting
-                                                    * consec. items */
+                  if (j < index)
                   {
-                     j++; /*increase the shift*/
-                     if (j == index) break;
+                     while ((i+j) == delete_array[j]) /* see if deleting
+                                                       * consec. items */
+                     {
+                        j++; /*increase the shift*/
+                        if (j == index) break;
+                     }
+                  }
+                  if ((i+j) < nentries) /* if deleting the last item then no moving */
+                  {
+                     ids_sort[i] = ids_sort[i+j];
+                     procs_sort[i] =  procs_sort[i+j];
+                     order_index[i] = order_index[i+j];
                   }
-               }
-               if ((i+j) < nentries) /* if deleting the last item then no moving */
-               {
-                  ids_sort[i] = ids_sort[i+j];
-                  procs_sort[i] =  procs_sort[i+j];
-                  order_index[i] = order_index[i+j];
                }
             }
          }
@@ -2420,6 +2791,16 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
          hypre_BoxManLastIndexD(manager, d) = 0;
       }
 
+      /* one point cache per thread (see hypre_BoxManFindEntry) */
+      hypre_TFree(hypre_BoxManPointCache(manager), HYPRE_MEMORY_HOST);
+      hypre_BoxManNumPointCaches(manager) = hypre_NumThreads();
+      hypre_BoxManPointCache(manager) =
+         hypre_TAlloc(HYPRE_Int, hypre_NumThreads()*HYPRE_MAXDIM, HYPRE_MEMORY_HOST);
+      for (i = 0; i < hypre_NumThreads()*HYPRE_MAXDIM; i++)
+      {
+         hypre_BoxManPointCache(manager)[i] = -1;
+      }
+
       hypre_BoxDestroy(index_box);
       hypre_BoxDestroy(table_box);
       
@@ -2435,6 +2816,7 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
    hypre_BoxManGatherRegions(manager) =  hypre_BoxArrayCreate(0, ndim);
 
    hypre_BoxManIsAssembled(manager) = 1;
+   hypre_BoxManPrevManager(manager) = NULL;
 
    return hypre_error_flag;
 }
@@ -2617,6 +2999,119 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Find the entry containing the point 'index'.  This is the point version of
+ * hypre_BoxManIntersect (with ilower = iupper = index), but it does not
+ * allocate an entries array and does not modify the shared last_index search
+ * state, so it may be called concurrently by multiple threads.
+ *
+ * The index table cell containing the point is located with a binary search
+ * in each dimension.  Each thread remembers the cell found by its last lookup,
+ * and since consecutive lookups (e.g., the stencil entries of a row) usually
+ * land in the same cell, most lookups are resolved in O(ndim) time.
+ *
+ * Returns entry = NULL if no entry contains the point.  The number of entries
+ * containing the point is returned in nentries; if it is larger than one,
+ * entry is the first one in the index table list.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxManFindEntry( hypre_BoxManager   *manager,
+                       hypre_Index         index,
+                       hypre_BoxManEntry **entry_ptr,
+                       HYPRE_Int          *nentries_ptr )
+{
+   HYPRE_Int           ndim = hypre_BoxManNDim(manager);
+   HYPRE_Int           d, ii, location, spot, nentries;
+   HYPRE_Int           cell[HYPRE_MAXDIM];
+   HYPRE_Int          *cache = NULL;
+   HYPRE_Int          *man_indexes_d;
+   HYPRE_Int           thread_num;
+   hypre_BoxManEntry  *entry;
+
+   *entry_ptr    = NULL;
+   *nentries_ptr = 0;
+
+   /* can only use after assembling */
+   if (!hypre_BoxManIsAssembled(manager))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (hypre_BoxManNEntries(manager) == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   thread_num = hypre_GetThreadNum();
+   if (thread_num < hypre_BoxManNumPointCaches(manager))
+   {
+      cache = hypre_BoxManPointCacheT(manager, thread_num);
+   }
+
+   /* Check the cell of the last lookup first */
+   for (d = 0; d < ndim; d++)
+   {
+      if (!cache || cache[d] < 0)
+      {
+         break;
+      }
+      man_indexes_d = hypre_BoxManIndexesD(manager, d);
+      if ( (hypre_IndexD(index, d) <  man_indexes_d[cache[d]]) ||
+           (hypre_IndexD(index, d) >= man_indexes_d[cache[d] + 1]) )
+      {
+         break;
+      }
+      cell[d] = cache[d];
+   }
+
+   /* Otherwise, search for the cell in the remaining dimensions */
+   for (; d < ndim; d++)
+   {
+      man_indexes_d = hypre_BoxManIndexesD(manager, d);
+      location = hypre_BinarySearch2(man_indexes_d, hypre_IndexD(index, d),
+                                     0, hypre_BoxManSizeD(manager, d), &spot);
+      if (location < 0)
+      {
+         location = spot - 1;
+      }
+      if ( (location < 0) || (location > hypre_BoxManSizeD(manager, d) - 1) )
+      {
+         return hypre_error_flag;
+      }
+      cell[d] = location;
+   }
+
+   /* Table position of the cell (same ordering as in the assemble) */
+   ii = 0;
+   for (d = ndim - 1; d >= 0; d--)
+   {
+      ii = ii*hypre_BoxManSizeD(manager, d) + cell[d];
+   }
+
+   if (cache)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         cache[d] = cell[d];
+      }
+   }
+
+   /* Count the entries in the cell's list (usually just one) */
+   nentries = 0;
+   for (entry = hypre_BoxManIndexTable(manager)[ii]; entry != NULL;
+        entry = hypre_BoxManEntryNext(entry))
+   {
+      nentries++;
+   }
+
+   *entry_ptr    = hypre_BoxManIndexTable(manager)[ii];
+   *nentries_ptr = nentries;
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
  * contact message is null.  need to return the (proc) id of each box in our
  * assumed partition.
@@ -2635,6 +3130,7 @@ hypre_FillResponseBoxManAssemble1( void *p_recv_contact_buf,
    HYPRE_Int    myid, i, index;
    HYPRE_Int    size, num_boxes, num_objects;
    HYPRE_Int   *proc_ids;
+   HYPRE_Int    num_updated, *updated_procs;
    HYPRE_Int   *send_response_buf = (HYPRE_Int *) *p_send_response_buf;
  
    hypre_DataExchangeResponse  *response_obj = (hypre_DataExchangeResponse  *)ro;  
@@ -2647,7 +3143,9 @@ hypre_FillResponseBoxManAssemble1( void *p_recv_contact_buf,
   
    proc_ids =  hypre_StructAssumedPartMyPartitionProcIds(ap);
 
-   /* we need to send back the list of all the processor ids for the boxes */
+   /* we need to send back the list of all the processor ids for the boxes
+      (in an incremental assemble, procs that updated their boxes are flagged
+      as -(proc+1)) */
 
    /* NOTE: in the AP, boxes with the same proc id are adjacent (but proc ids
       not in any sorted order) */
@@ -2684,6 +3182,19 @@ hypre_FillResponseBoxManAssemble1( void *p_recv_contact_buf,
          send_response_buf[index++] = proc_ids[i];
    }
 
+   if (response_obj->data2)
+   {
+      num_updated = hypre_StructAssumedPartMyPartitionNumUpdatedProcs(ap);
+      updated_procs = hypre_StructAssumedPartMyPartitionUpdatedProcs(ap);
+      for (i = 0; i < index; i++)
+      {
+         if (hypre_BinarySearch(updated_procs, send_response_buf[i], num_updated) >= 0)
+         {
+            send_response_buf[i] = -send_response_buf[i] - 1;
+         }
+      }
+   }
+
    /* return variables */
    *response_message_size = num_objects;
    *p_send_response_buf = send_response_buf;
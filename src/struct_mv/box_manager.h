@@ -44,6 +44,7 @@ typedef struct hypre_BoxManEntry_struct
 typedef struct
 {
    MPI_Comm            comm;
+   HYPRE_Int           myid; /* Rank of this processor in comm */
 
    HYPRE_Int           max_nentries; /* storage allocated for entries */
     
@@ -106,6 +107,11 @@ typedef struct
    HYPRE_Int           last_index[HYPRE_MAXDIM]; /* Last index used in the
                                                     indexes map */
 
+   HYPRE_Int           num_point_caches; /* Number of per-thread point caches */
+   HYPRE_Int          *point_cache; /* Index table cell (HYPRE_MAXDIM indexes
+                                       per thread) found by the last point
+                                       lookup of each thread, or -1 */
+
    HYPRE_Int           num_my_entries; /* Num entries with proc_id = myid */
    HYPRE_Int          *my_ids; /* Array of ids corresponding to my entries */ 
    hypre_BoxManEntry **my_entries; /* Points into entries that are mine and
@@ -119,6 +125,10 @@ typedef struct
                                                   For now this is only used
                                                   during the assemble (where it
                                                   is created). */
+   void               *prev_manager; /* A previously assembled manager for
+                                        the same (changed) grid whose entries
+                                        and assumed partition are reused in
+                                        the next assemble (incremental mode) */
    HYPRE_Int           ndim; /* Problem dimension (known in the grid) */
 
    hypre_Box          *bounding_box; /* Bounding box from associated grid */
@@ -136,6 +146,7 @@ typedef struct
  *--------------------------------------------------------------------------*/
 
 #define hypre_BoxManComm(manager)               ((manager) -> comm)
+#define hypre_BoxManMyId(manager)               ((manager) -> myid)
 
 #define hypre_BoxManMaxNEntries(manager)        ((manager) -> max_nentries)
 
@@ -161,11 +172,14 @@ typedef struct
 #define hypre_BoxManIndexes(manager)            ((manager) -> indexes)
 #define hypre_BoxManSize(manager)               ((manager) -> size)
 #define hypre_BoxManLastIndex(manager)          ((manager) -> last_index)
+#define hypre_BoxManNumPointCaches(manager)     ((manager) -> num_point_caches)
+#define hypre_BoxManPointCache(manager)         ((manager) -> point_cache)
 
 #define hypre_BoxManNumMyEntries(manager)       ((manager) -> num_my_entries)
 #define hypre_BoxManMyIds(manager)              ((manager) -> my_ids)
 #define hypre_BoxManMyEntries(manager)          ((manager) -> my_entries)
 #define hypre_BoxManAssumedPartition(manager)   ((manager) -> assumed_partition)
+#define hypre_BoxManPrevManager(manager)        ((manager) -> prev_manager)
 #define hypre_BoxManNDim(manager)               ((manager) -> ndim)
 #define hypre_BoxManBoundingBox(manager)        ((manager) -> bounding_box)
 
@@ -176,6 +190,8 @@ typedef struct
 #define hypre_BoxManIndexesD(manager, d)    hypre_BoxManIndexes(manager)[d]
 #define hypre_BoxManSizeD(manager, d)       hypre_BoxManSize(manager)[d]
 #define hypre_BoxManLastIndexD(manager, d)  hypre_BoxManLastIndex(manager)[d]
+#define hypre_BoxManPointCacheT(manager, t) \
+(hypre_BoxManPointCache(manager) + (t)*HYPRE_MAXDIM)
 
 #define hypre_BoxManInfoObject(manager, i) \
 (void *) ((char *)hypre_BoxManInfoObjects(manager) + i* hypre_BoxManEntryInfoSize(manager))
@@ -218,6 +218,122 @@ typedef struct hypre_Boxloop_struct
    }\
 }
 
+/*--------------------------------------------------------------------------
+ * BoxLoops for bodies whose iterations are independent of each other, i.e.,
+ * each iteration only writes data indexed by its own (last) loop index.  The
+ * innermost loop computes the indices from the loop counter instead of
+ * carrying them from one iteration to the next, and it is marked so that the
+ * compiler may vectorize it without proving that the data pointers in the
+ * body do not alias.
+ *--------------------------------------------------------------------------*/
+
+#if defined(__INTEL_COMPILER)
+#define zypre_BoxLoopIvdep _Pragma("ivdep")
+#elif defined(__clang__)
+#define zypre_BoxLoopIvdep _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define zypre_BoxLoopIvdep _Pragma("GCC ivdep")
+#else
+#define zypre_BoxLoopIvdep
+#endif
+
+#define zypre_newBoxLoop3SimdBegin(ndim, loop_size,\
+                                   dbox1, start1, stride1, i1,\
+                                   dbox2, start2, stride2, i2,\
+                                   dbox3, start3, stride3, i3)\
+{\
+   HYPRE_Int i1, i2, i3;\
+   zypre_BoxLoopDeclare();\
+   zypre_BoxLoopDeclareK(1);\
+   zypre_BoxLoopDeclareK(2);\
+   zypre_BoxLoopDeclareK(3);\
+   zypre_BoxLoopInit(ndim, loop_size);\
+   zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);\
+   zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);\
+   zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);\
+   OMP1\
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)\
+   {\
+      HYPRE_Int hypre__j1, hypre__j2, hypre__j3;\
+      zypre_BoxLoopSet();\
+      zypre_BoxLoopSetK(1, hypre__j1);\
+      zypre_BoxLoopSetK(2, hypre__j2);\
+      zypre_BoxLoopSetK(3, hypre__j3);\
+      for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)\
+      {\
+         zypre_BoxLoopIvdep\
+         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)\
+         {\
+            HYPRE_Int i1 = hypre__j1 + hypre__I*hypre__i0inc1;\
+            HYPRE_Int i2 = hypre__j2 + hypre__I*hypre__i0inc2;\
+            HYPRE_Int i3 = hypre__j3 + hypre__I*hypre__i0inc3;
+
+#define zypre_newBoxLoop3SimdEnd(i1, i2, i3)\
+         }\
+         hypre__j1 += hypre__IN*hypre__i0inc1;\
+         hypre__j2 += hypre__IN*hypre__i0inc2;\
+         hypre__j3 += hypre__IN*hypre__i0inc3;\
+         zypre_BoxLoopInc1();\
+         hypre__j1 += hypre__ikinc1[hypre__d];\
+         hypre__j2 += hypre__ikinc2[hypre__d];\
+         hypre__j3 += hypre__ikinc3[hypre__d];\
+         zypre_BoxLoopInc2();\
+      }\
+   }\
+}
+
+#define zypre_newBoxLoop4SimdBegin(ndim, loop_size,\
+                                   dbox1, start1, stride1, i1,\
+                                   dbox2, start2, stride2, i2,\
+                                   dbox3, start3, stride3, i3,\
+                                   dbox4, start4, stride4, i4)\
+{\
+   HYPRE_Int i1, i2, i3, i4;\
+   zypre_BoxLoopDeclare();\
+   zypre_BoxLoopDeclareK(1);\
+   zypre_BoxLoopDeclareK(2);\
+   zypre_BoxLoopDeclareK(3);\
+   zypre_BoxLoopDeclareK(4);\
+   zypre_BoxLoopInit(ndim, loop_size);\
+   zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);\
+   zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);\
+   zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);\
+   zypre_BoxLoopInitK(4, dbox4, start4, stride4, i4);\
+   OMP1\
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)\
+   {\
+      HYPRE_Int hypre__j1, hypre__j2, hypre__j3, hypre__j4;\
+      zypre_BoxLoopSet();\
+      zypre_BoxLoopSetK(1, hypre__j1);\
+      zypre_BoxLoopSetK(2, hypre__j2);\
+      zypre_BoxLoopSetK(3, hypre__j3);\
+      zypre_BoxLoopSetK(4, hypre__j4);\
+      for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)\
+      {\
+         zypre_BoxLoopIvdep\
+         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)\
+         {\
+            HYPRE_Int i1 = hypre__j1 + hypre__I*hypre__i0inc1;\
+            HYPRE_Int i2 = hypre__j2 + hypre__I*hypre__i0inc2;\
+            HYPRE_Int i3 = hypre__j3 + hypre__I*hypre__i0inc3;\
+            HYPRE_Int i4 = hypre__j4 + hypre__I*hypre__i0inc4;
+
+#define zypre_newBoxLoop4SimdEnd(i1, i2, i3, i4)\
+         }\
+         hypre__j1 += hypre__IN*hypre__i0inc1;\
+         hypre__j2 += hypre__IN*hypre__i0inc2;\
+         hypre__j3 += hypre__IN*hypre__i0inc3;\
+         hypre__j4 += hypre__IN*hypre__i0inc4;\
+         zypre_BoxLoopInc1();\
+         hypre__j1 += hypre__ikinc1[hypre__d];\
+         hypre__j2 += hypre__ikinc2[hypre__d];\
+         hypre__j3 += hypre__ikinc3[hypre__d];\
+         hypre__j4 += hypre__ikinc4[hypre__d];\
+         zypre_BoxLoopInc2();\
+      }\
+   }\
+}
+
 #define zypre_newBasicBoxLoop2Begin(ndim, loop_size,\
 				    stride1, i1,		\
 				    stride2, i2)		\
@@ -265,6 +381,10 @@ typedef struct hypre_Boxloop_struct
 #define hypre_BoxLoop3End        zypre_newBoxLoop3End
 #define hypre_BoxLoop4Begin      zypre_newBoxLoop4Begin
 #define hypre_BoxLoop4End        zypre_newBoxLoop4End
+#define hypre_BoxLoop3SimdBegin  zypre_newBoxLoop3SimdBegin
+#define hypre_BoxLoop3SimdEnd    zypre_newBoxLoop3SimdEnd
+#define hypre_BoxLoop4SimdBegin  zypre_newBoxLoop4SimdBegin
+#define hypre_BoxLoop4SimdEnd    zypre_newBoxLoop4SimdEnd
 #define hypre_BasicBoxLoop2Begin zypre_newBasicBoxLoop2Begin
 
 #endif
@@ -373,6 +373,10 @@ struct ColumnSums
 #define hypre_BoxLoop4Begin      hypre_newBoxLoop4Begin
 #define hypre_BoxLoop4For        hypre_newBoxLoop4For
 #define hypre_BoxLoop4End        hypre_newBoxLoop4End
+#define hypre_BoxLoop3SimdBegin  hypre_BoxLoop3Begin
+#define hypre_BoxLoop3SimdEnd    hypre_BoxLoop3End
+#define hypre_BoxLoop4SimdBegin  hypre_BoxLoop4Begin
+#define hypre_BoxLoop4SimdEnd    hypre_BoxLoop4End
 
 #define hypre_BasicBoxLoop2Begin hypre_newBasicBoxLoop2Begin
 #endif
@@ -82,6 +82,10 @@
 #define hypre_BoxLoop3End    zypre_omp4_dist_BoxLoopEnd
 #define hypre_BoxLoop4Begin  zypre_omp4_dist_BoxLoop4Begin
 #define hypre_BoxLoop4End    zypre_omp4_dist_BoxLoopEnd
+#define hypre_BoxLoop3SimdBegin hypre_BoxLoop3Begin
+#define hypre_BoxLoop3SimdEnd   hypre_BoxLoop3End
+#define hypre_BoxLoop4SimdBegin hypre_BoxLoop4Begin
+#define hypre_BoxLoop4SimdEnd   hypre_BoxLoop4End
 #define hypre_LoopBegin      zypre_LoopBegin
 #define hypre_LoopEnd        zypre_omp4_dist_BoxLoopEnd
 
@@ -302,6 +302,10 @@ hypre_CheckErrorDevice(cudaDeviceSynchronize());
 #define hypre_BoxLoop4Begin      zypre_newBoxLoop4Begin
 #define hypre_BoxLoop4For        zypre_newBoxLoop4For
 #define hypre_BoxLoop4End        zypre_newBoxLoop4End
+#define hypre_BoxLoop3SimdBegin  hypre_BoxLoop3Begin
+#define hypre_BoxLoop3SimdEnd    hypre_BoxLoop3End
+#define hypre_BoxLoop4SimdBegin  hypre_BoxLoop4Begin
+#define hypre_BoxLoop4SimdEnd    hypre_BoxLoop4End
 
 #define hypre_BasicBoxLoop2Begin zypre_newBasicBoxLoop2Begin
 #endif
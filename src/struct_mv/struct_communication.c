@@ -137,6 +137,9 @@ hypre_CommPkgCreate( hypre_CommInfo   *comm_info,
 
    hypre_CommPkgComm(comm_pkg)      = comm;
    hypre_CommPkgFirstComm(comm_pkg) = 1;
+#if defined(HYPRE_USING_PERSISTENT_COMM_PKG) && defined(HYPRE_USING_NEIGHBOR_COLL)
+   hypre_CommPkgNeighborComm(comm_pkg) = hypre_MPI_COMM_NULL;
+#endif
    hypre_CommPkgNDim(comm_pkg)      = ndim;
    hypre_CommPkgNumValues(comm_pkg) = num_values;
    hypre_CommPkgNumOrders(comm_pkg) = 0;
@@ -763,12 +766,238 @@ hypre_CommTypeSetEntry( hypre_Box           *box,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Set up the persistent exchange of a CommPkg.  The message buffers are
+ * allocated once and the MPI requests are created with MPI_Send_init and
+ * MPI_Recv_init (or, with HYPRE_USING_NEIGHBOR_COLL, the message layout for
+ * MPI_Ineighbor_alltoallv is set up).  This must be called after the first
+ * communication, when the buffer sizes no longer include the prefix
+ * information.
+ *
+ * With HYPRE_USING_NEIGHBOR_COLL, the graph communicator is created here the
+ * first time, so that CommPkgs used for a single exchange never create one.
+ * The creation is collective over the CommPkg communicator.  This relies on
+ * every process of that communicator doing the same sequence of exchanges with
+ * its CommPkgs, as is the case for the struct and semi-struct codes, where
+ * hypre_InitializeCommunication is called also by processes with nothing to
+ * send or receive.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgCreatePersistent( hypre_CommPkg *comm_pkg,
+                               HYPRE_Int      tag )
+{
+#ifdef HYPRE_USING_PERSISTENT_COMM_PKG
+   HYPRE_Int            num_sends  = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs  = hypre_CommPkgNumRecvs(comm_pkg);
+#ifndef HYPRE_USING_NEIGHBOR_COLL
+   MPI_Comm             comm       = hypre_CommPkgComm(comm_pkg);
+   HYPRE_Int            j;
+#endif
+
+   HYPRE_Int            num_requests;
+   hypre_MPI_Request   *requests;
+   HYPRE_Complex      **send_buffers;
+   HYPRE_Complex      **recv_buffers;
+
+   hypre_CommType      *comm_type;
+   HYPRE_Int            i, size;
+
+   if (hypre_CommPkgFirstComm(comm_pkg))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CommPkgDestroyPersistent(comm_pkg);
+
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+   if (hypre_CommPkgNeighborComm(comm_pkg) == hypre_MPI_COMM_NULL)
+   {
+      HYPRE_Int *sources, *destinations;
+
+      sources      = hypre_TAlloc(HYPRE_Int,  num_recvs, HYPRE_MEMORY_HOST);
+      destinations = hypre_TAlloc(HYPRE_Int,  num_sends, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_sends; i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i);
+         destinations[i] = hypre_CommTypeProc(comm_type);
+      }
+      for (i = 0; i < num_recvs; i++)
+      {
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+         sources[i] = hypre_CommTypeProc(comm_type);
+      }
+      hypre_MPI_Dist_graph_create_adjacent(hypre_CommPkgComm(comm_pkg),
+                                           num_recvs, sources,
+                                           num_sends, destinations, 0,
+                                           &hypre_CommPkgNeighborComm(comm_pkg));
+      hypre_TFree(sources, HYPRE_MEMORY_HOST);
+      hypre_TFree(destinations, HYPRE_MEMORY_HOST);
+   }
+#endif
+
+   /* the buffers are laid out exactly as in hypre_InitializeCommunication */
+   send_buffers = hypre_TAlloc(HYPRE_Complex *,  num_sends, HYPRE_MEMORY_HOST);
+   if (num_sends > 0)
+   {
+      size = hypre_CommPkgSendBufsize(comm_pkg);
+      send_buffers[0] = hypre_TAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
+      for (i = 1; i < num_sends; i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i-1);
+         send_buffers[i] = send_buffers[i-1] + hypre_CommTypeBufsize(comm_type);
+      }
+   }
+   recv_buffers = hypre_TAlloc(HYPRE_Complex *,  num_recvs, HYPRE_MEMORY_HOST);
+   if (num_recvs > 0)
+   {
+      size = hypre_CommPkgRecvBufsize(comm_pkg);
+      recv_buffers[0] = hypre_TAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
+      for (i = 1; i < num_recvs; i++)
+      {
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i-1);
+         recv_buffers[i] = recv_buffers[i-1] + hypre_CommTypeBufsize(comm_type);
+      }
+   }
+
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+   {
+      hypre_int  *send_counts, *send_displs, *recv_counts, *recv_displs;
+
+      send_counts  = hypre_TAlloc(hypre_int,  num_sends, HYPRE_MEMORY_HOST);
+      send_displs  = hypre_TAlloc(hypre_int,  num_sends, HYPRE_MEMORY_HOST);
+      recv_counts  = hypre_TAlloc(hypre_int,  num_recvs, HYPRE_MEMORY_HOST);
+      recv_displs  = hypre_TAlloc(hypre_int,  num_recvs, HYPRE_MEMORY_HOST);
+
+      size = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i);
+         send_counts[i]  = (hypre_int)
+            (hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex));
+         send_displs[i]  = (hypre_int) (size*sizeof(HYPRE_Complex));
+         size += hypre_CommTypeBufsize(comm_type);
+      }
+      size = 0;
+      for (i = 0; i < num_recvs; i++)
+      {
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+         recv_counts[i] = (hypre_int)
+            (hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex));
+         recv_displs[i] = (hypre_int) (size*sizeof(HYPRE_Complex));
+         size += hypre_CommTypeBufsize(comm_type);
+      }
+
+
+      hypre_CommPkgNeighborSendCounts(comm_pkg) = send_counts;
+      hypre_CommPkgNeighborSendDispls(comm_pkg) = send_displs;
+      hypre_CommPkgNeighborRecvCounts(comm_pkg) = recv_counts;
+      hypre_CommPkgNeighborRecvDispls(comm_pkg) = recv_displs;
+
+      /* one request for the whole neighborhood exchange */
+      num_requests = 1;
+      requests = hypre_CTAlloc(hypre_MPI_Request,  num_requests, HYPRE_MEMORY_HOST);
+   }
+#else
+   num_requests = num_sends + num_recvs;
+   requests = hypre_CTAlloc(hypre_MPI_Request,  num_requests, HYPRE_MEMORY_HOST);
+
+   j = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      hypre_MPI_Recv_init(recv_buffers[i],
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      hypre_MPI_Send_init(send_buffers[i],
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+   }
+#endif
+
+   hypre_CommPkgPersistent(comm_pkg)            = 1;
+   hypre_CommPkgPersistentTag(comm_pkg)         = tag;
+   hypre_CommPkgNumPersistentRequests(comm_pkg) = num_requests;
+   hypre_CommPkgPersistentRequests(comm_pkg)    = requests;
+   hypre_CommPkgPersistentStatus(comm_pkg)      =
+      hypre_CTAlloc(hypre_MPI_Status,  num_requests, HYPRE_MEMORY_HOST);
+   hypre_CommPkgPersistentSendBuffers(comm_pkg) = send_buffers;
+   hypre_CommPkgPersistentRecvBuffers(comm_pkg) = recv_buffers;
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgDestroyPersistent( hypre_CommPkg *comm_pkg )
+{
+#ifdef HYPRE_USING_PERSISTENT_COMM_PKG
+   HYPRE_Complex  **send_buffers;
+   HYPRE_Complex  **recv_buffers;
+#ifndef HYPRE_USING_NEIGHBOR_COLL
+   HYPRE_Int        i;
+#endif
+
+   if (hypre_CommPkgPersistent(comm_pkg))
+   {
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+      hypre_TFree(hypre_CommPkgNeighborSendCounts(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgNeighborSendDispls(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgNeighborRecvCounts(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgNeighborRecvDispls(comm_pkg), HYPRE_MEMORY_HOST);
+#else
+      for (i = 0; i < hypre_CommPkgNumPersistentRequests(comm_pkg); i++)
+      {
+         hypre_MPI_Request_free(&hypre_CommPkgPersistentRequests(comm_pkg)[i]);
+      }
+#endif
+      hypre_TFree(hypre_CommPkgPersistentRequests(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgPersistentStatus(comm_pkg), HYPRE_MEMORY_HOST);
+
+      send_buffers = hypre_CommPkgPersistentSendBuffers(comm_pkg);
+      recv_buffers = hypre_CommPkgPersistentRecvBuffers(comm_pkg);
+      if (hypre_CommPkgNumSends(comm_pkg) > 0)
+      {
+         hypre_TFree(send_buffers[0], HYPRE_MEMORY_HOST);
+      }
+      if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
+      {
+         hypre_TFree(recv_buffers[0], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(send_buffers, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_buffers, HYPRE_MEMORY_HOST);
+
+      hypre_CommPkgPersistent(comm_pkg) = 0;
+      hypre_CommPkgNumPersistentRequests(comm_pkg) = 0;
+      hypre_CommPkgPersistentSendBuffers(comm_pkg) = NULL;
+      hypre_CommPkgPersistentRecvBuffers(comm_pkg) = NULL;
+   }
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Initialize a non-blocking communication exchange.
  *
  * The communication buffers are created, the send buffer is manually
  * packed, and the communication requests are posted.
  *
+ * With HYPRE_USING_PERSISTENT_COMM (or HYPRE_USING_NEIGHBOR_COLL), every
+ * communication after the first one reuses the buffers and requests of the
+ * CommPkg persistent exchange instead, unless that exchange is already in
+ * use by another outstanding communication handle.
+ *
  * Different "actions" are possible when the buffer data is unpacked:
  *   action = 0    - copy the data over existing values in memory
  *   action = 1    - add the data to existing values in memory
@@ -812,22 +1041,57 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
 
    HYPRE_Int            i, j, d, ll;
    HYPRE_Int            size;
+   HYPRE_Int            persistent = 0;
+
+#ifdef HYPRE_USING_PERSISTENT_COMM_PKG
+   if ( !hypre_CommPkgFirstComm(comm_pkg) &&
+        hypre_CommPkgPersistent(comm_pkg) != 2 )
+   {
+      if ( !hypre_CommPkgPersistent(comm_pkg) ||
+           hypre_CommPkgPersistentTag(comm_pkg) != tag )
+      {
+         hypre_CommPkgCreatePersistent(comm_pkg, tag);
+      }
+      hypre_CommPkgPersistent(comm_pkg) = 2;
+      persistent = 1;
+   }
+#endif
 
    /*--------------------------------------------------------------------
     * allocate requests and status
     *--------------------------------------------------------------------*/
 
-   num_requests = num_sends + num_recvs;
-   requests = hypre_CTAlloc(hypre_MPI_Request,  num_requests, HYPRE_MEMORY_HOST);
-   status   = hypre_CTAlloc(hypre_MPI_Status,  num_requests, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_PERSISTENT_COMM_PKG
+   if (persistent)
+   {
+      num_requests = hypre_CommPkgNumPersistentRequests(comm_pkg);
+      requests     = hypre_CommPkgPersistentRequests(comm_pkg);
+      status       = hypre_CommPkgPersistentStatus(comm_pkg);
+   }
+   else
+#endif
+   {
+      num_requests = num_sends + num_recvs;
+      requests = hypre_CTAlloc(hypre_MPI_Request,  num_requests, HYPRE_MEMORY_HOST);
+      status   = hypre_CTAlloc(hypre_MPI_Status,  num_requests, HYPRE_MEMORY_HOST);
+   }
 
    /*--------------------------------------------------------------------
     * allocate buffers
     *--------------------------------------------------------------------*/
 
    /* allocate send buffers */
-   send_buffers = hypre_TAlloc(HYPRE_Complex *,  num_sends, HYPRE_MEMORY_HOST);
-   if (num_sends > 0)
+#ifdef HYPRE_USING_PERSISTENT_COMM_PKG
+   if (persistent)
+   {
+      send_buffers = hypre_CommPkgPersistentSendBuffers(comm_pkg);
+   }
+   else
+#endif
+   {
+      send_buffers = hypre_TAlloc(HYPRE_Complex *,  num_sends, HYPRE_MEMORY_HOST);
+   }
+   if (num_sends > 0 && !persistent)
    {
       size = hypre_CommPkgSendBufsize(comm_pkg);
       send_buffers[0] =  hypre_TAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
@@ -880,8 +1144,17 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
 #endif
 
    /* allocate recv buffers */
-   recv_buffers = hypre_TAlloc(HYPRE_Complex *,  num_recvs, HYPRE_MEMORY_HOST);
-   if (num_recvs > 0)
+#ifdef HYPRE_USING_PERSISTENT_COMM_PKG
+   if (persistent)
+   {
+      recv_buffers = hypre_CommPkgPersistentRecvBuffers(comm_pkg);
+   }
+   else
+#endif
+   {
+      recv_buffers = hypre_TAlloc(HYPRE_Complex *,  num_recvs, HYPRE_MEMORY_HOST);
+   }
+   if (num_recvs > 0 && !persistent)
    {
       size = hypre_CommPkgRecvBufsize(comm_pkg);
       recv_buffers[0] =  hypre_TAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
@@ -1058,36 +1331,71 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
     * post receives and initiate sends
     *--------------------------------------------------------------------*/
 
-   j = 0;
-   for(i = 0; i < num_recvs; i++)
+#ifdef HYPRE_USING_PERSISTENT_COMM_PKG
+   if (persistent)
    {
-      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
-      hypre_MPI_Irecv(recv_buffers[i],
-                      hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
-                      hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
-                      tag, comm, &requests[j++]);
-      if ( hypre_CommPkgFirstComm(comm_pkg) )
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+      hypre_MPI_Ineighbor_alltoallv((num_sends > 0) ? send_buffers[0] : NULL,
+                                    hypre_CommPkgNeighborSendCounts(comm_pkg),
+                                    hypre_CommPkgNeighborSendDispls(comm_pkg),
+                                    hypre_MPI_BYTE,
+                                    (num_recvs > 0) ? recv_buffers[0] : NULL,
+                                    hypre_CommPkgNeighborRecvCounts(comm_pkg),
+                                    hypre_CommPkgNeighborRecvDispls(comm_pkg),
+                                    hypre_MPI_BYTE,
+                                    hypre_CommPkgNeighborComm(comm_pkg),
+                                    &requests[0]);
+#else
+      if (num_requests)
       {
-         size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
-         hypre_CommTypeBufsize(comm_type)   -= size;
-         hypre_CommPkgRecvBufsize(comm_pkg) -= size;
+         hypre_MPI_Startall(num_requests, requests);
       }
+#endif
    }
-
-   for(i = 0; i < num_sends; i++)
+   else
+#endif
    {
-      comm_type = hypre_CommPkgSendType(comm_pkg, i);
-      hypre_MPI_Isend(send_buffers[i],
-                      hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
-                      hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
-                      tag, comm, &requests[j++]);
-      if ( hypre_CommPkgFirstComm(comm_pkg) )
+      j = 0;
+      for(i = 0; i < num_recvs; i++)
       {
-         size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
-         hypre_CommTypeBufsize(comm_type)   -= size;
-         hypre_CommPkgSendBufsize(comm_pkg) -= size;
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+         hypre_MPI_Irecv(recv_buffers[i],
+                         hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                         hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
+         if ( hypre_CommPkgFirstComm(comm_pkg) )
+         {
+            size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
+            hypre_CommTypeBufsize(comm_type)   -= size;
+            hypre_CommPkgRecvBufsize(comm_pkg) -= size;
+         }
       }
+
+      for(i = 0; i < num_sends; i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i);
+         hypre_MPI_Isend(send_buffers[i],
+                         hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                         hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
+         if ( hypre_CommPkgFirstComm(comm_pkg) )
+         {
+            size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
+            hypre_CommTypeBufsize(comm_type)   -= size;
+            hypre_CommPkgSendBufsize(comm_pkg) -= size;
+         }
+      }
+   }
+
+   if (hypre_comm_stats_active)
+   {
+      hypre_CommPkgNumExchanges(comm_pkg) ++;
+      hypre_CommPkgNumMessages(comm_pkg) += num_sends;
+      hypre_CommPkgNumBytes(comm_pkg) +=
+         (HYPRE_Real) hypre_CommPkgSendBufsize(comm_pkg) * sizeof(HYPRE_Complex);
    }
+   HYPRE_PROFILE_COUNT(0.0, 0.0, (HYPRE_Real) hypre_CommPkgSendBufsize(comm_pkg) *
+                       sizeof(HYPRE_Complex));
 
    /*--------------------------------------------------------------------
     * set up CopyToType and exchange local data
@@ -1131,6 +1439,7 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
    hypre_CommHandleSendBuffers(comm_handle) = send_buffers;
    hypre_CommHandleRecvBuffers(comm_handle) = recv_buffers;
    hypre_CommHandleAction(comm_handle)      = action;
+   hypre_CommHandlePersistent(comm_handle)  = persistent;
    hypre_CommHandleSendBuffersDevice(comm_handle) = send_buffers_data;
    hypre_CommHandleRecvBuffersDevice(comm_handle) = recv_buffers_data;
 
@@ -1187,9 +1496,21 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
 
    if (hypre_CommHandleNumRequests(comm_handle))
    {
+      HYPRE_Real  wait_start = 0.0;
+
+      if (hypre_comm_stats_active)
+      {
+         wait_start = hypre_MPI_Wtime();
+      }
+      HYPRE_PROFILE_BEGIN("comm.wait", -1);
       hypre_MPI_Waitall(hypre_CommHandleNumRequests(comm_handle),
                         hypre_CommHandleRequests(comm_handle),
                         hypre_CommHandleStatus(comm_handle));
+      HYPRE_PROFILE_END("comm.wait");
+      if (hypre_comm_stats_active)
+      {
+         hypre_CommPkgWaitTime(comm_pkg) += hypre_MPI_Wtime() - wait_start;
+      }
    }
 
    /*--------------------------------------------------------------------
@@ -1332,6 +1653,17 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
     * Free up communication handle
     *--------------------------------------------------------------------*/
 
+#ifdef HYPRE_USING_PERSISTENT_COMM_PKG
+   if (hypre_CommHandlePersistent(comm_handle))
+   {
+      /* requests and buffers stay with the CommPkg for the next exchange */
+      hypre_CommPkgPersistent(comm_pkg) = 1;
+      hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+#endif
+
    hypre_TFree(hypre_CommHandleRequests(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_CommHandleStatus(comm_handle), HYPRE_MEMORY_HOST);
    if (num_sends > 0)
@@ -1471,6 +1803,14 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
    if (comm_pkg)
    {
+      hypre_CommPkgDestroyPersistent(comm_pkg);
+#if defined(HYPRE_USING_PERSISTENT_COMM_PKG) && defined(HYPRE_USING_NEIGHBOR_COLL)
+      if (hypre_CommPkgNeighborComm(comm_pkg) != hypre_MPI_COMM_NULL)
+      {
+         hypre_MPI_Comm_free(&hypre_CommPkgNeighborComm(comm_pkg));
+      }
+#endif
+
       /* note that entries are allocated in two stages for To/Recv */
       if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
       {
@@ -1505,3 +1845,62 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * Adds the statistics accumulated by comm_pkg since the last call to
+ * stats[1..4] (exchanges, messages, MB sent, time spent waiting) and resets
+ * them.  stats[0] becomes the larger of its value and the number of distinct
+ * processes comm_pkg sends to or receives from, so that the packages of one
+ * operation count their common neighbors once.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgGetStats( hypre_CommPkg *comm_pkg,
+                       HYPRE_Real    *stats )
+{
+   hypre_CommType  *comm_type;
+   HYPRE_Int       *procs;
+   HYPRE_Int        num_sends, num_recvs, num_nbrs, i;
+
+   if (!comm_pkg)
+   {
+      return hypre_error_flag;
+   }
+
+   num_sends = hypre_CommPkgNumSends(comm_pkg);
+   num_recvs = hypre_CommPkgNumRecvs(comm_pkg);
+   procs = hypre_TAlloc(HYPRE_Int, num_sends+num_recvs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      procs[i]  = hypre_CommTypeProc(comm_type);
+   }
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      procs[num_sends+i] = hypre_CommTypeProc(comm_type);
+   }
+   hypre_qsort0(procs, 0, num_sends+num_recvs-1);
+   num_nbrs = 0;
+   for (i = 0; i < num_sends+num_recvs; i++)
+   {
+      if (i == 0 || procs[i] != procs[i-1])
+      {
+         num_nbrs++;
+      }
+   }
+   hypre_TFree(procs, HYPRE_MEMORY_HOST);
+
+   stats[0]  = hypre_max(stats[0], (HYPRE_Real) num_nbrs);
+   stats[1] += (HYPRE_Real) hypre_CommPkgNumExchanges(comm_pkg);
+   stats[2] += (HYPRE_Real) hypre_CommPkgNumMessages(comm_pkg);
+   stats[3] += hypre_CommPkgNumBytes(comm_pkg) / 1.0e6;
+   stats[4] += hypre_CommPkgWaitTime(comm_pkg);
+
+   hypre_CommPkgNumExchanges(comm_pkg) = 0;
+   hypre_CommPkgNumMessages(comm_pkg)  = 0;
+   hypre_CommPkgNumBytes(comm_pkg)     = 0.0;
+   hypre_CommPkgWaitTime(comm_pkg)     = 0.0;
+
+   return hypre_error_flag;
+}
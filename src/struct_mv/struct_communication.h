@@ -81,6 +81,17 @@ typedef struct hypre_CommType_struct
 
 } hypre_CommType;
 
+/*--------------------------------------------------------------------------
+ * Persistent exchanges reuse the MPI requests and message buffers of a
+ * CommPkg after its first communication.  They are only used with host
+ * communication buffers.
+ *--------------------------------------------------------------------------*/
+
+#if (defined(HYPRE_USING_PERSISTENT_COMM) || defined(HYPRE_USING_NEIGHBOR_COLL)) \
+   && !defined(HYPRE_MEMORY_GPU) && !defined(HYPRE_USE_OMP45)
+#define HYPRE_USING_PERSISTENT_COMM_PKG
+#endif
+
 /*--------------------------------------------------------------------------
  * hypre_CommPkg:
  *   Structure containing information for doing communications
@@ -122,6 +133,31 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+   /* statistics, accumulated while hypre_comm_stats_active is set */
+   HYPRE_Int         num_exchanges;
+   HYPRE_Int         num_messages;
+   HYPRE_Real        num_bytes;
+   HYPRE_Real        wait_time;
+
+#ifdef HYPRE_USING_PERSISTENT_COMM_PKG
+   /* persistent exchange (set up after the first communication) */
+   HYPRE_Int           persistent;  /* 0 = none, 1 = ready, 2 = in use */
+   HYPRE_Int           persistent_tag;
+   HYPRE_Int           num_persistent_requests;
+   hypre_MPI_Request  *persistent_requests;
+   hypre_MPI_Status   *persistent_status;
+   HYPRE_Complex     **persistent_send_buffers;
+   HYPRE_Complex     **persistent_recv_buffers;
+#ifdef HYPRE_USING_NEIGHBOR_COLL
+   /* distributed graph communicator and message layout (in bytes) */
+   hypre_MPI_Comm      neighbor_comm;
+   hypre_int          *neighbor_send_counts;
+   hypre_int          *neighbor_send_displs;
+   hypre_int          *neighbor_recv_counts;
+   hypre_int          *neighbor_recv_displs;
+#endif
+#endif
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -147,6 +183,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int       action;
 
+   /* requests and buffers belong to the CommPkg persistent exchange */
+   HYPRE_Int       persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -238,6 +277,25 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)     (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)   (comm_pkg -> identity_order)
 
+#define hypre_CommPkgNumExchanges(comm_pkg)    (comm_pkg -> num_exchanges)
+#define hypre_CommPkgNumMessages(comm_pkg)     (comm_pkg -> num_messages)
+#define hypre_CommPkgNumBytes(comm_pkg)        (comm_pkg -> num_bytes)
+#define hypre_CommPkgWaitTime(comm_pkg)        (comm_pkg -> wait_time)
+
+#define hypre_CommPkgPersistent(comm_pkg)             (comm_pkg -> persistent)
+#define hypre_CommPkgPersistentTag(comm_pkg)          (comm_pkg -> persistent_tag)
+#define hypre_CommPkgNumPersistentRequests(comm_pkg)  (comm_pkg -> num_persistent_requests)
+#define hypre_CommPkgPersistentRequests(comm_pkg)     (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)       (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffers(comm_pkg)  (comm_pkg -> persistent_send_buffers)
+#define hypre_CommPkgPersistentRecvBuffers(comm_pkg)  (comm_pkg -> persistent_recv_buffers)
+
+#define hypre_CommPkgNeighborComm(comm_pkg)           (comm_pkg -> neighbor_comm)
+#define hypre_CommPkgNeighborSendCounts(comm_pkg)     (comm_pkg -> neighbor_send_counts)
+#define hypre_CommPkgNeighborSendDispls(comm_pkg)     (comm_pkg -> neighbor_send_displs)
+#define hypre_CommPkgNeighborRecvCounts(comm_pkg)     (comm_pkg -> neighbor_recv_counts)
+#define hypre_CommPkgNeighborRecvDispls(comm_pkg)     (comm_pkg -> neighbor_recv_displs)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -251,6 +309,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleSendBuffers(comm_handle) (comm_handle -> send_buffers)
 #define hypre_CommHandleRecvBuffers(comm_handle) (comm_handle -> recv_buffers)
 #define hypre_CommHandleAction(comm_handle)      (comm_handle -> action)
+#define hypre_CommHandlePersistent(comm_handle)  (comm_handle -> persistent)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_data)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_data)
 
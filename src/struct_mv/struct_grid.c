@@ -55,6 +55,7 @@ hypre_StructGridCreate( MPI_Comm           comm,
    hypre_SetIndex(hypre_StructGridPeriodic(grid), 0);
    hypre_StructGridRefCount(grid)     = 1;
    hypre_StructGridBoxMan(grid)       = NULL;
+   hypre_StructGridPrevBoxMan(grid)   = NULL;
    
    hypre_StructGridNumPeriods(grid)   = 1;
    hypre_StructGridPShifts(grid)     = NULL;
@@ -127,6 +128,23 @@ hypre_StructGridSetPeriodic( hypre_StructGrid  *grid,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Declare that grid replaces the assembled grid prev_grid (e.g., after a
+ * regrid that changed the boxes of a few processes).  The assemble then
+ * reuses the box manager of prev_grid (see hypre_BoxManSetPrevManager).  This
+ * must be called on all processes (or on none), and prev_grid must not be
+ * destroyed before grid is assembled.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int 
+hypre_StructGridSetPrevGrid( hypre_StructGrid  *grid,
+                             hypre_StructGrid  *prev_grid )
+{
+   hypre_StructGridPrevBoxMan(grid) = hypre_StructGridBoxMan(prev_grid);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructGridSetExtents
  *--------------------------------------------------------------------------*/
@@ -456,6 +474,10 @@ hypre_StructGridAssemble( hypre_StructGrid *grid )
       info_size = 0; /* we don't need an info object */
       hypre_BoxManCreate(max_nentries, info_size, ndim, bounding_box, 
                          comm, &boxman);
+      if (hypre_StructGridPrevBoxMan(grid) != NULL)
+      {
+         hypre_BoxManSetPrevManager(boxman, hypre_StructGridPrevBoxMan(grid));
+      }
       
       /******** populate the box manager with my local boxes and gather neighbor
                 information  ******/
@@ -553,6 +575,7 @@ hypre_StructGridAssemble( hypre_StructGrid *grid )
    hypre_BoxManAssemble(boxman);
    
    hypre_StructGridBoxMan(grid) = boxman;
+   hypre_StructGridPrevBoxMan(grid) = NULL;
 
    hypre_EndTiming(time_index);
 
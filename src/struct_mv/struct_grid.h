@@ -53,6 +53,8 @@ typedef struct hypre_StructGrid_struct
    HYPRE_Int            num_ghost[2*HYPRE_MAXDIM]; /* ghost layer size */  
 
    hypre_BoxManager    *boxman;
+   hypre_BoxManager    *prev_boxman;  /* box manager of a previous version of
+                                         the grid, reused in the assemble */
 #if defined(HYPRE_USE_CUDA) 
    HYPRE_Int            data_location;
 #endif
@@ -78,6 +80,7 @@ typedef struct hypre_StructGrid_struct
 #define hypre_StructGridGhlocalSize(grid)   ((grid) -> ghlocal_size)
 #define hypre_StructGridNumGhost(grid)      ((grid) -> num_ghost)
 #define hypre_StructGridBoxMan(grid)        ((grid) -> boxman) 
+#define hypre_StructGridPrevBoxMan(grid)    ((grid) -> prev_boxman)
 
 #define hypre_StructGridBox(grid, i) \
 (hypre_BoxArrayBox(hypre_StructGridBoxes(grid), i))
@@ -24,8 +24,16 @@
 #endif
 #define MAX_DEPTH 7
 
+/* largest stencil handled by hypre_StructMatvecFused, and the number of
+ * points of a row it accumulates at a time */
+#define HYPRE_MATVEC_FUSED_MAX_SIZE 27
+#define HYPRE_MATVEC_FUSED_CHUNK    256
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecData data structure
+ *
+ * fused_size is the stencil size when a specialized single-pass kernel is
+ * used (see hypre_StructMatvecFused), and 0 otherwise.
  *--------------------------------------------------------------------------*/
 
 typedef struct
@@ -33,6 +41,7 @@ typedef struct
    hypre_StructMatrix  *A;
    hypre_StructVector  *x;
    hypre_ComputePkg    *compute_pkg;
+   HYPRE_Int            fused_size;
 
 } hypre_StructMatvecData;
 
@@ -65,6 +74,11 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    hypre_StructStencil     *stencil;
    hypre_ComputeInfo       *compute_info;
    hypre_ComputePkg        *compute_pkg;
+   hypre_IndexRef           stride;
+   HYPRE_Int                stencil_size;
+   HYPRE_Int                constant_coefficient;
+   HYPRE_Int                fused_size;
+   HYPRE_Int                d;
 
    /*----------------------------------------------------------
     * Set up the compute package
@@ -77,6 +91,39 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
                           grid, &compute_pkg);
 
+   /*----------------------------------------------------------
+    * Select a fused kernel for the common 2D/3D stencils
+    *----------------------------------------------------------*/
+
+   stencil_size         = hypre_StructStencilSize(stencil);
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   stride               = hypre_ComputePkgStride(compute_pkg);
+
+   fused_size = 0;
+#if !defined(HYPRE_USE_RAJA) && !defined(HYPRE_USE_KOKKOS) && \
+    !defined(HYPRE_USE_CUDA) && !defined(HYPRE_USE_OMP45)
+   switch (stencil_size)
+   {
+      case 5:
+      case 7:
+      case 9:
+      case 19:
+      case 27:
+         if (constant_coefficient == 0 || constant_coefficient == 1)
+         {
+            fused_size = stencil_size;
+         }
+         break;
+   }
+   for (d = 0; d < hypre_StructVectorNDim(x); d++)
+   {
+      if (hypre_IndexD(stride, d) != 1)
+      {
+         fused_size = 0;
+      }
+   }
+#endif
+
    /*----------------------------------------------------------
     * Set up the matvec data structure
     *----------------------------------------------------------*/
@@ -84,6 +131,7 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    (matvec_data -> A)           = hypre_StructMatrixRef(A);
    (matvec_data -> x)           = hypre_StructVectorRef(x);
    (matvec_data -> compute_pkg) = compute_pkg;
+   (matvec_data -> fused_size)  = fused_size;
 
    return hypre_error_flag;
 }
@@ -256,6 +304,13 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
        * y += A*x
        *--------------------------------------------------------------------*/
 
+      if (matvec_data -> fused_size)
+      {
+         hypre_StructMatvecFused(alpha, A, x, y, compute_box_aa,
+                                 (matvec_data -> fused_size));
+         continue;
+      }
+
       switch( constant_coefficient )
       {
          case 0:
@@ -1429,6 +1484,214 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecFused
+ * single-pass struct matvec for 5, 7, 9, 19, and 27 point stencils with
+ * constant_coefficient 0 or 1.  Unlike hypre_StructMatvecCC0/CC1, which
+ * sweep all of y once per group of MAX_DEPTH stencil entries, the groups are
+ * applied one row chunk at a time into a local buffer, so y is streamed from
+ * memory once.  Keeping the MAX_DEPTH grouping bounds the number of
+ * coefficient streams that are live at once, and accumulating into a local
+ * buffer lets the unit-stride loops vectorize without alias checks.  The
+ * stencil size is a compile-time constant in each row kernel, and the rows of
+ * a box are distributed over threads in contiguous blocks.
+ *
+ * As for CC0, y is expected to hold (beta/alpha)*y on input in the variable
+ * coefficient case and alpha*(y + A*x) is written back.  In the constant
+ * coefficient case y holds beta*y and alpha*A*x is added.
+ *--------------------------------------------------------------------------*/
+
+/* sum of the first D terms T(0) + ... + T(D-1) of a stencil group */
+#define hypre_StructMatvecFusedSum1(T) T(0)
+#define hypre_StructMatvecFusedSum2(T) hypre_StructMatvecFusedSum1(T) + T(1)
+#define hypre_StructMatvecFusedSum3(T) hypre_StructMatvecFusedSum2(T) + T(2)
+#define hypre_StructMatvecFusedSum4(T) hypre_StructMatvecFusedSum3(T) + T(3)
+#define hypre_StructMatvecFusedSum5(T) hypre_StructMatvecFusedSum4(T) + T(4)
+#define hypre_StructMatvecFusedSum6(T) hypre_StructMatvecFusedSum5(T) + T(5)
+#define hypre_StructMatvecFusedSum7(T) hypre_StructMatvecFusedSum6(T) + T(6)
+
+#define hypre_StructMatvecFusedTermCC0(k) Ag[k][ii] * xg[k][ii]
+#define hypre_StructMatvecFusedTermCC1(k) AAg[k] * xg[k][ii]
+
+/* add the products of stencil entries si, ..., si+D-1 for the current row
+ * chunk to tmp */
+#define hypre_StructMatvecFusedGroup(CC, D)                             \
+for (k = 0; k < D; k++)                                                 \
+{                                                                       \
+   Ag[k]  = Ap[si+k] + Ai;                                              \
+   AAg[k] = Ac[si+k];                                                   \
+   xg[k]  = xp + xi + xoff[si+k];                                       \
+}                                                                       \
+for (ii = 0; ii < ni; ii++)                                             \
+{                                                                       \
+   tmp[ii] += hypre_StructMatvecFusedSum##D(hypre_StructMatvecFusedTerm##CC); \
+}                                                                       \
+si += D
+
+/* apply all entries of an N-point stencil in groups of at most MAX_DEPTH */
+#define hypre_StructMatvecFusedRow(CC, N)                               \
+si = 0;                                                                 \
+switch (N)                                                              \
+{                                                                       \
+   case 5:                                                              \
+      hypre_StructMatvecFusedGroup(CC, 5);                              \
+      break;                                                            \
+   case 7:                                                              \
+      hypre_StructMatvecFusedGroup(CC, 7);                              \
+      break;                                                            \
+   case 9:                                                              \
+      hypre_StructMatvecFusedGroup(CC, 7);                              \
+      hypre_StructMatvecFusedGroup(CC, 2);                              \
+      break;                                                            \
+   case 19:                                                             \
+      hypre_StructMatvecFusedGroup(CC, 7);                              \
+      hypre_StructMatvecFusedGroup(CC, 7);                              \
+      hypre_StructMatvecFusedGroup(CC, 5);                              \
+      break;                                                            \
+   case 27:                                                             \
+      hypre_StructMatvecFusedGroup(CC, 7);                              \
+      hypre_StructMatvecFusedGroup(CC, 7);                              \
+      hypre_StructMatvecFusedGroup(CC, 7);                              \
+      hypre_StructMatvecFusedGroup(CC, 6);                              \
+      break;                                                            \
+}
+
+HYPRE_Int
+hypre_StructMatvecFused( HYPRE_Complex        alpha,
+                         hypre_StructMatrix  *A,
+                         hypre_StructVector  *x,
+                         hypre_StructVector  *y,
+                         hypre_BoxArrayArray *compute_box_aa,
+                         HYPRE_Int            stencil_size )
+{
+   HYPRE_Int                constant_coefficient;
+   hypre_Index             *stencil_shape;
+   HYPRE_Int                ndim;
+
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+   hypre_Box               *A_data_box;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   hypre_IndexRef           start;
+
+   HYPRE_Complex           *Ap[HYPRE_MATVEC_FUSED_MAX_SIZE];
+   HYPRE_Complex            Ac[HYPRE_MATVEC_FUSED_MAX_SIZE];
+   HYPRE_Int                xoff[HYPRE_MATVEC_FUSED_MAX_SIZE];
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+
+   HYPRE_Int                nx, ny, nz, num_rows;
+   HYPRE_Int                Ai0, xi0, yi0;
+   HYPRE_Int                Asj, Ask, xsj, xsk, ysj, ysk;
+   HYPRE_Int                i, j, si, r;
+
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   stencil_shape = hypre_StructStencilShape(hypre_StructMatrixStencil(A));
+   ndim          = hypre_StructVectorNDim(x);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         Ap[si]   = hypre_StructMatrixBoxData(A, i, si);
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+         Ac[si]   = constant_coefficient ? alpha * Ap[si][0] : 0.0;
+      }
+
+      /* data strides in the j and k directions */
+      Asj = Ask = xsj = xsk = ysj = ysk = 0;
+      if (ndim > 1)
+      {
+         Asj = hypre_BoxSizeD(A_data_box, 0);
+         xsj = hypre_BoxSizeD(x_data_box, 0);
+         ysj = hypre_BoxSizeD(y_data_box, 0);
+      }
+      if (ndim > 2)
+      {
+         Ask = Asj * hypre_BoxSizeD(A_data_box, 1);
+         xsk = xsj * hypre_BoxSizeD(x_data_box, 1);
+         ysk = ysj * hypre_BoxSizeD(y_data_box, 1);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+         start = hypre_BoxIMin(compute_box);
+
+         nx = hypre_BoxSizeD(compute_box, 0);
+         ny = (ndim > 1) ? hypre_BoxSizeD(compute_box, 1) : 1;
+         nz = (ndim > 2) ? hypre_BoxSizeD(compute_box, 2) : 1;
+         num_rows = ny * nz;
+         if (nx * num_rows == 0)
+         {
+            continue;
+         }
+
+         Ai0 = constant_coefficient ? 0 : hypre_BoxIndexRank(A_data_box, start);
+         xi0 = hypre_BoxIndexRank(x_data_box, start);
+         yi0 = hypre_BoxIndexRank(y_data_box, start);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+         for (r = 0; r < num_rows; r++)
+         {
+            HYPRE_Complex  tmp[HYPRE_MATVEC_FUSED_CHUNK];
+            HYPRE_Complex *Ag[MAX_DEPTH];
+            HYPRE_Complex  AAg[MAX_DEPTH];
+            HYPRE_Complex *xg[MAX_DEPTH];
+            HYPRE_Complex *yrow;
+            HYPRE_Int      jj, kk, i0, ii, ni, k, si, Ai, xi;
+
+            jj = r % ny;
+            kk = r / ny;
+
+            for (i0 = 0; i0 < nx; i0 += HYPRE_MATVEC_FUSED_CHUNK)
+            {
+               ni   = hypre_min(HYPRE_MATVEC_FUSED_CHUNK, nx - i0);
+               Ai   = constant_coefficient ? 0 : Ai0 + jj*Asj + kk*Ask + i0;
+               xi   = xi0 + jj*xsj + kk*xsk + i0;
+               yrow = yp + yi0 + jj*ysj + kk*ysk + i0;
+
+               for (ii = 0; ii < ni; ii++)
+               {
+                  tmp[ii] = 0.0;
+               }
+
+               if (constant_coefficient)
+               {
+                  hypre_StructMatvecFusedRow(CC1, stencil_size);
+                  for (ii = 0; ii < ni; ii++)
+                  {
+                     yrow[ii] += tmp[ii];
+                  }
+               }
+               else
+               {
+                  hypre_StructMatvecFusedRow(CC0, stencil_size);
+                  for (ii = 0; ii < ni; ii++)
+                  {
+                     yrow[ii] = alpha * (yrow[ii] + tmp[ii]);
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecDestroy
  *--------------------------------------------------------------------------*/
@@ -1449,6 +1712,28 @@ hypre_StructMatvecDestroy( void *matvec_vdata )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecCommStats
+ *
+ * Adds the communication statistics of the matvec to stats and resets them
+ * (see hypre_CommPkgGetStats).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecCommStats( void       *matvec_vdata,
+                             HYPRE_Real *stats )
+{
+   hypre_StructMatvecData *matvec_data = (hypre_StructMatvecData *)matvec_vdata;
+
+   if (matvec_data && (matvec_data -> compute_pkg))
+   {
+      hypre_CommPkgGetStats(hypre_ComputePkgCommPkg(matvec_data -> compute_pkg),
+                            stats);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvec
  *--------------------------------------------------------------------------*/
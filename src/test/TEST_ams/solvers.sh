@@ -27,6 +27,28 @@ diff -bI"time" solvers.out.4 solvers.out.5 >&2
 diff -bI"time" solvers.out.6 solvers.out.7 >&2
 diff -bI"time" solvers.out.8 solvers.out.9 >&2
 diff -bI"time" solvers.out.10 solvers.out.11 >&2
+diff -bI"time" solvers.out.15 solvers.out.16 >&2
+
+#=============================================================================
+# The numeric refreshes (the diagonal of A is doubled before each one) should
+# take as many iterations as fresh setups with the same matrices.  The final
+# residuals may differ, since a refresh keeps the auxiliary coarse grids.
+#=============================================================================
+
+grep "Iterations" solvers.out.13 | sed -n 2,3p > ${TNAME}.testdata
+grep "Iterations" solvers.out.17 solvers.out.18 | cut -d: -f2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# The concurrent subspace solves on one and two MPI tasks (with OpenMP threads
+# and Jacobi smoothers, which do not depend on the number of threads) should
+# take as many iterations as the sequential ones.  The final residuals may
+# differ in roundoff, as with any change in the number of threads.
+#=============================================================================
+
+grep "Iterations" solvers.out.19 solvers.out.21 | cut -d: -f2 > ${TNAME}.testdata
+grep "Iterations" solvers.out.20 solvers.out.22 | cut -d: -f2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
 #=============================================================================
 # compare with baseline case
@@ -57,6 +79,42 @@ do
   tail -4 $i
 done >> ${TNAME}.out
 
+FILES="\
+ ${TNAME}.out.13\
+"
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep "Iterations\|Final Relative" $i
+  echo ""
+done >> ${TNAME}.out
+
+FILES="\
+ ${TNAME}.out.14\
+ ${TNAME}.out.15\
+ ${TNAME}.out.16\
+ ${TNAME}.out.17\
+ ${TNAME}.out.18\
+"
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -4 $i
+done >> ${TNAME}.out
+
+FILES="\
+ ${TNAME}.out.19\
+ ${TNAME}.out.20\
+ ${TNAME}.out.21\
+ ${TNAME}.out.22\
+"
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep "Iterations" $i
+  echo ""
+done >> ${TNAME}.out
+
 FILES="\
  ${TNAME}.out.8\
  ${TNAME}.out.9\
@@ -86,4 +144,4 @@ fi
 # remove temporary files
 #=============================================================================
 
-# rm -f ${TNAME}.testdata*
+rm -f ${TNAME}.testdata*
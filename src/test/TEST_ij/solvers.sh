@@ -134,6 +134,58 @@ FILES="\
  ${TNAME}.out.211\
  ${TNAME}.out.212\
  ${TNAME}.out.213\
+ ${TNAME}.out.214\
+ ${TNAME}.out.215\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -3 $i
+done >> ${TNAME}.out
+
+FILES="\
+ ${TNAME}.out.216\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep "Iterations\|Final Relative" $i
+  echo ""
+done >> ${TNAME}.out
+
+FILES="\
+ ${TNAME}.out.300\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -7 $i
+done >> ${TNAME}.out
+
+FILES="\
+ ${TNAME}.out.301\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -11 $i | head -7
+done >> ${TNAME}.out
+
+FILES="\
+ ${TNAME}.out.400\
+ ${TNAME}.out.401\
+ ${TNAME}.out.500\
+ ${TNAME}.out.501\
+ ${TNAME}.out.502\
+ ${TNAME}.out.503\
+ ${TNAME}.out.504\
+ ${TNAME}.out.505\
+ ${TNAME}.out.506\
+ ${TNAME}.out.507\
 "
 
 for i in $FILES
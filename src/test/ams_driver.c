@@ -36,6 +36,117 @@ void CheckIfFileExists(char *file)
    fclose(test);
 }
 
+/* Number of the files <file>.00000, <file>.00001, ... of an IJ matrix or
+   vector, i.e. the number of processors it was written for */
+HYPRE_Int AMSDriverNumParts(const char *file)
+{
+   FILE *test;
+   char file0[100];
+   HYPRE_Int nparts = 0;
+   while (1)
+   {
+      sprintf(file0,"%s.%05d",file,nparts);
+      if (!(test = fopen(file0,"r")))
+         break;
+      fclose(test);
+      nparts++;
+   }
+   return nparts;
+}
+
+/* Read the IJ matrix or vector (if ij_A is NULL) written for nparts
+   processors on a number of processors that divides nparts. Each processor
+   reads nparts/num_procs consecutive parts. As in HYPRE_IJMatrixRead, the
+   entries outside the rows of their part are added, after all parts are set. */
+void AMSDriverIJReadParts(const char *file, HYPRE_Int nparts,
+                          HYPRE_IJMatrix *ij_A, HYPRE_IJVector *ij_x)
+{
+   FILE *fp;
+   char file0[100];
+   HYPRE_Int num_procs, myid, nloc, part, pass, ret, ncols = 1;
+   HYPRE_Int ilower = 0, iupper = -1, jlower = 0, jupper = -1;
+   HYPRE_Int il, iu, jl = 0, ju = -1, I, J = 0;
+   HYPRE_Real value;
+
+   hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs);
+   hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &myid);
+   nloc = nparts / num_procs;
+
+   /* the local range goes from the first to the last local part */
+   for (part = myid*nloc; part < (myid+1)*nloc; part++)
+   {
+      sprintf(file0,"%s.%05d",file,part);
+      fp = fopen(file0,"r");
+      if (ij_A)
+         hypre_fscanf(fp, "%d %d %d %d", &il, &iu, &jl, &ju);
+      else
+         hypre_fscanf(fp, "%d %d", &il, &iu);
+      fclose(fp);
+      if (part == myid*nloc)
+      {
+         ilower = il;
+         jlower = jl;
+      }
+      iupper = iu;
+      jupper = ju;
+   }
+
+   if (ij_A)
+   {
+      HYPRE_IJMatrixCreate(hypre_MPI_COMM_WORLD, ilower, iupper, jlower, jupper, ij_A);
+      HYPRE_IJMatrixSetObjectType(*ij_A, HYPRE_PARCSR);
+      HYPRE_IJMatrixInitialize(*ij_A);
+   }
+   else
+   {
+      HYPRE_IJVectorCreate(hypre_MPI_COMM_WORLD, ilower, iupper, ij_x);
+      HYPRE_IJVectorSetObjectType(*ij_x, HYPRE_PARCSR);
+      HYPRE_IJVectorInitialize(*ij_x);
+   }
+
+   for (pass = 0; pass < 2; pass++)
+   {
+      for (part = myid*nloc; part < (myid+1)*nloc; part++)
+      {
+         sprintf(file0,"%s.%05d",file,part);
+         fp = fopen(file0,"r");
+         if (ij_A)
+            hypre_fscanf(fp, "%d %d %d %d", &il, &iu, &jl, &ju);
+         else
+            hypre_fscanf(fp, "%d %d", &il, &iu);
+         while (1)
+         {
+            if (ij_A)
+               ret = (hypre_fscanf(fp, "%d %d%*[ \t]%le", &I, &J, &value) == 3);
+            else
+               ret = (hypre_fscanf(fp, "%d%*[ \t]%le", &I, &value) == 2);
+            if (!ret)
+               break;
+            if (pass == 0 && I >= il && I <= iu)
+            {
+               if (ij_A)
+                  HYPRE_IJMatrixSetValues(*ij_A, 1, &ncols, &I, &J, &value);
+               else
+                  HYPRE_IJVectorSetValues(*ij_x, 1, &I, &value);
+            }
+            else if (pass == 1 && (I < il || I > iu))
+            {
+               if (ij_A)
+                  HYPRE_IJMatrixAddToValues(*ij_A, 1, &ncols, &I, &J, &value);
+               else
+                  HYPRE_IJVectorAddToValues(*ij_x, 1, &I, &value);
+            }
+         }
+         fclose(fp);
+      }
+   }
+
+   if (ij_A)
+      HYPRE_IJMatrixAssemble(*ij_A);
+   else
+      HYPRE_IJVectorAssemble(*ij_x);
+}
+
 void AMSDriverMatrixRead(const char *file, HYPRE_ParCSRMatrix *A)
 {
    FILE *test;
@@ -54,7 +165,13 @@ void AMSDriverMatrixRead(const char *file, HYPRE_ParCSRMatrix *A)
       {
          HYPRE_IJMatrix ij_A;
          void *object;
-         HYPRE_IJMatrixRead(file, hypre_MPI_COMM_WORLD, HYPRE_PARCSR, &ij_A);
+         HYPRE_Int num_procs, nparts = AMSDriverNumParts(file);
+         hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs);
+         /* data written for more processors */
+         if (nparts > num_procs && nparts % num_procs == 0)
+            AMSDriverIJReadParts(file, nparts, &ij_A, NULL);
+         else
+            HYPRE_IJMatrixRead(file, hypre_MPI_COMM_WORLD, HYPRE_PARCSR, &ij_A);
          HYPRE_IJMatrixGetObject(ij_A, &object);
          *A = (HYPRE_ParCSRMatrix) object;
          hypre_IJMatrixObject((hypre_IJMatrix *)ij_A) = NULL;
@@ -86,7 +203,13 @@ void AMSDriverVectorRead(const char *file, HYPRE_ParVector *x)
       {
          HYPRE_IJVector ij_x;
          void *object;
-         HYPRE_IJVectorRead(file, hypre_MPI_COMM_WORLD, HYPRE_PARCSR, &ij_x);
+         HYPRE_Int num_procs, nparts = AMSDriverNumParts(file);
+         hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs);
+         /* data written for more processors */
+         if (nparts > num_procs && nparts % num_procs == 0)
+            AMSDriverIJReadParts(file, nparts, NULL, &ij_x);
+         else
+            HYPRE_IJVectorRead(file, hypre_MPI_COMM_WORLD, HYPRE_PARCSR, &ij_x);
          HYPRE_IJVectorGetObject(ij_x, &object);
          *x = (HYPRE_ParVector) object;
          hypre_IJVectorObject((hypre_IJVector *)ij_x) = NULL;
@@ -100,6 +223,21 @@ void AMSDriverVectorRead(const char *file, HYPRE_ParVector *x)
    fclose(test);
 }
 
+/* Multiply the diagonal entries of A by s (this keeps the sparsity pattern) */
+void AMSDriverScaleDiagonal(HYPRE_ParCSRMatrix A, HYPRE_Real s)
+{
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag((hypre_ParCSRMatrix *) A);
+   HYPRE_Int *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int *A_diag_j = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int i, j;
+
+   for (i = 0; i < hypre_CSRMatrixNumRows(A_diag); i++)
+      for (j = A_diag_i[i]; j < A_diag_i[i+1]; j++)
+         if (A_diag_j[j] == i)
+            A_diag_data[j] *= s;
+}
+
 hypre_int main (hypre_int argc, char *argv[])
 {
    HYPRE_Int num_procs, myid;
@@ -109,11 +247,16 @@ hypre_int main (hypre_int argc, char *argv[])
    HYPRE_Int maxit, cycle_type, rlx_type, rlx_sweeps, dim;
    HYPRE_Real rlx_weight, rlx_omega;
    HYPRE_Int amg_coarsen_type, amg_rlx_type, amg_agg_levels, amg_interp_type, amg_Pmax;
+   HYPRE_Int amg_crlx_type;
    HYPRE_Int h1_method, singular_problem, coordinates;
    HYPRE_Real tol, theta;
    HYPRE_Real rtol;
    HYPRE_Int rr;
    HYPRE_Int zero_cond;
+   HYPRE_Int num_refresh;
+   HYPRE_Real diag_scale;
+   HYPRE_Int concurrent, num_threads, provided;
+   HYPRE_Int block_pi;
    HYPRE_Int blockSize;
    HYPRE_Solver solver, precond;
 
@@ -124,8 +267,9 @@ hypre_int main (hypre_int argc, char *argv[])
 
    HYPRE_ParVector interior_nodes;
 
-   /* Initialize MPI */
-   hypre_MPI_Init(&argc, &argv);
+   /* Initialize MPI (the concurrent AMS subspace solves of several MPI tasks
+      communicate from more than one thread) */
+   hypre_MPI_Init_thread(&argc, &argv, hypre_MPI_THREAD_MULTIPLE, &provided);
    hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs);
    hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &myid);
 
@@ -147,6 +291,7 @@ hypre_int main (hypre_int argc, char *argv[])
    /* cycle_type = 1; amg_coarsen_type = 8; amg_agg_levels = 1; amg_rlx_type = 3;  */ /* PMIS-1 */
    /* cycle_type = 1; amg_coarsen_type = 8; amg_agg_levels = 0; amg_rlx_type = 3;  */ /* PMIS-0 */
    /* cycle_type = 7; amg_coarsen_type = 6; amg_agg_levels = 0; amg_rlx_type = 6;  */ /* Falgout-0 */
+   amg_crlx_type = 8;
    amg_interp_type = 6; amg_Pmax = 4;     /* long-range interpolation */
    /* amg_interp_type = 0; amg_Pmax = 0; */  /* standard interpolation */
    theta = 0.25;
@@ -154,6 +299,11 @@ hypre_int main (hypre_int argc, char *argv[])
    rtol = 0;
    rr = 0;
    zero_cond = 0;
+   num_refresh = 0;
+   diag_scale = 1.0;
+   concurrent = 0;
+   num_threads = 0;
+   block_pi = 0;
 
    /* Parse command line */
    {
@@ -212,6 +362,11 @@ hypre_int main (hypre_int argc, char *argv[])
             arg_index++;
             amg_rlx_type = atoi(argv[arg_index++]);
          }
+         else if ( strcmp(argv[arg_index], "-amgcrlx") == 0 )
+         {
+            arg_index++;
+            amg_crlx_type = atoi(argv[arg_index++]);
+         }
          else if ( strcmp(argv[arg_index], "-agg") == 0 )
          {
             arg_index++;
@@ -272,6 +427,31 @@ hypre_int main (hypre_int argc, char *argv[])
             arg_index++;
             zero_cond = 1;
          }
+         else if ( strcmp(argv[arg_index], "-refresh") == 0 )
+         {
+            arg_index++;
+            num_refresh = atoi(argv[arg_index++]);
+         }
+         else if ( strcmp(argv[arg_index], "-diagscale") == 0 )
+         {
+            arg_index++;
+            diag_scale = atof(argv[arg_index++]);
+         }
+         else if ( strcmp(argv[arg_index], "-concurrent") == 0 )
+         {
+            arg_index++;
+            concurrent = 1;
+         }
+         else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+         {
+            arg_index++;
+            num_threads = atoi(argv[arg_index++]);
+         }
+         else if ( strcmp(argv[arg_index], "-blockpi") == 0 )
+         {
+            arg_index++;
+            block_pi = 1;
+         }
          else if ( strcmp(argv[arg_index], "-help") == 0 )
          {
             print_usage = 1;
@@ -309,6 +489,7 @@ hypre_int main (hypre_int argc, char *argv[])
          hypre_printf("    -ctype <num>         : BoomerAMG coarsening type           \n");
          hypre_printf("    -agg <num>           : Levels of BoomerAMG agg. coarsening \n");
          hypre_printf("    -amgrlx <num>        : BoomerAMG relaxation type           \n");
+         hypre_printf("    -amgcrlx <num>       : BoomerAMG coarsest relaxation type  \n");
          hypre_printf("    -itype <num>         : BoomerAMG interpolation type        \n");
          hypre_printf("    -pmax <num>          : BoomerAMG interpolation truncation  \n");
          hypre_printf("    -rlx <num>           : relaxation type                     \n");
@@ -318,6 +499,14 @@ hypre_int main (hypre_int argc, char *argv[])
          hypre_printf("    -coord               : use coordinate vectors              \n");
          hypre_printf("    -h1                  : use block-diag Poisson solves       \n");
          hypre_printf("    -sing                : curl-curl only (singular) problem   \n");
+         hypre_printf("    -refresh <num>       : repeat AMS-PCG setup and solve <num> \n");
+         hypre_printf("                           times with a numeric refresh, after \n");
+         hypre_printf("                           doubling the diagonal of A          \n");
+         hypre_printf("    -diagscale <num>     : multiply the diagonal of A by <num> \n");
+         hypre_printf("    -concurrent          : concurrent additive subspace solves \n");
+         hypre_printf("                           (OpenMP thread teams)               \n");
+         hypre_printf("    -nthreads <num>      : number of OpenMP threads            \n");
+         hypre_printf("    -blockpi             : block storage in the B_Pi AMG       \n");
          hypre_printf("\n");
          hypre_printf("  AME eigensolver options:                                     \n");
          hypre_printf("    -bsize<num>          : number of eigenvalues to compute    \n");
@@ -331,7 +520,14 @@ hypre_int main (hypre_int argc, char *argv[])
       }
    }
 
+#ifdef HYPRE_USING_OPENMP
+   if (num_threads > 0)
+      omp_set_num_threads(num_threads);
+#endif
+
    AMSDriverMatrixRead("mfem.A", &A);
+   if (diag_scale != 1.0)
+      AMSDriverScaleDiagonal(A, diag_scale);
    AMSDriverVectorRead("mfem.x0", &x0);
    AMSDriverVectorRead("mfem.b", &b);
    AMSDriverMatrixRead("mfem.G", &G);
@@ -447,6 +643,8 @@ hypre_int main (hypre_int argc, char *argv[])
       HYPRE_AMSSetTol(solver, tol);
       HYPRE_AMSSetCycleType(solver, cycle_type);
       HYPRE_AMSSetPrintLevel(solver, 1);
+      HYPRE_AMSSetConcurrentSubspaces(solver, concurrent);
+      HYPRE_AMSSetAlphaAMGBlockMode(solver, block_pi);
       HYPRE_AMSSetDiscreteGradient(solver, G);
 
       /* Vectors Gx, Gy and Gz */
@@ -471,6 +669,8 @@ hypre_int main (hypre_int argc, char *argv[])
       HYPRE_AMSSetSmoothingOptions(solver, rlx_type, rlx_sweeps, rlx_weight, rlx_omega);
       HYPRE_AMSSetAlphaAMGOptions(solver, amg_coarsen_type, amg_agg_levels, amg_rlx_type, theta, amg_interp_type, amg_Pmax);
       HYPRE_AMSSetBetaAMGOptions(solver, amg_coarsen_type, amg_agg_levels, amg_rlx_type, theta, amg_interp_type, amg_Pmax);
+      HYPRE_AMSSetAlphaAMGCoarseRelaxType(solver, amg_crlx_type);
+      HYPRE_AMSSetBetaAMGCoarseRelaxType(solver, amg_crlx_type);
 
       HYPRE_AMSSetup(solver, A, b, x0);
 
@@ -584,6 +784,13 @@ hypre_int main (hypre_int argc, char *argv[])
          HYPRE_AMSSetSmoothingOptions(precond, rlx_type, rlx_sweeps, rlx_weight, rlx_omega);
          HYPRE_AMSSetAlphaAMGOptions(precond, amg_coarsen_type, amg_agg_levels, amg_rlx_type, theta, amg_interp_type, amg_Pmax);
          HYPRE_AMSSetBetaAMGOptions(precond, amg_coarsen_type, amg_agg_levels, amg_rlx_type, theta, amg_interp_type, amg_Pmax);
+         HYPRE_AMSSetAlphaAMGCoarseRelaxType(precond, amg_crlx_type);
+         HYPRE_AMSSetBetaAMGCoarseRelaxType(precond, amg_crlx_type);
+
+         if (num_refresh)
+            HYPRE_AMSSetNumericRefresh(precond, 1);
+         HYPRE_AMSSetConcurrentSubspaces(precond, concurrent);
+         HYPRE_AMSSetAlphaAMGBlockMode(precond, block_pi);
 
          /* Set the PCG preconditioner */
          HYPRE_PCGSetPrecond(solver,
@@ -639,6 +846,51 @@ hypre_int main (hypre_int argc, char *argv[])
          hypre_printf("\n");
       }
 
+      /* Repeated setup and solve, as in a time stepping loop where only the
+         matrix values change.  The diagonal of A is doubled before each
+         refresh (exactly, so that the result can be compared with a fresh
+         setup for A read with -diagscale 2^i). */
+      if (solver_id == 3)
+      {
+         HYPRE_Int i;
+
+         for (i = 0; i < num_refresh; i++)
+         {
+            AMSDriverScaleDiagonal(A, 2.0);
+            HYPRE_ParVectorSetConstantValues(x0, 0.0);
+
+            time_index = hypre_InitializeTiming("AMS-PCG Refresh Setup");
+            hypre_BeginTiming(time_index);
+
+            HYPRE_ParCSRPCGSetup(solver, A, b, x0);
+
+            hypre_EndTiming(time_index);
+            hypre_PrintTiming("Refresh setup phase times", hypre_MPI_COMM_WORLD);
+            hypre_FinalizeTiming(time_index);
+            hypre_ClearTiming();
+
+            time_index = hypre_InitializeTiming("AMS-PCG Refresh Solve");
+            hypre_BeginTiming(time_index);
+
+            HYPRE_ParCSRPCGSolve(solver, A, b, x0);
+
+            hypre_EndTiming(time_index);
+            hypre_PrintTiming("Refresh solve phase times", hypre_MPI_COMM_WORLD);
+            hypre_FinalizeTiming(time_index);
+            hypre_ClearTiming();
+
+            HYPRE_PCGGetNumIterations(solver, &num_iterations);
+            HYPRE_PCGGetFinalRelativeResidualNorm(solver, &final_res_norm);
+            if (myid == 0)
+            {
+               hypre_printf("\n");
+               hypre_printf("Iterations = %d\n", num_iterations);
+               hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+               hypre_printf("\n");
+            }
+         }
+      }
+
       /* Destroy solver and preconditioner */
       HYPRE_ParCSRPCGDestroy(solver);
       if (solver_id == 1)
@@ -688,6 +940,8 @@ hypre_int main (hypre_int argc, char *argv[])
       HYPRE_AMSSetSmoothingOptions(precond, rlx_type, rlx_sweeps, rlx_weight, rlx_omega);
       HYPRE_AMSSetAlphaAMGOptions(precond, amg_coarsen_type, amg_agg_levels, amg_rlx_type, theta, amg_interp_type, amg_Pmax);
       HYPRE_AMSSetBetaAMGOptions(precond, amg_coarsen_type, amg_agg_levels, amg_rlx_type, theta, amg_interp_type, amg_Pmax);
+      HYPRE_AMSSetAlphaAMGCoarseRelaxType(precond, amg_crlx_type);
+      HYPRE_AMSSetBetaAMGCoarseRelaxType(precond, amg_crlx_type);
 
       /* Create AME object */
       HYPRE_AMECreate(&solver);
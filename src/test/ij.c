@@ -82,6 +82,8 @@ HYPRE_ParCSRMatrix GenerateSysLaplacianVCoef (MPI_Comm comm, HYPRE_Int nx, HYPRE
 HYPRE_Int SetSysVcoefValues(HYPRE_Int num_fun, HYPRE_Int nx, HYPRE_Int ny, HYPRE_Int nz, HYPRE_Real vcx, HYPRE_Real vcy, HYPRE_Real vcz, HYPRE_Int mtx_entry, HYPRE_Real *values);
 
 HYPRE_Int BuildParCoordinates (HYPRE_Int argc , char *argv [], HYPRE_Int arg_index , HYPRE_Int *coorddim_ptr , float **coord_ptr );
+HYPRE_Int BuildParStructCoordinates (HYPRE_Int argc , char *argv [], HYPRE_Int arg_index , HYPRE_Int *ndim_ptr , HYPRE_Int **index_ptr );
+HYPRE_Int SolveMultiRhs (HYPRE_Solver solver , HYPRE_PtrToSolverFcn solve , HYPRE_PtrToSolverFcn solve_multi , HYPRE_Int (*get_num_iterations)(HYPRE_Solver, HYPRE_Int*) , HYPRE_Int (*get_res_norm)(HYPRE_Solver, HYPRE_Real*) , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_Int nrhs );
                                                                                 
 extern HYPRE_Int hypre_FlexGMRESModifyPCAMGExample(void *precond_data, HYPRE_Int iterations, 
                                                    HYPRE_Real rel_residual_norm);
@@ -255,6 +257,10 @@ main( hypre_int argc,
    HYPRE_Int      coord_dim  = 3;
    float    *coordinates = NULL;
    char    plot_file_name[256];
+   /* structured grid indices for geometric coarsening */
+   HYPRE_Int      struct_coords = 0;
+   HYPRE_Int      struct_ndim = 0;
+   HYPRE_Int     *struct_index = NULL;
    
    /* parameters for ParaSAILS */
    HYPRE_Real   sai_threshold = 0.1;
@@ -272,6 +278,8 @@ main( hypre_int argc,
    HYPRE_Int	    eu_stats = 0;
    HYPRE_Int	    eu_mem = 0;
    HYPRE_Int	    eu_row_scale = 0; /* Euclid only */
+   HYPRE_Int	    eu_factor_sweeps = 0; /* Euclid only */
+   HYPRE_Int	    eu_tri_sweeps = 0; /* Euclid only */
 
    /* parameters for GMRES */
    HYPRE_Int	    k_dim;
@@ -292,6 +300,10 @@ main( hypre_int argc,
    HYPRE_Real   agg_P12_trunc_factor  = 0; /* default value */
 
    HYPRE_Int      print_system = 0;
+   HYPRE_Int      profile = 0;
+   HYPRE_Int      comm_stats = 0;
+   HYPRE_Int      nrhs = 1;
+   char          *profile_file = NULL;
 
    HYPRE_Int rel_change = 0;
    /* begin lobpcg */
@@ -360,6 +372,8 @@ main( hypre_int argc,
    HYPRE_Int mgr_num_gsmooth_sweeps = 1;
    HYPRE_Int mgr_restrict_type = 0;
    HYPRE_Int mgr_num_restrict_sweeps = 0;   
+   HYPRE_Int mgr_num_refresh = 0;
+   HYPRE_Int mgr_coarse_refresh_freq = 1;
    /* end mgr options */
 
    HYPRE_Real     *nongalerk_tol = NULL;
@@ -999,6 +1013,16 @@ main( hypre_int argc,
          arg_index++;        
          mgr_num_restrict_sweeps = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-mgr_refresh") == 0 )
+      {                /* number of repeated setups with numeric refresh */
+         arg_index++;        
+         mgr_num_refresh = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mgr_coarse_refresh_freq") == 0 )
+      {                /* coarse grid solver setup frequency for refresh */
+         arg_index++;        
+         mgr_coarse_refresh_freq = atoi(argv[arg_index++]);
+      }
       /* end mgr options */
       else
       {
@@ -1212,6 +1236,16 @@ main( hypre_int argc,
          arg_index++;
          eu_level  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-factorSweeps") == 0 )
+      {
+         arg_index++;
+         eu_factor_sweeps  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-triSweeps") == 0 )
+      {
+         arg_index++;
+         eu_tri_sweeps  = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-bj") == 0 )
       {
          arg_index++;
@@ -1460,6 +1494,27 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-profile") == 0 )
+      {
+         arg_index++;
+         profile = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-comm_stats") == 0 )
+      {
+         arg_index++;
+         comm_stats = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-nrhs") == 0 )
+      {
+         arg_index++;
+         nrhs = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-profile_file") == 0 )
+      {
+         arg_index++;
+         profile = 1;
+         profile_file = argv[arg_index++];
+      }
       /* BM Oct 23, 2006 */
       else if ( strcmp(argv[arg_index], "-plot_grids") == 0 )
       {
@@ -1471,6 +1526,11 @@ main( hypre_int argc,
          arg_index++;
 	 hypre_sprintf (plot_file_name,"%s",argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-struct_coords") == 0 )
+      {
+         arg_index++;
+         struct_coords = 1;
+      }
       else if ( strcmp(argv[arg_index], "-AIR") == 0 )
       {
          arg_index++;
@@ -1736,6 +1796,8 @@ main( hypre_int argc,
          hypre_printf("                           Note ILUT is sequential only!\n");
          hypre_printf("  -sparseA <val>         : set drop tolerance in ILU(k) for Euclid \n");
          hypre_printf("  -rowScale <val>        : enable row scaling in Euclid \n");
+         hypre_printf("  -factorSweeps <val>    : fixed-point sweeps for ILU(k) in Euclid\n");
+         hypre_printf("  -triSweeps <val>       : Jacobi sweeps for triangular solves in Euclid\n");
          hypre_printf("\n");  
          hypre_printf("  -drop_tol  <val>       : set threshold for dropping in PILUT\n");
          hypre_printf("  -nonzeros_to_keep <val>: number of nonzeros in each row to keep\n");
@@ -1748,6 +1810,13 @@ main( hypre_int argc,
          hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
+         hypre_printf("  -profile               : print a profile of the solve phases\n");
+         hypre_printf("  -profile_file <name>   : also write a trace per rank to <name>.NNNNN.json,\n");
+         hypre_printf("                           where NNNNN is the rank with 5 digits\n");
+         hypre_printf("  -comm_stats            : print BoomerAMG communication statistics\n");
+         hypre_printf("                           after the setup and the solve (solvers 0, 1)\n");
+         hypre_printf("  -nrhs <k>              : also solve for k rhs at once and compare with\n");
+         hypre_printf("                           k single solves (BoomerAMG and PCG solvers)\n");
          hypre_printf("\n");
          /* begin lobpcg */
 
@@ -1814,6 +1883,8 @@ main( hypre_int argc,
 
          hypre_printf("  -plot_grids            : print out information for plotting the grids\n");
          hypre_printf("  -plot_file_name <val>  : file name for plotting output\n");
+         hypre_printf("  -struct_coords         : pass the grid indices of the generated\n");
+         hypre_printf("                           problems to AMG for structured coarsening\n");
          hypre_printf("\n");
          hypre_printf("  -smtype <val>      :smooth type\n");
          hypre_printf("  -smlv <val>        :smooth num levels\n");
@@ -1840,6 +1911,13 @@ main( hypre_int argc,
          hypre_printf("                                     for F-relaxation \n");      
          hypre_printf("  -mgr_frelax_method   1           : Use a 'multi-level smoother' strategy \n");  
          hypre_printf("                                     for F-relaxation \n");      
+         hypre_printf("  -mgr_frelax_method   2           : Use sweeps on the extracted A_ff \n");
+         hypre_printf("                                     for F-relaxation \n");
+         hypre_printf("  -mgr_refresh   <val>             : repeat MGR setup and solve <val> times \n");
+         hypre_printf("                                     with a numeric refresh of the setup, \n");
+         hypre_printf("                                     scaling the diagonal of A by 1.1 first \n");
+         hypre_printf("  -mgr_coarse_refresh_freq <val>   : set up the coarse solver again every \n");
+         hypre_printf("                                     <val>-th refresh \n");
          /* end MGR options */
       }
 
@@ -1931,6 +2009,16 @@ main( hypre_int argc,
          hypre_printf("Warning: coordinates are not yet printed for build_matrix_type = %d.\n", build_matrix_type);
       }
    }
+   if (struct_coords)
+   {
+      if (build_matrix_type > 1 &&  build_matrix_type < 8)
+         BuildParStructCoordinates (argc, argv, build_matrix_arg_index,
+                                    &struct_ndim, &struct_index);
+      else
+      {
+         hypre_printf("Warning: grid indices are not available for build_matrix_type = %d.\n", build_matrix_type);
+      }
+   }
 
    if (build_matrix_type < 0)
    {
@@ -2745,6 +2833,11 @@ main( hypre_int argc,
       /* HYPRE_ParCSRMatrixPrint( parcsr_A, "new_mat.A" );*/
    }
 
+   if (profile)
+   {
+      HYPRE_ProfilingStart();
+   }
+
    /*-----------------------------------------------------------
     * Solve the system using the hybrid solver
     *-----------------------------------------------------------*/
@@ -2946,6 +3039,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetMaxIter(amg_solver, mg_max_iter);
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetCommStats(amg_solver, comm_stats);
 #ifdef HAVE_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -2971,6 +3065,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetCoordDim (amg_solver, coord_dim);
          HYPRE_BoomerAMGSetCoordinates (amg_solver, coordinates);
       }
+      if (struct_index)
+      {
+         HYPRE_BoomerAMGSetStructCoordinates (amg_solver, struct_ndim, NULL, struct_index);
+      }
 
       HYPRE_BoomerAMGSetup(amg_solver, parcsr_A, b, x);
 
@@ -2992,6 +3090,11 @@ main( hypre_int argc,
       HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
       HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
 
+      if (comm_stats)
+      {
+         HYPRE_BoomerAMGPrintCommStats(amg_solver);
+      }
+
       if (myid == 0)
       {
          hypre_printf("\n");
@@ -3000,6 +3103,15 @@ main( hypre_int argc,
          hypre_printf("\n");
       }
 
+      if (nrhs > 1)
+      {
+         SolveMultiRhs(amg_solver, (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSolve,
+                       (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSolve,
+                       HYPRE_BoomerAMGGetNumIterations,
+                       HYPRE_BoomerAMGGetFinalRelativeResidualNorm,
+                       parcsr_A, b, nrhs);
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       HYPRE_ParVectorSetRandomValues(x, 775);
@@ -3274,6 +3386,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetCommStats(pcg_precond, comm_stats);
 #ifdef HAVE_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -3290,6 +3403,10 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetInterpVecQMax(pcg_precond, Q_max);
             HYPRE_BoomerAMGSetInterpVecAbsQTrunc(pcg_precond, Q_trunc);
          }
+         if (struct_index)
+         {
+            HYPRE_BoomerAMGSetStructCoordinates(pcg_precond, struct_ndim, NULL, struct_index);
+         }
          HYPRE_PCGSetMaxIter(pcg_solver, mg_max_iter);
          HYPRE_PCGSetPrecond(pcg_solver,
                              (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSolve,
@@ -3466,6 +3583,8 @@ main( hypre_int argc,
          if (eu_sparse_A) HYPRE_EuclidSetSparseA(pcg_precond, eu_sparse_A);
          if (eu_row_scale) HYPRE_EuclidSetRowScale(pcg_precond, eu_row_scale);
          if (eu_bj) HYPRE_EuclidSetBJ(pcg_precond, eu_bj);
+         if (eu_factor_sweeps) HYPRE_EuclidSetFactorSweeps(pcg_precond, eu_factor_sweeps);
+         if (eu_tri_sweeps) HYPRE_EuclidSetTriSolveSweeps(pcg_precond, eu_tri_sweeps);
          HYPRE_EuclidSetStats(pcg_precond, eu_stats);
          HYPRE_EuclidSetMem(pcg_precond, eu_mem);
 
@@ -3592,6 +3711,20 @@ main( hypre_int argc,
       HYPRE_PCGGetNumIterations(pcg_solver, &num_iterations);
       HYPRE_PCGGetFinalRelativeResidualNorm(pcg_solver, &final_res_norm);
 
+      if (comm_stats && solver_id == 1)
+      {
+         HYPRE_BoomerAMGPrintCommStats(pcg_precond);
+      }
+
+      if (nrhs > 1)
+      {
+         SolveMultiRhs(pcg_solver, (HYPRE_PtrToSolverFcn) HYPRE_PCGSolve,
+                       (HYPRE_PtrToSolverFcn) HYPRE_ParCSRPCGSolveMulti,
+                       HYPRE_PCGGetNumIterations,
+                       HYPRE_PCGGetFinalRelativeResidualNorm,
+                       parcsr_A, b, nrhs);
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       HYPRE_ParVectorSetRandomValues(x, 775);
@@ -4849,6 +4982,8 @@ main( hypre_int argc,
          if (eu_sparse_A) HYPRE_EuclidSetSparseA(pcg_precond, eu_sparse_A);
          if (eu_row_scale) HYPRE_EuclidSetRowScale(pcg_precond, eu_row_scale);
          if (eu_bj) HYPRE_EuclidSetBJ(pcg_precond, eu_bj);
+         if (eu_factor_sweeps) HYPRE_EuclidSetFactorSweeps(pcg_precond, eu_factor_sweeps);
+         if (eu_tri_sweeps) HYPRE_EuclidSetTriSolveSweeps(pcg_precond, eu_tri_sweeps);
          HYPRE_EuclidSetStats(pcg_precond, eu_stats);
          HYPRE_EuclidSetMem(pcg_precond, eu_mem);
          /*HYPRE_EuclidSetParams(pcg_precond, argc, argv);*/
@@ -5577,6 +5712,8 @@ main( hypre_int argc,
          if (eu_sparse_A) HYPRE_EuclidSetSparseA(pcg_precond, eu_sparse_A);
          if (eu_row_scale) HYPRE_EuclidSetRowScale(pcg_precond, eu_row_scale);
          if (eu_bj) HYPRE_EuclidSetBJ(pcg_precond, eu_bj);
+         if (eu_factor_sweeps) HYPRE_EuclidSetFactorSweeps(pcg_precond, eu_factor_sweeps);
+         if (eu_tri_sweeps) HYPRE_EuclidSetTriSolveSweeps(pcg_precond, eu_tri_sweeps);
          HYPRE_EuclidSetStats(pcg_precond, eu_stats);
          HYPRE_EuclidSetMem(pcg_precond, eu_mem);
 
@@ -5977,6 +6114,12 @@ main( hypre_int argc,
 
       HYPRE_MGRSetGlobalsmoothType(mgr_solver, mgr_gsmooth_type);
       HYPRE_MGRSetMaxGlobalsmoothIters( mgr_solver, mgr_num_gsmooth_sweeps );
+      /* set numeric refresh for repeated setups */
+      if (mgr_num_refresh > 0)
+      {
+         HYPRE_MGRSetNumericRefresh(mgr_solver, 1);
+         HYPRE_MGRSetCoarseGridRefreshFrequency(mgr_solver, mgr_coarse_refresh_freq);
+      }
       
       /* create AMG coarse grid solver */
       
@@ -6045,6 +6188,44 @@ main( hypre_int argc,
          hypre_printf("\n");
       }
 
+      /* repeat setup and solve from a zero initial guess, refreshing the
+         values of the previous setup; the diagonal of A is scaled before
+         each refresh, so that the values change but the pattern does not */
+      for (i = 0; i < mgr_num_refresh; i++)
+      {
+         hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag((hypre_ParCSRMatrix *) parcsr_A);
+         HYPRE_Int       *A_diag_i = hypre_CSRMatrixI(A_diag);
+         HYPRE_Real      *A_diag_data = hypre_CSRMatrixData(A_diag);
+
+         for (j = 0; j < hypre_CSRMatrixNumRows(A_diag); j++)
+         {
+            A_diag_data[A_diag_i[j]] *= 1.1;
+         }
+
+         time_index = hypre_InitializeTiming("MGR Refresh Setup");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_ParVectorSetConstantValues(x, 0.0);
+         HYPRE_MGRSetup(mgr_solver, parcsr_A, b, x);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Refresh setup phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         HYPRE_MGRSolve(mgr_solver, parcsr_A, b, x);
+         HYPRE_MGRGetNumIterations(mgr_solver, &num_iterations);
+         HYPRE_MGRGetFinalRelativeResidualNorm(mgr_solver, &final_res_norm);
+
+         if (myid == 0)
+         {
+            hypre_printf("\n");
+            hypre_printf("MGR Iterations (refresh %d) = %d\n", i+1, num_iterations);
+            hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+            hypre_printf("\n");
+         }
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       HYPRE_ParVectorSetRandomValues(x, 775);
@@ -6089,6 +6270,16 @@ main( hypre_int argc,
       HYPRE_IJVectorPrint(ij_x, "IJ.out.x");
    }
 
+   if (profile)
+   {
+      HYPRE_ProfilingStop();
+      HYPRE_ProfilingPrint(hypre_MPI_COMM_WORLD);
+      if (profile_file)
+      {
+         HYPRE_ProfilingWrite(hypre_MPI_COMM_WORLD, profile_file);
+      }
+   }
+
    /*-----------------------------------------------------------
     * Finalize things
     *-----------------------------------------------------------*/
@@ -6112,6 +6303,7 @@ main( hypre_int argc,
       hypre_TFree(interp_vecs, HYPRE_MEMORY_HOST);
    }
    if (nongalerk_tol) hypre_TFree(nongalerk_tol, HYPRE_MEMORY_HOST);
+   if (struct_index) hypre_TFree(struct_index, HYPRE_MEMORY_HOST);
 
 /*
   hypre_FinalizeMemoryDebug();
@@ -7923,6 +8115,81 @@ BuildParCoordinates( HYPRE_Int                  argc,
    return (0);
 }
 
+/*----------------------------------------------------------------------
+ * Build structured grid indices for 1D/2D/3D
+ *----------------------------------------------------------------------*/
+
+HYPRE_Int
+BuildParStructCoordinates( HYPRE_Int                  argc,
+                           char                *argv[],
+                           HYPRE_Int                  arg_index,
+                           HYPRE_Int                 *ndim_ptr,
+                           HYPRE_Int                **index_ptr     )
+{
+   HYPRE_Int                 nx, ny, nz;
+   HYPRE_Int                 P, Q, R;
+
+   HYPRE_Int                 num_procs, myid;
+   HYPRE_Int                 p, q, r;
+
+   HYPRE_Int                 ndim;
+   HYPRE_Int                *index;
+
+   hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs );
+   hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &myid );
+
+   nx = 10;
+   ny = 10;
+   nz = 10;
+
+   P  = 1;
+   Q  = num_procs;
+   R  = 1;
+
+   /* same parsing as BuildParCoordinates */
+   arg_index = 0;
+   while (arg_index < argc)
+   {
+      if ( strcmp(argv[arg_index], "-n") == 0 )
+      {
+         arg_index++;
+         nx = atoi(argv[arg_index++]);
+         ny = atoi(argv[arg_index++]);
+         nz = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-P") == 0 )
+      {
+         arg_index++;
+         P  = atoi(argv[arg_index++]);
+         Q  = atoi(argv[arg_index++]);
+         R  = atoi(argv[arg_index++]);
+      }
+      else
+      {
+         arg_index++;
+      }
+   }
+
+   p = myid % P;
+   q = (( myid - p)/P) % Q;
+   r = ( myid - p - P*q)/( P*Q );
+
+   ndim = 3;
+   if (nx<2) ndim--;
+   if (ny<2) ndim--;
+   if (nz<2) ndim--;
+
+   if (ndim>0)
+      index = GenerateStructCoordinates (hypre_MPI_COMM_WORLD,
+                                         nx, ny, nz, P, Q, R, p, q, r, ndim);
+   else
+      index = NULL;
+
+   *ndim_ptr = ndim;
+   *index_ptr = index;
+   return (0);
+}
+
 
 /* begin lobpcg */
 
@@ -8044,3 +8311,96 @@ BuildParIsoLaplacian( HYPRE_Int argc, char** argv, HYPRE_ParCSRMatrix *A_ptr )
 
 /* end lobpcg */
 
+/*----------------------------------------------------------------------
+ * Solve for nrhs right-hand sides at once with an already set up solver,
+ * using solve_multi on multivectors, and compare with nrhs single solves.
+ * Column 0 of the rhs is b and the other columns are random.  The single
+ * solves and the multiple rhs solve start from a zero initial guess.
+ *----------------------------------------------------------------------*/
+
+HYPRE_Int
+SolveMultiRhs( HYPRE_Solver          solver,
+               HYPRE_PtrToSolverFcn  solve,
+               HYPRE_PtrToSolverFcn  solve_multi,
+               HYPRE_Int           (*get_num_iterations)(HYPRE_Solver, HYPRE_Int*),
+               HYPRE_Int           (*get_res_norm)(HYPRE_Solver, HYPRE_Real*),
+               HYPRE_ParCSRMatrix    A,
+               HYPRE_ParVector       b,
+               HYPRE_Int             nrhs )
+{
+   MPI_Comm         comm = hypre_ParVectorComm(b);
+   HYPRE_Int        global_size = hypre_ParVectorGlobalSize(b);
+   HYPRE_Int       *partitioning = hypre_ParVectorPartitioning(b);
+
+   hypre_ParVector *b_multi, *x_multi, *b_col, *x_col;
+
+   HYPRE_Int        myid, j;
+   HYPRE_Int        num_iterations, *single_iterations;
+   HYPRE_Real       final_res_norm;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   single_iterations = hypre_CTAlloc(HYPRE_Int, nrhs, HYPRE_MEMORY_HOST);
+
+   b_multi = hypre_ParMultiVectorCreate(comm, global_size, partitioning, nrhs);
+   hypre_ParVectorInitialize(b_multi);
+   hypre_ParVectorSetPartitioningOwner(b_multi, 0);
+   x_multi = hypre_ParMultiVectorCreate(comm, global_size, partitioning, nrhs);
+   hypre_ParVectorInitialize(x_multi);
+   hypre_ParVectorSetPartitioningOwner(x_multi, 0);
+   b_col = hypre_ParVectorCreate(comm, global_size, partitioning);
+   hypre_ParVectorInitialize(b_col);
+   hypre_ParVectorSetPartitioningOwner(b_col, 0);
+   x_col = hypre_ParVectorCreate(comm, global_size, partitioning);
+   hypre_ParVectorInitialize(x_col);
+   hypre_ParVectorSetPartitioningOwner(x_col, 0);
+
+   /* single solves */
+   for (j = 0; j < nrhs; j++)
+   {
+      if (j == 0)
+      {
+         hypre_ParVectorCopy((hypre_ParVector *) b, b_col);
+      }
+      else
+      {
+         hypre_ParVectorSetRandomValues(b_col, j);
+      }
+      hypre_ParMultiVectorSetColumn(b_multi, j, b_col);
+
+      hypre_ParVectorSetConstantValues(x_col, 0.0);
+      solve(solver, (HYPRE_Matrix) A, (HYPRE_Vector) b_col,
+            (HYPRE_Vector) x_col);
+      get_num_iterations(solver, &single_iterations[j]);
+   }
+
+   /* all right-hand sides at once */
+   hypre_ParVectorSetConstantValues(x_multi, 0.0);
+   solve_multi(solver, (HYPRE_Matrix) A, (HYPRE_Vector) b_multi,
+               (HYPRE_Vector) x_multi);
+   get_num_iterations(solver, &num_iterations);
+   get_res_norm(solver, &final_res_norm);
+
+   if (myid == 0)
+   {
+      hypre_printf("\n");
+      hypre_printf("Multiple right-hand sides:\n");
+      for (j = 0; j < nrhs; j++)
+      {
+         hypre_printf("   rhs %d single solve Iterations = %d\n",
+                      j, single_iterations[j]);
+      }
+      hypre_printf("   Multiple rhs solve Iterations = %d\n", num_iterations);
+      hypre_printf("   Final Relative Residual Norm = %e\n", final_res_norm);
+      hypre_printf("\n");
+   }
+
+   hypre_TFree(single_iterations, HYPRE_MEMORY_HOST);
+
+   hypre_ParVectorDestroy(b_multi);
+   hypre_ParVectorDestroy(x_multi);
+   hypre_ParVectorDestroy(b_col);
+   hypre_ParVectorDestroy(x_col);
+
+   return (0);
+}
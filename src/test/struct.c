@@ -107,6 +107,7 @@ main( hypre_int argc,
    HYPRE_Int           n_pre, n_post;
    HYPRE_Int           nblocks ;
    HYPRE_Int           skip;
+   HYPRE_Int           comm_stats;
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
@@ -129,6 +130,9 @@ main( hypre_int argc,
 
    HYPRE_StructGrid    grid;
    HYPRE_StructGrid    readgrid;
+   HYPRE_StructGrid    new_grid;
+   HYPRE_Int           regrid = 0;
+   HYPRE_Int           split[3];
    HYPRE_StructStencil stencil;
 
    HYPRE_Int           i, s;
@@ -145,6 +149,9 @@ main( hypre_int argc,
    HYPRE_Int           sum;
 
    HYPRE_Int           print_system = 0;
+   HYPRE_Int           matvec_reps = 0;
+   void               *matvec_data;
+   hypre_StructVector *matvec_y;
 
    /* begin lobpcg */
    
@@ -205,6 +212,7 @@ main( hypre_int argc,
    dim = 3;
 
    skip  = 0;
+   comm_stats = 0;
    sym  = 1;
    rap = 0;
    relax = 1;
@@ -395,6 +403,11 @@ main( hypre_int argc,
          arg_index++;
          skip = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-comm_stats") == 0 )
+      {
+         arg_index++;
+         comm_stats = 1;
+      }
       else if ( strcmp(argv[arg_index], "-jump") == 0 )
       {
          arg_index++;
@@ -410,11 +423,21 @@ main( hypre_int argc,
          arg_index++;
          cf_tol = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-matvec") == 0 )
+      {
+         arg_index++;
+         matvec_reps = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-print") == 0 )
       {
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-regrid") == 0 )
+      {
+         arg_index++;
+         regrid = 1;
+      }
       else if ( strcmp(argv[arg_index], "-help") == 0 )
       {
          print_usage = 1;
@@ -566,14 +589,19 @@ main( hypre_int argc,
       hypre_printf("                        1 - Weighted Jacobi (default)\n");
       hypre_printf("                        2 - R/B Gauss-Seidel\n");
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
+      hypre_printf("                        4 - Weighted Jacobi, wavefront (PFMG)\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
+      hypre_printf("  -comm_stats         : print PFMG communication statistics\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
       hypre_printf("  -jump <num>         : num levels to jump in SparseMSG\n");
       hypre_printf("  -solver_type <ID>   : solver type for Hybrid\n");
       hypre_printf("                        1 - PCG (default)\n");
       hypre_printf("                        2 - GMRES\n");
       hypre_printf("  -cf <cf>            : convergence factor for Hybrid\n");
+      hypre_printf("  -matvec <reps>      : time <reps> matvecs before solving\n");
+      hypre_printf("  -regrid             : split the first box of proc 0 and\n");
+      hypre_printf("                        reassemble the grid from the old one\n");
       hypre_printf("\n");
 
       /* begin lobpcg */
@@ -978,6 +1006,41 @@ main( hypre_int argc,
          HYPRE_StructGridSetPeriodic(grid, periodic);
          HYPRE_StructGridSetNumGhost(grid, num_ghost);
          HYPRE_StructGridAssemble(grid);
+
+         if (regrid)
+         {
+            /* split the first box of process 0 in two along x, and assemble
+               the new grid from the box manager of the old one */
+            HYPRE_StructGridCreate(hypre_MPI_COMM_WORLD, dim, &new_grid);
+            for (ib = 0; ib < nblocks; ib++)
+            {
+               if ((myid == 0) && (ib == 0) && (iupper[ib][0] > ilower[ib][0]))
+               {
+                  for (i = 0; i < dim; i++)
+                  {
+                     split[i] = iupper[ib][i];
+                  }
+                  split[0] = (ilower[ib][0] + iupper[ib][0]) / 2;
+                  HYPRE_StructGridSetExtents(new_grid, ilower[ib], split);
+                  for (i = 0; i < dim; i++)
+                  {
+                     split[i] = ilower[ib][i];
+                  }
+                  split[0] = (ilower[ib][0] + iupper[ib][0]) / 2 + 1;
+                  HYPRE_StructGridSetExtents(new_grid, split, iupper[ib]);
+               }
+               else
+               {
+                  HYPRE_StructGridSetExtents(new_grid, ilower[ib], iupper[ib]);
+               }
+            }
+            HYPRE_StructGridSetPeriodic(new_grid, periodic);
+            HYPRE_StructGridSetNumGhost(new_grid, num_ghost);
+            HYPRE_StructGridSetPrevGrid(new_grid, grid);
+            HYPRE_StructGridAssemble(new_grid);
+            HYPRE_StructGridDestroy(grid);
+            grid = new_grid;
+         }
 	 
 #if defined(HYPRE_USE_CUDA)
          HYPRE_StructGridSetDataLocation(grid, HYPRE_MEMORY_DEVICE);
@@ -1311,6 +1374,37 @@ main( hypre_int argc,
          HYPRE_StructVectorPrint("struct.out.x0", x, 0);
       }
 
+      /*-----------------------------------------------------------
+       * Time repeated matrix-vector products y = A*x
+       *-----------------------------------------------------------*/
+
+      if (matvec_reps > 0)
+      {
+         matvec_y = hypre_StructVectorClone((hypre_StructVector *) b);
+         matvec_data = hypre_StructMatvecCreate();
+         hypre_StructMatvecSetup(matvec_data, (hypre_StructMatrix *) A,
+                                 (hypre_StructVector *) x);
+
+         time_index = hypre_InitializeTiming("Struct Matvec");
+         hypre_BeginTiming(time_index);
+
+         for (i = 0; i < matvec_reps; i++)
+         {
+            hypre_StructMatvecCompute(matvec_data, 1.0,
+                                      (hypre_StructMatrix *) A,
+                                      (hypre_StructVector *) x,
+                                      0.0, matvec_y);
+         }
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Matvec times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         hypre_StructMatvecDestroy(matvec_data);
+         hypre_StructVectorDestroy(matvec_y);
+      }
+
       /*-----------------------------------------------------------
        * Solve the system using SMG
        *-----------------------------------------------------------*/
@@ -1403,6 +1497,7 @@ main( hypre_int argc,
          /*HYPRE_StructPFMGSetDxyz(solver, dxyz);*/
          HYPRE_StructPFMGSetPrintLevel(solver, 1);
          HYPRE_StructPFMGSetLogging(solver, 1);
+         HYPRE_StructPFMGSetCommStats(solver, comm_stats);
 
 #if defined(HYPRE_USE_CUDA) 
          //HYPRE_StructPFMGSetDeviceLevel(solver,device_level);
@@ -1439,6 +1534,10 @@ main( hypre_int argc,
             hypre_ClearTiming();
          }
    
+         if (comm_stats)
+         {
+            HYPRE_StructPFMGPrintCommStats(solver);
+         }
          HYPRE_StructPFMGGetNumIterations(solver, &num_iterations);
          HYPRE_StructPFMGGetFinalRelativeResidualNorm(solver, &final_res_norm);
          HYPRE_StructPFMGDestroy(solver);
@@ -1581,6 +1680,7 @@ main( hypre_int argc,
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
+            HYPRE_StructPFMGSetCommStats(precond, comm_stats);
 #if defined(HYPRE_USE_CUDA) 
             //HYPRE_StructPFMGSetDeviceLevel(precond,device_level);
 #endif
@@ -1655,6 +1755,10 @@ main( hypre_int argc,
          hypre_FinalizeTiming(time_index);
          hypre_ClearTiming();
 
+         if (comm_stats && (solver_id == 11 || solver_id == 13 || solver_id == 14))
+         {
+            HYPRE_StructPFMGPrintCommStats(precond);
+         }
          HYPRE_PCGGetNumIterations( (HYPRE_Solver)solver, &num_iterations );
          HYPRE_PCGGetFinalRelativeResidualNorm( (HYPRE_Solver)solver,
                                                 &final_res_norm );
@@ -140,6 +140,23 @@ HYPRE_Int HYPRE_ClearError(HYPRE_Int hypre_error_code);
 /*Checks whether the AP is on */
 HYPRE_Int HYPRE_AssumedPartitionCheck();
 
+/*--------------------------------------------------------------------------
+ * HYPRE profiling user functions
+ *--------------------------------------------------------------------------*/
+
+/* Start recording profiling regions; previously recorded data is discarded */
+HYPRE_Int HYPRE_ProfilingStart( void );
+
+/* Stop recording; regions that are still open are closed */
+HYPRE_Int HYPRE_ProfilingStop( void );
+
+/* Print the region tree of process 0 of comm */
+HYPRE_Int HYPRE_ProfilingPrint( MPI_Comm comm );
+
+/* Write the regions of each process of comm to <filename>.NNNNN.json, where
+   NNNNN is the rank with 5 digits, in the Chrome trace event format */
+HYPRE_Int HYPRE_ProfilingWrite( MPI_Comm comm, const char *filename );
+
 
 #ifdef __cplusplus
 }
@@ -146,8 +146,14 @@ extern "C" {
 #define MPI_ANY_TAG         hypre_MPI_ANY_TAG
 #define MPI_SOURCE          hypre_MPI_SOURCE
 #define MPI_TAG             hypre_MPI_TAG
+#define MPI_THREAD_SINGLE   hypre_MPI_THREAD_SINGLE
+#define MPI_THREAD_FUNNELED hypre_MPI_THREAD_FUNNELED
+#define MPI_THREAD_SERIALIZED hypre_MPI_THREAD_SERIALIZED
+#define MPI_THREAD_MULTIPLE hypre_MPI_THREAD_MULTIPLE
 
 #define MPI_Init            hypre_MPI_Init             
+#define MPI_Init_thread     hypre_MPI_Init_thread
+#define MPI_Query_thread    hypre_MPI_Query_thread
 #define MPI_Finalize        hypre_MPI_Finalize         
 #define MPI_Abort           hypre_MPI_Abort         
 #define MPI_Wtime           hypre_MPI_Wtime            
@@ -200,6 +206,8 @@ extern "C" {
 #define MPI_Type_free       hypre_MPI_Type_free        
 #define MPI_Op_free         hypre_MPI_Op_free        
 #define MPI_Op_create       hypre_MPI_Op_create
+#define MPI_Dist_graph_create_adjacent hypre_MPI_Dist_graph_create_adjacent
+#define MPI_Ineighbor_alltoallv hypre_MPI_Ineighbor_alltoallv
 #define MPI_User_function   hypre_MPI_User_function
 
 /*--------------------------------------------------------------------------
@@ -250,6 +258,11 @@ typedef HYPRE_Int  hypre_MPI_Aint;
 #define  hypre_MPI_ANY_SOURCE    1
 #define  hypre_MPI_ANY_TAG       1
 
+#define  hypre_MPI_THREAD_SINGLE     0
+#define  hypre_MPI_THREAD_FUNNELED   1
+#define  hypre_MPI_THREAD_SERIALIZED 2
+#define  hypre_MPI_THREAD_MULTIPLE   3
+
 #else
 
 /******************************************************************************
@@ -298,6 +311,11 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_TAG             MPI_TAG
 #define  hypre_MPI_LAND            MPI_LAND
 
+#define  hypre_MPI_THREAD_SINGLE     MPI_THREAD_SINGLE
+#define  hypre_MPI_THREAD_FUNNELED   MPI_THREAD_FUNNELED
+#define  hypre_MPI_THREAD_SERIALIZED MPI_THREAD_SERIALIZED
+#define  hypre_MPI_THREAD_MULTIPLE   MPI_THREAD_MULTIPLE
+
 #endif
 
 /******************************************************************************
@@ -310,6 +328,8 @@ typedef MPI_User_function    hypre_MPI_User_function;
 
 /* mpistubs.c */
 HYPRE_Int hypre_MPI_Init( hypre_int *argc , char ***argv );
+HYPRE_Int hypre_MPI_Init_thread( hypre_int *argc , char ***argv , HYPRE_Int required , HYPRE_Int *provided );
+HYPRE_Int hypre_MPI_Query_thread( HYPRE_Int *provided );
 HYPRE_Int hypre_MPI_Finalize( void );
 HYPRE_Int hypre_MPI_Abort( hypre_MPI_Comm comm , HYPRE_Int errorcode );
 HYPRE_Real hypre_MPI_Wtime( void );
@@ -362,6 +382,8 @@ HYPRE_Int hypre_MPI_Type_commit( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function , hypre_int commute , hypre_MPI_Op *op );
+HYPRE_Int hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm , HYPRE_Int indegree , HYPRE_Int *sources , HYPRE_Int outdegree , HYPRE_Int *destinations , HYPRE_Int reorder , hypre_MPI_Comm *newcomm );
+HYPRE_Int hypre_MPI_Ineighbor_alltoallv( void *sendbuf , hypre_int *sendcounts , hypre_int *sdispls , hypre_MPI_Datatype sendtype , void *recvbuf , hypre_int *recvcounts , hypre_int *rdispls , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 
 #ifdef __cplusplus
 }
@@ -1063,6 +1085,59 @@ void hypre_error_handler(const char *filename, HYPRE_Int line, HYPRE_Int ierr, c
 
 #endif /* CALIPER_INSTRUMENTATION_HEADER */
 
+/*BHEADER**********************************************************************
+ * Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+ * Produced at the Lawrence Livermore National Laboratory.
+ * This file is part of HYPRE.  See file COPYRIGHT for details.
+ *
+ * HYPRE is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License (as published by the Free
+ * Software Foundation) version 2.1 dated February 1999.
+ *
+ * $Revision$
+ ***********************************************************************EHEADER*/
+
+/******************************************************************************
+ *
+ * Header file for the hierarchical profiler
+ *
+ * Regions are opened and closed with HYPRE_PROFILE_BEGIN/END and nest.  A
+ * region is identified by its name, its level (-1 if it has none) and its
+ * parent region, so the same phase on different multigrid levels is kept
+ * apart.  HYPRE_PROFILE_COUNT charges flops, memory traffic and message
+ * bytes to the innermost open region.  Nothing is recorded unless profiling
+ * was started with HYPRE_ProfilingStart.
+ *
+ * Independently of the profiler, communication packages count their
+ * exchanges, messages, bytes and wait time while hypre_comm_stats_active
+ * is nonzero.  It is the number of solvers that collect statistics (see
+ * HYPRE_BoomerAMGSetCommStats); each releases its count when it is
+ * destroyed or when its statistics are switched off.
+ *
+ *****************************************************************************/
+
+#ifndef hypre_PROFILE_HEADER
+#define hypre_PROFILE_HEADER
+
+extern HYPRE_Int hypre_profile_active;
+extern HYPRE_Int hypre_comm_stats_active;
+
+#define HYPRE_PROFILE_BEGIN( name, level ) \
+do { if (hypre_profile_active) hypre_ProfileBegin(name, level); } while (0)
+
+#define HYPRE_PROFILE_END( name ) \
+do { if (hypre_profile_active) hypre_ProfileEnd(name); } while (0)
+
+#define HYPRE_PROFILE_COUNT( flops, bytes, msg_bytes ) \
+do { if (hypre_profile_active) hypre_ProfileCount(flops, bytes, msg_bytes); } while (0)
+
+/* hypre_profile.c */
+HYPRE_Int hypre_ProfileBegin( const char *name, HYPRE_Int level );
+HYPRE_Int hypre_ProfileEnd( const char *name );
+HYPRE_Int hypre_ProfileCount( HYPRE_Real flops, HYPRE_Real bytes, HYPRE_Real msg_bytes );
+
+#endif /* hypre_PROFILE_HEADER */
+
 /*BHEADER**********************************************************************
  * Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
  * Produced at the Lawrence Livermore National Laboratory.
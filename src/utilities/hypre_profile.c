@@ -0,0 +1,523 @@
+/*BHEADER**********************************************************************
+ * Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+ * Produced at the Lawrence Livermore National Laboratory.
+ * This file is part of HYPRE.  See file COPYRIGHT for details.
+ *
+ * HYPRE is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License (as published by the Free
+ * Software Foundation) version 2.1 dated February 1999.
+ *
+ * $Revision$
+ ***********************************************************************EHEADER*/
+
+/******************************************************************************
+ *
+ * Hierarchical profiler.
+ *
+ * Every region instance is accumulated into a node of the region tree,
+ * keyed by (parent node, name, level), and is also recorded as an event
+ * for the trace file.  The counters of a region include those of the
+ * regions nested in it.  Only the master thread records regions.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+#define hypre_PROFILE_MAX_DEPTH   64
+#define hypre_PROFILE_MAX_EVENTS  1048576
+
+typedef struct
+{
+   const char  *name;
+   HYPRE_Int    level;
+   HYPRE_Int    parent;
+   HYPRE_Int    child;       /* first child */
+   HYPRE_Int    sibling;     /* next sibling */
+   HYPRE_Int    depth;
+   HYPRE_Int    num_calls;
+   HYPRE_Real   time;
+   HYPRE_Real   flops;
+   HYPRE_Real   bytes;
+   HYPRE_Real   msg_bytes;
+
+} hypre_ProfileNode;
+
+typedef struct
+{
+   HYPRE_Int    node;
+   HYPRE_Real   start;
+   HYPRE_Real   duration;
+   HYPRE_Real   flops;
+   HYPRE_Real   bytes;
+   HYPRE_Real   msg_bytes;
+
+} hypre_ProfileEvent;
+
+typedef struct
+{
+   HYPRE_Int    node;
+   HYPRE_Int    event;       /* -1 if the event was dropped */
+   HYPRE_Real   start;
+   HYPRE_Real   flops;
+   HYPRE_Real   bytes;
+   HYPRE_Real   msg_bytes;
+
+} hypre_ProfileFrame;
+
+HYPRE_Int hypre_profile_active = 0;
+HYPRE_Int hypre_comm_stats_active = 0;
+
+static hypre_ProfileNode  *hypre_profile_nodes      = NULL;
+static HYPRE_Int           hypre_profile_num_nodes  = 0;
+static HYPRE_Int           hypre_profile_node_size  = 0;
+static hypre_ProfileEvent *hypre_profile_events     = NULL;
+static HYPRE_Int           hypre_profile_num_events = 0;
+static HYPRE_Int           hypre_profile_event_size = 0;
+static HYPRE_Int           hypre_profile_dropped    = 0;
+static hypre_ProfileFrame  hypre_profile_stack[hypre_PROFILE_MAX_DEPTH];
+static HYPRE_Int           hypre_profile_depth      = 0;
+static HYPRE_Int           hypre_profile_overflow   = 0;
+static HYPRE_Real          hypre_profile_t0         = 0.0;
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileTime
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+hypre_ProfileTime( void )
+{
+#ifndef HYPRE_SEQUENTIAL
+   return hypre_MPI_Wtime();
+#elif defined(HYPRE_USING_OPENMP)
+   return omp_get_wtime();
+#else
+   return time_getWallclockSeconds();
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileOnMaster
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ProfileOnMaster( void )
+{
+#ifdef HYPRE_USING_OPENMP
+   return !omp_in_parallel();
+#else
+   return 1;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileFindNode
+ *
+ * Return the child of parent (-1 for the root) with the given name and
+ * level, and create it if it does not exist yet.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ProfileFindNode( HYPRE_Int   parent,
+                       const char *name,
+                       HYPRE_Int   level )
+{
+   hypre_ProfileNode *node;
+   HYPRE_Int          i, last = -1;
+
+   i = (parent < 0) ? (hypre_profile_num_nodes ? 0 : -1) :
+                      hypre_profile_nodes[parent].child;
+   while (i > -1)
+   {
+      node = &hypre_profile_nodes[i];
+      if (node -> level == level &&
+          (node -> name == name || strcmp(node -> name, name) == 0))
+      {
+         return i;
+      }
+      last = i;
+      i = node -> sibling;
+   }
+
+   if (hypre_profile_num_nodes == hypre_profile_node_size)
+   {
+      hypre_profile_node_size = 2*hypre_profile_node_size + 64;
+      hypre_profile_nodes = hypre_TReAlloc(hypre_profile_nodes, hypre_ProfileNode,
+                                           hypre_profile_node_size, HYPRE_MEMORY_HOST);
+   }
+   i = hypre_profile_num_nodes++;
+   node = &hypre_profile_nodes[i];
+   node -> name      = name;
+   node -> level     = level;
+   node -> parent    = parent;
+   node -> child     = -1;
+   node -> sibling   = -1;
+   node -> depth     = (parent < 0) ? 0 : hypre_profile_nodes[parent].depth + 1;
+   node -> num_calls = 0;
+   node -> time      = 0.0;
+   node -> flops     = 0.0;
+   node -> bytes     = 0.0;
+   node -> msg_bytes = 0.0;
+
+   if (last > -1)
+   {
+      hypre_profile_nodes[last].sibling = i;
+   }
+   else if (parent > -1)
+   {
+      hypre_profile_nodes[parent].child = i;
+   }
+
+   return i;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfilePop
+ *
+ * Close the innermost open region at time t.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ProfilePop( HYPRE_Real t )
+{
+   hypre_ProfileFrame *frame = &hypre_profile_stack[--hypre_profile_depth];
+   hypre_ProfileNode  *node  = &hypre_profile_nodes[frame -> node];
+
+   node -> num_calls ++;
+   node -> time      += t - (frame -> start);
+   node -> flops     += frame -> flops;
+   node -> bytes     += frame -> bytes;
+   node -> msg_bytes += frame -> msg_bytes;
+
+   if (frame -> event > -1)
+   {
+      hypre_ProfileEvent *event = &hypre_profile_events[frame -> event];
+
+      event -> duration  = t - (frame -> start);
+      event -> flops     = frame -> flops;
+      event -> bytes     = frame -> bytes;
+      event -> msg_bytes = frame -> msg_bytes;
+   }
+
+   /* the counters of a region are included in those of its parent */
+   if (hypre_profile_depth > 0)
+   {
+      hypre_ProfileFrame *parent = &hypre_profile_stack[hypre_profile_depth-1];
+
+      parent -> flops     += frame -> flops;
+      parent -> bytes     += frame -> bytes;
+      parent -> msg_bytes += frame -> msg_bytes;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileBegin
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfileBegin( const char *name,
+                    HYPRE_Int   level )
+{
+   hypre_ProfileFrame *frame;
+   HYPRE_Int           parent;
+
+   if (!hypre_profile_active || !hypre_ProfileOnMaster())
+   {
+      return hypre_error_flag;
+   }
+   if (hypre_profile_depth == hypre_PROFILE_MAX_DEPTH)
+   {
+      hypre_profile_overflow ++;
+      return hypre_error_flag;
+   }
+
+   parent = hypre_profile_depth ? hypre_profile_stack[hypre_profile_depth-1].node : -1;
+
+   frame = &hypre_profile_stack[hypre_profile_depth++];
+   frame -> node      = hypre_ProfileFindNode(parent, name, level);
+   frame -> flops     = 0.0;
+   frame -> bytes     = 0.0;
+   frame -> msg_bytes = 0.0;
+   frame -> event     = -1;
+
+   if (hypre_profile_num_events < hypre_PROFILE_MAX_EVENTS)
+   {
+      if (hypre_profile_num_events == hypre_profile_event_size)
+      {
+         hypre_profile_event_size = hypre_min(2*hypre_profile_event_size + 1024,
+                                              hypre_PROFILE_MAX_EVENTS);
+         hypre_profile_events = hypre_TReAlloc(hypre_profile_events, hypre_ProfileEvent,
+                                               hypre_profile_event_size, HYPRE_MEMORY_HOST);
+      }
+      frame -> event = hypre_profile_num_events++;
+      hypre_profile_events[frame -> event].node = frame -> node;
+   }
+   else
+   {
+      hypre_profile_dropped ++;
+   }
+
+   frame -> start = hypre_ProfileTime();
+   if (frame -> event > -1)
+   {
+      hypre_profile_events[frame -> event].start = frame -> start;
+      hypre_profile_events[frame -> event].duration = 0.0;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileEnd
+ *
+ * Close the innermost open region with the given name.  Regions opened
+ * inside it and not closed (e.g. because of an early return) are closed
+ * with it.  Nothing is done if no such region is open.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfileEnd( const char *name )
+{
+   HYPRE_Real  t;
+   HYPRE_Int   i;
+
+   if (!hypre_profile_active || !hypre_ProfileOnMaster())
+   {
+      return hypre_error_flag;
+   }
+
+   t = hypre_ProfileTime();
+
+   if (hypre_profile_overflow)
+   {
+      hypre_profile_overflow --;
+      return hypre_error_flag;
+   }
+
+   for (i = hypre_profile_depth-1; i > -1; i--)
+   {
+      const char *open_name = hypre_profile_nodes[hypre_profile_stack[i].node].name;
+
+      if (open_name == name || strcmp(open_name, name) == 0)
+      {
+         break;
+      }
+   }
+   while (i > -1 && hypre_profile_depth > i)
+   {
+      hypre_ProfilePop(t);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileCount
+ *
+ * Charge flops, bytes moved to and from memory, and bytes sent in messages
+ * to the innermost open region.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfileCount( HYPRE_Real flops,
+                    HYPRE_Real bytes,
+                    HYPRE_Real msg_bytes )
+{
+   hypre_ProfileFrame *frame;
+
+   if (!hypre_profile_active || !hypre_ProfileOnMaster() || hypre_profile_depth == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   frame = &hypre_profile_stack[hypre_profile_depth-1];
+   frame -> flops     += flops;
+   frame -> bytes     += bytes;
+   frame -> msg_bytes += msg_bytes;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfilingStart
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfilingStart( void )
+{
+   hypre_TFree(hypre_profile_nodes, HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_profile_events, HYPRE_MEMORY_HOST);
+   hypre_profile_num_nodes  = 0;
+   hypre_profile_node_size  = 0;
+   hypre_profile_num_events = 0;
+   hypre_profile_event_size = 0;
+   hypre_profile_dropped    = 0;
+   hypre_profile_depth      = 0;
+   hypre_profile_overflow   = 0;
+
+   hypre_profile_t0 = hypre_ProfileTime();
+   hypre_profile_active = 1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfilingStop
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfilingStop( void )
+{
+   HYPRE_Real  t = hypre_ProfileTime();
+
+   while (hypre_profile_depth > 0)
+   {
+      hypre_ProfilePop(t);
+   }
+   hypre_profile_overflow = 0;
+   hypre_profile_active = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfilingPrint
+ *
+ * Print the region tree of process 0 of comm with the inclusive time of
+ * each region, its share of the time of the parent region, and the rates
+ * derived from its counters.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfilingPrint( MPI_Comm comm )
+{
+   hypre_ProfileNode *node;
+   HYPRE_Real         parent_time, percent;
+   HYPRE_Int          my_id, i, next, indent;
+   char               label[80];
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   if (my_id != 0 || hypre_profile_num_nodes == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_printf("=============================================\n");
+   hypre_printf("Profile (process 0):\n");
+   hypre_printf("=============================================\n");
+   hypre_printf("%-36s %8s %11s %8s %10s %10s %10s\n", "region", "calls",
+                "time (s)", "% parent", "MFLOPS", "MB/s", "msg MB");
+
+   /* depth-first walk of the tree */
+   i = 0;
+   while (i > -1)
+   {
+      node = &hypre_profile_nodes[i];
+
+      indent = hypre_min(2*(node -> depth), 16);
+      memset(label, ' ', indent);
+      if (node -> level > -1)
+      {
+         hypre_sprintf(label + indent, "%.40s L%d", node -> name, node -> level);
+      }
+      else
+      {
+         hypre_sprintf(label + indent, "%.40s", node -> name);
+      }
+      parent_time = (node -> parent > -1) ? hypre_profile_nodes[node -> parent].time : 0.0;
+      percent = (parent_time > 0.0) ? 100.0 * (node -> time) / parent_time : 100.0;
+
+      hypre_printf("%-36s %8d %11.4e %8.2f %10.2f %10.2f %10.3f\n", label,
+                   node -> num_calls, node -> time, percent,
+                   (node -> time > 0.0) ? (node -> flops) / (node -> time) / 1.0E6 : 0.0,
+                   (node -> time > 0.0) ? (node -> bytes) / (node -> time) / 1.0E6 : 0.0,
+                   (node -> msg_bytes) / 1.0E6);
+
+      if (node -> child > -1)
+      {
+         i = node -> child;
+      }
+      else
+      {
+         next = i;
+         while (next > -1 && hypre_profile_nodes[next].sibling < 0)
+         {
+            next = hypre_profile_nodes[next].parent;
+         }
+         i = (next > -1) ? hypre_profile_nodes[next].sibling : -1;
+      }
+   }
+   if (hypre_profile_dropped)
+   {
+      hypre_printf("(%d trace events dropped)\n", hypre_profile_dropped);
+   }
+   hypre_printf("\n");
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfilingWrite
+ *
+ * Write the events of each process of comm to <filename>.NNNNN.json, where
+ * NNNNN is the rank with 5 digits (as for the matrix print routines), in
+ * the Chrome trace event format (chrome://tracing, Perfetto), with the
+ * region tree appended under "hypreRegions".  Times are in microseconds.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfilingWrite( MPI_Comm    comm,
+                      const char *filename )
+{
+   hypre_ProfileEvent *event;
+   hypre_ProfileNode  *node;
+   FILE               *fp;
+   char                new_filename[1024];
+   HYPRE_Int           my_id, i;
+
+   if (!filename)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_sprintf(new_filename, "%.1000s.%05d.json", filename, my_id);
+   if ((fp = fopen(new_filename, "w")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      return hypre_error_flag;
+   }
+
+   hypre_fprintf(fp, "{\"traceEvents\": [\n");
+   for (i = 0; i < hypre_profile_num_events; i++)
+   {
+      event = &hypre_profile_events[i];
+      node  = &hypre_profile_nodes[event -> node];
+      hypre_fprintf(fp, "{\"name\": \"%s\", \"cat\": \"hypre\", \"ph\": \"X\", "
+                    "\"ts\": %.3f, \"dur\": %.3f, \"pid\": %d, \"tid\": 0, "
+                    "\"args\": {\"level\": %d, \"flops\": %.0f, \"bytes\": %.0f, "
+                    "\"msg_bytes\": %.0f}}%s\n",
+                    node -> name, 1.0E6 * (event -> start - hypre_profile_t0),
+                    1.0E6 * (event -> duration), my_id, node -> level,
+                    event -> flops, event -> bytes, event -> msg_bytes,
+                    (i < hypre_profile_num_events-1) ? "," : "");
+   }
+   hypre_fprintf(fp, "],\n\"displayTimeUnit\": \"ms\",\n");
+   hypre_fprintf(fp, "\"droppedEvents\": %d,\n", hypre_profile_dropped);
+   hypre_fprintf(fp, "\"hypreRegions\": [\n");
+   for (i = 0; i < hypre_profile_num_nodes; i++)
+   {
+      node = &hypre_profile_nodes[i];
+      hypre_fprintf(fp, "{\"id\": %d, \"parent\": %d, \"name\": \"%s\", \"level\": %d, "
+                    "\"calls\": %d, \"time\": %.6e, \"flops\": %.0f, \"bytes\": %.0f, "
+                    "\"msg_bytes\": %.0f}%s\n",
+                    i, node -> parent, node -> name, node -> level, node -> num_calls,
+                    node -> time, node -> flops, node -> bytes, node -> msg_bytes,
+                    (i < hypre_profile_num_nodes-1) ? "," : "");
+   }
+   hypre_fprintf(fp, "]}\n");
+
+   fclose(fp);
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,53 @@
+/*BHEADER**********************************************************************
+ * Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+ * Produced at the Lawrence Livermore National Laboratory.
+ * This file is part of HYPRE.  See file COPYRIGHT for details.
+ *
+ * HYPRE is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License (as published by the Free
+ * Software Foundation) version 2.1 dated February 1999.
+ *
+ * $Revision$
+ ***********************************************************************EHEADER*/
+
+/******************************************************************************
+ *
+ * Header file for the hierarchical profiler
+ *
+ * Regions are opened and closed with HYPRE_PROFILE_BEGIN/END and nest.  A
+ * region is identified by its name, its level (-1 if it has none) and its
+ * parent region, so the same phase on different multigrid levels is kept
+ * apart.  HYPRE_PROFILE_COUNT charges flops, memory traffic and message
+ * bytes to the innermost open region.  Nothing is recorded unless profiling
+ * was started with HYPRE_ProfilingStart.
+ *
+ * Independently of the profiler, communication packages count their
+ * exchanges, messages, bytes and wait time while hypre_comm_stats_active
+ * is nonzero.  It is the number of solvers that collect statistics (see
+ * HYPRE_BoomerAMGSetCommStats); each releases its count when it is
+ * destroyed or when its statistics are switched off.
+ *
+ *****************************************************************************/
+
+#ifndef hypre_PROFILE_HEADER
+#define hypre_PROFILE_HEADER
+
+extern HYPRE_Int hypre_profile_active;
+extern HYPRE_Int hypre_comm_stats_active;
+
+#define HYPRE_PROFILE_BEGIN( name, level ) \
+do { if (hypre_profile_active) hypre_ProfileBegin(name, level); } while (0)
+
+#define HYPRE_PROFILE_END( name ) \
+do { if (hypre_profile_active) hypre_ProfileEnd(name); } while (0)
+
+#define HYPRE_PROFILE_COUNT( flops, bytes, msg_bytes ) \
+do { if (hypre_profile_active) hypre_ProfileCount(flops, bytes, msg_bytes); } while (0)
+
+/* hypre_profile.c */
+HYPRE_Int hypre_ProfileBegin( const char *name, HYPRE_Int level );
+HYPRE_Int hypre_ProfileEnd( const char *name );
+HYPRE_Int hypre_ProfileCount( HYPRE_Real flops, HYPRE_Real bytes, HYPRE_Real msg_bytes );
+
+#endif /* hypre_PROFILE_HEADER */
+
@@ -48,6 +48,23 @@ hypre_MPI_Init( hypre_int   *argc,
    return(0);
 }
 
+HYPRE_Int
+hypre_MPI_Init_thread( hypre_int   *argc,
+                       char      ***argv,
+                       HYPRE_Int    required,
+                       HYPRE_Int   *provided )
+{
+   *provided = hypre_MPI_THREAD_MULTIPLE;
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Query_thread( HYPRE_Int *provided )
+{
+   *provided = hypre_MPI_THREAD_MULTIPLE;
+   return(0);
+}
+
 HYPRE_Int
 hypre_MPI_Finalize( )
 {
@@ -651,6 +668,34 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return(0);
 }
 
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm  comm,
+                                      HYPRE_Int       indegree,
+                                      HYPRE_Int      *sources,
+                                      HYPRE_Int       outdegree,
+                                      HYPRE_Int      *destinations,
+                                      HYPRE_Int       reorder,
+                                      hypre_MPI_Comm *newcomm )
+{
+   *newcomm = comm;
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void               *sendbuf,
+                               hypre_int          *sendcounts,
+                               hypre_int          *sdispls,
+                               hypre_MPI_Datatype  sendtype,
+                               void               *recvbuf,
+                               hypre_int          *recvcounts,
+                               hypre_int          *rdispls,
+                               hypre_MPI_Datatype  recvtype,
+                               hypre_MPI_Comm      comm,
+                               hypre_MPI_Request  *request )
+{
+   return(0);
+}
+
 HYPRE_Int
 hypre_MPI_Op_free( hypre_MPI_Op *op )
 {
@@ -674,6 +719,36 @@ hypre_MPI_Init( hypre_int   *argc,
    return (HYPRE_Int) MPI_Init(argc, argv);
 }
 
+HYPRE_Int
+hypre_MPI_Init_thread( hypre_int   *argc,
+                       char      ***argv,
+                       HYPRE_Int    required,
+                       HYPRE_Int   *provided )
+{
+   hypre_int mpi_provided;
+   HYPRE_Int ierr;
+
+#if defined(HYPRE_USE_OMP45)
+   hypre__offload_device_num = omp_get_initial_device();
+   hypre__offload_host_num   = omp_get_initial_device();
+#endif
+
+   ierr = (HYPRE_Int) MPI_Init_thread(argc, argv, (hypre_int)required,
+                                      &mpi_provided);
+   *provided = (HYPRE_Int) mpi_provided;
+   return ierr;
+}
+
+HYPRE_Int
+hypre_MPI_Query_thread( HYPRE_Int *provided )
+{
+   hypre_int mpi_provided;
+   HYPRE_Int ierr;
+   ierr = (HYPRE_Int) MPI_Query_thread(&mpi_provided);
+   *provided = (HYPRE_Int) mpi_provided;
+   return ierr;
+}
+
 HYPRE_Int
 hypre_MPI_Finalize( )
 {
@@ -1312,4 +1387,77 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return (HYPRE_Int) MPI_Op_create(function, commute, op);
 }
 
+/* neighborhood collectives require MPI-3 */
+
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm  comm,
+                                      HYPRE_Int       indegree,
+                                      HYPRE_Int      *sources,
+                                      HYPRE_Int       outdegree,
+                                      HYPRE_Int      *destinations,
+                                      HYPRE_Int       reorder,
+                                      hypre_MPI_Comm *newcomm )
+{
+#if MPI_VERSION > 2
+   hypre_int *mpi_sources, *mpi_destinations;
+   HYPRE_Int  i;
+   HYPRE_Int  ierr;
+
+   mpi_sources = hypre_TAlloc(hypre_int,  indegree, HYPRE_MEMORY_HOST);
+   mpi_destinations = hypre_TAlloc(hypre_int,  outdegree, HYPRE_MEMORY_HOST);
+   for (i = 0; i < indegree; i++)
+   {
+      mpi_sources[i] = (hypre_int) sources[i];
+   }
+   for (i = 0; i < outdegree; i++)
+   {
+      mpi_destinations[i] = (hypre_int) destinations[i];
+   }
+   /* GCC 11+ takes the MPI_UNWEIGHTED sentinel address for an empty array
+      (-Wstringop-overread); the weights are never read for it */
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overread"
+#endif
+   ierr = (HYPRE_Int) MPI_Dist_graph_create_adjacent(comm,
+                                                     (hypre_int)indegree, mpi_sources,
+                                                     MPI_UNWEIGHTED,
+                                                     (hypre_int)outdegree, mpi_destinations,
+                                                     MPI_UNWEIGHTED, MPI_INFO_NULL,
+                                                     (hypre_int)reorder, newcomm);
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#pragma GCC diagnostic pop
+#endif
+   hypre_TFree(mpi_sources, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_destinations, HYPRE_MEMORY_HOST);
+
+   return ierr;
+#else
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "MPI_Dist_graph_create_adjacent requires MPI-3\n");
+   return hypre_error_flag;
+#endif
+}
+
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void               *sendbuf,
+                               hypre_int          *sendcounts,
+                               hypre_int          *sdispls,
+                               hypre_MPI_Datatype  sendtype,
+                               void               *recvbuf,
+                               hypre_int          *recvcounts,
+                               hypre_int          *rdispls,
+                               hypre_MPI_Datatype  recvtype,
+                               hypre_MPI_Comm      comm,
+                               hypre_MPI_Request  *request )
+{
+#if MPI_VERSION > 2
+   return (HYPRE_Int) MPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype,
+                                              recvbuf, recvcounts, rdispls, recvtype,
+                                              comm, request);
+#else
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "MPI_Ineighbor_alltoallv requires MPI-3\n");
+   return hypre_error_flag;
+#endif
+}
+
 #endif
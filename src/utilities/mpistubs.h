@@ -74,8 +74,14 @@ extern "C" {
 #define MPI_ANY_TAG         hypre_MPI_ANY_TAG
 #define MPI_SOURCE          hypre_MPI_SOURCE
 #define MPI_TAG             hypre_MPI_TAG
+#define MPI_THREAD_SINGLE   hypre_MPI_THREAD_SINGLE
+#define MPI_THREAD_FUNNELED hypre_MPI_THREAD_FUNNELED
+#define MPI_THREAD_SERIALIZED hypre_MPI_THREAD_SERIALIZED
+#define MPI_THREAD_MULTIPLE hypre_MPI_THREAD_MULTIPLE
 
 #define MPI_Init            hypre_MPI_Init             
+#define MPI_Init_thread     hypre_MPI_Init_thread
+#define MPI_Query_thread    hypre_MPI_Query_thread
 #define MPI_Finalize        hypre_MPI_Finalize         
 #define MPI_Abort           hypre_MPI_Abort         
 #define MPI_Wtime           hypre_MPI_Wtime            
@@ -128,6 +134,8 @@ extern "C" {
 #define MPI_Type_free       hypre_MPI_Type_free        
 #define MPI_Op_free         hypre_MPI_Op_free        
 #define MPI_Op_create       hypre_MPI_Op_create
+#define MPI_Dist_graph_create_adjacent hypre_MPI_Dist_graph_create_adjacent
+#define MPI_Ineighbor_alltoallv hypre_MPI_Ineighbor_alltoallv
 #define MPI_User_function   hypre_MPI_User_function
 
 /*--------------------------------------------------------------------------
@@ -178,6 +186,11 @@ typedef HYPRE_Int  hypre_MPI_Aint;
 #define  hypre_MPI_ANY_SOURCE    1
 #define  hypre_MPI_ANY_TAG       1
 
+#define  hypre_MPI_THREAD_SINGLE     0
+#define  hypre_MPI_THREAD_FUNNELED   1
+#define  hypre_MPI_THREAD_SERIALIZED 2
+#define  hypre_MPI_THREAD_MULTIPLE   3
+
 #else
 
 /******************************************************************************
@@ -226,6 +239,11 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_TAG             MPI_TAG
 #define  hypre_MPI_LAND            MPI_LAND
 
+#define  hypre_MPI_THREAD_SINGLE     MPI_THREAD_SINGLE
+#define  hypre_MPI_THREAD_FUNNELED   MPI_THREAD_FUNNELED
+#define  hypre_MPI_THREAD_SERIALIZED MPI_THREAD_SERIALIZED
+#define  hypre_MPI_THREAD_MULTIPLE   MPI_THREAD_MULTIPLE
+
 #endif
 
 /******************************************************************************
@@ -238,6 +256,8 @@ typedef MPI_User_function    hypre_MPI_User_function;
 
 /* mpistubs.c */
 HYPRE_Int hypre_MPI_Init( hypre_int *argc , char ***argv );
+HYPRE_Int hypre_MPI_Init_thread( hypre_int *argc , char ***argv , HYPRE_Int required , HYPRE_Int *provided );
+HYPRE_Int hypre_MPI_Query_thread( HYPRE_Int *provided );
 HYPRE_Int hypre_MPI_Finalize( void );
 HYPRE_Int hypre_MPI_Abort( hypre_MPI_Comm comm , HYPRE_Int errorcode );
 HYPRE_Real hypre_MPI_Wtime( void );
@@ -290,6 +310,8 @@ HYPRE_Int hypre_MPI_Type_commit( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function , hypre_int commute , hypre_MPI_Op *op );
+HYPRE_Int hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm , HYPRE_Int indegree , HYPRE_Int *sources , HYPRE_Int outdegree , HYPRE_Int *destinations , HYPRE_Int reorder , hypre_MPI_Comm *newcomm );
+HYPRE_Int hypre_MPI_Ineighbor_alltoallv( void *sendbuf , hypre_int *sendcounts , hypre_int *sdispls , hypre_MPI_Datatype sendtype , void *recvbuf , hypre_int *recvcounts , hypre_int *rdispls , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 
 #ifdef __cplusplus
 }